@@ -230,3 +230,19 @@ DEFINE_INTERFACE_DISPATCHER(_aes_gcm_dec_256_update_nt)
 
         return PROVIDER_BASIC(_aes_gcm_dec_256_update_nt);
 }
+
+DEFINE_INTERFACE_DISPATCHER(_ghash)
+{
+        if (is_crypto_available())
+                return PROVIDER_INFO(aes_gcm_ghash_aes);
+
+        return PROVIDER_BASIC(_ghash);
+}
+
+DEFINE_INTERFACE_DISPATCHER(_ghash_ctx)
+{
+        if (is_crypto_available())
+                return PROVIDER_INFO(aes_gcm_ghash_ctx_aes);
+
+        return PROVIDER_BASIC(_ghash_ctx);
+}
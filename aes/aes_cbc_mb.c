@@ -0,0 +1,135 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdlib.h>
+#include "isal_crypto_api.h"
+#include "aes_cbc_mb.h"
+#include "aes_cbc_mb_internal.h"
+
+int
+isal_aes_cbc_enc_ctx_mgr_init(ISAL_AES_CBC_CTX_MGR *mgr, const isal_cbc_key_size key_size)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (key_size != ISAL_CBC_128_BITS && key_size != ISAL_CBC_192_BITS &&
+            key_size != ISAL_CBC_256_BITS)
+                return ISAL_CRYPTO_ERR_KEY_LEN;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        _aes_cbc_enc_ctx_mgr_init(mgr, key_size);
+
+        return 0;
+}
+
+int
+isal_aes_cbc_enc_ctx_init(ISAL_AES_CBC_CTX *ctx, const void *keys, const void *iv)
+{
+        unsigned int i;
+
+#ifdef SAFE_PARAM
+        if (ctx == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (keys == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+        if (iv == NULL)
+                return ISAL_CRYPTO_ERR_NULL_IV;
+#endif
+
+        ctx->job.keys = (const uint8_t *) keys;
+        for (i = 0; i < ISAL_CBC_IV_DATA_LEN; i++)
+                ctx->job.iv[i] = ((const uint8_t *) iv)[i];
+        ctx->job.len = 0;
+        ctx->job.status = ISAL_STS_COMPLETED;
+        ctx->status = ISAL_HASH_CTX_STS_COMPLETE;
+        ctx->error = ISAL_HASH_CTX_ERROR_NONE;
+
+        return 0;
+}
+
+int
+isal_aes_cbc_enc_ctx_mgr_submit(ISAL_AES_CBC_CTX_MGR *mgr, ISAL_AES_CBC_CTX *ctx_in,
+                                ISAL_AES_CBC_CTX **ctx_out, const void *in, void *out,
+                                const uint64_t len_bytes)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_in == NULL || ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (in == NULL && len_bytes != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        if (out == NULL && len_bytes != 0)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+        if ((len_bytes & 0xf) != 0)
+                return ISAL_CRYPTO_ERR_CIPH_LEN;
+        if (ctx_in->job.keys == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        *ctx_out = _aes_cbc_enc_ctx_mgr_submit(mgr, ctx_in, in, out, len_bytes);
+
+#ifdef SAFE_PARAM
+        if (*ctx_out != NULL && (*ctx_out)->error != ISAL_HASH_CTX_ERROR_NONE) {
+                if ((*ctx_out)->error == ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING)
+                        return ISAL_CRYPTO_ERR_ALREADY_PROCESSING;
+        }
+#endif
+        return 0;
+}
+
+int
+isal_aes_cbc_enc_ctx_mgr_flush(ISAL_AES_CBC_CTX_MGR *mgr, ISAL_AES_CBC_CTX **ctx_out)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        *ctx_out = _aes_cbc_enc_ctx_mgr_flush(mgr);
+
+        return 0;
+}
@@ -0,0 +1,233 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "isal_crypto_api.h"
+#include "aes_ctr.h"
+#include "aes_ctr_internal.h"
+#include "endian_helper.h"
+
+typedef void (*aes_ctr_func)(const uint8_t *, const uint8_t *, const uint8_t *, uint8_t *,
+                             uint64_t);
+
+/*
+ * Process whole blocks and advance the 128-bit big-endian counter. The kernels
+ * only increment the low 64 bits of the counter, so the data is split where
+ * they would wrap and the carry is propagated here.
+ */
+static void
+aes_ctr_blocks(aes_ctr_func ctr_func, const uint8_t *keys, uint8_t *counter, const uint8_t *in,
+               uint8_t *out, uint64_t num_blocks)
+{
+        while (num_blocks > 0) {
+                uint64_t hi, lo, n = num_blocks;
+
+                memcpy(&hi, counter, sizeof(hi));
+                memcpy(&lo, counter + 8, sizeof(lo));
+                hi = to_be64(hi);
+                lo = to_be64(lo);
+
+                if (lo != 0 && n > 0 - lo)
+                        n = 0 - lo;
+
+                ctr_func(in, counter, keys, out, n);
+
+                lo += n;
+                if (lo == 0)
+                        hi++;
+                hi = to_be64(hi);
+                lo = to_be64(lo);
+                memcpy(counter, &hi, sizeof(hi));
+                memcpy(counter + 8, &lo, sizeof(lo));
+
+                in += n * ISAL_AES_CTR_BLOCK_LEN;
+                out += n * ISAL_AES_CTR_BLOCK_LEN;
+                num_blocks -= n;
+        }
+}
+
+static void
+aes_ctr_update(aes_ctr_func ctr_func, const uint8_t *keys,
+               struct isal_aes_ctr_context_data *context_data, uint8_t *out, const uint8_t *in,
+               uint64_t len)
+{
+        uint64_t num_blocks, i;
+
+        context_data->in_length += len;
+
+        // Use up keystream left over from the previous update
+        while (context_data->partial_block_length != 0 && len > 0) {
+                *out++ = *in++ ^
+                         context_data->partial_block_enc_key[context_data->partial_block_length];
+                len--;
+                if (++context_data->partial_block_length == ISAL_AES_CTR_BLOCK_LEN)
+                        context_data->partial_block_length = 0;
+        }
+
+        num_blocks = len / ISAL_AES_CTR_BLOCK_LEN;
+        aes_ctr_blocks(ctr_func, keys, context_data->current_counter, in, out, num_blocks);
+        in += num_blocks * ISAL_AES_CTR_BLOCK_LEN;
+        out += num_blocks * ISAL_AES_CTR_BLOCK_LEN;
+        len -= num_blocks * ISAL_AES_CTR_BLOCK_LEN;
+
+        // Generate a keystream block for the tail, keeping the unused bytes
+        if (len > 0) {
+                memset(context_data->partial_block_enc_key, 0, ISAL_AES_CTR_BLOCK_LEN);
+                aes_ctr_blocks(ctr_func, keys, context_data->current_counter,
+                               context_data->partial_block_enc_key,
+                               context_data->partial_block_enc_key, 1);
+                for (i = 0; i < len; i++)
+                        out[i] = in[i] ^ context_data->partial_block_enc_key[i];
+                context_data->partial_block_length = len;
+        }
+}
+
+int
+isal_aes_ctr_init(struct isal_aes_ctr_context_data *context_data, const void *iv)
+{
+#ifdef SAFE_PARAM
+        if (context_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+
+        if (iv == NULL)
+                return ISAL_CRYPTO_ERR_NULL_IV;
+#endif
+
+        memcpy(context_data->current_counter, iv, ISAL_AES_CTR_IV_LEN);
+        memset(context_data->partial_block_enc_key, 0, ISAL_AES_CTR_BLOCK_LEN);
+        context_data->partial_block_length = 0;
+        context_data->in_length = 0;
+
+        return 0;
+}
+
+int
+isal_aes_ctr_finalize(struct isal_aes_ctr_context_data *context_data)
+{
+#ifdef SAFE_PARAM
+        if (context_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+
+        memset(context_data, 0, sizeof(*context_data));
+
+        return 0;
+}
+
+static int
+aes_ctr_update_check(aes_ctr_func ctr_func, const void *keys,
+                     struct isal_aes_ctr_context_data *context_data, void *out, const void *in,
+                     const uint64_t len_bytes)
+{
+#ifdef SAFE_PARAM
+        if (keys == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+
+        if (context_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+
+        if (in == NULL && len_bytes != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+
+        if (out == NULL && len_bytes != 0)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        aes_ctr_update(ctr_func, (const uint8_t *) keys, context_data, (uint8_t *) out,
+                       (const uint8_t *) in, len_bytes);
+
+        return 0;
+}
+
+static int
+aes_ctr(aes_ctr_func ctr_func, const void *in, const void *iv, const void *keys, void *out,
+        const uint64_t len_bytes)
+{
+        struct isal_aes_ctr_context_data context_data;
+        int ret;
+
+#ifdef SAFE_PARAM
+        if (iv == NULL)
+                return ISAL_CRYPTO_ERR_NULL_IV;
+#endif
+
+        isal_aes_ctr_init(&context_data, iv);
+        ret = aes_ctr_update_check(ctr_func, keys, &context_data, out, in, len_bytes);
+        isal_aes_ctr_finalize(&context_data);
+
+        return ret;
+}
+
+int
+isal_aes_ctr_128(const void *in, const void *iv, const void *keys, void *out,
+                 const uint64_t len_bytes)
+{
+        return aes_ctr(_aes_ctr_128, in, iv, keys, out, len_bytes);
+}
+
+int
+isal_aes_ctr_192(const void *in, const void *iv, const void *keys, void *out,
+                 const uint64_t len_bytes)
+{
+        return aes_ctr(_aes_ctr_192, in, iv, keys, out, len_bytes);
+}
+
+int
+isal_aes_ctr_256(const void *in, const void *iv, const void *keys, void *out,
+                 const uint64_t len_bytes)
+{
+        return aes_ctr(_aes_ctr_256, in, iv, keys, out, len_bytes);
+}
+
+int
+isal_aes_ctr_128_update(const void *keys, struct isal_aes_ctr_context_data *context_data,
+                        void *out, const void *in, const uint64_t len_bytes)
+{
+        return aes_ctr_update_check(_aes_ctr_128, keys, context_data, out, in, len_bytes);
+}
+
+int
+isal_aes_ctr_192_update(const void *keys, struct isal_aes_ctr_context_data *context_data,
+                        void *out, const void *in, const uint64_t len_bytes)
+{
+        return aes_ctr_update_check(_aes_ctr_192, keys, context_data, out, in, len_bytes);
+}
+
+int
+isal_aes_ctr_256_update(const void *keys, struct isal_aes_ctr_context_data *context_data,
+                        void *out, const void *in, const uint64_t len_bytes)
+{
+        return aes_ctr_update_check(_aes_ctr_256, keys, context_data, out, in, len_bytes);
+}
@@ -28,10 +28,65 @@
 **********************************************************************/
 
 #include <stdlib.h>
+#include <string.h>
 #include "isal_crypto_api.h"
 #include "aes_gcm.h"
 #include "aes_gcm_internal.h"
 
+/*
+ * AAD streamed with isal_aes_gcm_aad_update_*() is hashed in whole blocks straight into the
+ * context. A trailing partial block is kept in partial_block_enc_key, which the kernels only use
+ * once message data is processed, and is padded and hashed before the first enc/dec update
+ * or finalize call.
+ */
+static void
+gcm_aad_update(const struct isal_gcm_key_data *key_data,
+               struct isal_gcm_context_data *context_data, const uint8_t *aad, uint64_t len)
+{
+        uint8_t *partial = context_data->partial_block_enc_key;
+        uint64_t n;
+
+        context_data->aad_length += len;
+
+        if (context_data->partial_block_length != 0) {
+                n = ISAL_GCM_BLOCK_LEN - context_data->partial_block_length;
+                if (n > len)
+                        n = len;
+                memcpy(partial + context_data->partial_block_length, aad, n);
+                context_data->partial_block_length += n;
+                aad += n;
+                len -= n;
+                if (context_data->partial_block_length < ISAL_GCM_BLOCK_LEN)
+                        return;
+                _ghash_ctx(key_data, context_data->aad_hash, partial, ISAL_GCM_BLOCK_LEN);
+                context_data->partial_block_length = 0;
+        }
+
+        n = len & ~(uint64_t) (ISAL_GCM_BLOCK_LEN - 1);
+        if (n != 0)
+                _ghash_ctx(key_data, context_data->aad_hash, aad, n);
+
+        len -= n;
+        if (len != 0) {
+                memcpy(partial, aad + n, len);
+                context_data->partial_block_length = len;
+        }
+}
+
+static inline void
+gcm_aad_flush(const struct isal_gcm_key_data *key_data, struct isal_gcm_context_data *context_data)
+{
+        uint8_t *partial = context_data->partial_block_enc_key;
+
+        if (context_data->in_length != 0 || context_data->partial_block_length == 0)
+                return;
+
+        memset(partial + context_data->partial_block_length, 0,
+               ISAL_GCM_BLOCK_LEN - context_data->partial_block_length);
+        _ghash_ctx(key_data, context_data->aad_hash, partial, ISAL_GCM_BLOCK_LEN);
+        context_data->partial_block_length = 0;
+}
+
 int
 isal_aes_gcm_enc_128(const struct isal_gcm_key_data *key_data,
                      struct isal_gcm_context_data *context_data, uint8_t *out, const uint8_t *in,
@@ -234,6 +289,60 @@ isal_aes_gcm_init_256(const struct isal_gcm_key_data *key_data,
         return 0;
 }
 
+int
+isal_aes_gcm_aad_update_128(const struct isal_gcm_key_data *key_data,
+                            struct isal_gcm_context_data *context_data, const uint8_t *aad,
+                            const uint64_t aad_len)
+{
+#ifdef SAFE_PARAM
+        if (key_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+        if (context_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (aad == NULL && aad_len > 0)
+                return ISAL_CRYPTO_ERR_NULL_AAD;
+        if (context_data->in_length != 0 ||
+            (context_data->aad_length % ISAL_GCM_BLOCK_LEN) != context_data->partial_block_length)
+                return ISAL_CRYPTO_ERR_AAD_ORDER;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        gcm_aad_update(key_data, context_data, aad, aad_len);
+
+        return 0;
+}
+
+int
+isal_aes_gcm_aad_update_256(const struct isal_gcm_key_data *key_data,
+                            struct isal_gcm_context_data *context_data, const uint8_t *aad,
+                            const uint64_t aad_len)
+{
+#ifdef SAFE_PARAM
+        if (key_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+        if (context_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (aad == NULL && aad_len > 0)
+                return ISAL_CRYPTO_ERR_NULL_AAD;
+        if (context_data->in_length != 0 ||
+            (context_data->aad_length % ISAL_GCM_BLOCK_LEN) != context_data->partial_block_length)
+                return ISAL_CRYPTO_ERR_AAD_ORDER;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        gcm_aad_update(key_data, context_data, aad, aad_len);
+
+        return 0;
+}
+
 int
 isal_aes_gcm_enc_128_update(const struct isal_gcm_key_data *key_data,
                             struct isal_gcm_context_data *context_data, uint8_t *out,
@@ -257,6 +366,7 @@ isal_aes_gcm_enc_128_update(const struct isal_gcm_key_data *key_data,
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
+        gcm_aad_flush(key_data, context_data);
         _aes_gcm_enc_128_update(key_data, context_data, out, (uint8_t *) in, len);
 
         return 0;
@@ -285,6 +395,7 @@ isal_aes_gcm_enc_256_update(const struct isal_gcm_key_data *key_data,
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
+        gcm_aad_flush(key_data, context_data);
         _aes_gcm_enc_256_update(key_data, context_data, out, in, len);
 
         return 0;
@@ -313,6 +424,7 @@ isal_aes_gcm_dec_128_update(const struct isal_gcm_key_data *key_data,
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
+        gcm_aad_flush(key_data, context_data);
         _aes_gcm_dec_128_update(key_data, context_data, out, in, len);
 
         return 0;
@@ -335,6 +447,7 @@ isal_aes_gcm_dec_256_update(const struct isal_gcm_key_data *key_data,
         if (len > ISAL_GCM_MAX_LEN)
                 return ISAL_CRYPTO_ERR_CIPH_LEN;
 #endif
+        gcm_aad_flush(key_data, context_data);
         _aes_gcm_dec_256_update(key_data, context_data, out, in, len);
 
         return 0;
@@ -361,6 +474,7 @@ isal_aes_gcm_enc_128_finalize(const struct isal_gcm_key_data *key_data,
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
+        gcm_aad_flush(key_data, context_data);
         _aes_gcm_enc_128_finalize(key_data, context_data, auth_tag, auth_tag_len);
 
         return 0;
@@ -387,6 +501,7 @@ isal_aes_gcm_enc_256_finalize(const struct isal_gcm_key_data *key_data,
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
+        gcm_aad_flush(key_data, context_data);
         _aes_gcm_enc_256_finalize(key_data, context_data, auth_tag, auth_tag_len);
 
         return 0;
@@ -413,6 +528,7 @@ isal_aes_gcm_dec_128_finalize(const struct isal_gcm_key_data *key_data,
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
+        gcm_aad_flush(key_data, context_data);
         _aes_gcm_dec_128_finalize(key_data, context_data, auth_tag, auth_tag_len);
 
         return 0;
@@ -439,6 +555,7 @@ isal_aes_gcm_dec_256_finalize(const struct isal_gcm_key_data *key_data,
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
+        gcm_aad_flush(key_data, context_data);
         _aes_gcm_dec_256_finalize(key_data, context_data, auth_tag, auth_tag_len);
 
         return 0;
@@ -659,6 +776,7 @@ isal_aes_gcm_enc_128_update_nt(const struct isal_gcm_key_data *key_data,
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
+        gcm_aad_flush(key_data, context_data);
         _aes_gcm_enc_128_update_nt(key_data, context_data, out, in, len);
         return 0;
 }
@@ -686,6 +804,7 @@ isal_aes_gcm_enc_256_update_nt(const struct isal_gcm_key_data *key_data,
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
+        gcm_aad_flush(key_data, context_data);
         _aes_gcm_enc_256_update_nt(key_data, context_data, out, in, len);
 
         return 0;
@@ -714,6 +833,7 @@ isal_aes_gcm_dec_128_update_nt(const struct isal_gcm_key_data *key_data,
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
+        gcm_aad_flush(key_data, context_data);
         _aes_gcm_dec_128_update_nt(key_data, context_data, out, in, len);
 
         return 0;
@@ -742,6 +862,7 @@ isal_aes_gcm_dec_256_update_nt(const struct isal_gcm_key_data *key_data,
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
+        gcm_aad_flush(key_data, context_data);
         _aes_gcm_dec_256_update_nt(key_data, context_data, out, in, len);
 
         return 0;
@@ -0,0 +1,143 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdlib.h>
+#include "isal_crypto_api.h"
+#include "aes_gcm_mb.h"
+#include "aes_gcm_mb_internal.h"
+
+int
+isal_aes_gcm_ctx_mgr_init(ISAL_AES_GCM_CTX_MGR *mgr, const uint32_t key_len)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (key_len != ISAL_GCM_128_KEY_LEN && key_len != ISAL_GCM_256_KEY_LEN)
+                return ISAL_CRYPTO_ERR_KEY_LEN;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        _aes_gcm_ctx_mgr_init(mgr, key_len);
+
+        return 0;
+}
+
+int
+isal_aes_gcm_ctx_init(ISAL_AES_GCM_CTX *ctx, const struct isal_gcm_key_data *key_data,
+                      const ISAL_AES_GCM_DIR dir)
+{
+#ifdef SAFE_PARAM
+        if (ctx == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (key_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+        if (dir != ISAL_AES_GCM_ENCRYPT && dir != ISAL_AES_GCM_DECRYPT)
+                return ISAL_CRYPTO_ERR_INVALID_FLAGS;
+#endif
+
+        ctx->job.key_data = key_data;
+        ctx->job.dir = dir;
+        ctx->job.len = 0;
+        ctx->job.status = ISAL_STS_COMPLETED;
+        ctx->status = ISAL_HASH_CTX_STS_COMPLETE;
+        ctx->error = ISAL_HASH_CTX_ERROR_NONE;
+
+        return 0;
+}
+
+int
+isal_aes_gcm_ctx_mgr_submit(ISAL_AES_GCM_CTX_MGR *mgr, ISAL_AES_GCM_CTX *ctx_in,
+                            ISAL_AES_GCM_CTX **ctx_out, uint8_t *out, const uint8_t *in,
+                            const uint64_t len, const uint8_t *iv, const uint8_t *aad,
+                            const uint64_t aad_len, uint8_t *auth_tag,
+                            const uint64_t auth_tag_len)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_in == NULL || ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (out == NULL && len != 0)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+        if (in == NULL && len != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        if (len > ISAL_GCM_MAX_LEN)
+                return ISAL_CRYPTO_ERR_CIPH_LEN;
+        if (iv == NULL)
+                return ISAL_CRYPTO_ERR_NULL_IV;
+        if (aad == NULL && aad_len > 0)
+                return ISAL_CRYPTO_ERR_NULL_AAD;
+        if (auth_tag == NULL)
+                return ISAL_CRYPTO_ERR_NULL_AUTH;
+        if (auth_tag_len != ISAL_GCM_MAX_TAG_LEN && auth_tag_len != 12 && auth_tag_len != 8)
+                return ISAL_CRYPTO_ERR_AUTH_TAG_LEN;
+        if (ctx_in->job.key_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        *ctx_out = _aes_gcm_ctx_mgr_submit(mgr, ctx_in, out, in, len, iv, aad, aad_len, auth_tag,
+                                           auth_tag_len);
+
+#ifdef SAFE_PARAM
+        if (*ctx_out != NULL && (*ctx_out)->error != ISAL_HASH_CTX_ERROR_NONE) {
+                if ((*ctx_out)->error == ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING)
+                        return ISAL_CRYPTO_ERR_ALREADY_PROCESSING;
+        }
+#endif
+        return 0;
+}
+
+int
+isal_aes_gcm_ctx_mgr_flush(ISAL_AES_GCM_CTX_MGR *mgr, ISAL_AES_GCM_CTX **ctx_out)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        *ctx_out = _aes_gcm_ctx_mgr_flush(mgr);
+
+        return 0;
+}
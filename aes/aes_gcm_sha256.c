@@ -0,0 +1,281 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stddef.h>
+#include "isal_crypto_api.h"
+#include "aes_gcm.h"
+#include "aes_gcm_sha256.h"
+#include "sha256_mb_internal.h"
+
+static void
+gs_gcm_enc_update(const ISAL_AES_GCM_SHA256_CTX_MGR *mgr, ISAL_AES_GCM_SHA256_CTX *ctx)
+{
+        if (mgr->key_len == ISAL_GCM_128_KEY_LEN)
+                isal_aes_gcm_enc_128_update(ctx->key_data, &ctx->gcm, ctx->data_out,
+                                            ctx->data_buffer, ctx->tile_len);
+        else
+                isal_aes_gcm_enc_256_update(ctx->key_data, &ctx->gcm, ctx->data_out,
+                                            ctx->data_buffer, ctx->tile_len);
+}
+
+/* The SHA256 manager is done with the current tile of a job, so it can be encrypted */
+static void
+gs_sha256_done(ISAL_AES_GCM_SHA256_CTX_MGR *mgr, ISAL_SHA256_HASH_CTX *sub)
+{
+        ISAL_AES_GCM_SHA256_CTX *ctx;
+
+        if (sub == NULL)
+                return;
+
+        ctx = (ISAL_AES_GCM_SHA256_CTX *) sub->user_data;
+        if (sub->error != ISAL_HASH_CTX_ERROR_NONE)
+                ctx->error = sub->error;
+        ctx->next = mgr->ready;
+        mgr->ready = ctx;
+}
+
+/*
+ * Hand the next tile of a job to the SHA256 manager. The tile is hashed before it is
+ * encrypted, so that in-place encryption does not overwrite plaintext still to be hashed.
+ */
+static void
+gs_submit_tile(ISAL_AES_GCM_SHA256_CTX_MGR *mgr, ISAL_AES_GCM_SHA256_CTX *ctx)
+{
+        ISAL_HASH_CTX_FLAG flags = ctx->data_flags;
+
+        ctx->tile_len = ISAL_AES_GCM_SHA256_TILE_SIZE;
+        if (ctx->data_len < ctx->tile_len)
+                ctx->tile_len = (uint32_t) ctx->data_len;
+
+        /* Only the first tile may start the digest and only the last one may end it */
+        if (ctx->data_len != ctx->tile_len)
+                flags = (ISAL_HASH_CTX_FLAG) (flags & ~ISAL_HASH_LAST);
+        ctx->data_flags = (ISAL_HASH_CTX_FLAG) (ctx->data_flags & ISAL_HASH_LAST);
+
+        gs_sha256_done(mgr, _sha256_ctx_mgr_submit(&mgr->sha256, &ctx->sha256, ctx->data_buffer,
+                                                   ctx->tile_len, flags));
+}
+
+/*
+ * Encrypt the tiles the SHA256 manager is done with and move their jobs on to the next tile.
+ * Jobs with no input left are queued for the application. Submitting a tile can make other
+ * jobs ready, so the list is drained in a loop rather than recursively.
+ */
+static void
+gs_run_ready(ISAL_AES_GCM_SHA256_CTX_MGR *mgr)
+{
+        ISAL_AES_GCM_SHA256_CTX *ctx;
+
+        while (mgr->ready != NULL) {
+                ctx = mgr->ready;
+                mgr->ready = ctx->next;
+
+                if (ctx->error == ISAL_HASH_CTX_ERROR_NONE) {
+                        gs_gcm_enc_update(mgr, ctx);
+                        ctx->data_buffer += ctx->tile_len;
+                        ctx->data_out += ctx->tile_len;
+                        ctx->data_len -= ctx->tile_len;
+                        ctx->tile_len = 0;
+
+                        if (ctx->data_len != 0) {
+                                gs_submit_tile(mgr, ctx);
+                                continue;
+                        }
+                }
+
+                ctx->status = (ctx->data_flags & ISAL_HASH_LAST) ? ISAL_HASH_CTX_STS_COMPLETE
+                                                                 : ISAL_HASH_CTX_STS_IDLE;
+                ctx->next = NULL;
+                if (mgr->done_head == NULL)
+                        mgr->done_head = ctx;
+                else
+                        mgr->done_tail->next = ctx;
+                mgr->done_tail = ctx;
+        }
+}
+
+static ISAL_AES_GCM_SHA256_CTX *
+gs_pop_done(ISAL_AES_GCM_SHA256_CTX_MGR *mgr)
+{
+        ISAL_AES_GCM_SHA256_CTX *ctx = mgr->done_head;
+
+        if (ctx != NULL)
+                mgr->done_head = ctx->next;
+
+        return ctx;
+}
+
+static ISAL_AES_GCM_SHA256_CTX *
+gs_ctx_mgr_submit(ISAL_AES_GCM_SHA256_CTX_MGR *mgr, ISAL_AES_GCM_SHA256_CTX *ctx,
+                  const struct isal_gcm_key_data *key_data, uint8_t *out, const uint8_t *in,
+                  const uint64_t len, const ISAL_HASH_CTX_FLAG flags)
+{
+        if (flags & (~ISAL_HASH_ENTIRE)) {
+                // Cannot submit with an invalid flag combination
+                ctx->error = ISAL_HASH_CTX_ERROR_INVALID_FLAGS;
+                return ctx;
+        }
+
+        if (ctx->status & ISAL_HASH_CTX_STS_PROCESSING) {
+                // Cannot submit to a currently processing job.
+                ctx->error = ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING;
+                return ctx;
+        }
+
+        if ((ctx->status & ISAL_HASH_CTX_STS_COMPLETE) && !(flags & ISAL_HASH_FIRST)) {
+                // Cannot update a finished job.
+                ctx->error = ISAL_HASH_CTX_ERROR_ALREADY_COMPLETED;
+                return ctx;
+        }
+
+        if (flags & ISAL_HASH_FIRST) {
+                isal_hash_ctx_init(&ctx->sha256);
+                ctx->sha256.user_data = ctx;
+        }
+
+        ctx->error = ISAL_HASH_CTX_ERROR_NONE;
+        ctx->status = ISAL_HASH_CTX_STS_PROCESSING;
+        ctx->key_data = key_data;
+        ctx->data_buffer = in;
+        ctx->data_out = out;
+        ctx->data_len = len;
+        ctx->data_flags = flags;
+
+        gs_submit_tile(mgr, ctx);
+        gs_run_ready(mgr);
+
+        return gs_pop_done(mgr);
+}
+
+static ISAL_AES_GCM_SHA256_CTX *
+gs_ctx_mgr_flush(ISAL_AES_GCM_SHA256_CTX_MGR *mgr)
+{
+        ISAL_SHA256_HASH_CTX *sub;
+
+        while (mgr->done_head == NULL) {
+                sub = _sha256_ctx_mgr_flush(&mgr->sha256);
+                if (sub == NULL)
+                        return NULL;
+
+                gs_sha256_done(mgr, sub);
+                gs_run_ready(mgr);
+        }
+
+        return gs_pop_done(mgr);
+}
+
+int
+isal_aes_gcm_sha256_ctx_mgr_init(ISAL_AES_GCM_SHA256_CTX_MGR *mgr, const uint32_t key_len)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (key_len != ISAL_GCM_128_KEY_LEN && key_len != ISAL_GCM_256_KEY_LEN)
+                return ISAL_CRYPTO_ERR_KEY_LEN;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        _sha256_ctx_mgr_init(&mgr->sha256);
+        mgr->key_len = key_len;
+        mgr->ready = NULL;
+        mgr->done_head = NULL;
+        mgr->done_tail = NULL;
+
+        return 0;
+}
+
+int
+isal_aes_gcm_sha256_ctx_mgr_submit(ISAL_AES_GCM_SHA256_CTX_MGR *mgr,
+                                   ISAL_AES_GCM_SHA256_CTX *ctx_in,
+                                   ISAL_AES_GCM_SHA256_CTX **ctx_out,
+                                   const struct isal_gcm_key_data *key_data, uint8_t *out,
+                                   const uint8_t *in, const uint64_t len,
+                                   const ISAL_HASH_CTX_FLAG flags)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_in == NULL || ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (key_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+        if (in == NULL && len != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        if (out == NULL && len != 0)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+        if (len > ISAL_GCM_MAX_LEN)
+                return ISAL_CRYPTO_ERR_CIPH_LEN;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        *ctx_out = gs_ctx_mgr_submit(mgr, ctx_in, key_data, out, in, len, flags);
+
+#ifdef SAFE_PARAM
+        if (*ctx_out != NULL && (*ctx_out)->error != ISAL_HASH_CTX_ERROR_NONE) {
+                ISAL_AES_GCM_SHA256_CTX *cp = *ctx_out;
+
+                if (cp->error == ISAL_HASH_CTX_ERROR_INVALID_FLAGS)
+                        return ISAL_CRYPTO_ERR_INVALID_FLAGS;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING)
+                        return ISAL_CRYPTO_ERR_ALREADY_PROCESSING;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_COMPLETED)
+                        return ISAL_CRYPTO_ERR_ALREADY_COMPLETED;
+        }
+#endif
+        return 0;
+}
+
+int
+isal_aes_gcm_sha256_ctx_mgr_flush(ISAL_AES_GCM_SHA256_CTX_MGR *mgr,
+                                  ISAL_AES_GCM_SHA256_CTX **ctx_out)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        *ctx_out = gs_ctx_mgr_flush(mgr);
+
+        return 0;
+}
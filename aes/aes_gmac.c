@@ -0,0 +1,241 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "isal_crypto_api.h"
+#include "aes_gcm.h"
+#include "aes_gcm_internal.h"
+#include "endian_helper.h"
+
+/*
+ * GMAC tag = E(K, J0) ^ GHASH(A || 0-pad || len(A) || 0^64). E(K, J0) is
+ * taken from a GCM finalize over an empty message, whose GHASH is zero.
+ */
+
+static void
+gmac_update(const struct isal_gcm_key_data *key_data, struct isal_gmac_context_data *ctx,
+            const uint8_t *in, uint64_t len)
+{
+        uint64_t pos = ctx->partial_block_length;
+        uint64_t whole;
+
+        ctx->aad_length += len;
+
+        if (pos != 0) {
+                const uint64_t left = ISAL_GCM_BLOCK_LEN - pos;
+                const uint64_t n = (len < left) ? len : left;
+
+                memcpy(&ctx->partial_block[pos], in, n);
+                pos += n;
+                in += n;
+                len -= n;
+                if (pos < ISAL_GCM_BLOCK_LEN) {
+                        ctx->partial_block_length = pos;
+                        return;
+                }
+                _ghash(key_data, ctx->hash, ctx->partial_block, ISAL_GCM_BLOCK_LEN);
+        }
+
+        whole = len & ~(uint64_t) (ISAL_GCM_BLOCK_LEN - 1);
+        if (whole != 0)
+                _ghash(key_data, ctx->hash, in, whole);
+
+        memcpy(ctx->partial_block, &in[whole], len - whole);
+        ctx->partial_block_length = len - whole;
+}
+
+static void
+gmac_finalize(const struct isal_gcm_key_data *key_data, struct isal_gmac_context_data *ctx,
+              uint8_t *auth_tag, uint64_t auth_tag_len)
+{
+        uint8_t len_block[ISAL_GCM_BLOCK_LEN] = { 0 };
+        const uint64_t aad_bits = to_be64(ctx->aad_length << 3);
+        const uint64_t pos = ctx->partial_block_length;
+        uint64_t i;
+
+        if (pos != 0) {
+                memset(&ctx->partial_block[pos], 0, ISAL_GCM_BLOCK_LEN - pos);
+                _ghash(key_data, ctx->hash, ctx->partial_block, ISAL_GCM_BLOCK_LEN);
+                ctx->partial_block_length = 0;
+        }
+
+        memcpy(len_block, &aad_bits, sizeof(aad_bits));
+        _ghash(key_data, ctx->hash, len_block, ISAL_GCM_BLOCK_LEN);
+
+        for (i = 0; i < auth_tag_len; i++)
+                auth_tag[i] = ctx->hash[i] ^ ctx->enc_j0[i];
+}
+
+static void
+gmac_reset(struct isal_gmac_context_data *ctx)
+{
+        memset(ctx->hash, 0, sizeof(ctx->hash));
+        ctx->aad_length = 0;
+        ctx->partial_block_length = 0;
+}
+
+int
+isal_aes_gmac_init_128(const struct isal_gcm_key_data *key_data,
+                       struct isal_gmac_context_data *context_data, const uint8_t *iv)
+{
+        struct isal_gcm_context_data gcm_ctx;
+
+#ifdef SAFE_PARAM
+        if (key_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+        if (context_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (iv == NULL)
+                return ISAL_CRYPTO_ERR_NULL_IV;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        _aes_gcm_init_128(key_data, &gcm_ctx, (uint8_t *) iv, NULL, 0);
+        _aes_gcm_enc_128_finalize(key_data, &gcm_ctx, context_data->enc_j0, ISAL_GCM_MAX_TAG_LEN);
+        gmac_reset(context_data);
+
+        return 0;
+}
+
+int
+isal_aes_gmac_init_256(const struct isal_gcm_key_data *key_data,
+                       struct isal_gmac_context_data *context_data, const uint8_t *iv)
+{
+        struct isal_gcm_context_data gcm_ctx;
+
+#ifdef SAFE_PARAM
+        if (key_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+        if (context_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (iv == NULL)
+                return ISAL_CRYPTO_ERR_NULL_IV;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        _aes_gcm_init_256(key_data, &gcm_ctx, (uint8_t *) iv, NULL, 0);
+        _aes_gcm_enc_256_finalize(key_data, &gcm_ctx, context_data->enc_j0, ISAL_GCM_MAX_TAG_LEN);
+        gmac_reset(context_data);
+
+        return 0;
+}
+
+int
+isal_aes_gmac_update(const struct isal_gcm_key_data *key_data,
+                     struct isal_gmac_context_data *context_data, const uint8_t *in,
+                     const uint64_t len)
+{
+#ifdef SAFE_PARAM
+        if (key_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+        if (context_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (in == NULL && len != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        if (len != 0)
+                gmac_update(key_data, context_data, in, len);
+
+        return 0;
+}
+
+int
+isal_aes_gmac_finalize(const struct isal_gcm_key_data *key_data,
+                       struct isal_gmac_context_data *context_data, uint8_t *auth_tag,
+                       const uint64_t auth_tag_len)
+{
+#ifdef SAFE_PARAM
+        if (key_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+        if (context_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (auth_tag == NULL)
+                return ISAL_CRYPTO_ERR_NULL_AUTH;
+        if (auth_tag_len != ISAL_GCM_MAX_TAG_LEN && auth_tag_len != 12 && auth_tag_len != 8)
+                return ISAL_CRYPTO_ERR_AUTH_TAG_LEN;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        gmac_finalize(key_data, context_data, auth_tag, auth_tag_len);
+
+        return 0;
+}
+
+int
+isal_aes_gcm_ghash_update(const struct isal_gcm_key_data *key_data, uint8_t *hash,
+                          const uint8_t *in, const uint64_t len)
+{
+        uint64_t whole;
+
+#ifdef SAFE_PARAM
+        if (key_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+        if (hash == NULL)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+        if (in == NULL && len != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        whole = len & ~(uint64_t) (ISAL_GCM_BLOCK_LEN - 1);
+        if (whole != 0)
+                _ghash(key_data, hash, in, whole);
+
+        if (whole != len) {
+                uint8_t last[ISAL_GCM_BLOCK_LEN] = { 0 };
+
+                memcpy(last, &in[whole], len - whole);
+                _ghash(key_data, hash, last, ISAL_GCM_BLOCK_LEN);
+        }
+
+        return 0;
+}
@@ -33,8 +33,13 @@
 #include "isal_crypto_api.h"
 #include "aes_keyexp.h"
 #include "aes_cbc.h"
+#include "aes_cbc_mb.h"
+#include "aes_ctr.h"
 #include "aes_xts.h"
 #include "aes_gcm.h"
+#include "aes_gcm_mb.h"
+#include "aes_gcm_sha256.h"
+#include "aes_xts_mb.h"
 #include "test.h"
 #include "aes/gcm_vectors.h"
 
@@ -53,24 +58,36 @@ typedef int (*aes_keyexp_func)(const uint8_t *, uint8_t *, uint8_t *);
 typedef int (*aes_cbc_func)(const void *, const void *, const void *, void *, const uint64_t);
 typedef int (*aes_xts_func)(const uint8_t *, const uint8_t *, const uint8_t *, const uint64_t,
                             const void *, void *);
+typedef int (*aes_xts_sectors_func)(const uint8_t *, const uint8_t *, const uint64_t,
+                                    const uint64_t, const uint64_t, const void *, void *);
 typedef int (*aes_gcm_func)(const struct isal_gcm_key_data *, struct isal_gcm_context_data *,
                             uint8_t *, const uint8_t *, const uint64_t, const uint8_t *,
                             const uint8_t *, const uint64_t, uint8_t *, const uint64_t);
 typedef int (*aes_gcm_init_func)(const struct isal_gcm_key_data *, struct isal_gcm_context_data *,
                                  const uint8_t *, const uint8_t *, const uint64_t);
+typedef int (*aes_gcm_aad_update_func)(const struct isal_gcm_key_data *,
+                                       struct isal_gcm_context_data *, const uint8_t *,
+                                       const uint64_t);
 typedef int (*aes_gcm_update_func)(const struct isal_gcm_key_data *, struct isal_gcm_context_data *,
                                    uint8_t *, const uint8_t *, const uint64_t);
 typedef int (*aes_gcm_finalize_func)(const struct isal_gcm_key_data *,
                                      struct isal_gcm_context_data *, uint8_t *, const uint64_t);
 typedef int (*aes_gcm_pre_func)(const void *, struct isal_gcm_key_data *);
+typedef int (*aes_gmac_init_func)(const struct isal_gcm_key_data *,
+                                  struct isal_gmac_context_data *, const uint8_t *);
+typedef int (*aes_ctr_func)(const void *, const void *, const void *, void *, const uint64_t);
+typedef int (*aes_ctr_update_func)(const void *, struct isal_aes_ctr_context_data *, void *,
+                                   const void *, const uint64_t);
 
 struct test_func {
         union {
                 aes_keyexp_func keyexp_func_ptr;
                 aes_cbc_func cbc_func_ptr;
                 aes_xts_func xts_func_ptr;
+                aes_xts_sectors_func xts_sectors_func_ptr;
                 aes_gcm_func gcm_func_ptr;
                 aes_gcm_init_func gcm_init_func_ptr;
+                aes_gcm_aad_update_func gcm_aad_update_func_ptr;
                 aes_gcm_update_func gcm_update_func_ptr;
                 aes_gcm_finalize_func gcm_finalize_func_ptr;
                 aes_gcm_pre_func gcm_pre_func_ptr;
@@ -191,6 +208,52 @@ test_aes_xts_api(aes_xts_func aes_xts_func_ptr, const char *name, const int expa
         return 0;
 }
 
+static int
+test_aes_xts_sectors_api(aes_xts_sectors_func aes_xts_func_ptr, const char *name)
+{
+        uint8_t key1[32] = { 0 };
+        uint8_t key2[32];
+        uint8_t buf[32] = { 0 };
+
+        /* Key1 and key2 must be different, to avoid error */
+        memset(key2, 0xff, sizeof(key2));
+
+        // test null key ptr
+        CHECK_RETURN(aes_xts_func_ptr(NULL, key1, 0, 16, 2, buf, buf), ISAL_CRYPTO_ERR_NULL_KEY,
+                     name);
+        CHECK_RETURN(aes_xts_func_ptr(key2, NULL, 0, 16, 2, buf, buf), ISAL_CRYPTO_ERR_NULL_KEY,
+                     name);
+
+        // test invalid sector size (outside range)
+        CHECK_RETURN(aes_xts_func_ptr(key2, key1, 0, ISAL_AES_XTS_MIN_LEN - 1, 2, buf, buf),
+                     ISAL_CRYPTO_ERR_CIPH_LEN, name);
+        CHECK_RETURN(aes_xts_func_ptr(key2, key1, 0, ISAL_AES_XTS_MAX_LEN + 1, 2, buf, buf),
+                     ISAL_CRYPTO_ERR_CIPH_LEN, name);
+
+        // test total length overflow
+        CHECK_RETURN(aes_xts_func_ptr(key2, key1, 0, 16, UINT64_MAX / 8, buf, buf),
+                     ISAL_CRYPTO_ERR_CIPH_LEN, name);
+
+        // test null input ptr
+        CHECK_RETURN(aes_xts_func_ptr(key2, key1, 0, 16, 2, NULL, buf), ISAL_CRYPTO_ERR_NULL_SRC,
+                     name);
+
+        // test null output ptr
+        CHECK_RETURN(aes_xts_func_ptr(key2, key1, 0, 16, 2, buf, NULL), ISAL_CRYPTO_ERR_NULL_DST,
+                     name);
+
+#ifdef FIPS_MODE
+        // test same key error
+        CHECK_RETURN(aes_xts_func_ptr(key1, key1, 0, 16, 2, buf, buf),
+                     ISAL_CRYPTO_ERR_XTS_SAME_KEYS, name);
+#endif
+        // test valid params, including an empty run
+        CHECK_RETURN(aes_xts_func_ptr(key2, key1, 0, 16, 0, buf, buf), ISAL_CRYPTO_ERR_NONE, name);
+        CHECK_RETURN(aes_xts_func_ptr(key2, key1, 0, 16, 2, buf, buf), ISAL_CRYPTO_ERR_NONE, name);
+
+        return 0;
+}
+
 static int
 test_aes_gcm_api(aes_gcm_func aes_gcm_func_ptr, const char *name)
 {
@@ -304,11 +367,51 @@ test_aes_gcm_init_api(aes_gcm_init_func aes_gcm_func_ptr, const char *name)
         return 0;
 }
 
+static int
+test_aes_gcm_aad_update_api(aes_gcm_aad_update_func aes_gcm_func_ptr, const char *name)
+{
+        struct isal_gcm_key_data gkey = { 0 };
+        struct isal_gcm_context_data gctx = { 0 };
+        uint8_t aad[64] = { 0 };
+
+        // test null key data
+        CHECK_RETURN(aes_gcm_func_ptr(NULL, &gctx, aad, sizeof(aad)), ISAL_CRYPTO_ERR_NULL_EXP_KEY,
+                     name);
+
+        // test null context
+        CHECK_RETURN(aes_gcm_func_ptr(&gkey, NULL, aad, sizeof(aad)), ISAL_CRYPTO_ERR_NULL_CTX,
+                     name);
+
+        // test null aad
+        CHECK_RETURN(aes_gcm_func_ptr(&gkey, &gctx, NULL, sizeof(aad)), ISAL_CRYPTO_ERR_NULL_AAD,
+                     name);
+
+        // test null aad with zero len
+        CHECK_RETURN(aes_gcm_func_ptr(&gkey, &gctx, NULL, 0), ISAL_CRYPTO_ERR_NONE, name);
+
+        // test partial blocks
+        CHECK_RETURN(aes_gcm_func_ptr(&gkey, &gctx, aad, 7), ISAL_CRYPTO_ERR_NONE, name);
+        CHECK_RETURN(aes_gcm_func_ptr(&gkey, &gctx, aad, 37), ISAL_CRYPTO_ERR_NONE, name);
+
+        // test AAD after message data
+        gctx.in_length = 16;
+        CHECK_RETURN(aes_gcm_func_ptr(&gkey, &gctx, aad, sizeof(aad)), ISAL_CRYPTO_ERR_AAD_ORDER,
+                     name);
+
+        // test AAD after init with non block multiple AAD
+        memset(&gctx, 0, sizeof(gctx));
+        gctx.aad_length = 5;
+        CHECK_RETURN(aes_gcm_func_ptr(&gkey, &gctx, aad, sizeof(aad)), ISAL_CRYPTO_ERR_AAD_ORDER,
+                     name);
+
+        return 0;
+}
+
 static int
 test_aes_gcm_update_api(aes_gcm_update_func aes_gcm_func_ptr, const char *name)
 {
-        struct isal_gcm_key_data gkey;
-        struct isal_gcm_context_data gctx;
+        struct isal_gcm_key_data gkey = { 0 };
+        struct isal_gcm_context_data gctx = { 0 };
         uint8_t buf[256] = { 0 };
 
         // test null key data
@@ -397,6 +500,432 @@ test_aes_gcm_pre_api(aes_gcm_pre_func aes_gcm_func_ptr, const char *name)
         return 0;
 }
 
+static int
+test_aes_gmac_api(aes_gmac_init_func aes_gmac_init_func_ptr, const char *name)
+{
+        struct isal_gcm_key_data gkey = { 0 };
+        struct isal_gmac_context_data ctx = { 0 };
+        uint8_t tag[ISAL_GCM_MAX_TAG_LEN] = { 0 };
+        uint8_t iv[ISAL_GCM_IV_LEN] = { 0 };
+        uint8_t buf[64] = { 0 };
+
+        // test null key data
+        CHECK_RETURN(aes_gmac_init_func_ptr(NULL, &ctx, iv), ISAL_CRYPTO_ERR_NULL_EXP_KEY, name);
+
+        // test null context
+        CHECK_RETURN(aes_gmac_init_func_ptr(&gkey, NULL, iv), ISAL_CRYPTO_ERR_NULL_CTX, name);
+
+        // test null IV
+        CHECK_RETURN(aes_gmac_init_func_ptr(&gkey, &ctx, NULL), ISAL_CRYPTO_ERR_NULL_IV, name);
+
+        // test valid params
+        CHECK_RETURN(aes_gmac_init_func_ptr(&gkey, &ctx, iv), ISAL_CRYPTO_ERR_NONE, name);
+
+        name = "isal_aes_gmac_update";
+        CHECK_RETURN(isal_aes_gmac_update(NULL, &ctx, buf, sizeof(buf)),
+                     ISAL_CRYPTO_ERR_NULL_EXP_KEY, name);
+        CHECK_RETURN(isal_aes_gmac_update(&gkey, NULL, buf, sizeof(buf)), ISAL_CRYPTO_ERR_NULL_CTX,
+                     name);
+        CHECK_RETURN(isal_aes_gmac_update(&gkey, &ctx, NULL, sizeof(buf)),
+                     ISAL_CRYPTO_ERR_NULL_SRC, name);
+        CHECK_RETURN(isal_aes_gmac_update(&gkey, &ctx, NULL, 0), ISAL_CRYPTO_ERR_NONE, name);
+        CHECK_RETURN(isal_aes_gmac_update(&gkey, &ctx, buf, 7), ISAL_CRYPTO_ERR_NONE, name);
+
+        name = "isal_aes_gmac_finalize";
+        CHECK_RETURN(isal_aes_gmac_finalize(NULL, &ctx, tag, ISAL_GCM_MAX_TAG_LEN),
+                     ISAL_CRYPTO_ERR_NULL_EXP_KEY, name);
+        CHECK_RETURN(isal_aes_gmac_finalize(&gkey, NULL, tag, ISAL_GCM_MAX_TAG_LEN),
+                     ISAL_CRYPTO_ERR_NULL_CTX, name);
+        CHECK_RETURN(isal_aes_gmac_finalize(&gkey, &ctx, NULL, ISAL_GCM_MAX_TAG_LEN),
+                     ISAL_CRYPTO_ERR_NULL_AUTH, name);
+
+        // test auth tag lens
+        for (int i = 5; i <= ISAL_GCM_MAX_TAG_LEN + 1; i++)
+                if (i % 4 == 0)
+                        CHECK_RETURN(isal_aes_gmac_finalize(&gkey, &ctx, tag, i),
+                                     ISAL_CRYPTO_ERR_NONE, name);
+                else
+                        CHECK_RETURN(isal_aes_gmac_finalize(&gkey, &ctx, tag, i),
+                                     ISAL_CRYPTO_ERR_AUTH_TAG_LEN, name);
+
+        name = "isal_aes_gcm_ghash_update";
+        CHECK_RETURN(isal_aes_gcm_ghash_update(NULL, tag, buf, sizeof(buf)),
+                     ISAL_CRYPTO_ERR_NULL_EXP_KEY, name);
+        CHECK_RETURN(isal_aes_gcm_ghash_update(&gkey, NULL, buf, sizeof(buf)),
+                     ISAL_CRYPTO_ERR_NULL_DST, name);
+        CHECK_RETURN(isal_aes_gcm_ghash_update(&gkey, tag, NULL, sizeof(buf)),
+                     ISAL_CRYPTO_ERR_NULL_SRC, name);
+        CHECK_RETURN(isal_aes_gcm_ghash_update(&gkey, tag, NULL, 0), ISAL_CRYPTO_ERR_NONE, name);
+        CHECK_RETURN(isal_aes_gcm_ghash_update(&gkey, tag, buf, 21), ISAL_CRYPTO_ERR_NONE, name);
+
+        return 0;
+}
+
+static int
+test_aes_ctr_api(aes_ctr_func aes_ctr_func_ptr, const char *name,
+                 aes_ctr_update_func aes_ctr_update_func_ptr, const char *update_name)
+{
+        DECLARE_ALIGNED(uint8_t exp_keys[16 * 15], 16) = { 0 };
+        struct isal_aes_ctr_context_data ctx;
+        uint8_t buf[16] = { 0 };
+        uint8_t iv[16] = { 0 };
+
+        // test null expanded key ptr
+        CHECK_RETURN(aes_ctr_func_ptr(buf, iv, NULL, buf, 16), ISAL_CRYPTO_ERR_NULL_EXP_KEY, name);
+
+        // test null source ptr
+        CHECK_RETURN(aes_ctr_func_ptr(NULL, iv, exp_keys, buf, 16), ISAL_CRYPTO_ERR_NULL_SRC, name);
+
+        // test null destination ptr
+        CHECK_RETURN(aes_ctr_func_ptr(buf, iv, exp_keys, NULL, 16), ISAL_CRYPTO_ERR_NULL_DST, name);
+
+        // test null IV ptr
+        CHECK_RETURN(aes_ctr_func_ptr(buf, NULL, exp_keys, buf, 16), ISAL_CRYPTO_ERR_NULL_IV, name);
+
+        // test any length and null buffers with zero length
+        CHECK_RETURN(aes_ctr_func_ptr(buf, iv, exp_keys, buf, 15), ISAL_CRYPTO_ERR_NONE, name);
+        CHECK_RETURN(aes_ctr_func_ptr(NULL, iv, exp_keys, NULL, 0), ISAL_CRYPTO_ERR_NONE, name);
+
+        CHECK_RETURN(isal_aes_ctr_init(NULL, iv), ISAL_CRYPTO_ERR_NULL_CTX, "isal_aes_ctr_init");
+        CHECK_RETURN(isal_aes_ctr_init(&ctx, NULL), ISAL_CRYPTO_ERR_NULL_IV, "isal_aes_ctr_init");
+        CHECK_RETURN(isal_aes_ctr_init(&ctx, iv), ISAL_CRYPTO_ERR_NONE, "isal_aes_ctr_init");
+
+        CHECK_RETURN(aes_ctr_update_func_ptr(NULL, &ctx, buf, buf, 16),
+                     ISAL_CRYPTO_ERR_NULL_EXP_KEY, update_name);
+        CHECK_RETURN(aes_ctr_update_func_ptr(exp_keys, NULL, buf, buf, 16),
+                     ISAL_CRYPTO_ERR_NULL_CTX, update_name);
+        CHECK_RETURN(aes_ctr_update_func_ptr(exp_keys, &ctx, buf, NULL, 16),
+                     ISAL_CRYPTO_ERR_NULL_SRC, update_name);
+        CHECK_RETURN(aes_ctr_update_func_ptr(exp_keys, &ctx, NULL, buf, 16),
+                     ISAL_CRYPTO_ERR_NULL_DST, update_name);
+        CHECK_RETURN(aes_ctr_update_func_ptr(exp_keys, &ctx, buf, buf, 7), ISAL_CRYPTO_ERR_NONE,
+                     update_name);
+
+        CHECK_RETURN(isal_aes_ctr_finalize(NULL), ISAL_CRYPTO_ERR_NULL_CTX,
+                     "isal_aes_ctr_finalize");
+        CHECK_RETURN(isal_aes_ctr_finalize(&ctx), ISAL_CRYPTO_ERR_NONE, "isal_aes_ctr_finalize");
+
+        return 0;
+}
+
+static int
+test_aes_cbc_mb_api(void)
+{
+        DECLARE_ALIGNED(ISAL_AES_CBC_CTX_MGR mgr, 64);
+        DECLARE_ALIGNED(ISAL_AES_CBC_CTX ctx, 16);
+        DECLARE_ALIGNED(uint8_t exp_keys[ISAL_CBC_MAX_KEYS_SIZE], 16) = { 0 };
+        ISAL_AES_CBC_CTX *ctx_out;
+        uint8_t buf[16] = { 0 };
+        uint8_t iv[16] = { 0 };
+        const char *name = "isal_aes_cbc_enc_ctx_mgr_init";
+
+        // test null manager
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_init(NULL, ISAL_CBC_128_BITS),
+                     ISAL_CRYPTO_ERR_NULL_MGR, name);
+
+        // test invalid key size
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_init(&mgr, (isal_cbc_key_size) 20),
+                     ISAL_CRYPTO_ERR_KEY_LEN, name);
+
+        // test valid params
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_init(&mgr, ISAL_CBC_128_BITS), ISAL_CRYPTO_ERR_NONE,
+                     name);
+
+        name = "isal_aes_cbc_enc_ctx_init";
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_init(NULL, exp_keys, iv), ISAL_CRYPTO_ERR_NULL_CTX, name);
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_init(&ctx, NULL, iv), ISAL_CRYPTO_ERR_NULL_EXP_KEY, name);
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_init(&ctx, exp_keys, NULL), ISAL_CRYPTO_ERR_NULL_IV,
+                     name);
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_init(&ctx, exp_keys, iv), ISAL_CRYPTO_ERR_NONE, name);
+
+        name = "isal_aes_cbc_enc_ctx_mgr_submit";
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_submit(NULL, &ctx, &ctx_out, buf, buf, 16),
+                     ISAL_CRYPTO_ERR_NULL_MGR, name);
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_submit(&mgr, NULL, &ctx_out, buf, buf, 16),
+                     ISAL_CRYPTO_ERR_NULL_CTX, name);
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_submit(&mgr, &ctx, NULL, buf, buf, 16),
+                     ISAL_CRYPTO_ERR_NULL_CTX, name);
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_submit(&mgr, &ctx, &ctx_out, NULL, buf, 16),
+                     ISAL_CRYPTO_ERR_NULL_SRC, name);
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, NULL, 16),
+                     ISAL_CRYPTO_ERR_NULL_DST, name);
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf, 15),
+                     ISAL_CRYPTO_ERR_CIPH_LEN, name);
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf, 16),
+                     ISAL_CRYPTO_ERR_NONE, name);
+
+        // test resubmit of a context being processed
+        if (ctx_out == NULL)
+                CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf, 16),
+                             ISAL_CRYPTO_ERR_ALREADY_PROCESSING, name);
+
+        name = "isal_aes_cbc_enc_ctx_mgr_flush";
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_flush(NULL, &ctx_out), ISAL_CRYPTO_ERR_NULL_MGR,
+                     name);
+        CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_flush(&mgr, NULL), ISAL_CRYPTO_ERR_NULL_CTX, name);
+        do {
+                CHECK_RETURN(isal_aes_cbc_enc_ctx_mgr_flush(&mgr, &ctx_out), ISAL_CRYPTO_ERR_NONE,
+                             name);
+        } while (ctx_out != NULL);
+
+        return 0;
+}
+
+static int
+test_aes_gcm_mb_api(void)
+{
+        DECLARE_ALIGNED(ISAL_AES_GCM_CTX_MGR mgr, 64);
+        DECLARE_ALIGNED(ISAL_AES_GCM_CTX ctx, 16);
+        struct isal_gcm_key_data gkey;
+        ISAL_AES_GCM_CTX *ctx_out;
+        uint8_t key[ISAL_GCM_128_KEY_LEN] = { 0 };
+        uint8_t buf[16] = { 0 };
+        uint8_t iv[ISAL_GCM_IV_LEN] = { 0 };
+        uint8_t aad[16] = { 0 };
+        uint8_t tag[ISAL_GCM_MAX_TAG_LEN];
+        const char *name = "isal_aes_gcm_ctx_mgr_init";
+
+        isal_aes_gcm_pre_128(key, &gkey);
+
+        // test null manager
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_init(NULL, ISAL_GCM_128_KEY_LEN),
+                     ISAL_CRYPTO_ERR_NULL_MGR, name);
+
+        // test invalid key length
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_init(&mgr, 24), ISAL_CRYPTO_ERR_KEY_LEN, name);
+
+        // test valid params
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_init(&mgr, ISAL_GCM_128_KEY_LEN), ISAL_CRYPTO_ERR_NONE,
+                     name);
+
+        name = "isal_aes_gcm_ctx_init";
+        CHECK_RETURN(isal_aes_gcm_ctx_init(NULL, &gkey, ISAL_AES_GCM_ENCRYPT),
+                     ISAL_CRYPTO_ERR_NULL_CTX, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_init(&ctx, NULL, ISAL_AES_GCM_ENCRYPT),
+                     ISAL_CRYPTO_ERR_NULL_EXP_KEY, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_init(&ctx, &gkey, (ISAL_AES_GCM_DIR) 2),
+                     ISAL_CRYPTO_ERR_INVALID_FLAGS, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_init(&ctx, &gkey, ISAL_AES_GCM_ENCRYPT),
+                     ISAL_CRYPTO_ERR_NONE, name);
+
+        name = "isal_aes_gcm_ctx_mgr_submit";
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_submit(NULL, &ctx, &ctx_out, buf, buf, 16, iv, aad, 16,
+                                                 tag, 16),
+                     ISAL_CRYPTO_ERR_NULL_MGR, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_submit(&mgr, NULL, &ctx_out, buf, buf, 16, iv, aad, 16,
+                                                 tag, 16),
+                     ISAL_CRYPTO_ERR_NULL_CTX, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_submit(&mgr, &ctx, NULL, buf, buf, 16, iv, aad, 16, tag,
+                                                 16),
+                     ISAL_CRYPTO_ERR_NULL_CTX, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_submit(&mgr, &ctx, &ctx_out, NULL, buf, 16, iv, aad, 16,
+                                                 tag, 16),
+                     ISAL_CRYPTO_ERR_NULL_DST, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, NULL, 16, iv, aad, 16,
+                                                 tag, 16),
+                     ISAL_CRYPTO_ERR_NULL_SRC, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf,
+                                                 ISAL_GCM_MAX_LEN + 1, iv, aad, 16, tag, 16),
+                     ISAL_CRYPTO_ERR_CIPH_LEN, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf, 16, NULL, aad, 16,
+                                                 tag, 16),
+                     ISAL_CRYPTO_ERR_NULL_IV, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf, 16, iv, NULL, 16,
+                                                 tag, 16),
+                     ISAL_CRYPTO_ERR_NULL_AAD, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf, 16, iv, aad, 16,
+                                                 NULL, 16),
+                     ISAL_CRYPTO_ERR_NULL_AUTH, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf, 16, iv, aad, 16,
+                                                 tag, 7),
+                     ISAL_CRYPTO_ERR_AUTH_TAG_LEN, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf, 16, iv, aad, 16,
+                                                 tag, 16),
+                     ISAL_CRYPTO_ERR_NONE, name);
+
+        // test resubmit of a context being processed
+        if (ctx_out == NULL)
+                CHECK_RETURN(isal_aes_gcm_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf, 16, iv,
+                                                         aad, 16, tag, 16),
+                             ISAL_CRYPTO_ERR_ALREADY_PROCESSING, name);
+
+        name = "isal_aes_gcm_ctx_mgr_flush";
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_flush(NULL, &ctx_out), ISAL_CRYPTO_ERR_NULL_MGR, name);
+        CHECK_RETURN(isal_aes_gcm_ctx_mgr_flush(&mgr, NULL), ISAL_CRYPTO_ERR_NULL_CTX, name);
+        do {
+                CHECK_RETURN(isal_aes_gcm_ctx_mgr_flush(&mgr, &ctx_out), ISAL_CRYPTO_ERR_NONE,
+                             name);
+        } while (ctx_out != NULL);
+
+        return 0;
+}
+
+static int
+test_aes_xts_mb_api(void)
+{
+        DECLARE_ALIGNED(ISAL_AES_XTS_CTX_MGR mgr, 64);
+        DECLARE_ALIGNED(ISAL_AES_XTS_CTX ctx, 16);
+        DECLARE_ALIGNED(uint8_t k1_exp[16 * 11], 16);
+        DECLARE_ALIGNED(uint8_t k2_exp[16 * 11], 16);
+        uint8_t key[ISAL_AES_XTS_128_KEY_LEN] = { 0 };
+        uint8_t key_dec[16 * 11];
+        uint8_t buf[16] = { 0 };
+        uint8_t tweak[ISAL_AES_XTS_TWEAK_LEN] = { 0 };
+        ISAL_AES_XTS_CTX *ctx_out;
+        const char *name = "isal_aes_xts_ctx_mgr_init";
+
+        isal_aes_keyexp_128(key, k1_exp, key_dec);
+        key[0] = 1;
+        isal_aes_keyexp_128(key, k2_exp, key_dec);
+
+        // test null manager
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_init(NULL, ISAL_AES_XTS_128_KEY_LEN,
+                                               ISAL_AES_XTS_ENCRYPT),
+                     ISAL_CRYPTO_ERR_NULL_MGR, name);
+
+        // test invalid key length
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_init(&mgr, 24, ISAL_AES_XTS_ENCRYPT),
+                     ISAL_CRYPTO_ERR_KEY_LEN, name);
+
+        // test invalid direction
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_init(&mgr, ISAL_AES_XTS_128_KEY_LEN,
+                                               (ISAL_AES_XTS_DIR) 2),
+                     ISAL_CRYPTO_ERR_INVALID_FLAGS, name);
+
+        // test valid params
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_init(&mgr, ISAL_AES_XTS_128_KEY_LEN,
+                                               ISAL_AES_XTS_ENCRYPT),
+                     ISAL_CRYPTO_ERR_NONE, name);
+
+        name = "isal_aes_xts_ctx_init";
+        CHECK_RETURN(isal_aes_xts_ctx_init(NULL, k2_exp, k1_exp), ISAL_CRYPTO_ERR_NULL_CTX, name);
+        CHECK_RETURN(isal_aes_xts_ctx_init(&ctx, NULL, k1_exp), ISAL_CRYPTO_ERR_NULL_EXP_KEY,
+                     name);
+        CHECK_RETURN(isal_aes_xts_ctx_init(&ctx, k2_exp, NULL), ISAL_CRYPTO_ERR_NULL_EXP_KEY,
+                     name);
+        CHECK_RETURN(isal_aes_xts_ctx_init(&ctx, k2_exp, k1_exp), ISAL_CRYPTO_ERR_NONE, name);
+
+        name = "isal_aes_xts_ctx_mgr_submit";
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_submit(NULL, &ctx, &ctx_out, buf, buf, 16, tweak),
+                     ISAL_CRYPTO_ERR_NULL_MGR, name);
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_submit(&mgr, NULL, &ctx_out, buf, buf, 16, tweak),
+                     ISAL_CRYPTO_ERR_NULL_CTX, name);
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_submit(&mgr, &ctx, NULL, buf, buf, 16, tweak),
+                     ISAL_CRYPTO_ERR_NULL_CTX, name);
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_submit(&mgr, &ctx, &ctx_out, NULL, buf, 16, tweak),
+                     ISAL_CRYPTO_ERR_NULL_DST, name);
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, NULL, 16, tweak),
+                     ISAL_CRYPTO_ERR_NULL_SRC, name);
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf,
+                                                 ISAL_AES_XTS_MIN_LEN - 1, tweak),
+                     ISAL_CRYPTO_ERR_CIPH_LEN, name);
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf,
+                                                 ISAL_AES_XTS_MAX_LEN + 1, tweak),
+                     ISAL_CRYPTO_ERR_CIPH_LEN, name);
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf, 16, NULL),
+                     ISAL_CRYPTO_ERR_XTS_NULL_TWEAK, name);
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf, 16, tweak),
+                     ISAL_CRYPTO_ERR_NONE, name);
+
+        // test resubmit of a context being processed
+        if (ctx_out == NULL)
+                CHECK_RETURN(isal_aes_xts_ctx_mgr_submit(&mgr, &ctx, &ctx_out, buf, buf, 16,
+                                                         tweak),
+                             ISAL_CRYPTO_ERR_ALREADY_PROCESSING, name);
+
+        name = "isal_aes_xts_ctx_mgr_flush";
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_flush(NULL, &ctx_out), ISAL_CRYPTO_ERR_NULL_MGR, name);
+        CHECK_RETURN(isal_aes_xts_ctx_mgr_flush(&mgr, NULL), ISAL_CRYPTO_ERR_NULL_CTX, name);
+        do {
+                CHECK_RETURN(isal_aes_xts_ctx_mgr_flush(&mgr, &ctx_out), ISAL_CRYPTO_ERR_NONE,
+                             name);
+        } while (ctx_out != NULL);
+
+        return 0;
+}
+
+static int
+test_aes_gcm_sha256_api(void)
+{
+        DECLARE_ALIGNED(ISAL_AES_GCM_SHA256_CTX_MGR mgr, 64);
+        DECLARE_ALIGNED(ISAL_AES_GCM_SHA256_CTX ctx, 16);
+        struct isal_gcm_key_data gkey;
+        ISAL_AES_GCM_SHA256_CTX *ctx_out;
+        uint8_t key[ISAL_GCM_128_KEY_LEN] = { 0 };
+        uint8_t buf[16] = { 0 };
+        uint8_t iv[ISAL_GCM_IV_LEN] = { 0 };
+        const char *name = "isal_aes_gcm_sha256_ctx_mgr_init";
+
+        isal_aes_gcm_pre_128(key, &gkey);
+
+        // test null manager
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_init(NULL, ISAL_GCM_128_KEY_LEN),
+                     ISAL_CRYPTO_ERR_NULL_MGR, name);
+
+        // test invalid key length
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_init(&mgr, 24), ISAL_CRYPTO_ERR_KEY_LEN, name);
+
+        // test valid params
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_init(&mgr, ISAL_GCM_128_KEY_LEN),
+                     ISAL_CRYPTO_ERR_NONE, name);
+
+        isal_hash_ctx_init(&ctx);
+        isal_aes_gcm_init_128(&gkey, &ctx.gcm, iv, NULL, 0);
+
+        name = "isal_aes_gcm_sha256_ctx_mgr_submit";
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_submit(NULL, &ctx, &ctx_out, &gkey, buf, buf, 16,
+                                                        ISAL_HASH_ENTIRE),
+                     ISAL_CRYPTO_ERR_NULL_MGR, name);
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_submit(&mgr, NULL, &ctx_out, &gkey, buf, buf, 16,
+                                                        ISAL_HASH_ENTIRE),
+                     ISAL_CRYPTO_ERR_NULL_CTX, name);
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_submit(&mgr, &ctx, NULL, &gkey, buf, buf, 16,
+                                                        ISAL_HASH_ENTIRE),
+                     ISAL_CRYPTO_ERR_NULL_CTX, name);
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_submit(&mgr, &ctx, &ctx_out, NULL, buf, buf, 16,
+                                                        ISAL_HASH_ENTIRE),
+                     ISAL_CRYPTO_ERR_NULL_EXP_KEY, name);
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_submit(&mgr, &ctx, &ctx_out, &gkey, NULL, buf, 16,
+                                                        ISAL_HASH_ENTIRE),
+                     ISAL_CRYPTO_ERR_NULL_DST, name);
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_submit(&mgr, &ctx, &ctx_out, &gkey, buf, NULL, 16,
+                                                        ISAL_HASH_ENTIRE),
+                     ISAL_CRYPTO_ERR_NULL_SRC, name);
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_submit(&mgr, &ctx, &ctx_out, &gkey, buf, buf,
+                                                        ISAL_GCM_MAX_LEN + 1, ISAL_HASH_ENTIRE),
+                     ISAL_CRYPTO_ERR_CIPH_LEN, name);
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_submit(&mgr, &ctx, &ctx_out, &gkey, buf, buf, 16,
+                                                        999),
+                     ISAL_CRYPTO_ERR_INVALID_FLAGS, name);
+
+        // test update of a completed context
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_submit(&mgr, &ctx, &ctx_out, &gkey, buf, buf, 16,
+                                                        ISAL_HASH_UPDATE),
+                     ISAL_CRYPTO_ERR_ALREADY_COMPLETED, name);
+
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_submit(&mgr, &ctx, &ctx_out, &gkey, buf, buf, 16,
+                                                        ISAL_HASH_ENTIRE),
+                     ISAL_CRYPTO_ERR_NONE, name);
+
+        // test resubmit of a context being processed
+        if (ctx_out == NULL)
+                CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_submit(&mgr, &ctx, &ctx_out, &gkey, buf,
+                                                                buf, 16, ISAL_HASH_ENTIRE),
+                             ISAL_CRYPTO_ERR_ALREADY_PROCESSING, name);
+
+        name = "isal_aes_gcm_sha256_ctx_mgr_flush";
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_flush(NULL, &ctx_out), ISAL_CRYPTO_ERR_NULL_MGR,
+                     name);
+        CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_flush(&mgr, NULL), ISAL_CRYPTO_ERR_NULL_CTX,
+                     name);
+        do {
+                CHECK_RETURN(isal_aes_gcm_sha256_ctx_mgr_flush(&mgr, &ctx_out),
+                             ISAL_CRYPTO_ERR_NONE, name);
+        } while (ctx_out != NULL);
+
+        return 0;
+}
+
 #endif /* SAFE_PARAM */
 
 int
@@ -459,6 +988,22 @@ main(void)
                 fail |= test_aes_xts_api(xts_exp_test_funcs[i].xts_func_ptr,
                                          xts_exp_test_funcs[i].func_name, 1);
         }
+        /* Test AES-XTS multi-sector API */
+        const struct test_func xts_sectors_test_funcs[] = {
+                { .xts_sectors_func_ptr = isal_aes_xts_enc_128_sectors,
+                  "isal_aes_xts_enc_128_sectors" },
+                { .xts_sectors_func_ptr = isal_aes_xts_enc_256_sectors,
+                  "isal_aes_xts_enc_256_sectors" },
+                { .xts_sectors_func_ptr = isal_aes_xts_dec_128_sectors,
+                  "isal_aes_xts_dec_128_sectors" },
+                { .xts_sectors_func_ptr = isal_aes_xts_dec_256_sectors,
+                  "isal_aes_xts_dec_256_sectors" },
+        };
+
+        for (int i = 0; i < DIM(xts_sectors_test_funcs); i++) {
+                fail |= test_aes_xts_sectors_api(xts_sectors_test_funcs[i].xts_sectors_func_ptr,
+                                                 xts_sectors_test_funcs[i].func_name);
+        }
 
         /* Test AES-GCM enc / dec API */
         const struct test_func gcm_test_funcs[] = {
@@ -488,6 +1033,20 @@ main(void)
                                               gcm_init_test_funcs[i].func_name);
         }
 
+        /* Test AES-GCM AAD update API */
+        const struct test_func gcm_aad_update_test_funcs[] = {
+                { .gcm_aad_update_func_ptr = isal_aes_gcm_aad_update_128,
+                  "isal_aes_gcm_aad_update_128" },
+                { .gcm_aad_update_func_ptr = isal_aes_gcm_aad_update_256,
+                  "isal_aes_gcm_aad_update_256" },
+        };
+
+        for (int i = 0; i < DIM(gcm_aad_update_test_funcs); i++) {
+                fail |= test_aes_gcm_aad_update_api(
+                        gcm_aad_update_test_funcs[i].gcm_aad_update_func_ptr,
+                        gcm_aad_update_test_funcs[i].func_name);
+        }
+
         /* Test AES-GCM update API */
         const struct test_func gcm_update_test_funcs[] = {
                 { .gcm_update_func_ptr = isal_aes_gcm_enc_128_update,
@@ -551,6 +1110,30 @@ main(void)
                                              gcm_pre_test_funcs[i].func_name);
         }
 
+        /* Test AES-GMAC and GHASH API */
+        fail |= test_aes_gmac_api(isal_aes_gmac_init_128, "isal_aes_gmac_init_128");
+        fail |= test_aes_gmac_api(isal_aes_gmac_init_256, "isal_aes_gmac_init_256");
+
+        /* Test AES-CTR API */
+        fail |= test_aes_ctr_api(isal_aes_ctr_128, "isal_aes_ctr_128", isal_aes_ctr_128_update,
+                                 "isal_aes_ctr_128_update");
+        fail |= test_aes_ctr_api(isal_aes_ctr_192, "isal_aes_ctr_192", isal_aes_ctr_192_update,
+                                 "isal_aes_ctr_192_update");
+        fail |= test_aes_ctr_api(isal_aes_ctr_256, "isal_aes_ctr_256", isal_aes_ctr_256_update,
+                                 "isal_aes_ctr_256_update");
+
+        /* Test AES-CBC multi-buffer API */
+        fail |= test_aes_cbc_mb_api();
+
+        /* Test AES-GCM multi-buffer API */
+        fail |= test_aes_gcm_mb_api();
+
+        /* Test AES-XTS multi-buffer API */
+        fail |= test_aes_xts_mb_api();
+
+        /* Test AES-GCM + SHA256 API */
+        fail |= test_aes_gcm_sha256_api();
+
         printf(fail ? "Fail\n" : "Pass\n");
 #else
         printf("Not Executed\n");
@@ -32,6 +32,7 @@
 #include "isal_crypto_api.h"
 #include "aes_xts.h"
 #include "aes_xts_internal.h"
+#include "aes_keyexp_internal.h"
 
 int
 isal_aes_xts_enc_128(const uint8_t *k2, const uint8_t *k1, const uint8_t *initial_tweak,
@@ -325,6 +326,207 @@ isal_aes_xts_dec_256_expanded_key(const uint8_t *k2, const uint8_t *k1,
         return 0;
 }
 
+typedef void (*xts_expanded_key_func)(uint8_t *k2, uint8_t *k1, uint8_t *TW_initial, uint64_t N,
+                                      const uint8_t *in, uint8_t *out);
+
+/*
+ * Process num_sectors consecutive sectors with pre-expanded keys. The initial
+ * tweak of each sector is its number as a 128-bit little-endian value, which the
+ * XTS functions encrypt with k2.
+ */
+static void
+xts_sectors(xts_expanded_key_func xts_func, uint8_t *k2_exp, uint8_t *k1_exp,
+            const uint64_t start_lba, const uint64_t sector_size, const uint64_t num_sectors,
+            const uint8_t *in, uint8_t *out)
+{
+        uint8_t tweak[16];
+        uint64_t i, lba;
+        int j;
+
+        for (i = 0; i < num_sectors; i++) {
+                lba = start_lba + i;
+                for (j = 0; j < 8; j++)
+                        tweak[j] = (uint8_t) (lba >> (8 * j));
+                // Carry into the upper 64 bits when the sector number wraps
+                tweak[8] = (lba < start_lba) ? 1 : 0;
+                memset(&tweak[9], 0, 7);
+
+                xts_func(k2_exp, k1_exp, tweak, sector_size, in, out);
+                in += sector_size;
+                out += sector_size;
+        }
+}
+
+#ifdef SAFE_PARAM
+static int
+xts_sectors_check_params(const uint8_t *k2, const uint8_t *k1, const uint64_t sector_size,
+                         const uint64_t num_sectors, const void *in, const void *out)
+{
+        if (k2 == NULL || k1 == NULL)
+                return ISAL_CRYPTO_ERR_NULL_KEY;
+
+        if (in == NULL)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+
+        if (out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+
+        if (sector_size < ISAL_AES_XTS_MIN_LEN || sector_size > ISAL_AES_XTS_MAX_LEN)
+                return ISAL_CRYPTO_ERR_CIPH_LEN;
+
+        if (num_sectors > UINT64_MAX / sector_size)
+                return ISAL_CRYPTO_ERR_CIPH_LEN;
+
+        return 0;
+}
+#endif
+
+int
+isal_aes_xts_enc_128_sectors(const uint8_t *k2, const uint8_t *k1, const uint64_t start_lba,
+                             const uint64_t sector_size, const uint64_t num_sectors,
+                             const void *in, void *out)
+{
+        // Expanded keys; the decryption schedule of k2 is not needed
+        DECLARE_ALIGNED(uint8_t expkey1_enc[16 * 11], 16);
+        DECLARE_ALIGNED(uint8_t expkey1_dec[16 * 11], 16);
+        DECLARE_ALIGNED(uint8_t expkey2_enc[16 * 11], 16);
+        DECLARE_ALIGNED(uint8_t null_key[16 * 11], 16);
+
+#ifdef SAFE_PARAM
+        const int ret = xts_sectors_check_params(k2, k1, sector_size, num_sectors, in, out);
+
+        if (ret != 0)
+                return ret;
+#endif
+
+#ifdef FIPS_MODE
+        /* Compare keys, before expansion (16 bytes) */
+        if (memcmp(k1, k2, 16) == 0)
+                return ISAL_CRYPTO_ERR_XTS_SAME_KEYS;
+
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        _aes_keyexp_128(k1, expkey1_enc, expkey1_dec);
+        _aes_keyexp_128(k2, expkey2_enc, null_key);
+
+        xts_sectors(_XTS_AES_128_enc_expanded_key, expkey2_enc, expkey1_enc, start_lba, sector_size,
+                    num_sectors, in, out);
+
+        return 0;
+}
+
+int
+isal_aes_xts_dec_128_sectors(const uint8_t *k2, const uint8_t *k1, const uint64_t start_lba,
+                             const uint64_t sector_size, const uint64_t num_sectors,
+                             const void *in, void *out)
+{
+        // Expanded keys; the decryption schedule of k2 is not needed
+        DECLARE_ALIGNED(uint8_t expkey1_enc[16 * 11], 16);
+        DECLARE_ALIGNED(uint8_t expkey1_dec[16 * 11], 16);
+        DECLARE_ALIGNED(uint8_t expkey2_enc[16 * 11], 16);
+        DECLARE_ALIGNED(uint8_t null_key[16 * 11], 16);
+
+#ifdef SAFE_PARAM
+        const int ret = xts_sectors_check_params(k2, k1, sector_size, num_sectors, in, out);
+
+        if (ret != 0)
+                return ret;
+#endif
+
+#ifdef FIPS_MODE
+        /* Compare keys, before expansion (16 bytes) */
+        if (memcmp(k1, k2, 16) == 0)
+                return ISAL_CRYPTO_ERR_XTS_SAME_KEYS;
+
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        _aes_keyexp_128(k1, expkey1_enc, expkey1_dec);
+        _aes_keyexp_128(k2, expkey2_enc, null_key);
+
+        // The tweak is always encrypted, so the encryption schedule of k2 is used
+        xts_sectors(_XTS_AES_128_dec_expanded_key, expkey2_enc, expkey1_dec, start_lba, sector_size,
+                    num_sectors, in, out);
+
+        return 0;
+}
+
+int
+isal_aes_xts_enc_256_sectors(const uint8_t *k2, const uint8_t *k1, const uint64_t start_lba,
+                             const uint64_t sector_size, const uint64_t num_sectors,
+                             const void *in, void *out)
+{
+        // Expanded keys; the decryption schedule of k2 is not needed
+        DECLARE_ALIGNED(uint8_t expkey1_enc[16 * 15], 16);
+        DECLARE_ALIGNED(uint8_t expkey1_dec[16 * 15], 16);
+        DECLARE_ALIGNED(uint8_t expkey2_enc[16 * 15], 16);
+        DECLARE_ALIGNED(uint8_t null_key[16 * 15], 16);
+
+#ifdef SAFE_PARAM
+        const int ret = xts_sectors_check_params(k2, k1, sector_size, num_sectors, in, out);
+
+        if (ret != 0)
+                return ret;
+#endif
+
+#ifdef FIPS_MODE
+        /* Compare keys, before expansion (32 bytes) */
+        if (memcmp(k1, k2, 32) == 0)
+                return ISAL_CRYPTO_ERR_XTS_SAME_KEYS;
+
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        _aes_keyexp_256(k1, expkey1_enc, expkey1_dec);
+        _aes_keyexp_256(k2, expkey2_enc, null_key);
+
+        xts_sectors(_XTS_AES_256_enc_expanded_key, expkey2_enc, expkey1_enc, start_lba, sector_size,
+                    num_sectors, in, out);
+
+        return 0;
+}
+
+int
+isal_aes_xts_dec_256_sectors(const uint8_t *k2, const uint8_t *k1, const uint64_t start_lba,
+                             const uint64_t sector_size, const uint64_t num_sectors,
+                             const void *in, void *out)
+{
+        // Expanded keys; the decryption schedule of k2 is not needed
+        DECLARE_ALIGNED(uint8_t expkey1_enc[16 * 15], 16);
+        DECLARE_ALIGNED(uint8_t expkey1_dec[16 * 15], 16);
+        DECLARE_ALIGNED(uint8_t expkey2_enc[16 * 15], 16);
+        DECLARE_ALIGNED(uint8_t null_key[16 * 15], 16);
+
+#ifdef SAFE_PARAM
+        const int ret = xts_sectors_check_params(k2, k1, sector_size, num_sectors, in, out);
+
+        if (ret != 0)
+                return ret;
+#endif
+
+#ifdef FIPS_MODE
+        /* Compare keys, before expansion (32 bytes) */
+        if (memcmp(k1, k2, 32) == 0)
+                return ISAL_CRYPTO_ERR_XTS_SAME_KEYS;
+
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        _aes_keyexp_256(k1, expkey1_enc, expkey1_dec);
+        _aes_keyexp_256(k2, expkey2_enc, null_key);
+
+        // The tweak is always encrypted, so the encryption schedule of k2 is used
+        xts_sectors(_XTS_AES_256_dec_expanded_key, expkey2_enc, expkey1_dec, start_lba, sector_size,
+                    num_sectors, in, out);
+
+        return 0;
+}
+
 void
 XTS_AES_128_enc(uint8_t *k2, uint8_t *k1, uint8_t *TW_initial, uint64_t N, const uint8_t *pt,
                 uint8_t *ct)
@@ -0,0 +1,140 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "isal_crypto_api.h"
+#include "aes_xts_mb.h"
+#include "aes_xts_mb_internal.h"
+
+int
+isal_aes_xts_ctx_mgr_init(ISAL_AES_XTS_CTX_MGR *mgr, const uint32_t key_len,
+                          const ISAL_AES_XTS_DIR dir)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (key_len != ISAL_AES_XTS_128_KEY_LEN && key_len != ISAL_AES_XTS_256_KEY_LEN)
+                return ISAL_CRYPTO_ERR_KEY_LEN;
+        if (dir != ISAL_AES_XTS_ENCRYPT && dir != ISAL_AES_XTS_DECRYPT)
+                return ISAL_CRYPTO_ERR_INVALID_FLAGS;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        _aes_xts_ctx_mgr_init(mgr, key_len, dir);
+
+        return 0;
+}
+
+int
+isal_aes_xts_ctx_init(ISAL_AES_XTS_CTX *ctx, const uint8_t *k2, const uint8_t *k1)
+{
+#ifdef SAFE_PARAM
+        if (ctx == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (k2 == NULL || k1 == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+#endif
+
+        ctx->job.k2 = k2;
+        ctx->job.k1 = k1;
+        ctx->job.len = 0;
+        ctx->job.status = ISAL_STS_COMPLETED;
+        ctx->status = ISAL_HASH_CTX_STS_COMPLETE;
+        ctx->error = ISAL_HASH_CTX_ERROR_NONE;
+
+        return 0;
+}
+
+int
+isal_aes_xts_ctx_mgr_submit(ISAL_AES_XTS_CTX_MGR *mgr, ISAL_AES_XTS_CTX *ctx_in,
+                            ISAL_AES_XTS_CTX **ctx_out, uint8_t *out, const uint8_t *in,
+                            const uint64_t len, const uint8_t *initial_tweak)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_in == NULL || ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+        if (in == NULL)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        if (len < ISAL_AES_XTS_MIN_LEN || len > ISAL_AES_XTS_MAX_LEN)
+                return ISAL_CRYPTO_ERR_CIPH_LEN;
+        if (initial_tweak == NULL)
+                return ISAL_CRYPTO_ERR_XTS_NULL_TWEAK;
+        if (ctx_in->job.k2 == NULL || ctx_in->job.k1 == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+#endif
+
+#ifdef FIPS_MODE
+        /* Compare entire expanded keys */
+        if (memcmp(ctx_in->job.k1, ctx_in->job.k2,
+                   ISAL_AES_XTS_ROUND_KEY_LEN * (mgr->mgr.num_rounds + 1)) == 0)
+                return ISAL_CRYPTO_ERR_XTS_SAME_KEYS;
+
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        *ctx_out = _aes_xts_ctx_mgr_submit(mgr, ctx_in, out, in, len, initial_tweak);
+
+#ifdef SAFE_PARAM
+        if (*ctx_out != NULL && (*ctx_out)->error != ISAL_HASH_CTX_ERROR_NONE) {
+                if ((*ctx_out)->error == ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING)
+                        return ISAL_CRYPTO_ERR_ALREADY_PROCESSING;
+        }
+#endif
+        return 0;
+}
+
+int
+isal_aes_xts_ctx_mgr_flush(ISAL_AES_XTS_CTX_MGR *mgr, ISAL_AES_XTS_CTX **ctx_out)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        *ctx_out = _aes_xts_ctx_mgr_flush(mgr);
+
+        return 0;
+}
@@ -0,0 +1,147 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f,vaes"))), apply_to = function)
+#elif defined(__ICC)
+#pragma intel optimization_parameter target_arch = CORE-AVX512
+#elif defined(__ICL)
+#pragma[intel] optimization_parameter target_arch = CORE-AVX512
+#elif (__GNUC__ >= 5)
+#pragma GCC target("avx512f,vaes")
+#endif
+
+#include <immintrin.h>
+#include "aes_cbc_mb_internal.h"
+
+#define CBC_MB_AVX512_LANES 16
+#define CBC_MB_AVX512_FOR_EACH_GROUP(M) M(0) M(1) M(2) M(3)
+
+/*
+ * Each ZMM register carries the CBC chains of 4 lanes, one per 128-bit slot.
+ * Round keys are interleaved by lane in args, so the keys of 4 lanes for one
+ * round are a single 64-byte load. Groups are unrolled by hand so the chaining
+ * values stay in registers.
+ */
+#define CBC_GROUP_DECLARE(g)                                                                       \
+        __m512i s##g = _mm512_loadu_si512((const void *) args->iv[4 * (g)]);
+
+#define CBC_GROUP_LOAD(g)                                                                          \
+        {                                                                                          \
+                __m512i pt = _mm512_castsi128_si512(                                               \
+                        _mm_loadu_si128((const __m128i *) (in[4 * (g)] + offset)));                \
+                pt = _mm512_inserti32x4(                                                           \
+                        pt, _mm_loadu_si128((const __m128i *) (in[4 * (g) + 1] + offset)), 1);     \
+                pt = _mm512_inserti32x4(                                                           \
+                        pt, _mm_loadu_si128((const __m128i *) (in[4 * (g) + 2] + offset)), 2);     \
+                pt = _mm512_inserti32x4(                                                           \
+                        pt, _mm_loadu_si128((const __m128i *) (in[4 * (g) + 3] + offset)), 3);     \
+                s##g = _mm512_ternarylogic_epi64(                                                  \
+                        s##g, pt, _mm512_loadu_si512((const void *) keys[0][4 * (g)]), 0x96);      \
+        }
+
+#define CBC_GROUP_ROUND(g)                                                                         \
+        s##g = _mm512_aesenc_epi128(s##g, _mm512_loadu_si512((const void *) keys[r][4 * (g)]));
+
+#define CBC_GROUP_LAST(g)                                                                          \
+        s##g = _mm512_aesenclast_epi128(                                                           \
+                s##g, _mm512_loadu_si512((const void *) keys[num_rounds][4 * (g)]));               \
+        _mm_storeu_si128((__m128i *) (out[4 * (g)] + offset), _mm512_castsi512_si128(s##g));      \
+        _mm_storeu_si128((__m128i *) (out[4 * (g) + 1] + offset),                                  \
+                         _mm512_extracti32x4_epi32(s##g, 1));                                      \
+        _mm_storeu_si128((__m128i *) (out[4 * (g) + 2] + offset),                                  \
+                         _mm512_extracti32x4_epi32(s##g, 2));                                      \
+        _mm_storeu_si128((__m128i *) (out[4 * (g) + 3] + offset),                                  \
+                         _mm512_extracti32x4_epi32(s##g, 3));
+
+#define CBC_GROUP_SAVE(g) _mm512_storeu_si512((void *) args->iv[4 * (g)], s##g);
+
+static inline void
+aes_cbc_enc_mb_x16_vaes_avx512(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks,
+                               const int num_rounds)
+{
+        const uint8_t(*keys)[ISAL_AES_CBC_MAX_LANES][ISAL_CBC_ROUND_KEY_LEN] = args->keys;
+        const uint8_t *in[CBC_MB_AVX512_LANES];
+        uint8_t *out[CBC_MB_AVX512_LANES];
+        uint64_t offset;
+        int i, r;
+
+        for (i = 0; i < CBC_MB_AVX512_LANES; i++) {
+                in[i] = args->in[i];
+                out[i] = args->out[i];
+        }
+
+        CBC_MB_AVX512_FOR_EACH_GROUP(CBC_GROUP_DECLARE)
+
+        for (offset = 0; offset < num_blocks * 16; offset += 16) {
+                CBC_MB_AVX512_FOR_EACH_GROUP(CBC_GROUP_LOAD)
+                for (r = 1; r < num_rounds; r++) {
+                        CBC_MB_AVX512_FOR_EACH_GROUP(CBC_GROUP_ROUND)
+                }
+                CBC_MB_AVX512_FOR_EACH_GROUP(CBC_GROUP_LAST)
+        }
+
+        CBC_MB_AVX512_FOR_EACH_GROUP(CBC_GROUP_SAVE)
+
+        for (i = 0; i < CBC_MB_AVX512_LANES; i++) {
+                args->in[i] = in[i] + num_blocks * 16;
+                args->out[i] = out[i] + num_blocks * 16;
+        }
+}
+
+void
+_aes_cbc_enc_128_mb_x16_vaes_avx512(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_cbc_enc_mb_x16_vaes_avx512(args, num_blocks, 10);
+}
+
+void
+_aes_cbc_enc_192_mb_x16_vaes_avx512(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_cbc_enc_mb_x16_vaes_avx512(args, num_blocks, 12);
+}
+
+void
+_aes_cbc_enc_256_mb_x16_vaes_avx512(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_cbc_enc_mb_x16_vaes_avx512(args, num_blocks, 14);
+}
+
+#define CBC_MB_CTX_MGR_INIT_FUNCTION   _aes_cbc_enc_ctx_mgr_init_avx512
+#define CBC_MB_CTX_MGR_SUBMIT_FUNCTION _aes_cbc_enc_ctx_mgr_submit_avx512
+#define CBC_MB_CTX_MGR_FLUSH_FUNCTION  _aes_cbc_enc_ctx_mgr_flush_avx512
+#define CBC_MB_ENC_128_FUNCTION        _aes_cbc_enc_128_mb_x16_vaes_avx512
+#define CBC_MB_ENC_192_FUNCTION        _aes_cbc_enc_192_mb_x16_vaes_avx512
+#define CBC_MB_ENC_256_FUNCTION        _aes_cbc_enc_256_mb_x16_vaes_avx512
+#define CBC_MB_LANES                   CBC_MB_AVX512_LANES
+#include "cbc_enc_mb_ctx_base.c"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
@@ -0,0 +1,271 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+/*
+ * AES-CBC encryption multi-buffer manager.
+ *
+ * Default functions are the base (single lane) version, which hands each job to
+ * the single-buffer CBC encrypt function. Vectorized versions are generated by
+ * the architecture files, which define the lane count and the lane kernels before
+ * including this file.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "aes_cbc_mb_internal.h"
+#include "aes_cbc_internal.h"
+#include "memcpy_inline.h"
+
+#ifndef CBC_MB_CTX_MGR_INIT_FUNCTION
+#define CBC_MB_CTX_MGR_INIT_FUNCTION   _aes_cbc_enc_ctx_mgr_init_base
+#define CBC_MB_CTX_MGR_SUBMIT_FUNCTION _aes_cbc_enc_ctx_mgr_submit_base
+#define CBC_MB_CTX_MGR_FLUSH_FUNCTION  _aes_cbc_enc_ctx_mgr_flush_base
+#define CBC_MB_ENC_128_FUNCTION        aes_cbc_enc_128_mb_x1_base
+#define CBC_MB_ENC_192_FUNCTION        aes_cbc_enc_192_mb_x1_base
+#define CBC_MB_ENC_256_FUNCTION        aes_cbc_enc_256_mb_x1_base
+#define CBC_MB_LANES                   1
+
+typedef int (*aes_cbc_enc_sb_func)(void *, uint8_t *, uint8_t *, void *, uint64_t);
+
+static void
+aes_cbc_enc_mb_x1_base(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks, const int num_rounds,
+                       aes_cbc_enc_sb_func enc)
+{
+        DECLARE_ALIGNED(uint8_t keys[ISAL_CBC_MAX_KEYS_SIZE], 16);
+        const uint64_t len = num_blocks * ISAL_CBC_ROUND_KEY_LEN;
+        int r;
+
+        for (r = 0; r <= num_rounds; r++)
+                memcpy_fixedlen(&keys[r * ISAL_CBC_ROUND_KEY_LEN], args->keys[r][0],
+                                ISAL_CBC_ROUND_KEY_LEN);
+
+        enc((void *) args->in[0], args->iv[0], keys, args->out[0], len);
+
+        memcpy_fixedlen(args->iv[0], args->out[0] + len - ISAL_CBC_IV_DATA_LEN,
+                        ISAL_CBC_IV_DATA_LEN);
+        args->in[0] += len;
+        args->out[0] += len;
+}
+
+static void
+aes_cbc_enc_128_mb_x1_base(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_cbc_enc_mb_x1_base(args, num_blocks, 10, _aes_cbc_enc_128);
+}
+
+static void
+aes_cbc_enc_192_mb_x1_base(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_cbc_enc_mb_x1_base(args, num_blocks, 12, _aes_cbc_enc_192);
+}
+
+static void
+aes_cbc_enc_256_mb_x1_base(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_cbc_enc_mb_x1_base(args, num_blocks, 14, _aes_cbc_enc_256);
+}
+#endif
+
+#define ISAL_AES_CBC_JOB_TO_CTX(job_ptr)                                                           \
+        ((ISAL_AES_CBC_CTX *) ((char *) (job_ptr) - offsetof(ISAL_AES_CBC_CTX, job)))
+
+static void
+cbc_mb_mgr_run_lanes(ISAL_AES_CBC_MB_JOB_MGR *state, uint64_t num_blocks)
+{
+        if (state->num_rounds == 10)
+                CBC_MB_ENC_128_FUNCTION(&state->args, num_blocks);
+        else if (state->num_rounds == 12)
+                CBC_MB_ENC_192_FUNCTION(&state->args, num_blocks);
+        else
+                CBC_MB_ENC_256_FUNCTION(&state->args, num_blocks);
+}
+
+static void
+cbc_mb_mgr_copy_lane(ISAL_AES_CBC_MB_JOB_MGR *state, const unsigned int dst,
+                     const unsigned int src)
+{
+        unsigned int r;
+
+        state->args.in[dst] = state->args.in[src];
+        state->args.out[dst] = state->args.out[src];
+        memcpy_fixedlen(state->args.iv[dst], state->args.iv[src], ISAL_CBC_IV_DATA_LEN);
+        for (r = 0; r <= state->num_rounds; r++)
+                memcpy_fixedlen(state->args.keys[r][dst], state->args.keys[r][src],
+                                ISAL_CBC_ROUND_KEY_LEN);
+}
+
+/*
+ * Run all lanes until the shortest job is done and return it.
+ * Lanes without a job must hold a copy of a used lane.
+ */
+static ISAL_AES_CBC_JOB *
+cbc_mb_mgr_complete_min_job(ISAL_AES_CBC_MB_JOB_MGR *state)
+{
+        ISAL_AES_CBC_JOB *job;
+        uint64_t min_len = UINT64_MAX;
+        unsigned int i, min_idx = 0;
+
+        for (i = 0; i < CBC_MB_LANES; i++) {
+                if (state->ldata[i].job_in_lane != NULL && state->lens[i] < min_len) {
+                        min_len = state->lens[i];
+                        min_idx = i;
+                }
+        }
+
+        if (min_len) {
+                cbc_mb_mgr_run_lanes(state, min_len);
+                for (i = 0; i < CBC_MB_LANES; i++)
+                        if (state->ldata[i].job_in_lane != NULL)
+                                state->lens[i] -= min_len;
+        }
+
+        job = state->ldata[min_idx].job_in_lane;
+        memcpy_fixedlen(job->iv, state->args.iv[min_idx], ISAL_CBC_IV_DATA_LEN);
+        job->status = ISAL_STS_COMPLETED;
+
+        state->ldata[min_idx].job_in_lane = NULL;
+        state->unused_lanes = (state->unused_lanes << 4) | min_idx;
+        state->num_lanes_inuse--;
+
+        return job;
+}
+
+static ISAL_AES_CBC_JOB *
+cbc_mb_mgr_submit(ISAL_AES_CBC_MB_JOB_MGR *state, ISAL_AES_CBC_JOB *job)
+{
+        const unsigned int lane = (unsigned int) (state->unused_lanes & 0xF);
+        unsigned int r;
+
+        state->unused_lanes >>= 4;
+        state->num_lanes_inuse++;
+        state->ldata[lane].job_in_lane = job;
+        state->lens[lane] = job->len;
+        state->args.in[lane] = job->in;
+        state->args.out[lane] = job->out;
+        memcpy_fixedlen(state->args.iv[lane], job->iv, ISAL_CBC_IV_DATA_LEN);
+        for (r = 0; r <= state->num_rounds; r++)
+                memcpy_fixedlen(state->args.keys[r][lane], &job->keys[r * ISAL_CBC_ROUND_KEY_LEN],
+                                ISAL_CBC_ROUND_KEY_LEN);
+        job->status = ISAL_STS_BEING_PROCESSED;
+
+        if (state->num_lanes_inuse < CBC_MB_LANES)
+                return NULL;
+
+        return cbc_mb_mgr_complete_min_job(state);
+}
+
+static ISAL_AES_CBC_JOB *
+cbc_mb_mgr_flush(ISAL_AES_CBC_MB_JOB_MGR *state)
+{
+        unsigned int i, valid = 0;
+
+        if (state->num_lanes_inuse == 0)
+                return NULL;
+
+        for (i = 0; i < CBC_MB_LANES; i++) {
+                if (state->ldata[i].job_in_lane != NULL) {
+                        valid = i;
+                        break;
+                }
+        }
+
+        // Unused lanes redo the work of a used lane: same input, keys, IV and output
+        for (i = 0; i < CBC_MB_LANES; i++)
+                if (state->ldata[i].job_in_lane == NULL)
+                        cbc_mb_mgr_copy_lane(state, i, valid);
+
+        return cbc_mb_mgr_complete_min_job(state);
+}
+
+void
+CBC_MB_CTX_MGR_INIT_FUNCTION(ISAL_AES_CBC_CTX_MGR *mgr, const isal_cbc_key_size key_size)
+{
+        ISAL_AES_CBC_MB_JOB_MGR *state = &mgr->mgr;
+        unsigned int j;
+
+        memset(state, 0, sizeof(*state));
+        for (j = CBC_MB_LANES; j > 0; j--)
+                state->unused_lanes = (state->unused_lanes << 4) | (j - 1);
+
+        if (key_size == ISAL_CBC_256_BITS)
+                state->num_rounds = ISAL_CBC_256_KEY_ROUNDS - 1;
+        else if (key_size == ISAL_CBC_192_BITS)
+                state->num_rounds = ISAL_CBC_192_KEY_ROUNDS - 1;
+        else
+                state->num_rounds = ISAL_CBC_128_KEY_ROUNDS - 1;
+}
+
+ISAL_AES_CBC_CTX *
+CBC_MB_CTX_MGR_SUBMIT_FUNCTION(ISAL_AES_CBC_CTX_MGR *mgr, ISAL_AES_CBC_CTX *ctx, const void *in,
+                               void *out, uint64_t len)
+{
+        ISAL_AES_CBC_JOB *job;
+
+        if (ctx->status & ISAL_HASH_CTX_STS_PROCESSING) {
+                // Cannot submit to a currently processing job.
+                ctx->error = ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING;
+                return ctx;
+        }
+        ctx->error = ISAL_HASH_CTX_ERROR_NONE;
+
+        ctx->job.in = (const uint8_t *) in;
+        ctx->job.out = (uint8_t *) out;
+        ctx->job.len = len / ISAL_CBC_ROUND_KEY_LEN;
+
+        // Nothing to encrypt, the IV is unchanged
+        if (ctx->job.len == 0) {
+                ctx->job.status = ISAL_STS_COMPLETED;
+                ctx->status = ISAL_HASH_CTX_STS_COMPLETE;
+                return ctx;
+        }
+
+        ctx->status = ISAL_HASH_CTX_STS_PROCESSING;
+
+        job = cbc_mb_mgr_submit(&mgr->mgr, &ctx->job);
+        if (job == NULL)
+                return NULL;
+
+        ctx = ISAL_AES_CBC_JOB_TO_CTX(job);
+        ctx->status = ISAL_HASH_CTX_STS_COMPLETE;
+        return ctx;
+}
+
+ISAL_AES_CBC_CTX *
+CBC_MB_CTX_MGR_FLUSH_FUNCTION(ISAL_AES_CBC_CTX_MGR *mgr)
+{
+        ISAL_AES_CBC_CTX *ctx;
+        ISAL_AES_CBC_JOB *job = cbc_mb_mgr_flush(&mgr->mgr);
+
+        if (job == NULL)
+                return NULL;
+
+        ctx = ISAL_AES_CBC_JOB_TO_CTX(job);
+        ctx->status = ISAL_HASH_CTX_STS_COMPLETE;
+        return ctx;
+}
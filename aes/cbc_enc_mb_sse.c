@@ -0,0 +1,118 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("aes,sse4.1"))), apply_to = function)
+#elif defined(__ICC)
+#pragma intel optimization_parameter target_arch = SSE4.1
+#elif defined(__ICL)
+#pragma[intel] optimization_parameter target_arch = SSE4.1
+#elif (__GNUC__ >= 5)
+#pragma GCC target("aes,sse4.1")
+#endif
+
+#include <immintrin.h>
+#include "aes_cbc_mb_internal.h"
+
+#define CBC_MB_SSE_LANES 4
+#define CBC_MB_SSE_FOR_EACH_LANE(M) M(0) M(1) M(2) M(3)
+
+/*
+ * CBC encryption is serial within a buffer; the 4 lanes are independent
+ * chains interleaved to hide the AESENC latency. Lanes are unrolled by hand so
+ * the chaining values stay in registers.
+ */
+#define CBC_LANE_DECLARE(l)                                                                        \
+        __m128i s##l = _mm_loadu_si128((const __m128i *) args->iv[l]);                             \
+        const uint8_t *in##l = args->in[l];                                                        \
+        uint8_t *out##l = args->out[l];
+#define CBC_LANE_LOAD(l)                                                                           \
+        s##l = _mm_xor_si128(s##l, _mm_loadu_si128((const __m128i *) (in##l + offset)));           \
+        s##l = _mm_xor_si128(s##l, _mm_loadu_si128((const __m128i *) keys[0][l]));
+#define CBC_LANE_ROUND(l)                                                                          \
+        s##l = _mm_aesenc_si128(s##l, _mm_loadu_si128((const __m128i *) keys[r][l]));
+#define CBC_LANE_LAST(l)                                                                           \
+        s##l = _mm_aesenclast_si128(s##l,                                                          \
+                                    _mm_loadu_si128((const __m128i *) keys[num_rounds][l]));       \
+        _mm_storeu_si128((__m128i *) (out##l + offset), s##l);
+#define CBC_LANE_SAVE(l)                                                                           \
+        _mm_storeu_si128((__m128i *) args->iv[l], s##l);                                           \
+        args->in[l] = in##l + num_blocks * 16;                                                     \
+        args->out[l] = out##l + num_blocks * 16;
+
+static inline void
+aes_cbc_enc_mb_x4_sse(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks, const int num_rounds)
+{
+        const uint8_t(*keys)[ISAL_AES_CBC_MAX_LANES][ISAL_CBC_ROUND_KEY_LEN] = args->keys;
+        uint64_t offset;
+        int r;
+
+        CBC_MB_SSE_FOR_EACH_LANE(CBC_LANE_DECLARE)
+
+        for (offset = 0; offset < num_blocks * 16; offset += 16) {
+                CBC_MB_SSE_FOR_EACH_LANE(CBC_LANE_LOAD)
+                for (r = 1; r < num_rounds; r++) {
+                        CBC_MB_SSE_FOR_EACH_LANE(CBC_LANE_ROUND)
+                }
+                CBC_MB_SSE_FOR_EACH_LANE(CBC_LANE_LAST)
+        }
+
+        CBC_MB_SSE_FOR_EACH_LANE(CBC_LANE_SAVE)
+}
+
+void
+_aes_cbc_enc_128_mb_x4_sse(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_cbc_enc_mb_x4_sse(args, num_blocks, 10);
+}
+
+void
+_aes_cbc_enc_192_mb_x4_sse(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_cbc_enc_mb_x4_sse(args, num_blocks, 12);
+}
+
+void
+_aes_cbc_enc_256_mb_x4_sse(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_cbc_enc_mb_x4_sse(args, num_blocks, 14);
+}
+
+#define CBC_MB_CTX_MGR_INIT_FUNCTION   _aes_cbc_enc_ctx_mgr_init_sse
+#define CBC_MB_CTX_MGR_SUBMIT_FUNCTION _aes_cbc_enc_ctx_mgr_submit_sse
+#define CBC_MB_CTX_MGR_FLUSH_FUNCTION  _aes_cbc_enc_ctx_mgr_flush_sse
+#define CBC_MB_ENC_128_FUNCTION        _aes_cbc_enc_128_mb_x4_sse
+#define CBC_MB_ENC_192_FUNCTION        _aes_cbc_enc_192_mb_x4_sse
+#define CBC_MB_ENC_256_FUNCTION        _aes_cbc_enc_256_mb_x4_sse
+#define CBC_MB_LANES                   CBC_MB_SSE_LANES
+#include "cbc_enc_mb_ctx_base.c"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
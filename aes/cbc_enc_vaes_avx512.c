@@ -0,0 +1,170 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("aes,avx512f,vaes"))), apply_to = function)
+#elif defined(__ICC)
+#pragma intel optimization_parameter target_arch = CORE-AVX512
+#elif defined(__ICL)
+#pragma[intel] optimization_parameter target_arch = CORE-AVX512
+#elif (__GNUC__ >= 5)
+#pragma GCC target("aes,avx512f,vaes")
+#endif
+
+#include <stdint.h>
+#include <immintrin.h>
+#include "aes_cbc.h"
+
+/*
+ * Single stream CBC encryption for VAES/AVX512 capable CPUs.
+ *
+ * Block j+1 enters the cipher as c[j] ^ p[j+1] ^ k[0]. AESENCLAST ends with a
+ * XOR of its round key, so using k[nr] ^ k[0] ^ p[j+1] as last round key for
+ * block j directly produces the state of block j+1, and the chaining XORs drop
+ * out of the serial dependency: every block costs exactly nr AES rounds of
+ * latency. c[j] is recovered off the critical path. The k[0] ^ p and
+ * k[0] ^ k[nr] ^ p terms are computed four blocks at a time in ZMM registers.
+ */
+
+/* Rounds 1 to nr - 1; nr is a constant once inlined so the branches fold away */
+#define CBC_ENC_ROUNDS(x, k, nr)                                                                   \
+        {                                                                                          \
+                x = _mm_aesenc_si128(x, k[1]);                                                     \
+                x = _mm_aesenc_si128(x, k[2]);                                                     \
+                x = _mm_aesenc_si128(x, k[3]);                                                     \
+                x = _mm_aesenc_si128(x, k[4]);                                                     \
+                x = _mm_aesenc_si128(x, k[5]);                                                     \
+                x = _mm_aesenc_si128(x, k[6]);                                                     \
+                x = _mm_aesenc_si128(x, k[7]);                                                     \
+                x = _mm_aesenc_si128(x, k[8]);                                                     \
+                x = _mm_aesenc_si128(x, k[9]);                                                     \
+                if ((nr) > 10) {                                                                   \
+                        x = _mm_aesenc_si128(x, k[10]);                                            \
+                        x = _mm_aesenc_si128(x, k[11]);                                            \
+                }                                                                                  \
+                if ((nr) > 12) {                                                                   \
+                        x = _mm_aesenc_si128(x, k[12]);                                            \
+                        x = _mm_aesenc_si128(x, k[13]);                                            \
+                }                                                                                  \
+        }
+
+static inline void
+aes_cbc_enc_vaes_avx512(const uint8_t *in, const uint8_t *iv, const uint8_t *keys, uint8_t *out,
+                        uint64_t len_bytes, const int nr)
+{
+        __m128i k[ISAL_CBC_256_KEY_ROUNDS];
+        __m128i x, t, pk;
+        __m512i k0_512, klast_512;
+        uint64_t j, n = len_bytes / ISAL_CBC_ROUND_KEY_LEN;
+        int r;
+
+        if (n == 0)
+                return;
+
+        for (r = 0; r <= nr; r++)
+                k[r] = _mm_loadu_si128((const __m128i *) (keys + r * ISAL_CBC_ROUND_KEY_LEN));
+        k0_512 = _mm512_broadcast_i32x4(k[0]);
+        klast_512 = _mm512_broadcast_i32x4(k[nr]);
+
+        // state of block 0
+        x = _mm_xor_si128(_mm_loadu_si128((const __m128i *) iv), k[0]);
+        x = _mm_xor_si128(x, _mm_loadu_si128((const __m128i *) in));
+
+        // 4 blocks per iteration, needs plaintext of block j + 4
+        for (j = 0; j + 4 < n; j += 4) {
+                const __m512i pn = _mm512_loadu_si512((const void *) (in + (j + 1) * 16));
+                const __m512i pk_512 = _mm512_xor_si512(pn, k0_512);
+                const __m512i pkl_512 = _mm512_xor_si512(pk_512, klast_512);
+
+                CBC_ENC_ROUNDS(x, k, nr);
+                t = _mm_aesenclast_si128(x, _mm512_castsi512_si128(pkl_512));
+                _mm_storeu_si128((__m128i *) (out + j * 16),
+                                 _mm_xor_si128(t, _mm512_castsi512_si128(pk_512)));
+                x = t;
+
+                CBC_ENC_ROUNDS(x, k, nr);
+                t = _mm_aesenclast_si128(x, _mm512_extracti32x4_epi32(pkl_512, 1));
+                _mm_storeu_si128((__m128i *) (out + (j + 1) * 16),
+                                 _mm_xor_si128(t, _mm512_extracti32x4_epi32(pk_512, 1)));
+                x = t;
+
+                CBC_ENC_ROUNDS(x, k, nr);
+                t = _mm_aesenclast_si128(x, _mm512_extracti32x4_epi32(pkl_512, 2));
+                _mm_storeu_si128((__m128i *) (out + (j + 2) * 16),
+                                 _mm_xor_si128(t, _mm512_extracti32x4_epi32(pk_512, 2)));
+                x = t;
+
+                CBC_ENC_ROUNDS(x, k, nr);
+                t = _mm_aesenclast_si128(x, _mm512_extracti32x4_epi32(pkl_512, 3));
+                _mm_storeu_si128((__m128i *) (out + (j + 3) * 16),
+                                 _mm_xor_si128(t, _mm512_extracti32x4_epi32(pk_512, 3)));
+                x = t;
+        }
+
+        for (; j + 1 < n; j++) {
+                pk = _mm_xor_si128(_mm_loadu_si128((const __m128i *) (in + (j + 1) * 16)), k[0]);
+
+                CBC_ENC_ROUNDS(x, k, nr);
+                t = _mm_aesenclast_si128(x, _mm_xor_si128(pk, k[nr]));
+                _mm_storeu_si128((__m128i *) (out + j * 16), _mm_xor_si128(t, pk));
+                x = t;
+        }
+
+        // last block
+        CBC_ENC_ROUNDS(x, k, nr);
+        _mm_storeu_si128((__m128i *) (out + j * 16), _mm_aesenclast_si128(x, k[nr]));
+}
+
+int
+_aes_cbc_enc_128_vaes_avx512(void *in, uint8_t *IV, uint8_t *keys, void *out, uint64_t len_bytes)
+{
+        aes_cbc_enc_vaes_avx512((const uint8_t *) in, IV, keys, (uint8_t *) out, len_bytes,
+                                ISAL_CBC_128_KEY_ROUNDS - 1);
+        return 0;
+}
+
+int
+_aes_cbc_enc_192_vaes_avx512(void *in, uint8_t *IV, uint8_t *keys, void *out, uint64_t len_bytes)
+{
+        aes_cbc_enc_vaes_avx512((const uint8_t *) in, IV, keys, (uint8_t *) out, len_bytes,
+                                ISAL_CBC_192_KEY_ROUNDS - 1);
+        return 0;
+}
+
+int
+_aes_cbc_enc_256_vaes_avx512(void *in, uint8_t *IV, uint8_t *keys, void *out, uint64_t len_bytes)
+{
+        aes_cbc_enc_vaes_avx512((const uint8_t *) in, IV, keys, (uint8_t *) out, len_bytes,
+                                ISAL_CBC_256_KEY_ROUNDS - 1);
+        return 0;
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
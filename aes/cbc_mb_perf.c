@@ -0,0 +1,193 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <aes_cbc.h>
+#include <aes_cbc_mb.h>
+#include <aes_keyexp.h>
+#include <test.h>
+#include "types.h"
+
+#ifndef GT_L3_CACHE
+#define GT_L3_CACHE 32 * 1024 * 1024 /* some number > last level cache */
+#endif
+
+#if !defined(COLD_TEST) && !defined(TEST_CUSTOM)
+// Cached test, loop many times over small dataset
+#define TEST_LEN      4 * 1024
+#define TEST_LOOPS    20000
+#define TEST_TYPE_STR "_warm"
+#elif defined(COLD_TEST)
+// Uncached test.  Pull from large mem base.
+#define TEST_LEN      (GT_L3_CACHE / TEST_BUFS)
+#define TEST_LOOPS    20
+#define TEST_TYPE_STR "_cold"
+#endif
+
+#define TEST_BUFS ISAL_AES_CBC_MAX_LANES
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+static isal_cbc_key_size const Ksize[] = { ISAL_CBC_128_BITS, ISAL_CBC_192_BITS,
+                                           ISAL_CBC_256_BITS };
+
+static uint8_t *plaintext[TEST_BUFS];
+static uint8_t *ciphertext[TEST_BUFS];
+static uint8_t *mb_ciphertext[TEST_BUFS];
+static struct isal_cbc_key_data key_data[TEST_BUFS];
+static uint8_t iv[TEST_BUFS][ISAL_CBC_IV_DATA_LEN];
+
+static void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        unsigned int i;
+        for (i = 0; i < size; i++)
+                *data++ = rand();
+}
+
+static int
+sb_cbc_enc(const isal_cbc_key_size k_size, const int i, uint8_t *out)
+{
+        if (k_size == ISAL_CBC_128_BITS)
+                return isal_aes_cbc_enc_128(plaintext[i], iv[i], key_data[i].enc_keys, out,
+                                            TEST_LEN);
+        if (k_size == ISAL_CBC_192_BITS)
+                return isal_aes_cbc_enc_192(plaintext[i], iv[i], key_data[i].enc_keys, out,
+                                            TEST_LEN);
+        return isal_aes_cbc_enc_256(plaintext[i], iv[i], key_data[i].enc_keys, out, TEST_LEN);
+}
+
+static int
+mb_cbc_enc(ISAL_AES_CBC_CTX_MGR *mgr, ISAL_AES_CBC_CTX *ctxpool)
+{
+        ISAL_AES_CBC_CTX *ctx;
+        int i;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                isal_aes_cbc_enc_ctx_init(&ctxpool[i], key_data[i].enc_keys, iv[i]);
+                if (isal_aes_cbc_enc_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, plaintext[i],
+                                                    mb_ciphertext[i], TEST_LEN) != 0)
+                        return 1;
+        }
+        do {
+                if (isal_aes_cbc_enc_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return 1;
+        } while (ctx != NULL);
+
+        return 0;
+}
+
+int
+main(void)
+{
+        ISAL_AES_CBC_CTX_MGR *mgr = NULL;
+        ISAL_AES_CBC_CTX *ctxpool = NULL;
+        uint8_t key[ISAL_CBC_256_BITS];
+        int i, k, t, ret = 1;
+
+        printf("AES-CBC multi-buffer encrypt perf, %d buffers of %d bytes\n", TEST_BUFS,
+               TEST_LEN);
+        srand(TEST_SEED);
+
+        if (posix_memalign((void **) &mgr, 64, sizeof(*mgr)) != 0 ||
+            posix_memalign((void **) &ctxpool, 16, sizeof(*ctxpool) * TEST_BUFS) != 0) {
+                printf("alloc error: Fail");
+                goto exit;
+        }
+        for (i = 0; i < TEST_BUFS; i++) {
+                plaintext[i] = malloc(TEST_LEN);
+                ciphertext[i] = malloc(TEST_LEN);
+                mb_ciphertext[i] = malloc(TEST_LEN);
+                if (plaintext[i] == NULL || ciphertext[i] == NULL || mb_ciphertext[i] == NULL) {
+                        printf("malloc error: Fail");
+                        goto exit;
+                }
+                mk_rand_data(plaintext[i], TEST_LEN);
+                mk_rand_data(iv[i], ISAL_CBC_IV_DATA_LEN);
+        }
+
+        for (k = 0; k < (int) (sizeof(Ksize) / sizeof(Ksize[0])); k++) {
+                struct perf start, stop;
+                const int kbits = (int) Ksize[k] * 8;
+
+                for (i = 0; i < TEST_BUFS; i++) {
+                        mk_rand_data(key, sizeof(key));
+                        if (Ksize[k] == ISAL_CBC_128_BITS)
+                                isal_aes_keyexp_128(key, key_data[i].enc_keys,
+                                                    key_data[i].dec_keys);
+                        else if (Ksize[k] == ISAL_CBC_192_BITS)
+                                isal_aes_keyexp_192(key, key_data[i].enc_keys,
+                                                    key_data[i].dec_keys);
+                        else
+                                isal_aes_keyexp_256(key, key_data[i].enc_keys,
+                                                    key_data[i].dec_keys);
+                }
+                if (isal_aes_cbc_enc_ctx_mgr_init(mgr, Ksize[k]) != 0)
+                        goto exit;
+
+                perf_start(&start);
+                for (t = 0; t < TEST_LOOPS; t++)
+                        for (i = 0; i < TEST_BUFS; i++)
+                                sb_cbc_enc(Ksize[k], i, ciphertext[i]);
+                perf_stop(&stop);
+                printf("aes_cbc_%d_enc_sb" TEST_TYPE_STR ": ", kbits);
+                perf_print(stop, start, (long long) TEST_LEN * TEST_BUFS * t);
+
+                perf_start(&start);
+                for (t = 0; t < TEST_LOOPS; t++)
+                        if (mb_cbc_enc(mgr, ctxpool) != 0)
+                                goto exit;
+                perf_stop(&stop);
+                printf("aes_cbc_%d_enc_mb" TEST_TYPE_STR ": ", kbits);
+                perf_print(stop, start, (long long) TEST_LEN * TEST_BUFS * t);
+
+                for (i = 0; i < TEST_BUFS; i++) {
+                        if (memcmp(ciphertext[i], mb_ciphertext[i], TEST_LEN) != 0) {
+                                printf("aes_cbc_%d multi-buffer mismatch: Fail\n", kbits);
+                                goto exit;
+                        }
+                }
+        }
+        ret = 0;
+
+exit:
+        for (i = 0; i < TEST_BUFS; i++) {
+                free(plaintext[i]);
+                free(ciphertext[i]);
+                free(mb_ciphertext[i]);
+        }
+        aligned_free(ctxpool);
+        aligned_free(mgr);
+
+        return ret;
+}
@@ -0,0 +1,252 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <aes_cbc.h>
+#include <aes_cbc_mb.h>
+#include <aes_keyexp.h>
+#include "types.h"
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+#ifndef RANDOMS
+#define RANDOMS 4
+#endif
+#define TEST_BUFS       37
+#define MAX_BLOCKS      300
+#define MAX_CHUNKS      4
+#define TEST_LEN        (MAX_BLOCKS * ISAL_CBC_ROUND_KEY_LEN)
+#define IN_PLACE_STRIDE 5 // every 5th stream is encrypted in place
+
+static isal_cbc_key_size const Ksize[] = { ISAL_CBC_128_BITS, ISAL_CBC_192_BITS,
+                                           ISAL_CBC_256_BITS };
+
+struct stream {
+        uint8_t *pt;
+        uint8_t *ct;
+        uint8_t *ref;
+        uint8_t key[ISAL_CBC_256_BITS];
+        uint8_t iv[ISAL_CBC_IV_DATA_LEN];
+        uint64_t chunk_len[MAX_CHUNKS]; // bytes per submit, may be 0
+        int num_chunks;
+        int next_chunk;
+        uint64_t offset;
+        int in_flight;
+};
+
+static struct isal_cbc_key_data key_data[TEST_BUFS];
+static struct stream streams[TEST_BUFS];
+
+static void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        uint32_t i;
+        for (i = 0; i < size; i++)
+                *data++ = rand();
+}
+
+static int
+ref_cbc_enc(const isal_cbc_key_size k_size, struct stream *s, const struct isal_cbc_key_data *kd,
+            const uint64_t len)
+{
+        if (k_size == ISAL_CBC_128_BITS)
+                return isal_aes_cbc_enc_128(s->pt, s->iv, kd->enc_keys, s->ref, len);
+        if (k_size == ISAL_CBC_192_BITS)
+                return isal_aes_cbc_enc_192(s->pt, s->iv, kd->enc_keys, s->ref, len);
+        return isal_aes_cbc_enc_256(s->pt, s->iv, kd->enc_keys, s->ref, len);
+}
+
+static int
+key_exp(const isal_cbc_key_size k_size, const uint8_t *key, struct isal_cbc_key_data *kd)
+{
+        if (k_size == ISAL_CBC_128_BITS)
+                return isal_aes_keyexp_128(key, kd->enc_keys, kd->dec_keys);
+        if (k_size == ISAL_CBC_192_BITS)
+                return isal_aes_keyexp_192(key, kd->enc_keys, kd->dec_keys);
+        return isal_aes_keyexp_256(key, kd->enc_keys, kd->dec_keys);
+}
+
+static void
+ctx_done(ISAL_AES_CBC_CTX *ctx)
+{
+        struct stream *s = &streams[(uintptr_t) ctx->user_data];
+
+        s->offset += s->chunk_len[s->next_chunk];
+        s->next_chunk++;
+        s->in_flight = 0;
+}
+
+static int
+run_test(ISAL_AES_CBC_CTX_MGR *mgr, ISAL_AES_CBC_CTX *ctxpool, const isal_cbc_key_size k_size)
+{
+        ISAL_AES_CBC_CTX *ctx;
+        uint64_t total;
+        int i, c, pending;
+
+        if (isal_aes_cbc_enc_ctx_mgr_init(mgr, k_size) != 0)
+                return 1;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                struct stream *s = &streams[i];
+
+                mk_rand_data(s->key, sizeof(s->key));
+                mk_rand_data(s->iv, sizeof(s->iv));
+                mk_rand_data(s->pt, TEST_LEN);
+                if (key_exp(k_size, s->key, &key_data[i]) != 0)
+                        return 1;
+
+                s->num_chunks = 1 + rand() % MAX_CHUNKS;
+                total = 0;
+                for (c = 0; c < s->num_chunks; c++) {
+                        s->chunk_len[c] =
+                                (rand() % (MAX_BLOCKS / MAX_CHUNKS + 1)) * ISAL_CBC_ROUND_KEY_LEN;
+                        total += s->chunk_len[c];
+                }
+                s->next_chunk = 0;
+                s->offset = 0;
+                s->in_flight = 0;
+
+                if (total != 0 && ref_cbc_enc(k_size, s, &key_data[i], total) != 0)
+                        return 1;
+                if (i % IN_PLACE_STRIDE == 0)
+                        memcpy(s->ct, s->pt, TEST_LEN);
+                else
+                        memset(s->ct, 0, TEST_LEN);
+
+                if (isal_aes_cbc_enc_ctx_init(&ctxpool[i], key_data[i].enc_keys, s->iv) != 0)
+                        return 1;
+                ctxpool[i].user_data = (void *) (uintptr_t) i;
+        }
+
+        do {
+                pending = 0;
+                for (i = 0; i < TEST_BUFS; i++) {
+                        struct stream *s = &streams[i];
+                        const uint8_t *src =
+                                (i % IN_PLACE_STRIDE == 0) ? s->ct : (const uint8_t *) s->pt;
+
+                        if (s->in_flight || s->next_chunk == s->num_chunks)
+                                continue;
+
+                        s->in_flight = 1;
+                        if (isal_aes_cbc_enc_ctx_mgr_submit(mgr, &ctxpool[i], &ctx,
+                                                            src + s->offset, s->ct + s->offset,
+                                                            s->chunk_len[s->next_chunk]) != 0)
+                                return 1;
+                        if (ctx != NULL)
+                                ctx_done(ctx);
+                        pending = 1;
+                }
+
+                if (isal_aes_cbc_enc_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return 1;
+                while (ctx != NULL) {
+                        ctx_done(ctx);
+                        if (isal_aes_cbc_enc_ctx_mgr_flush(mgr, &ctx) != 0)
+                                return 1;
+                }
+        } while (pending);
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                struct stream *s = &streams[i];
+
+                if (!isal_hash_ctx_complete(&ctxpool[i])) {
+                        printf("Stream %d not complete\n", i);
+                        return 1;
+                }
+                if (memcmp(s->ct, s->ref, s->offset) != 0) {
+                        printf("Stream %d ciphertext mismatch, len %lu\n", i,
+                               (unsigned long) s->offset);
+                        return 1;
+                }
+                // Chaining value must be the last ciphertext block
+                if (s->offset != 0 && memcmp(ctxpool[i].job.iv,
+                                             s->ref + s->offset - ISAL_CBC_IV_DATA_LEN,
+                                             ISAL_CBC_IV_DATA_LEN) != 0) {
+                        printf("Stream %d IV mismatch\n", i);
+                        return 1;
+                }
+        }
+        return 0;
+}
+
+int
+main(void)
+{
+        ISAL_AES_CBC_CTX_MGR *mgr = NULL;
+        ISAL_AES_CBC_CTX *ctxpool = NULL;
+        int i, k, fail = 0;
+
+        printf("AES-CBC multi-buffer test, %d sets of %d streams: ", RANDOMS, TEST_BUFS);
+        srand(TEST_SEED);
+
+        if (posix_memalign((void **) &mgr, 64, sizeof(*mgr)) != 0 ||
+            posix_memalign((void **) &ctxpool, 16, sizeof(*ctxpool) * TEST_BUFS) != 0) {
+                printf("alloc error: Fail");
+                return 1;
+        }
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                streams[i].pt = malloc(TEST_LEN);
+                streams[i].ct = malloc(TEST_LEN);
+                streams[i].ref = malloc(TEST_LEN);
+                if (streams[i].pt == NULL || streams[i].ct == NULL || streams[i].ref == NULL) {
+                        printf("malloc error: Fail");
+                        fail = 1;
+                        goto exit;
+                }
+        }
+
+        for (i = 0; i < RANDOMS; i++) {
+                for (k = 0; k < (int) (sizeof(Ksize) / sizeof(Ksize[0])); k++) {
+                        fail = run_test(mgr, ctxpool, Ksize[k]);
+                        if (fail) {
+                                printf("Key size %d: Fail\n", (int) Ksize[k] * 8);
+                                goto exit;
+                        }
+                        printf(".");
+                }
+        }
+        printf(" Pass\n");
+
+exit:
+        for (i = 0; i < TEST_BUFS; i++) {
+                free(streams[i].pt);
+                free(streams[i].ct);
+                free(streams[i].ref);
+        }
+        aligned_free(ctxpool);
+        aligned_free(mgr);
+
+        return fail;
+}
@@ -50,6 +50,10 @@ extern _aes_cbc_dec_128_vaes_avx512
 extern _aes_cbc_dec_192_vaes_avx512
 extern _aes_cbc_dec_256_vaes_avx512
 
+extern _aes_cbc_enc_128_vaes_avx512
+extern _aes_cbc_enc_192_vaes_avx512
+extern _aes_cbc_enc_256_vaes_avx512
+
 %include "multibinary.asm"
 
 ;;;;
@@ -82,12 +86,32 @@ mbin_dispatch_init7 _aes_cbc_dec_256, \
 	_aes_cbc_dec_256_avx, \
 	_aes_cbc_dec_256_vaes_avx512
 
-mbin_interface     _aes_cbc_enc_128
-mbin_dispatch_init _aes_cbc_enc_128, _aes_cbc_enc_128_x4, _aes_cbc_enc_128_x8, _aes_cbc_enc_128_x8
-mbin_interface     _aes_cbc_enc_192
-mbin_dispatch_init _aes_cbc_enc_192, _aes_cbc_enc_192_x4, _aes_cbc_enc_192_x8, _aes_cbc_enc_192_x8
-mbin_interface     _aes_cbc_enc_256
-mbin_dispatch_init _aes_cbc_enc_256, _aes_cbc_enc_256_x4, _aes_cbc_enc_256_x8, _aes_cbc_enc_256_x8
+mbin_interface      _aes_cbc_enc_128
+mbin_dispatch_init7 _aes_cbc_enc_128, \
+	_aes_cbc_enc_128_x4, \
+	_aes_cbc_enc_128_x4, \
+	_aes_cbc_enc_128_x8, \
+	_aes_cbc_enc_128_x8, \
+	_aes_cbc_enc_128_x8, \
+	_aes_cbc_enc_128_vaes_avx512
+
+mbin_interface      _aes_cbc_enc_192
+mbin_dispatch_init7 _aes_cbc_enc_192, \
+	_aes_cbc_enc_192_x4, \
+	_aes_cbc_enc_192_x4, \
+	_aes_cbc_enc_192_x8, \
+	_aes_cbc_enc_192_x8, \
+	_aes_cbc_enc_192_x8, \
+	_aes_cbc_enc_192_vaes_avx512
+
+mbin_interface      _aes_cbc_enc_256
+mbin_dispatch_init7 _aes_cbc_enc_256, \
+	_aes_cbc_enc_256_x4, \
+	_aes_cbc_enc_256_x4, \
+	_aes_cbc_enc_256_x8, \
+	_aes_cbc_enc_256_x8, \
+	_aes_cbc_enc_256_x8, \
+	_aes_cbc_enc_256_vaes_avx512
 
 
 
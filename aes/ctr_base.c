@@ -0,0 +1,89 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <string.h>
+#include "aes_cbc.h"
+#include "aes_cbc_internal.h"
+#include "aes_ctr.h"
+#include "aes_ctr_internal.h"
+
+typedef int (*aes_cbc_enc_func)(void *, uint8_t *, uint8_t *, void *, uint64_t);
+
+/*
+ * Generic version, without a dedicated AES kernel: a single block CBC
+ * encryption with a zero IV is the AES block cipher, used here to encrypt
+ * each counter block.
+ */
+static void
+aes_ctr_base(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+             uint64_t num_blocks, aes_cbc_enc_func cbc_enc)
+{
+        DECLARE_ALIGNED(uint8_t zero_iv[ISAL_AES_CTR_BLOCK_LEN], 16) = { 0 };
+        DECLARE_ALIGNED(uint8_t ctr[ISAL_AES_CTR_BLOCK_LEN], 16);
+        DECLARE_ALIGNED(uint8_t ks[ISAL_AES_CTR_BLOCK_LEN], 16);
+        uint64_t i;
+        int j;
+
+        memcpy(ctr, counter, ISAL_AES_CTR_BLOCK_LEN);
+
+        for (i = 0; i < num_blocks; i++) {
+                cbc_enc(ctr, zero_iv, (uint8_t *) keys, ks, ISAL_AES_CTR_BLOCK_LEN);
+                for (j = 0; j < ISAL_AES_CTR_BLOCK_LEN; j++)
+                        out[j] = in[j] ^ ks[j];
+                in += ISAL_AES_CTR_BLOCK_LEN;
+                out += ISAL_AES_CTR_BLOCK_LEN;
+
+                // Increment the big-endian counter
+                for (j = ISAL_AES_CTR_BLOCK_LEN - 1; j >= 0; j--)
+                        if (++ctr[j] != 0)
+                                break;
+        }
+        memset(ks, 0, sizeof(ks));
+}
+
+void
+_aes_ctr_128_base(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                  uint64_t num_blocks)
+{
+        aes_ctr_base(in, counter, keys, out, num_blocks, _aes_cbc_enc_128);
+}
+
+void
+_aes_ctr_192_base(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                  uint64_t num_blocks)
+{
+        aes_ctr_base(in, counter, keys, out, num_blocks, _aes_cbc_enc_192);
+}
+
+void
+_aes_ctr_256_base(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                  uint64_t num_blocks)
+{
+        aes_ctr_base(in, counter, keys, out, num_blocks, _aes_cbc_enc_256);
+}
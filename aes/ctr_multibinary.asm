@@ -0,0 +1,82 @@
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;  Copyright(c) 2026 Intel Corporation All rights reserved.
+;
+;  Redistribution and use in source and binary forms, with or without
+;  modification, are permitted provided that the following conditions
+;  are met:
+;    * Redistributions of source code must retain the above copyright
+;      notice, this list of conditions and the following disclaimer.
+;    * Redistributions in binary form must reproduce the above copyright
+;      notice, this list of conditions and the following disclaimer in
+;      the documentation and/or other materials provided with the
+;      distribution.
+;    * Neither the name of Intel Corporation nor the names of its
+;      contributors may be used to endorse or promote products derived
+;      from this software without specific prior written permission.
+;
+;  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+;  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+;  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+;  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+;  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+;  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+;  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+;  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+;  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+;  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+;  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+
+%include "reg_sizes.asm"
+
+default rel
+[bits 64]
+
+extern _aes_ctr_128_base
+extern _aes_ctr_192_base
+extern _aes_ctr_256_base
+
+extern _aes_ctr_128_sse
+extern _aes_ctr_192_sse
+extern _aes_ctr_256_sse
+
+extern _aes_ctr_128_avx
+extern _aes_ctr_192_avx
+extern _aes_ctr_256_avx
+
+extern _aes_ctr_128_vaes_avx512
+extern _aes_ctr_192_vaes_avx512
+extern _aes_ctr_256_vaes_avx512
+
+%include "multibinary.asm"
+
+;;;;
+; instantiate aes_ctr interfaces
+;;;;
+mbin_interface      _aes_ctr_128
+mbin_dispatch_init7 _aes_ctr_128, \
+	_aes_ctr_128_base, \
+	_aes_ctr_128_sse, \
+	_aes_ctr_128_avx, \
+	_aes_ctr_128_avx, \
+	_aes_ctr_128_avx, \
+	_aes_ctr_128_vaes_avx512
+
+mbin_interface      _aes_ctr_192
+mbin_dispatch_init7 _aes_ctr_192, \
+	_aes_ctr_192_base, \
+	_aes_ctr_192_sse, \
+	_aes_ctr_192_avx, \
+	_aes_ctr_192_avx, \
+	_aes_ctr_192_avx, \
+	_aes_ctr_192_vaes_avx512
+
+mbin_interface      _aes_ctr_256
+mbin_dispatch_init7 _aes_ctr_256, \
+	_aes_ctr_256_base, \
+	_aes_ctr_256_sse, \
+	_aes_ctr_256_avx, \
+	_aes_ctr_256_avx, \
+	_aes_ctr_256_avx, \
+	_aes_ctr_256_vaes_avx512
@@ -0,0 +1,157 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h> // for rand
+#include <string.h> // for memcmp
+#include <aes_ctr.h>
+#include <aes_keyexp.h>
+#include <test.h>
+#include "ossl_helper.h"
+#include "types.h"
+
+#ifndef GT_L3_CACHE
+#define GT_L3_CACHE 32 * 1024 * 1024 /* some number > last level cache */
+#endif
+
+#if !defined(COLD_TEST) && !defined(TEST_CUSTOM)
+// Cached test, loop many times over small dataset
+#define TEST_LEN      8 * 1024
+#define TEST_LOOPS    400000
+#define TEST_TYPE_STR "_warm"
+#elif defined(COLD_TEST)
+// Uncached test.  Pull from large mem base.
+#define TEST_LEN      (2 * GT_L3_CACHE)
+#define TEST_LOOPS    50
+#define TEST_TYPE_STR "_cold"
+#endif
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+#define MAX_EXP_KEY_LEN (16 * 15)
+
+typedef int (*isal_ctr_func)(const void *, const void *, const void *, void *, const uint64_t);
+typedef int (*ossl_ctr_func)(uint8_t *, uint8_t *, uint64_t, uint8_t *, uint8_t *);
+typedef int (*keyexp_func)(const uint8_t *, uint8_t *, uint8_t *);
+
+static unsigned char *plaintext = NULL;
+static unsigned char *ciphertext = NULL;
+static unsigned char *ossl_ciphertext = NULL;
+
+static uint8_t test_key[32];
+static uint8_t test_iv[ISAL_AES_CTR_IV_LEN];
+
+void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        unsigned int i;
+        for (i = 0; i < size; i++) {
+                *data++ = rand();
+        }
+}
+
+int
+aes_ctr_perf(const int key_bits, keyexp_func keyexp, isal_ctr_func isal_ctr,
+             ossl_ctr_func ossl_ctr)
+{
+        int i;
+        DECLARE_ALIGNED(uint8_t enc_keys[MAX_EXP_KEY_LEN], 16);
+        DECLARE_ALIGNED(uint8_t dec_keys[MAX_EXP_KEY_LEN], 16);
+
+        keyexp(test_key, enc_keys, dec_keys);
+
+        // Preload code cache and check results
+        isal_ctr(plaintext, test_iv, enc_keys, ciphertext, TEST_LEN);
+        ossl_ctr(test_key, test_iv, TEST_LEN, plaintext, ossl_ciphertext);
+        if (memcmp(ciphertext, ossl_ciphertext, TEST_LEN)) {
+                printf("ISA-L vs OpenSSL aes_ctr_%d mismatch\n", key_bits);
+                return 1;
+        }
+
+        {
+                struct perf start, stop;
+
+                perf_start(&start);
+                for (i = 0; i < TEST_LOOPS; i++) {
+                        isal_ctr(plaintext, test_iv, enc_keys, ciphertext, TEST_LEN);
+                }
+
+                perf_stop(&stop);
+                printf("ISA-L__aes_ctr_%d" TEST_TYPE_STR ":   ", key_bits);
+                perf_print(stop, start, (long long) TEST_LEN * i);
+        }
+        {
+                struct perf start, stop;
+
+                perf_start(&start);
+                for (i = 0; i < TEST_LOOPS; i++) {
+                        ossl_ctr(test_key, test_iv, TEST_LEN, plaintext, ossl_ciphertext);
+                }
+
+                perf_stop(&stop);
+                printf("OpenSSL_aes_ctr_%d" TEST_TYPE_STR ":  ", key_bits);
+                perf_print(stop, start, (long long) TEST_LEN * i);
+        }
+        printf("\n");
+
+        return 0;
+}
+
+int
+main(void)
+{
+        uint32_t OK = 0;
+
+        srand(TEST_SEED);
+
+        plaintext = malloc(TEST_LEN);
+        ciphertext = malloc(TEST_LEN);
+        ossl_ciphertext = malloc(TEST_LEN + ISAL_AES_CTR_BLOCK_LEN);
+        if ((NULL == plaintext) || (NULL == ciphertext) || (NULL == ossl_ciphertext)) {
+                printf("malloc of testsize:0x%x failed\n", TEST_LEN);
+                return 1;
+        }
+
+        mk_rand_data(plaintext, TEST_LEN);
+        mk_rand_data(test_key, sizeof(test_key));
+        mk_rand_data(test_iv, sizeof(test_iv));
+        printf("AES CTR ISA-L vs OpenSSL performance:\n");
+
+        OK += aes_ctr_perf(128, isal_aes_keyexp_128, isal_aes_ctr_128, openssl_aes_128_ctr);
+        OK += aes_ctr_perf(192, isal_aes_keyexp_192, isal_aes_ctr_192, openssl_aes_192_ctr);
+        OK += aes_ctr_perf(256, isal_aes_keyexp_256, isal_aes_ctr_256, openssl_aes_256_ctr);
+
+        free(plaintext);
+        free(ciphertext);
+        free(ossl_ciphertext);
+
+        return OK;
+}
@@ -0,0 +1,127 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+/*
+ * AES-CTR with AES-NI, 8 blocks in flight. Also built as the AVX version by
+ * ctr_avx.c, which defines the function names and target before including
+ * this file.
+ */
+#ifndef AES_CTR_128_FUNCTION
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("aes,sse4.1"))), apply_to = function)
+#elif defined(__ICC)
+#pragma intel optimization_parameter target_arch = SSE4.1
+#elif defined(__ICL)
+#pragma[intel] optimization_parameter target_arch = SSE4.1
+#elif (__GNUC__ >= 5)
+#pragma GCC target("aes,sse4.1")
+#endif
+
+#define AES_CTR_128_FUNCTION _aes_ctr_128_sse
+#define AES_CTR_192_FUNCTION _aes_ctr_192_sse
+#define AES_CTR_256_FUNCTION _aes_ctr_256_sse
+#endif
+
+#include <immintrin.h>
+#include "aes_ctr.h"
+#include "aes_ctr_internal.h"
+
+#define CTR_FOR_EACH_BLOCK(M) M(0) M(1) M(2) M(3) M(4) M(5) M(6) M(7)
+
+#define CTR_BLOCK_INIT(b)                                                                          \
+        __m128i x##b = _mm_shuffle_epi8(_mm_add_epi64(ctr_le, _mm_set_epi64x(0, b)), bswap);       \
+        x##b = _mm_xor_si128(x##b, k[0]);
+#define CTR_BLOCK_ROUND(b) x##b = _mm_aesenc_si128(x##b, k[r]);
+#define CTR_BLOCK_LAST(b)                                                                          \
+        x##b = _mm_aesenclast_si128(x##b, k[num_rounds]);                                          \
+        _mm_storeu_si128((__m128i *) (out + b * 16),                                               \
+                         _mm_xor_si128(x##b, _mm_loadu_si128((const __m128i *) (in + b * 16))));
+
+static inline void
+aes_ctr_aesni(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+              uint64_t num_blocks, const int num_rounds)
+{
+        const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        __m128i k[15]; // up to 14 rounds for AES-256
+        // Counter as a little-endian 128-bit value; only the low qword is incremented
+        __m128i ctr_le = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) counter), bswap);
+        int r;
+
+        for (r = 0; r <= num_rounds; r++)
+                k[r] = _mm_loadu_si128((const __m128i *) (keys + r * 16));
+
+        for (; num_blocks >= 8; num_blocks -= 8) {
+                CTR_FOR_EACH_BLOCK(CTR_BLOCK_INIT)
+                for (r = 1; r < num_rounds; r++) {
+                        CTR_FOR_EACH_BLOCK(CTR_BLOCK_ROUND)
+                }
+                CTR_FOR_EACH_BLOCK(CTR_BLOCK_LAST)
+
+                ctr_le = _mm_add_epi64(ctr_le, _mm_set_epi64x(0, 8));
+                in += 8 * 16;
+                out += 8 * 16;
+        }
+
+        for (; num_blocks > 0; num_blocks--) {
+                CTR_BLOCK_INIT(0)
+                for (r = 1; r < num_rounds; r++) {
+                        CTR_BLOCK_ROUND(0)
+                }
+                CTR_BLOCK_LAST(0)
+
+                ctr_le = _mm_add_epi64(ctr_le, _mm_set_epi64x(0, 1));
+                in += 16;
+                out += 16;
+        }
+}
+
+void
+AES_CTR_128_FUNCTION(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                     uint64_t num_blocks)
+{
+        aes_ctr_aesni(in, counter, keys, out, num_blocks, 10);
+}
+
+void
+AES_CTR_192_FUNCTION(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                     uint64_t num_blocks)
+{
+        aes_ctr_aesni(in, counter, keys, out, num_blocks, 12);
+}
+
+void
+AES_CTR_256_FUNCTION(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                     uint64_t num_blocks)
+{
+        aes_ctr_aesni(in, counter, keys, out, num_blocks, 14);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
@@ -0,0 +1,312 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+/*
+ * Run the NIST SP 800-38A AES-CTR vectors, then check that streaming updates
+ * of random lengths and counters wrapping past 64 and 128 bits give the same
+ * result as one block at a time.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <aes_ctr.h>
+#include <aes_keyexp.h>
+#include "types.h"
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+#define RANDOMS      200
+#define TEST_LEN     (8 * 1024 + 13)
+#define MAX_KEY_LEN  32
+#define EXP_KEYS_LEN (16 * 15)
+
+typedef int (*aes_ctr_func)(const void *, const void *, const void *, void *, const uint64_t);
+typedef int (*aes_ctr_update_func)(const void *, struct isal_aes_ctr_context_data *, void *,
+                                   const void *, const uint64_t);
+typedef int (*keyexp_func)(const uint8_t *, uint8_t *, uint8_t *);
+
+struct ctr_vector {
+        int key_bits;
+        const uint8_t *key;
+        const uint8_t *ct;
+        keyexp_func keyexp;
+        aes_ctr_func ctr;
+        aes_ctr_update_func update;
+};
+
+static const uint8_t sp800_38a_ctr_iv[] = {
+        0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+        0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+
+static const uint8_t sp800_38a_ctr_pt[] = {
+        0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+        0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+        0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+        0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+        0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+        0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+        0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+        0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+
+static const uint8_t sp800_38a_ctr_128_key[] = {
+        0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+        0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+
+static const uint8_t sp800_38a_ctr_128_ct[] = {
+        0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26,
+        0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+        0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff,
+        0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+        0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e,
+        0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+        0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1,
+        0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee
+};
+
+static const uint8_t sp800_38a_ctr_192_key[] = {
+        0x8e, 0x73, 0xb0, 0xf7, 0xda, 0x0e, 0x64, 0x52,
+        0xc8, 0x10, 0xf3, 0x2b, 0x80, 0x90, 0x79, 0xe5,
+        0x62, 0xf8, 0xea, 0xd2, 0x52, 0x2c, 0x6b, 0x7b
+};
+
+static const uint8_t sp800_38a_ctr_192_ct[] = {
+        0x1a, 0xbc, 0x93, 0x24, 0x17, 0x52, 0x1c, 0xa2,
+        0x4f, 0x2b, 0x04, 0x59, 0xfe, 0x7e, 0x6e, 0x0b,
+        0x09, 0x03, 0x39, 0xec, 0x0a, 0xa6, 0xfa, 0xef,
+        0xd5, 0xcc, 0xc2, 0xc6, 0xf4, 0xce, 0x8e, 0x94,
+        0x1e, 0x36, 0xb2, 0x6b, 0xd1, 0xeb, 0xc6, 0x70,
+        0xd1, 0xbd, 0x1d, 0x66, 0x56, 0x20, 0xab, 0xf7,
+        0x4f, 0x78, 0xa7, 0xf6, 0xd2, 0x98, 0x09, 0x58,
+        0x5a, 0x97, 0xda, 0xec, 0x58, 0xc6, 0xb0, 0x50
+};
+
+static const uint8_t sp800_38a_ctr_256_key[] = {
+        0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe,
+        0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
+        0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7,
+        0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4
+};
+
+static const uint8_t sp800_38a_ctr_256_ct[] = {
+        0x60, 0x1e, 0xc3, 0x13, 0x77, 0x57, 0x89, 0xa5,
+        0xb7, 0xa7, 0xf5, 0x04, 0xbb, 0xf3, 0xd2, 0x28,
+        0xf4, 0x43, 0xe3, 0xca, 0x4d, 0x62, 0xb5, 0x9a,
+        0xca, 0x84, 0xe9, 0x90, 0xca, 0xca, 0xf5, 0xc5,
+        0x2b, 0x09, 0x30, 0xda, 0xa2, 0x3d, 0xe9, 0x4c,
+        0xe8, 0x70, 0x17, 0xba, 0x2d, 0x84, 0x98, 0x8d,
+        0xdf, 0xc9, 0xc5, 0x8d, 0xb6, 0x7a, 0xad, 0xa6,
+        0x13, 0xc2, 0xdd, 0x08, 0x45, 0x79, 0x41, 0xa6
+};
+
+
+static const struct ctr_vector ctr_vectors[] = {
+        { 128, sp800_38a_ctr_128_key, sp800_38a_ctr_128_ct, isal_aes_keyexp_128, isal_aes_ctr_128,
+          isal_aes_ctr_128_update },
+        { 192, sp800_38a_ctr_192_key, sp800_38a_ctr_192_ct, isal_aes_keyexp_192, isal_aes_ctr_192,
+          isal_aes_ctr_192_update },
+        { 256, sp800_38a_ctr_256_key, sp800_38a_ctr_256_ct, isal_aes_keyexp_256, isal_aes_ctr_256,
+          isal_aes_ctr_256_update },
+};
+
+static void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        unsigned int i;
+        for (i = 0; i < size; i++) {
+                *data++ = rand();
+        }
+}
+
+static int
+check_data(const uint8_t *test, const uint8_t *expected, uint64_t len, const char *data_name)
+{
+        uint64_t a;
+
+        if (memcmp(test, expected, len) == 0)
+                return 0;
+
+        printf("  failed %s \t\t", data_name);
+        for (a = 0; a < len; a++) {
+                if (test[a] != expected[a]) {
+                        printf(" '%x' != '%x' at %llx of %llx\n", test[a], expected[a],
+                               (unsigned long long) a, (unsigned long long) len);
+                        break;
+                }
+        }
+        return 1;
+}
+
+/* Reference: one block per call, incrementing the big-endian counter here */
+static void
+ctr_by_block(const struct ctr_vector *v, const uint8_t *keys, const uint8_t *iv,
+             const uint8_t *in, uint8_t *out, uint64_t len)
+{
+        uint8_t ctr[ISAL_AES_CTR_BLOCK_LEN];
+        uint64_t i;
+        int j;
+
+        memcpy(ctr, iv, sizeof(ctr));
+        for (i = 0; i < len; i += ISAL_AES_CTR_BLOCK_LEN) {
+                const uint64_t n =
+                        (len - i) < ISAL_AES_CTR_BLOCK_LEN ? (len - i) : ISAL_AES_CTR_BLOCK_LEN;
+
+                v->ctr(in + i, ctr, keys, out + i, n);
+                for (j = ISAL_AES_CTR_BLOCK_LEN - 1; j >= 0; j--)
+                        if (++ctr[j] != 0)
+                                break;
+        }
+}
+
+static int
+test_std_vector(const struct ctr_vector *v)
+{
+        DECLARE_ALIGNED(uint8_t enc_keys[EXP_KEYS_LEN], 16);
+        DECLARE_ALIGNED(uint8_t dec_keys[EXP_KEYS_LEN], 16);
+        uint8_t out[sizeof(sp800_38a_ctr_pt)];
+        struct isal_aes_ctr_context_data ctx;
+        int OK = 0;
+        uint64_t split;
+
+        v->keyexp(v->key, enc_keys, dec_keys);
+
+        v->ctr(sp800_38a_ctr_pt, sp800_38a_ctr_iv, enc_keys, out, sizeof(out));
+        OK |= check_data(out, v->ct, sizeof(out), "SP 800-38A encrypt");
+
+        v->ctr(v->ct, sp800_38a_ctr_iv, enc_keys, out, sizeof(out));
+        OK |= check_data(out, sp800_38a_ctr_pt, sizeof(out), "SP 800-38A decrypt");
+
+        // Same vector split in two updates at every offset
+        for (split = 0; split <= sizeof(out); split++) {
+                isal_aes_ctr_init(&ctx, sp800_38a_ctr_iv);
+                v->update(enc_keys, &ctx, out, sp800_38a_ctr_pt, split);
+                v->update(enc_keys, &ctx, out + split, sp800_38a_ctr_pt + split,
+                          sizeof(out) - split);
+                isal_aes_ctr_finalize(&ctx);
+                OK |= check_data(out, v->ct, sizeof(out), "SP 800-38A split update");
+        }
+
+        return OK;
+}
+
+static int
+test_random_updates(const struct ctr_vector *v)
+{
+        DECLARE_ALIGNED(uint8_t enc_keys[EXP_KEYS_LEN], 16);
+        DECLARE_ALIGNED(uint8_t dec_keys[EXP_KEYS_LEN], 16);
+        uint8_t key[MAX_KEY_LEN], iv[ISAL_AES_CTR_IV_LEN];
+        uint8_t *pt, *ct, *ref;
+        struct isal_aes_ctr_context_data ctx;
+        int t, OK = 0;
+
+        pt = malloc(TEST_LEN);
+        ct = malloc(TEST_LEN);
+        ref = malloc(TEST_LEN);
+        if (pt == NULL || ct == NULL || ref == NULL) {
+                printf("malloc of testsize:0x%x failed\n", TEST_LEN);
+                OK = 1;
+                goto exit;
+        }
+
+        for (t = 0; t < RANDOMS; t++) {
+                uint64_t len = rand() % TEST_LEN, done = 0;
+
+                mk_rand_data(key, sizeof(key));
+                mk_rand_data(iv, sizeof(iv));
+                mk_rand_data(pt, TEST_LEN);
+                // Place the counter near a 64-bit or 128-bit wrap every few runs
+                if (t % 4 == 1)
+                        memset(iv + 8, 0xff, 7);
+                else if (t % 4 == 2)
+                        memset(iv, 0xff, ISAL_AES_CTR_IV_LEN - 1);
+                v->keyexp(key, enc_keys, dec_keys);
+
+                ctr_by_block(v, enc_keys, iv, pt, ref, len);
+
+                v->ctr(pt, iv, enc_keys, ct, len);
+                OK |= check_data(ct, ref, len, "one call");
+
+                isal_aes_ctr_init(&ctx, iv);
+                while (done < len) {
+                        uint64_t n = rand() % 300;
+
+                        if (n > len - done)
+                                n = len - done;
+                        v->update(enc_keys, &ctx, ct + done, pt + done, n);
+                        done += n;
+                }
+                OK |= check_data(ct, ref, len, "random updates");
+                if (ctx.in_length != len) {
+                        printf("  failed in_length %llu != %llu\n",
+                               (unsigned long long) ctx.in_length, (unsigned long long) len);
+                        OK = 1;
+                }
+                isal_aes_ctr_finalize(&ctx);
+
+                // In-place
+                memcpy(ct, pt, len);
+                v->ctr(ct, iv, enc_keys, ct, len);
+                OK |= check_data(ct, ref, len, "in-place");
+
+                if (OK)
+                        break;
+        }
+
+exit:
+        free(pt);
+        free(ct);
+        free(ref);
+
+        return OK;
+}
+
+int
+main(void)
+{
+        uint32_t OK = 0;
+        unsigned int i;
+
+        srand(TEST_SEED);
+
+        for (i = 0; i < sizeof(ctr_vectors) / sizeof(ctr_vectors[0]); i++) {
+                printf("AES-CTR-%d: ", ctr_vectors[i].key_bits);
+                OK |= test_std_vector(&ctr_vectors[i]);
+                OK |= test_random_updates(&ctr_vectors[i]);
+                printf(".\n");
+        }
+
+        printf(0 == OK ? "Pass\n" : "Fail\n");
+        return OK;
+}
@@ -0,0 +1,134 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("aes,avx512f,avx512bw,vaes"))),               \
+                             apply_to = function)
+#elif defined(__ICC)
+#pragma intel optimization_parameter target_arch = CORE-AVX512
+#elif defined(__ICL)
+#pragma[intel] optimization_parameter target_arch = CORE-AVX512
+#elif (__GNUC__ >= 5)
+#pragma GCC target("aes,avx512f,avx512bw,vaes")
+#endif
+
+#include <immintrin.h>
+#include "aes_ctr.h"
+#include "aes_ctr_internal.h"
+
+/*
+ * AES-CTR with VAES: 16 blocks in flight, 4 per ZMM register. Counter blocks
+ * are built by adding the block index to the little-endian counter and byte
+ * swapping back, 4 at a time.
+ */
+#define CTR_FOR_EACH_GROUP(M) M(0) M(1) M(2) M(3)
+
+#define CTR_GROUP_INIT(g)                                                                          \
+        __m512i x##g = _mm512_shuffle_epi8(                                                        \
+                _mm512_add_epi64(ctr_le, _mm512_set_epi64(0, 4 * g + 3, 0, 4 * g + 2, 0,          \
+                                                          4 * g + 1, 0, 4 * g)),                   \
+                bswap);                                                                            \
+        x##g = _mm512_xor_si512(x##g, k[0]);
+#define CTR_GROUP_ROUND(g) x##g = _mm512_aesenc_epi128(x##g, k[r]);
+#define CTR_GROUP_LAST(g)                                                                          \
+        x##g = _mm512_aesenclast_epi128(x##g, k[num_rounds]);                                      \
+        _mm512_storeu_si512((void *) (out + g * 64),                                               \
+                            _mm512_xor_si512(x##g, _mm512_loadu_si512((const void *) (in + g * 64))));
+
+static inline void
+aes_ctr_vaes_avx512(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                    uint64_t num_blocks, const int num_rounds)
+{
+        const __m512i bswap = _mm512_broadcast_i32x4(
+                _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        __m512i k[15]; // up to 14 rounds for AES-256
+        // Counter as a little-endian 128-bit value; only the low qword is incremented
+        __m512i ctr_le = _mm512_shuffle_epi8(
+                _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *) counter)), bswap);
+        int r;
+
+        for (r = 0; r <= num_rounds; r++)
+                k[r] = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *) (keys + r * 16)));
+
+        for (; num_blocks >= 16; num_blocks -= 16) {
+                CTR_FOR_EACH_GROUP(CTR_GROUP_INIT)
+                for (r = 1; r < num_rounds; r++) {
+                        CTR_FOR_EACH_GROUP(CTR_GROUP_ROUND)
+                }
+                CTR_FOR_EACH_GROUP(CTR_GROUP_LAST)
+
+                ctr_le = _mm512_add_epi64(ctr_le, _mm512_set_epi64(0, 16, 0, 16, 0, 16, 0, 16));
+                in += 16 * 16;
+                out += 16 * 16;
+        }
+
+        // Remaining 1 to 15 blocks, 4 at a time with masked loads and stores
+        while (num_blocks > 0) {
+                const uint64_t n = num_blocks < 4 ? num_blocks : 4;
+                const __mmask64 mask = (n == 4) ? ~(__mmask64) 0 : ((__mmask64) 1 << (n * 16)) - 1;
+
+                CTR_GROUP_INIT(0)
+                for (r = 1; r < num_rounds; r++) {
+                        CTR_GROUP_ROUND(0)
+                }
+                x0 = _mm512_aesenclast_epi128(x0, k[num_rounds]);
+                _mm512_mask_storeu_epi8(
+                        out, mask, _mm512_xor_si512(x0, _mm512_maskz_loadu_epi8(mask, in)));
+
+                ctr_le = _mm512_add_epi64(ctr_le, _mm512_set_epi64(0, 4, 0, 4, 0, 4, 0, 4));
+                in += n * 16;
+                out += n * 16;
+                num_blocks -= n;
+        }
+}
+
+void
+_aes_ctr_128_vaes_avx512(const uint8_t *in, const uint8_t *counter, const uint8_t *keys,
+                         uint8_t *out, uint64_t num_blocks)
+{
+        aes_ctr_vaes_avx512(in, counter, keys, out, num_blocks, 10);
+}
+
+void
+_aes_ctr_192_vaes_avx512(const uint8_t *in, const uint8_t *counter, const uint8_t *keys,
+                         uint8_t *out, uint64_t num_blocks)
+{
+        aes_ctr_vaes_avx512(in, counter, keys, out, num_blocks, 12);
+}
+
+void
+_aes_ctr_256_vaes_avx512(const uint8_t *in, const uint8_t *counter, const uint8_t *keys,
+                         uint8_t *out, uint64_t num_blocks)
+{
+        aes_ctr_vaes_avx512(in, counter, keys, out, num_blocks, 14);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
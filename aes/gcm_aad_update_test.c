@@ -0,0 +1,228 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <aes_gcm.h>
+#include "ossl_helper.h"
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+#define MAX_AAD_LEN  (2 * 1024 + 64)
+#define MAX_TEST_LEN (4 * 1024 + 64)
+#define RANDOMS      200
+
+typedef int (*gcm_init_func)(const struct isal_gcm_key_data *, struct isal_gcm_context_data *,
+                             const uint8_t *, const uint8_t *, const uint64_t);
+typedef int (*gcm_aad_update_func)(const struct isal_gcm_key_data *,
+                                   struct isal_gcm_context_data *, const uint8_t *,
+                                   const uint64_t);
+typedef int (*gcm_update_func)(const struct isal_gcm_key_data *, struct isal_gcm_context_data *,
+                               uint8_t *, const uint8_t *, const uint64_t);
+typedef int (*gcm_finalize_func)(const struct isal_gcm_key_data *,
+                                 struct isal_gcm_context_data *, uint8_t *, const uint64_t);
+typedef int (*gcm_pre_func)(const void *, struct isal_gcm_key_data *);
+typedef int (*ossl_gcm_func)(uint8_t *, uint8_t *, uint64_t, uint8_t *, uint64_t, uint8_t *,
+                             uint64_t, uint8_t *, uint64_t, uint8_t *);
+
+struct gcm_funcs {
+        int key_len;
+        gcm_pre_func pre;
+        gcm_init_func init;
+        gcm_aad_update_func aad_update;
+        gcm_update_func enc_update;
+        gcm_update_func dec_update;
+        gcm_finalize_func enc_finalize;
+        gcm_finalize_func dec_finalize;
+        ossl_gcm_func ossl_enc;
+};
+
+static const struct gcm_funcs gcm128_funcs = {
+        ISAL_GCM_128_KEY_LEN,          isal_aes_gcm_pre_128,
+        isal_aes_gcm_init_128,         isal_aes_gcm_aad_update_128,
+        isal_aes_gcm_enc_128_update,   isal_aes_gcm_dec_128_update,
+        isal_aes_gcm_enc_128_finalize, isal_aes_gcm_dec_128_finalize,
+        openssl_aes_gcm_enc,
+};
+
+static const struct gcm_funcs gcm256_funcs = {
+        ISAL_GCM_256_KEY_LEN,          isal_aes_gcm_pre_256,
+        isal_aes_gcm_init_256,         isal_aes_gcm_aad_update_256,
+        isal_aes_gcm_enc_256_update,   isal_aes_gcm_dec_256_update,
+        isal_aes_gcm_enc_256_finalize, isal_aes_gcm_dec_256_finalize,
+        openssl_aes_256_gcm_enc,
+};
+
+static void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        uint32_t i;
+
+        for (i = 0; i < size; i++)
+                *data++ = rand();
+}
+
+/* Random piece length, biased towards sub-block fragments */
+static uint64_t
+rand_piece(uint64_t left)
+{
+        uint64_t piece = rand() % (left + 1);
+
+        if (rand() & 1)
+                piece %= 2 * ISAL_GCM_BLOCK_LEN;
+        return piece;
+}
+
+/*
+ * Start the message with a block multiple prefix of the AAD passed to init,
+ * stream the rest of the AAD and the message in random sized pieces.
+ */
+static int
+gcm_stream(const struct gcm_funcs *f, const struct isal_gcm_key_data *gkey, int dec,
+           const uint8_t *iv, const uint8_t *aad, uint64_t aad_len, uint8_t *out,
+           const uint8_t *in, uint64_t len, uint8_t *tag)
+{
+        struct isal_gcm_context_data gctx;
+        const gcm_update_func update = dec ? f->dec_update : f->enc_update;
+        uint64_t done = (rand() % (aad_len + 1)) & ~(uint64_t) (ISAL_GCM_BLOCK_LEN - 1);
+        int ret;
+
+        ret = f->init(gkey, &gctx, iv, aad, done);
+        while (ret == 0 && done < aad_len) {
+                const uint64_t piece = rand_piece(aad_len - done);
+
+                ret = f->aad_update(gkey, &gctx, aad + done, piece);
+                done += piece;
+        }
+
+        done = 0;
+        while (ret == 0 && done < len) {
+                const uint64_t piece = rand_piece(len - done);
+
+                ret = update(gkey, &gctx, out + done, in + done, piece);
+                done += piece;
+        }
+        if (ret != 0)
+                return ret;
+
+        if (dec)
+                return f->dec_finalize(gkey, &gctx, tag, ISAL_GCM_MAX_TAG_LEN);
+        return f->enc_finalize(gkey, &gctx, tag, ISAL_GCM_MAX_TAG_LEN);
+}
+
+static int
+test_gcm_aad_update(const struct gcm_funcs *f)
+{
+        struct isal_gcm_key_data gkey;
+        uint8_t key[ISAL_GCM_256_KEY_LEN], iv[ISAL_GCM_IV_LEN];
+        uint8_t tag[ISAL_GCM_MAX_TAG_LEN], ref_tag[ISAL_GCM_MAX_TAG_LEN];
+        uint8_t *aad = NULL, *pt = NULL, *ct = NULL, *ref_ct = NULL;
+        int errors = 0;
+        int t;
+
+        aad = malloc(MAX_AAD_LEN);
+        pt = malloc(MAX_TEST_LEN);
+        ct = malloc(MAX_TEST_LEN);
+        ref_ct = malloc(MAX_TEST_LEN);
+        if (aad == NULL || pt == NULL || ct == NULL || ref_ct == NULL) {
+                printf("alloc error: Fail");
+                errors = 1;
+                goto exit;
+        }
+
+        printf("AES-%d-GCM streamed AAD tests:", f->key_len * 8);
+        for (t = 0; t < RANDOMS; t++) {
+                const uint64_t aad_len = (t < 64) ? t : rand() % MAX_AAD_LEN;
+                const uint64_t len = rand() % MAX_TEST_LEN;
+
+                mk_rand_data(key, sizeof(key));
+                mk_rand_data(iv, sizeof(iv));
+                mk_rand_data(aad, (uint32_t) aad_len);
+                mk_rand_data(pt, (uint32_t) len);
+                f->pre(key, &gkey);
+
+                f->ossl_enc(key, iv, sizeof(iv), aad, aad_len, ref_tag, sizeof(ref_tag), pt, len,
+                            ref_ct);
+
+                if (gcm_stream(f, &gkey, 0, iv, aad, aad_len, ct, pt, len, tag) != 0 ||
+                    memcmp(ct, ref_ct, len) != 0 || memcmp(tag, ref_tag, sizeof(tag)) != 0) {
+                        printf("\n  aad_len %llu len %llu: encrypt mismatch",
+                               (unsigned long long) aad_len, (unsigned long long) len);
+                        errors++;
+                }
+
+                memset(tag, 0, sizeof(tag));
+                if (gcm_stream(f, &gkey, 1, iv, aad, aad_len, ct, ref_ct, len, tag) != 0 ||
+                    memcmp(ct, pt, len) != 0 || memcmp(tag, ref_tag, sizeof(tag)) != 0) {
+                        printf("\n  aad_len %llu len %llu: decrypt mismatch",
+                               (unsigned long long) aad_len, (unsigned long long) len);
+                        errors++;
+                }
+                if (t % 20 == 0)
+                        printf(".");
+        }
+        printf("\n");
+
+exit:
+        free(aad);
+        free(pt);
+        free(ct);
+        free(ref_ct);
+
+        return errors;
+}
+
+int
+main(int argc, char **argv)
+{
+        int errors = 0;
+        int seed;
+
+        if (argc == 1)
+                seed = TEST_SEED;
+        else
+                seed = atoi(argv[1]);
+
+        srand(seed);
+        printf("SEED: %d\n", seed);
+
+        errors += test_gcm_aad_update(&gcm128_funcs);
+        errors += test_gcm_aad_update(&gcm256_funcs);
+
+        if (0 == errors)
+                printf("...Pass\n");
+        else
+                printf("...Fail\n");
+
+        return errors;
+}
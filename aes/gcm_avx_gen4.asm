@@ -2954,7 +2954,7 @@ vmovdqu  %%T_key, [%%GDATA_KEY+16*j]
         mov     %%PLAIN_CYPH_LEN, [%%GDATA_CTX + InLen]
 
         shl     r12, 3                      ; convert into number of bits
-        vmovd   xmm15, r12d                 ; len(A) in xmm15
+        vmovq   xmm15, r12                  ; len(A) in xmm15
 
         shl     %%PLAIN_CYPH_LEN, 3         ; len(C) in bits  (*128)
         vmovq   xmm1, %%PLAIN_CYPH_LEN
@@ -3304,3 +3304,97 @@ FN_NAME(dec,_):
         FUNC_RESTORE
 
         ret
+
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;void   _ghash_avx_gen4 / _ghash_ctx_avx_gen4
+;        const struct isal_gcm_key_data *key_data,
+;        u8      *hash,
+;        const   u8 *in,
+;        u64     len);
+; _ghash takes the hash in GCM byte order, _ghash_ctx in the aad_hash layout of
+; isal_gcm_context_data. len must be a multiple of 16.
+; Only depends on the hash key powers, so it is emitted once for all key sizes.
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+%ifdef GCM128_MODE
+%ifnidn FUNCT_EXTENSION, _nt
+%macro GHASH_UPDATE 1
+%define %%HASH_ORDER %1  ; gcm: GCM byte order, ctx: isal_gcm_context_data aad_hash layout
+
+        FUNC_SAVE
+
+        vmovdqa         xmm9, [SHUF_MASK]
+        vmovdqu         xmm14, [arg2]
+%ifidn %%HASH_ORDER, gcm
+        vpshufb         xmm14, xmm9
+%endif
+        mov             r10, arg3
+        mov             r11, arg4
+
+%%_ghash_by_8:
+        cmp             r11, 128
+        jb              %%_ghash_by_1
+
+        vmovdqu         xmm1, [r10 + 16*0]
+        vmovdqu         xmm2, [r10 + 16*1]
+        vmovdqu         xmm3, [r10 + 16*2]
+        vmovdqu         xmm4, [r10 + 16*3]
+        vmovdqu         xmm5, [r10 + 16*4]
+        vmovdqu         xmm6, [r10 + 16*5]
+        vmovdqu         xmm7, [r10 + 16*6]
+        vmovdqu         xmm8, [r10 + 16*7]
+        vpshufb         xmm1, xmm9
+        vpshufb         xmm2, xmm9
+        vpshufb         xmm3, xmm9
+        vpshufb         xmm4, xmm9
+        vpshufb         xmm5, xmm9
+        vpshufb         xmm6, xmm9
+        vpshufb         xmm7, xmm9
+        vpshufb         xmm8, xmm9
+        vpxor           xmm1, xmm1, xmm14
+
+        ;; aggregated reduction over HashKey^8..HashKey, result in xmm14
+        GHASH_LAST_8    arg1, xmm0, xmm10, xmm11, xmm12, xmm13, xmm14, xmm15, xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8
+
+        add             r10, 128
+        sub             r11, 128
+        jmp             %%_ghash_by_8
+
+%%_ghash_by_1:
+        or              r11, r11
+        je              %%_ghash_done
+        vmovdqu         xmm13, [arg1 + HashKey]
+
+%%_ghash_by_1_loop:
+        vmovdqu         xmm1, [r10]
+        vpshufb         xmm1, xmm9
+        vpxor           xmm14, xmm14, xmm1
+        GHASH_MUL       xmm14, xmm13, xmm0, xmm10, xmm11, xmm12, xmm15
+        add             r10, 16
+        sub             r11, 16
+        jne             %%_ghash_by_1_loop
+
+%%_ghash_done:
+%ifidn %%HASH_ORDER, gcm
+        vpshufb         xmm14, xmm9
+%endif
+        vmovdqu         [arg2], xmm14
+
+%ifdef SAFE_DATA
+        clear_scratch_xmms_avx_asm
+%endif ;; SAFE_DATA
+        FUNC_RESTORE
+%endmacro
+
+global _ghash_avx_gen4
+_ghash_avx_gen4:
+        endbranch
+        GHASH_UPDATE gcm
+        ret
+
+global _ghash_ctx_avx_gen4
+_ghash_ctx_avx_gen4:
+        endbranch
+        GHASH_UPDATE ctx
+        ret
+%endif	; _nt
+%endif	; GCM128_MODE
@@ -0,0 +1,68 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("aes,pclmul,avx"))), apply_to = function)
+#elif defined(__ICC)
+#pragma intel optimization_parameter target_arch = AVX
+#elif defined(__ICL)
+#pragma[intel] optimization_parameter target_arch = AVX
+#elif (__GNUC__ >= 5)
+#pragma GCC target("aes,pclmul,avx")
+#endif
+
+#include "gcm_mb_lane_x86.h"
+
+#define GCM_MB_AVX_LANES 8
+
+void
+_aes_gcm_128_mb_x8_avx(ISAL_AES_GCM_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        gcm_mb_lanes_x128(args, num_blocks, GCM_MB_AVX_LANES, 10);
+}
+
+void
+_aes_gcm_256_mb_x8_avx(ISAL_AES_GCM_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        gcm_mb_lanes_x128(args, num_blocks, GCM_MB_AVX_LANES, 14);
+}
+
+#define GCM_MB_CTX_MGR_INIT_FUNCTION   _aes_gcm_ctx_mgr_init_avx
+#define GCM_MB_CTX_MGR_SUBMIT_FUNCTION _aes_gcm_ctx_mgr_submit_avx
+#define GCM_MB_CTX_MGR_FLUSH_FUNCTION  _aes_gcm_ctx_mgr_flush_avx
+#define GCM_MB_128_FUNCTION            _aes_gcm_128_mb_x8_avx
+#define GCM_MB_256_FUNCTION            _aes_gcm_256_mb_x8_avx
+#define GCM_MB_JOB_START_FUNCTION      gcm_mb_lane_job_start
+#define GCM_MB_JOB_END_FUNCTION        gcm_mb_lane_job_end
+#define GCM_MB_LANES                   GCM_MB_AVX_LANES
+#include "gcm_mb_ctx_base.c"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
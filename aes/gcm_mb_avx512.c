@@ -0,0 +1,199 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#if defined(__clang__)
+#pragma clang attribute push(                                                                      \
+        __attribute__((target("aes,pclmul,avx512f,avx512bw,vaes,vpclmulqdq"))), apply_to = function)
+#elif defined(__ICC)
+#pragma intel optimization_parameter target_arch = CORE-AVX512
+#elif defined(__ICL)
+#pragma[intel] optimization_parameter target_arch = CORE-AVX512
+#elif (__GNUC__ >= 5)
+#pragma GCC target("aes,pclmul,avx512f,avx512bw,vaes,vpclmulqdq")
+#endif
+
+#include "gcm_mb_lane_x86.h"
+
+#define GCM_MB_AVX512_LANES 16
+#define GCM_MB_AVX512_FOR_EACH_GROUP(M) M(0) M(1) M(2) M(3)
+
+/* GH = GH * HK mod poly on 4 lanes at once, see gcm_mb_ghash_mul() */
+static inline __m512i
+gcm_mb_ghash_mul_x4(__m512i gh, const __m512i hk, const __m512i poly2)
+{
+        __m512i t1, t2, t3;
+
+        t1 = _mm512_clmulepi64_epi128(gh, hk, 0x11);
+        t2 = _mm512_clmulepi64_epi128(gh, hk, 0x00);
+        t3 = _mm512_clmulepi64_epi128(gh, hk, 0x01);
+        gh = _mm512_clmulepi64_epi128(gh, hk, 0x10);
+        gh = _mm512_xor_si512(gh, t3);
+        t3 = _mm512_bsrli_epi128(gh, 8);
+        gh = _mm512_bslli_epi128(gh, 8);
+        t1 = _mm512_xor_si512(t1, t3);
+        gh = _mm512_xor_si512(gh, t2);
+
+        t2 = _mm512_clmulepi64_epi128(poly2, gh, 0x01);
+        gh = _mm512_xor_si512(gh, _mm512_bslli_epi128(t2, 8));
+
+        t2 = _mm512_clmulepi64_epi128(poly2, gh, 0x00);
+        t2 = _mm512_bsrli_epi128(t2, 4);
+        gh = _mm512_clmulepi64_epi128(poly2, gh, 0x10);
+        gh = _mm512_bslli_epi128(gh, 4);
+
+        return _mm512_ternarylogic_epi64(gh, t2, t1, 0x96);
+}
+
+/* Expand the decrypt bits of 4 lanes to a mask of their 64-bit elements */
+static inline __mmask8
+gcm_mb_dec_mask_x4(const uint64_t dec_lanes, const unsigned int first_lane)
+{
+        unsigned int i, mask = 0;
+
+        for (i = 0; i < 4; i++)
+                if (dec_lanes & (1ULL << (first_lane + i)))
+                        mask |= 3 << (2 * i);
+
+        return (__mmask8) mask;
+}
+
+/*
+ * Each ZMM register carries the counters, AES state or hash of 4 lanes, one per
+ * 128-bit slot. Round keys are interleaved by lane in args, so the keys of 4
+ * lanes for one round are a single 64-byte load. All groups load their input
+ * before any group stores, so lanes duplicated by flush may work in place.
+ */
+#define GCM_GROUP_DECLARE(g)                                                                       \
+        __m512i ctr##g = _mm512_loadu_si512((const void *) args->ctr[4 * (g)]);                    \
+        __m512i hash##g = _mm512_loadu_si512((const void *) args->hash[4 * (g)]);                  \
+        const __m512i hk##g = _mm512_loadu_si512((const void *) args->hkey[4 * (g)]);              \
+        const __mmask8 dec##g = gcm_mb_dec_mask_x4(args->dec_lanes, 4 * (g));                      \
+        __m512i s##g, d##g;
+
+#define GCM_GROUP_START(g)                                                                         \
+        ctr##g = _mm512_add_epi32(ctr##g, one);                                                    \
+        s##g = _mm512_xor_si512(_mm512_shuffle_epi8(ctr##g, shuf),                                 \
+                                _mm512_loadu_si512((const void *) keys[0][4 * (g)]));
+
+#define GCM_GROUP_ROUND(g)                                                                         \
+        s##g = _mm512_aesenc_epi128(s##g, _mm512_loadu_si512((const void *) keys[r][4 * (g)]));
+
+#define GCM_GROUP_LAST(g)                                                                          \
+        s##g = _mm512_aesenclast_epi128(                                                           \
+                s##g, _mm512_loadu_si512((const void *) keys[num_rounds][4 * (g)]));               \
+        d##g = _mm512_castsi128_si512(_mm_loadu_si128((const __m128i *) (in[4 * (g)] + offset))); \
+        d##g = _mm512_inserti32x4(                                                                 \
+                d##g, _mm_loadu_si128((const __m128i *) (in[4 * (g) + 1] + offset)), 1);           \
+        d##g = _mm512_inserti32x4(                                                                 \
+                d##g, _mm_loadu_si128((const __m128i *) (in[4 * (g) + 2] + offset)), 2);           \
+        d##g = _mm512_inserti32x4(                                                                 \
+                d##g, _mm_loadu_si128((const __m128i *) (in[4 * (g) + 3] + offset)), 3);
+
+#define GCM_GROUP_STORE(g)                                                                         \
+        s##g = _mm512_xor_si512(s##g, d##g);                                                       \
+        _mm_storeu_si128((__m128i *) (out[4 * (g)] + offset), _mm512_castsi512_si128(s##g));      \
+        _mm_storeu_si128((__m128i *) (out[4 * (g) + 1] + offset),                                  \
+                         _mm512_extracti32x4_epi32(s##g, 1));                                      \
+        _mm_storeu_si128((__m128i *) (out[4 * (g) + 2] + offset),                                  \
+                         _mm512_extracti32x4_epi32(s##g, 2));                                      \
+        _mm_storeu_si128((__m128i *) (out[4 * (g) + 3] + offset),                                  \
+                         _mm512_extracti32x4_epi32(s##g, 3));
+
+/* GHASH is over the ciphertext: the input of decrypting lanes */
+#define GCM_GROUP_GHASH(g)                                                                         \
+        s##g = _mm512_shuffle_epi8(_mm512_mask_blend_epi64(dec##g, s##g, d##g), shuf);             \
+        hash##g = gcm_mb_ghash_mul_x4(_mm512_xor_si512(hash##g, s##g), hk##g, poly2);
+
+#define GCM_GROUP_SAVE(g)                                                                          \
+        _mm512_storeu_si512((void *) args->ctr[4 * (g)], ctr##g);                                  \
+        _mm512_storeu_si512((void *) args->hash[4 * (g)], hash##g);
+
+static inline void
+aes_gcm_mb_x16_vaes_avx512(ISAL_AES_GCM_MB_ARGS_X16 *args, uint64_t num_blocks,
+                           const int num_rounds)
+{
+        const uint8_t(*keys)[ISAL_AES_GCM_MAX_LANES][ISAL_GCM_ENC_KEY_LEN] = args->keys;
+        const __m512i shuf = _mm512_broadcast_i32x4(GCM_MB_SHUF_MASK);
+        const __m512i poly2 = _mm512_broadcast_i32x4(GCM_MB_POLY2);
+        const __m512i one = _mm512_broadcast_i32x4(_mm_set_epi32(0, 0, 0, 1));
+        const uint8_t *in[GCM_MB_AVX512_LANES];
+        uint8_t *out[GCM_MB_AVX512_LANES];
+        uint64_t offset;
+        int i, r;
+
+        for (i = 0; i < GCM_MB_AVX512_LANES; i++) {
+                in[i] = args->in[i];
+                out[i] = args->out[i];
+        }
+
+        GCM_MB_AVX512_FOR_EACH_GROUP(GCM_GROUP_DECLARE)
+
+        for (offset = 0; offset < num_blocks * 16; offset += 16) {
+                GCM_MB_AVX512_FOR_EACH_GROUP(GCM_GROUP_START)
+                for (r = 1; r < num_rounds; r++) {
+                        GCM_MB_AVX512_FOR_EACH_GROUP(GCM_GROUP_ROUND)
+                }
+                GCM_MB_AVX512_FOR_EACH_GROUP(GCM_GROUP_LAST)
+                GCM_MB_AVX512_FOR_EACH_GROUP(GCM_GROUP_STORE)
+                GCM_MB_AVX512_FOR_EACH_GROUP(GCM_GROUP_GHASH)
+        }
+
+        GCM_MB_AVX512_FOR_EACH_GROUP(GCM_GROUP_SAVE)
+
+        for (i = 0; i < GCM_MB_AVX512_LANES; i++) {
+                args->in[i] = in[i] + num_blocks * 16;
+                args->out[i] = out[i] + num_blocks * 16;
+        }
+}
+
+void
+_aes_gcm_128_mb_x16_vaes_avx512(ISAL_AES_GCM_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_gcm_mb_x16_vaes_avx512(args, num_blocks, 10);
+}
+
+void
+_aes_gcm_256_mb_x16_vaes_avx512(ISAL_AES_GCM_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_gcm_mb_x16_vaes_avx512(args, num_blocks, 14);
+}
+
+#define GCM_MB_CTX_MGR_INIT_FUNCTION   _aes_gcm_ctx_mgr_init_avx512
+#define GCM_MB_CTX_MGR_SUBMIT_FUNCTION _aes_gcm_ctx_mgr_submit_avx512
+#define GCM_MB_CTX_MGR_FLUSH_FUNCTION  _aes_gcm_ctx_mgr_flush_avx512
+#define GCM_MB_128_FUNCTION            _aes_gcm_128_mb_x16_vaes_avx512
+#define GCM_MB_256_FUNCTION            _aes_gcm_256_mb_x16_vaes_avx512
+#define GCM_MB_JOB_START_FUNCTION      gcm_mb_lane_job_start
+#define GCM_MB_JOB_END_FUNCTION        gcm_mb_lane_job_end
+#define GCM_MB_LANES                   GCM_MB_AVX512_LANES
+#include "gcm_mb_ctx_base.c"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
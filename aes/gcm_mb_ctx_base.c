@@ -0,0 +1,273 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+/*
+ * AES-GCM multi-buffer manager.
+ *
+ * Default functions are the base (single lane) version, which hands each job to
+ * the single-buffer AES-GCM functions. Vectorized versions are generated by the
+ * architecture files, which define the lane count, the lane kernels and the
+ * per-job start/end functions before including this file.
+ *
+ * A job is split in three parts: the start function sets up the lane (round
+ * keys, hash key, counter, E(K, J0) and the GHASH of the AAD), the lane kernel
+ * processes the full blocks of all lanes together and the end function handles
+ * the trailing partial block, the length block and the tag.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "aes_gcm_mb_internal.h"
+#include "aes_gcm_internal.h"
+#include "memcpy_inline.h"
+
+#ifndef GCM_MB_CTX_MGR_INIT_FUNCTION
+#define GCM_MB_CTX_MGR_INIT_FUNCTION   _aes_gcm_ctx_mgr_init_base
+#define GCM_MB_CTX_MGR_SUBMIT_FUNCTION _aes_gcm_ctx_mgr_submit_base
+#define GCM_MB_CTX_MGR_FLUSH_FUNCTION  _aes_gcm_ctx_mgr_flush_base
+#define GCM_MB_128_FUNCTION            aes_gcm_mb_x1_base
+#define GCM_MB_256_FUNCTION            aes_gcm_mb_x1_base
+#define GCM_MB_JOB_START_FUNCTION      aes_gcm_mb_job_start_base
+#define GCM_MB_JOB_END_FUNCTION        aes_gcm_mb_job_end_base
+#define GCM_MB_LANES                   1
+
+/* The base version runs the whole job from the end function */
+static void
+aes_gcm_mb_x1_base(ISAL_AES_GCM_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+}
+
+static void
+aes_gcm_mb_job_start_base(ISAL_AES_GCM_MB_ARGS_X16 *args, const unsigned int lane,
+                          const ISAL_AES_GCM_JOB *job, const uint32_t num_rounds)
+{
+}
+
+static void
+aes_gcm_mb_job_end_base(ISAL_AES_GCM_MB_ARGS_X16 *args, const unsigned int lane,
+                        ISAL_AES_GCM_JOB *job, const uint32_t num_rounds)
+{
+        struct isal_gcm_context_data gctx;
+
+        if (num_rounds == 10 && job->dir == ISAL_AES_GCM_DECRYPT)
+                _aes_gcm_dec_128(job->key_data, &gctx, job->out, job->in, job->len, job->iv,
+                                 job->aad, job->aad_len, job->auth_tag, job->auth_tag_len);
+        else if (num_rounds == 10)
+                _aes_gcm_enc_128(job->key_data, &gctx, job->out, job->in, job->len, job->iv,
+                                 job->aad, job->aad_len, job->auth_tag, job->auth_tag_len);
+        else if (job->dir == ISAL_AES_GCM_DECRYPT)
+                _aes_gcm_dec_256(job->key_data, &gctx, job->out, job->in, job->len, job->iv,
+                                 job->aad, job->aad_len, job->auth_tag, job->auth_tag_len);
+        else
+                _aes_gcm_enc_256(job->key_data, &gctx, job->out, job->in, job->len, job->iv,
+                                 job->aad, job->aad_len, job->auth_tag, job->auth_tag_len);
+}
+#endif
+
+#define ISAL_AES_GCM_JOB_TO_CTX(job_ptr)                                                           \
+        ((ISAL_AES_GCM_CTX *) ((char *) (job_ptr) - offsetof(ISAL_AES_GCM_CTX, job)))
+
+static void
+gcm_mb_mgr_run_lanes(ISAL_AES_GCM_MB_JOB_MGR *state, uint64_t num_blocks)
+{
+        if (state->num_rounds == 10)
+                GCM_MB_128_FUNCTION(&state->args, num_blocks);
+        else
+                GCM_MB_256_FUNCTION(&state->args, num_blocks);
+}
+
+static void
+gcm_mb_mgr_copy_lane(ISAL_AES_GCM_MB_JOB_MGR *state, const unsigned int dst,
+                     const unsigned int src)
+{
+        ISAL_AES_GCM_MB_ARGS_X16 *args = &state->args;
+        unsigned int r;
+
+        args->in[dst] = args->in[src];
+        args->out[dst] = args->out[src];
+        for (r = 0; r <= state->num_rounds; r++)
+                memcpy_fixedlen(args->keys[r][dst], args->keys[r][src], ISAL_GCM_ENC_KEY_LEN);
+        memcpy_fixedlen(args->hkey[dst], args->hkey[src], ISAL_GCM_BLOCK_LEN);
+        memcpy_fixedlen(args->hash[dst], args->hash[src], ISAL_GCM_BLOCK_LEN);
+        memcpy_fixedlen(args->ctr[dst], args->ctr[src], ISAL_GCM_BLOCK_LEN);
+        memcpy_fixedlen(args->enc_j0[dst], args->enc_j0[src], ISAL_GCM_BLOCK_LEN);
+        if (args->dec_lanes & (1ULL << src))
+                args->dec_lanes |= 1ULL << dst;
+        else
+                args->dec_lanes &= ~(1ULL << dst);
+}
+
+static ISAL_AES_GCM_JOB *
+gcm_mb_mgr_release_lane(ISAL_AES_GCM_MB_JOB_MGR *state, const unsigned int lane)
+{
+        ISAL_AES_GCM_JOB *job = state->ldata[lane].job_in_lane;
+
+        GCM_MB_JOB_END_FUNCTION(&state->args, lane, job, state->num_rounds);
+        job->status = ISAL_STS_COMPLETED;
+
+        state->ldata[lane].job_in_lane = NULL;
+        state->unused_lanes = (state->unused_lanes << 4) | lane;
+        state->num_lanes_inuse--;
+
+        return job;
+}
+
+/*
+ * Run all lanes until the shortest job is done and return it.
+ * Lanes without a job must hold a copy of a used lane.
+ */
+static ISAL_AES_GCM_JOB *
+gcm_mb_mgr_complete_min_job(ISAL_AES_GCM_MB_JOB_MGR *state)
+{
+        uint64_t min_len = UINT64_MAX;
+        unsigned int i, min_idx = 0;
+
+        for (i = 0; i < GCM_MB_LANES; i++) {
+                if (state->ldata[i].job_in_lane != NULL && state->lens[i] < min_len) {
+                        min_len = state->lens[i];
+                        min_idx = i;
+                }
+        }
+
+        if (min_len) {
+                gcm_mb_mgr_run_lanes(state, min_len);
+                for (i = 0; i < GCM_MB_LANES; i++)
+                        if (state->ldata[i].job_in_lane != NULL)
+                                state->lens[i] -= min_len;
+        }
+
+        return gcm_mb_mgr_release_lane(state, min_idx);
+}
+
+static ISAL_AES_GCM_JOB *
+gcm_mb_mgr_submit(ISAL_AES_GCM_MB_JOB_MGR *state, ISAL_AES_GCM_JOB *job)
+{
+        const unsigned int lane = (unsigned int) (state->unused_lanes & 0xF);
+
+        state->unused_lanes >>= 4;
+        state->num_lanes_inuse++;
+        state->ldata[lane].job_in_lane = job;
+        state->lens[lane] = job->len / ISAL_GCM_BLOCK_LEN;
+        GCM_MB_JOB_START_FUNCTION(&state->args, lane, job, state->num_rounds);
+        job->status = ISAL_STS_BEING_PROCESSED;
+
+        // Less than a block of data needs no lane work
+        if (state->lens[lane] == 0)
+                return gcm_mb_mgr_release_lane(state, lane);
+
+        if (state->num_lanes_inuse < GCM_MB_LANES)
+                return NULL;
+
+        return gcm_mb_mgr_complete_min_job(state);
+}
+
+static ISAL_AES_GCM_JOB *
+gcm_mb_mgr_flush(ISAL_AES_GCM_MB_JOB_MGR *state)
+{
+        unsigned int i, valid = 0;
+
+        if (state->num_lanes_inuse == 0)
+                return NULL;
+
+        for (i = 0; i < GCM_MB_LANES; i++) {
+                if (state->ldata[i].job_in_lane != NULL) {
+                        valid = i;
+                        break;
+                }
+        }
+
+        // Unused lanes redo the work of a used lane: same input, keys, counter and output
+        for (i = 0; i < GCM_MB_LANES; i++)
+                if (state->ldata[i].job_in_lane == NULL)
+                        gcm_mb_mgr_copy_lane(state, i, valid);
+
+        return gcm_mb_mgr_complete_min_job(state);
+}
+
+void
+GCM_MB_CTX_MGR_INIT_FUNCTION(ISAL_AES_GCM_CTX_MGR *mgr, const uint32_t key_len)
+{
+        ISAL_AES_GCM_MB_JOB_MGR *state = &mgr->mgr;
+        unsigned int j;
+
+        memset(state, 0, sizeof(*state));
+        for (j = GCM_MB_LANES; j > 0; j--)
+                state->unused_lanes = (state->unused_lanes << 4) | (j - 1);
+
+        state->num_rounds = (key_len == ISAL_GCM_256_KEY_LEN) ? 14 : 10;
+}
+
+ISAL_AES_GCM_CTX *
+GCM_MB_CTX_MGR_SUBMIT_FUNCTION(ISAL_AES_GCM_CTX_MGR *mgr, ISAL_AES_GCM_CTX *ctx, uint8_t *out,
+                               const uint8_t *in, uint64_t len, const uint8_t *iv,
+                               const uint8_t *aad, uint64_t aad_len, uint8_t *auth_tag,
+                               uint64_t auth_tag_len)
+{
+        ISAL_AES_GCM_JOB *job;
+
+        if (ctx->status & ISAL_HASH_CTX_STS_PROCESSING) {
+                // Cannot submit to a currently processing job.
+                ctx->error = ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING;
+                return ctx;
+        }
+        ctx->error = ISAL_HASH_CTX_ERROR_NONE;
+
+        ctx->job.in = in;
+        ctx->job.out = out;
+        ctx->job.len = len;
+        ctx->job.aad = aad;
+        ctx->job.aad_len = aad_len;
+        memcpy(ctx->job.iv, iv, ISAL_GCM_IV_LEN);
+        ctx->job.auth_tag = auth_tag;
+        ctx->job.auth_tag_len = auth_tag_len;
+
+        ctx->status = ISAL_HASH_CTX_STS_PROCESSING;
+
+        job = gcm_mb_mgr_submit(&mgr->mgr, &ctx->job);
+        if (job == NULL)
+                return NULL;
+
+        ctx = ISAL_AES_GCM_JOB_TO_CTX(job);
+        ctx->status = ISAL_HASH_CTX_STS_COMPLETE;
+        return ctx;
+}
+
+ISAL_AES_GCM_CTX *
+GCM_MB_CTX_MGR_FLUSH_FUNCTION(ISAL_AES_GCM_CTX_MGR *mgr)
+{
+        ISAL_AES_GCM_CTX *ctx;
+        ISAL_AES_GCM_JOB *job = gcm_mb_mgr_flush(&mgr->mgr);
+
+        if (job == NULL)
+                return NULL;
+
+        ctx = ISAL_AES_GCM_JOB_TO_CTX(job);
+        ctx->status = ISAL_HASH_CTX_STS_COMPLETE;
+        return ctx;
+}
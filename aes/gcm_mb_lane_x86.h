@@ -0,0 +1,278 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+/*
+ * Helpers shared by the x86 multi-buffer AES-GCM implementations.
+ *
+ * This file is included by the architecture files after their target pragmas, so
+ * the helpers are compiled for the instruction set of the including file. All
+ * GHASH values are kept byte reflected: a block is byte swapped once on load and
+ * the multiplication is done on the reflected form with H<<1 mod poly as the key,
+ * the same scheme as the single-buffer GCM assembly.
+ */
+
+#ifndef _GCM_MB_LANE_X86_H
+#define _GCM_MB_LANE_X86_H
+
+#include <string.h>
+#include <immintrin.h>
+#include "aes_gcm_mb_internal.h"
+
+#define GCM_MB_SHUF_MASK _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)
+#define GCM_MB_POLY2     _mm_set_epi64x(0xC200000000000000, 0x00000001C2000000)
+
+/* GH = GH * HK mod poly, all in reflected form */
+static inline __m128i
+gcm_mb_ghash_mul(__m128i gh, const __m128i hk)
+{
+        const __m128i poly2 = GCM_MB_POLY2;
+        __m128i t1, t2, t3;
+
+        t1 = _mm_clmulepi64_si128(gh, hk, 0x11);
+        t2 = _mm_clmulepi64_si128(gh, hk, 0x00);
+        t3 = _mm_clmulepi64_si128(gh, hk, 0x01);
+        gh = _mm_clmulepi64_si128(gh, hk, 0x10);
+        gh = _mm_xor_si128(gh, t3);
+        t3 = _mm_srli_si128(gh, 8);
+        gh = _mm_slli_si128(gh, 8);
+        t1 = _mm_xor_si128(t1, t3);
+        gh = _mm_xor_si128(gh, t2);
+
+        // first phase of the reduction
+        t2 = _mm_clmulepi64_si128(poly2, gh, 0x01);
+        t2 = _mm_slli_si128(t2, 8);
+        gh = _mm_xor_si128(gh, t2);
+
+        // second phase of the reduction
+        t2 = _mm_clmulepi64_si128(poly2, gh, 0x00);
+        t2 = _mm_srli_si128(t2, 4);
+        gh = _mm_clmulepi64_si128(poly2, gh, 0x10);
+        gh = _mm_slli_si128(gh, 4);
+        gh = _mm_xor_si128(gh, t2);
+
+        return _mm_xor_si128(gh, t1);
+}
+
+/* Compute HashKey<<1 mod poly from the reflected hash key H */
+static inline __m128i
+gcm_mb_hkey(__m128i h)
+{
+        __m128i t1, t2;
+
+        t2 = _mm_srli_epi64(h, 63);
+        t1 = _mm_srli_si128(t2, 8);
+        t2 = _mm_slli_si128(t2, 8);
+        h = _mm_or_si128(_mm_slli_epi64(h, 1), t2);
+
+        // reduce if the bit shifted out was set
+        t2 = _mm_shuffle_epi32(t1, 0x24);
+        t2 = _mm_cmpeq_epi32(t2, _mm_set_epi32(1, 0, 0, 1));
+        t2 = _mm_and_si128(t2, _mm_set_epi64x(0xC200000000000000, 1));
+
+        return _mm_xor_si128(h, t2);
+}
+
+/* Encrypt one block with the round keys of a lane */
+static inline __m128i
+gcm_mb_lane_enc(const ISAL_AES_GCM_MB_ARGS_X16 *args, const unsigned int lane, __m128i b,
+                const uint32_t num_rounds)
+{
+        uint32_t r;
+
+        b = _mm_xor_si128(b, _mm_loadu_si128((const __m128i *) args->keys[0][lane]));
+        for (r = 1; r < num_rounds; r++)
+                b = _mm_aesenc_si128(b, _mm_loadu_si128((const __m128i *) args->keys[r][lane]));
+
+        return _mm_aesenclast_si128(b, _mm_loadu_si128((const __m128i *) args->keys[r][lane]));
+}
+
+/* Fold len bytes into the reflected hash, zero padding the last block */
+static inline __m128i
+gcm_mb_ghash(__m128i hash, const __m128i hk, const uint8_t *buf, uint64_t len)
+{
+        const __m128i shuf = GCM_MB_SHUF_MASK;
+        uint8_t last[ISAL_GCM_BLOCK_LEN];
+        __m128i d;
+
+        for (; len >= ISAL_GCM_BLOCK_LEN; len -= ISAL_GCM_BLOCK_LEN) {
+                d = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) buf), shuf);
+                hash = gcm_mb_ghash_mul(_mm_xor_si128(hash, d), hk);
+                buf += ISAL_GCM_BLOCK_LEN;
+        }
+        if (len) {
+                memset(last, 0, sizeof(last));
+                memcpy(last, buf, len);
+                d = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) last), shuf);
+                hash = gcm_mb_ghash_mul(_mm_xor_si128(hash, d), hk);
+        }
+
+        return hash;
+}
+
+/*
+ * Set up a lane for a new job: round keys, hash key, E(K, J0), the counter and
+ * the GHASH of the AAD.
+ */
+static inline void
+gcm_mb_lane_job_start(ISAL_AES_GCM_MB_ARGS_X16 *args, const unsigned int lane,
+                      const ISAL_AES_GCM_JOB *job, const uint32_t num_rounds)
+{
+        const __m128i shuf = GCM_MB_SHUF_MASK;
+        uint8_t j0[ISAL_GCM_BLOCK_LEN] = { 0 };
+        __m128i h, hk, ctr;
+        uint32_t r;
+
+        for (r = 0; r <= num_rounds; r++)
+                memcpy(args->keys[r][lane], job->key_data->expanded_keys + r * ISAL_GCM_ENC_KEY_LEN,
+                       ISAL_GCM_ENC_KEY_LEN);
+
+        /* The hash key is taken from the round keys, as its place in the key data differs
+         * between implementations */
+        h = gcm_mb_lane_enc(args, lane, _mm_setzero_si128(), num_rounds);
+        hk = gcm_mb_hkey(_mm_shuffle_epi8(h, shuf));
+        _mm_storeu_si128((__m128i *) args->hkey[lane], hk);
+
+        // J0 = IV || 0^31 || 1
+        memcpy(j0, job->iv, ISAL_GCM_IV_LEN);
+        j0[ISAL_GCM_BLOCK_LEN - 1] = 1;
+        ctr = _mm_loadu_si128((const __m128i *) j0);
+        _mm_storeu_si128((__m128i *) args->enc_j0[lane],
+                        gcm_mb_lane_enc(args, lane, ctr, num_rounds));
+        _mm_storeu_si128((__m128i *) args->ctr[lane], _mm_shuffle_epi8(ctr, shuf));
+
+        _mm_storeu_si128((__m128i *) args->hash[lane],
+                        gcm_mb_ghash(_mm_setzero_si128(), hk, job->aad, job->aad_len));
+
+        args->in[lane] = job->in;
+        args->out[lane] = job->out;
+        if (job->dir == ISAL_AES_GCM_DECRYPT)
+                args->dec_lanes |= 1ULL << lane;
+        else
+                args->dec_lanes &= ~(1ULL << lane);
+}
+
+/*
+ * Finish a job once the lane kernel has processed all its full blocks: the
+ * trailing partial block, the length block and the tag.
+ */
+static inline void
+gcm_mb_lane_job_end(ISAL_AES_GCM_MB_ARGS_X16 *args, const unsigned int lane,
+                    ISAL_AES_GCM_JOB *job, const uint32_t num_rounds)
+{
+        const __m128i shuf = GCM_MB_SHUF_MASK;
+        const __m128i hk = _mm_loadu_si128((const __m128i *) args->hkey[lane]);
+        const uint64_t tail = job->len % ISAL_GCM_BLOCK_LEN;
+        __m128i hash = _mm_loadu_si128((const __m128i *) args->hash[lane]);
+        uint8_t ks[ISAL_GCM_BLOCK_LEN], tag[ISAL_GCM_BLOCK_LEN];
+        uint64_t i;
+
+        if (tail) {
+                __m128i ctr = _mm_loadu_si128((const __m128i *) args->ctr[lane]);
+
+                ctr = _mm_add_epi32(ctr, _mm_set_epi32(0, 0, 0, 1));
+                _mm_storeu_si128((__m128i *) ks,
+                                 gcm_mb_lane_enc(args, lane, _mm_shuffle_epi8(ctr, shuf),
+                                                 num_rounds));
+                if (job->dir == ISAL_AES_GCM_DECRYPT)
+                        hash = gcm_mb_ghash(hash, hk, args->in[lane], tail);
+                for (i = 0; i < tail; i++)
+                        args->out[lane][i] = args->in[lane][i] ^ ks[i];
+                if (job->dir == ISAL_AES_GCM_ENCRYPT)
+                        hash = gcm_mb_ghash(hash, hk, args->out[lane], tail);
+        }
+
+        // len(A) || len(C) in bits, reflected
+        hash = _mm_xor_si128(hash, _mm_set_epi64x(job->aad_len * 8, job->len * 8));
+        hash = gcm_mb_ghash_mul(hash, hk);
+
+        hash = _mm_xor_si128(_mm_shuffle_epi8(hash, shuf),
+                             _mm_loadu_si128((const __m128i *) args->enc_j0[lane]));
+        _mm_storeu_si128((__m128i *) tag, hash);
+        memcpy(job->auth_tag, tag, job->auth_tag_len);
+}
+
+/*
+ * Generic kernel for lanes of 128-bit registers. All lane inputs of a block are
+ * loaded before any output is stored, so lanes duplicated by flush may work in
+ * place.
+ */
+static inline void
+gcm_mb_lanes_x128(ISAL_AES_GCM_MB_ARGS_X16 *args, uint64_t num_blocks, const unsigned int lanes,
+                  const uint32_t num_rounds)
+{
+        const __m128i shuf = GCM_MB_SHUF_MASK;
+        const __m128i one = _mm_set_epi32(0, 0, 0, 1);
+        __m128i ctr[ISAL_AES_GCM_MAX_LANES], hash[ISAL_AES_GCM_MAX_LANES];
+        __m128i hk[ISAL_AES_GCM_MAX_LANES];
+        __m128i s[ISAL_AES_GCM_MAX_LANES], d[ISAL_AES_GCM_MAX_LANES];
+        uint64_t offset;
+        unsigned int l;
+        uint32_t r;
+
+        for (l = 0; l < lanes; l++) {
+                ctr[l] = _mm_loadu_si128((const __m128i *) args->ctr[l]);
+                hash[l] = _mm_loadu_si128((const __m128i *) args->hash[l]);
+                hk[l] = _mm_loadu_si128((const __m128i *) args->hkey[l]);
+        }
+
+        for (offset = 0; offset < num_blocks * ISAL_GCM_BLOCK_LEN; offset += ISAL_GCM_BLOCK_LEN) {
+                for (l = 0; l < lanes; l++) {
+                        ctr[l] = _mm_add_epi32(ctr[l], one);
+                        s[l] = _mm_xor_si128(_mm_shuffle_epi8(ctr[l], shuf),
+                                             _mm_loadu_si128((const __m128i *) args->keys[0][l]));
+                }
+                for (r = 1; r < num_rounds; r++)
+                        for (l = 0; l < lanes; l++)
+                                s[l] = _mm_aesenc_si128(
+                                        s[l], _mm_loadu_si128((const __m128i *) args->keys[r][l]));
+                for (l = 0; l < lanes; l++) {
+                        s[l] = _mm_aesenclast_si128(
+                                s[l], _mm_loadu_si128((const __m128i *) args->keys[r][l]));
+                        d[l] = _mm_loadu_si128((const __m128i *) (args->in[l] + offset));
+                }
+                for (l = 0; l < lanes; l++) {
+                        s[l] = _mm_xor_si128(s[l], d[l]);
+                        _mm_storeu_si128((__m128i *) (args->out[l] + offset), s[l]);
+                        // GHASH is over the ciphertext: input when decrypting
+                        if (args->dec_lanes & (1ULL << l))
+                                s[l] = d[l];
+                        s[l] = _mm_shuffle_epi8(s[l], shuf);
+                        hash[l] = gcm_mb_ghash_mul(_mm_xor_si128(hash[l], s[l]), hk[l]);
+                }
+        }
+
+        for (l = 0; l < lanes; l++) {
+                _mm_storeu_si128((__m128i *) args->ctr[l], ctr[l]);
+                _mm_storeu_si128((__m128i *) args->hash[l], hash[l]);
+                args->in[l] += num_blocks * ISAL_GCM_BLOCK_LEN;
+                args->out[l] += num_blocks * ISAL_GCM_BLOCK_LEN;
+        }
+}
+
+#endif // ifndef _GCM_MB_LANE_X86_H
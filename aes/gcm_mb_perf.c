@@ -0,0 +1,190 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <aes_gcm.h>
+#include <aes_gcm_mb.h>
+#include <test.h>
+#include "types.h"
+
+// Cached test, loop many times over small packets
+#define MAX_PACKET_LEN 1500
+#define TEST_BYTES     (64 * 1024 * 1024)
+#define TEST_TYPE_STR  "_warm"
+
+#define TEST_BUFS ISAL_AES_GCM_MAX_LANES
+#define AAD_LEN   16
+#define TAG_LEN   ISAL_GCM_MAX_TAG_LEN
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+static const uint32_t Klen[] = { ISAL_GCM_128_KEY_LEN, ISAL_GCM_256_KEY_LEN };
+static const uint64_t Packet_len[] = { 64, 256, 576, 1500 };
+
+static uint8_t *plaintext[TEST_BUFS];
+static uint8_t *ciphertext[TEST_BUFS];
+static uint8_t *mb_ciphertext[TEST_BUFS];
+static struct isal_gcm_key_data key_data[TEST_BUFS];
+static uint8_t iv[TEST_BUFS][ISAL_GCM_IV_LEN];
+static uint8_t aad[TEST_BUFS][AAD_LEN];
+static uint8_t tag[TEST_BUFS][TAG_LEN];
+static uint8_t mb_tag[TEST_BUFS][TAG_LEN];
+
+static void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        unsigned int i;
+        for (i = 0; i < size; i++)
+                *data++ = rand();
+}
+
+static int
+sb_gcm_enc(const uint32_t klen, const int i, const uint64_t len)
+{
+        struct isal_gcm_context_data gctx;
+
+        if (klen == ISAL_GCM_128_KEY_LEN)
+                return isal_aes_gcm_enc_128(&key_data[i], &gctx, ciphertext[i], plaintext[i], len,
+                                            iv[i], aad[i], AAD_LEN, tag[i], TAG_LEN);
+        return isal_aes_gcm_enc_256(&key_data[i], &gctx, ciphertext[i], plaintext[i], len, iv[i],
+                                    aad[i], AAD_LEN, tag[i], TAG_LEN);
+}
+
+static int
+mb_gcm_enc(ISAL_AES_GCM_CTX_MGR *mgr, ISAL_AES_GCM_CTX *ctxpool, const uint64_t len)
+{
+        ISAL_AES_GCM_CTX *ctx;
+        int i;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                if (isal_aes_gcm_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, mb_ciphertext[i],
+                                                plaintext[i], len, iv[i], aad[i], AAD_LEN,
+                                                mb_tag[i], TAG_LEN) != 0)
+                        return 1;
+        }
+        do {
+                if (isal_aes_gcm_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return 1;
+        } while (ctx != NULL);
+
+        return 0;
+}
+
+int
+main(void)
+{
+        ISAL_AES_GCM_CTX_MGR *mgr = NULL;
+        ISAL_AES_GCM_CTX *ctxpool = NULL;
+        uint8_t key[ISAL_GCM_256_KEY_LEN];
+        int i, k, p, t, loops, ret = 1;
+
+        printf("AES-GCM multi-buffer encrypt perf, %d buffers\n", TEST_BUFS);
+        srand(TEST_SEED);
+
+        if (posix_memalign((void **) &mgr, 64, sizeof(*mgr)) != 0 ||
+            posix_memalign((void **) &ctxpool, 16, sizeof(*ctxpool) * TEST_BUFS) != 0) {
+                printf("alloc error: Fail");
+                goto exit;
+        }
+        for (i = 0; i < TEST_BUFS; i++) {
+                plaintext[i] = malloc(MAX_PACKET_LEN);
+                ciphertext[i] = malloc(MAX_PACKET_LEN);
+                mb_ciphertext[i] = malloc(MAX_PACKET_LEN);
+                if (plaintext[i] == NULL || ciphertext[i] == NULL || mb_ciphertext[i] == NULL) {
+                        printf("malloc error: Fail");
+                        goto exit;
+                }
+                mk_rand_data(plaintext[i], MAX_PACKET_LEN);
+                mk_rand_data(iv[i], ISAL_GCM_IV_LEN);
+                mk_rand_data(aad[i], AAD_LEN);
+        }
+
+        for (k = 0; k < (int) DIM(Klen); k++) {
+                const int kbits = (int) Klen[k] * 8;
+
+                for (i = 0; i < TEST_BUFS; i++) {
+                        mk_rand_data(key, sizeof(key));
+                        if (Klen[k] == ISAL_GCM_128_KEY_LEN)
+                                isal_aes_gcm_pre_128(key, &key_data[i]);
+                        else
+                                isal_aes_gcm_pre_256(key, &key_data[i]);
+                        isal_aes_gcm_ctx_init(&ctxpool[i], &key_data[i], ISAL_AES_GCM_ENCRYPT);
+                }
+                if (isal_aes_gcm_ctx_mgr_init(mgr, Klen[k]) != 0)
+                        goto exit;
+
+                for (p = 0; p < (int) DIM(Packet_len); p++) {
+                        const uint64_t len = Packet_len[p];
+                        struct perf start, stop;
+
+                        loops = TEST_BYTES / (len * TEST_BUFS);
+
+                        perf_start(&start);
+                        for (t = 0; t < loops; t++)
+                                for (i = 0; i < TEST_BUFS; i++)
+                                        sb_gcm_enc(Klen[k], i, len);
+                        perf_stop(&stop);
+                        printf("aes_gcm_%d_enc_sb_%d" TEST_TYPE_STR ": ", kbits, (int) len);
+                        perf_print(stop, start, (long long) len * TEST_BUFS * t);
+
+                        perf_start(&start);
+                        for (t = 0; t < loops; t++)
+                                if (mb_gcm_enc(mgr, ctxpool, len) != 0)
+                                        goto exit;
+                        perf_stop(&stop);
+                        printf("aes_gcm_%d_enc_mb_%d" TEST_TYPE_STR ": ", kbits, (int) len);
+                        perf_print(stop, start, (long long) len * TEST_BUFS * t);
+
+                        for (i = 0; i < TEST_BUFS; i++) {
+                                if (memcmp(ciphertext[i], mb_ciphertext[i], len) != 0 ||
+                                    memcmp(tag[i], mb_tag[i], TAG_LEN) != 0) {
+                                        printf("aes_gcm_%d multi-buffer mismatch: Fail\n",
+                                               kbits);
+                                        goto exit;
+                                }
+                        }
+                }
+        }
+        ret = 0;
+
+exit:
+        for (i = 0; i < TEST_BUFS; i++) {
+                free(plaintext[i]);
+                free(ciphertext[i]);
+                free(mb_ciphertext[i]);
+        }
+        aligned_free(ctxpool);
+        aligned_free(mgr);
+
+        return ret;
+}
@@ -0,0 +1,241 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <aes_gcm.h>
+#include <aes_gcm_mb.h>
+#include "types.h"
+#include "test.h"
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+#ifndef RANDOMS
+#define RANDOMS 4
+#endif
+#define TEST_BUFS       37
+#define TEST_LEN        (4 * 1024 + 15)
+#define MAX_AAD_LEN     80
+#define IN_PLACE_STRIDE 5 // every 5th packet is processed in place
+
+static const uint32_t Klen[] = { ISAL_GCM_128_KEY_LEN, ISAL_GCM_256_KEY_LEN };
+static const uint64_t Tag_len[] = { ISAL_GCM_MAX_TAG_LEN, 12, 8 };
+
+struct packet {
+        uint8_t *pt;
+        uint8_t *ct;
+        uint8_t *out;
+        uint8_t key[ISAL_GCM_256_KEY_LEN];
+        uint8_t iv[ISAL_GCM_IV_LEN];
+        uint8_t aad[MAX_AAD_LEN];
+        uint8_t ref_tag[ISAL_GCM_MAX_TAG_LEN];
+        uint8_t tag[ISAL_GCM_MAX_TAG_LEN];
+        uint64_t len;
+        uint64_t aad_len;
+        uint64_t tag_len;
+        ISAL_AES_GCM_DIR dir;
+        int done;
+};
+
+static struct isal_gcm_key_data key_data[TEST_BUFS];
+static struct packet packets[TEST_BUFS];
+
+static void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        uint32_t i;
+        for (i = 0; i < size; i++)
+                *data++ = rand();
+}
+
+static int
+ref_gcm_enc(const uint32_t klen, struct packet *p, const struct isal_gcm_key_data *kd)
+{
+        struct isal_gcm_context_data gctx;
+
+        if (klen == ISAL_GCM_128_KEY_LEN)
+                return isal_aes_gcm_enc_128(kd, &gctx, p->ct, p->pt, p->len, p->iv, p->aad,
+                                            p->aad_len, p->ref_tag, p->tag_len);
+        return isal_aes_gcm_enc_256(kd, &gctx, p->ct, p->pt, p->len, p->iv, p->aad, p->aad_len,
+                                    p->ref_tag, p->tag_len);
+}
+
+static int
+key_pre(const uint32_t klen, const uint8_t *key, struct isal_gcm_key_data *kd)
+{
+        if (klen == ISAL_GCM_128_KEY_LEN)
+                return isal_aes_gcm_pre_128(key, kd);
+        return isal_aes_gcm_pre_256(key, kd);
+}
+
+static void
+ctx_done(ISAL_AES_GCM_CTX *ctx)
+{
+        packets[(uintptr_t) ctx->user_data].done++;
+}
+
+static int
+run_test(ISAL_AES_GCM_CTX_MGR *mgr, ISAL_AES_GCM_CTX *ctxpool, const uint32_t klen)
+{
+        ISAL_AES_GCM_CTX *ctx;
+        int i;
+
+        if (isal_aes_gcm_ctx_mgr_init(mgr, klen) != 0)
+                return 1;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                struct packet *p = &packets[i];
+
+                mk_rand_data(p->key, sizeof(p->key));
+                mk_rand_data(p->iv, sizeof(p->iv));
+                mk_rand_data(p->aad, sizeof(p->aad));
+                mk_rand_data(p->pt, TEST_LEN);
+                if (key_pre(klen, p->key, &key_data[i]) != 0)
+                        return 1;
+
+                // Mix of short and long packets, including empty ones
+                p->len = (i % 4 == 0) ? rand() % 64 : rand() % (TEST_LEN + 1);
+                p->aad_len = rand() % (MAX_AAD_LEN + 1);
+                p->tag_len = Tag_len[rand() % DIM(Tag_len)];
+                p->dir = (rand() & 1) ? ISAL_AES_GCM_DECRYPT : ISAL_AES_GCM_ENCRYPT;
+                p->done = 0;
+                if (ref_gcm_enc(klen, p, &key_data[i]) != 0)
+                        return 1;
+
+                if (i % IN_PLACE_STRIDE == 0)
+                        memcpy(p->out, (p->dir == ISAL_AES_GCM_DECRYPT) ? p->ct : p->pt,
+                               p->len);
+                else
+                        memset(p->out, 0, TEST_LEN);
+                memset(p->tag, 0, sizeof(p->tag));
+
+                if (isal_aes_gcm_ctx_init(&ctxpool[i], &key_data[i], p->dir) != 0)
+                        return 1;
+                ctxpool[i].user_data = (void *) (uintptr_t) i;
+        }
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                struct packet *p = &packets[i];
+                const uint8_t *src = (p->dir == ISAL_AES_GCM_DECRYPT) ? p->ct : p->pt;
+
+                if (i % IN_PLACE_STRIDE == 0)
+                        src = p->out;
+                if (isal_aes_gcm_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, p->out, src, p->len,
+                                                p->iv, p->aad, p->aad_len, p->tag,
+                                                p->tag_len) != 0)
+                        return 1;
+                if (ctx != NULL)
+                        ctx_done(ctx);
+        }
+
+        if (isal_aes_gcm_ctx_mgr_flush(mgr, &ctx) != 0)
+                return 1;
+        while (ctx != NULL) {
+                ctx_done(ctx);
+                if (isal_aes_gcm_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return 1;
+        }
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                struct packet *p = &packets[i];
+                const uint8_t *expected = (p->dir == ISAL_AES_GCM_DECRYPT) ? p->pt : p->ct;
+
+                if (p->done != 1 || !isal_hash_ctx_complete(&ctxpool[i])) {
+                        printf("Packet %d not complete\n", i);
+                        return 1;
+                }
+                if (memcmp(p->out, expected, p->len) != 0) {
+                        printf("Packet %d %s output mismatch, len %lu\n", i,
+                               (p->dir == ISAL_AES_GCM_DECRYPT) ? "dec" : "enc",
+                               (unsigned long) p->len);
+                        return 1;
+                }
+                if (memcmp(p->tag, p->ref_tag, p->tag_len) != 0) {
+                        printf("Packet %d %s tag mismatch, len %lu aad_len %lu\n", i,
+                               (p->dir == ISAL_AES_GCM_DECRYPT) ? "dec" : "enc",
+                               (unsigned long) p->len, (unsigned long) p->aad_len);
+                        return 1;
+                }
+        }
+        return 0;
+}
+
+int
+main(void)
+{
+        ISAL_AES_GCM_CTX_MGR *mgr = NULL;
+        ISAL_AES_GCM_CTX *ctxpool = NULL;
+        int i, k, fail = 0;
+
+        printf("AES-GCM multi-buffer test, %d sets of %d packets: ", RANDOMS, TEST_BUFS);
+        srand(TEST_SEED);
+
+        if (posix_memalign((void **) &mgr, 64, sizeof(*mgr)) != 0 ||
+            posix_memalign((void **) &ctxpool, 16, sizeof(*ctxpool) * TEST_BUFS) != 0) {
+                printf("alloc error: Fail");
+                return 1;
+        }
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                packets[i].pt = malloc(TEST_LEN);
+                packets[i].ct = malloc(TEST_LEN);
+                packets[i].out = malloc(TEST_LEN);
+                if (packets[i].pt == NULL || packets[i].ct == NULL || packets[i].out == NULL) {
+                        printf("malloc error: Fail");
+                        fail = 1;
+                        goto exit;
+                }
+        }
+
+        for (i = 0; i < RANDOMS; i++) {
+                for (k = 0; k < (int) DIM(Klen); k++) {
+                        fail = run_test(mgr, ctxpool, Klen[k]);
+                        if (fail) {
+                                printf("Key size %d: Fail\n", (int) Klen[k] * 8);
+                                goto exit;
+                        }
+                        printf(".");
+                }
+        }
+        printf(" Pass\n");
+
+exit:
+        for (i = 0; i < TEST_BUFS; i++) {
+                free(packets[i].pt);
+                free(packets[i].ct);
+                free(packets[i].out);
+        }
+        aligned_free(ctxpool);
+        aligned_free(mgr);
+
+        return fail;
+}
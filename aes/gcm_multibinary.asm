@@ -106,6 +106,16 @@ extern _aes_gcm_dec_256_finalize_vaes_avx512
 extern _aes_gcm_enc_256_vaes_avx512
 extern _aes_gcm_dec_256_vaes_avx512
 
+extern _ghash_sse
+extern _ghash_avx_gen2
+extern _ghash_avx_gen4
+extern _ghash_vaes_avx512
+
+extern _ghash_ctx_sse
+extern _ghash_ctx_avx_gen2
+extern _ghash_ctx_avx_gen4
+extern _ghash_ctx_vaes_avx512
+
 section .text
 
 %include "multibinary.asm"
@@ -164,6 +174,15 @@ mbin_dispatch_init7 _aes_gcm_dec_256_finalize, _aes_gcm_dec_256_finalize_sse, _a
 mbin_interface     _aes_gcm_precomp_256
 mbin_dispatch_init7 _aes_gcm_precomp_256, _aes_gcm_precomp_256_sse, _aes_gcm_precomp_256_sse, _aes_gcm_precomp_256_avx_gen2, _aes_gcm_precomp_256_avx_gen4, _aes_gcm_precomp_256_avx_gen4, _aes_gcm_precomp_256_vaes_avx512
 
+;;;;
+; instantiate GHASH interface, independent of the AES key size
+;;;;
+mbin_interface     _ghash
+mbin_dispatch_init7 _ghash, _ghash_sse, _ghash_sse, _ghash_avx_gen2, _ghash_avx_gen4, _ghash_avx_gen4, _ghash_vaes_avx512
+
+mbin_interface     _ghash_ctx
+mbin_dispatch_init7 _ghash_ctx, _ghash_ctx_sse, _ghash_ctx_sse, _ghash_ctx_avx_gen2, _ghash_ctx_avx_gen4, _ghash_ctx_avx_gen4, _ghash_ctx_vaes_avx512
+
 
 ;;;       func				core, ver, snum
 slversion _aes_gcm_enc_128,		00,   00,  02c0
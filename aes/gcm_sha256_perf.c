@@ -0,0 +1,165 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <aes_gcm.h>
+#include <aes_gcm_sha256.h>
+#include "types.h"
+#include "test.h"
+
+// Set number of outstanding jobs
+#define TEST_BUFS 16
+
+#ifndef GT_L3_CACHE
+#define GT_L3_CACHE 32 * 1024 * 1024 /* some number > last level cache */
+#endif
+
+#if !defined(COLD_TEST) && !defined(TEST_CUSTOM)
+// Cached test, loop many times over small dataset
+#define TEST_LEN      64 * 1024
+#define TEST_LOOPS    400
+#define TEST_TYPE_STR "_warm"
+#elif defined(COLD_TEST)
+// Uncached test.  Pull from large mem base.
+#define TEST_LEN      (2 * GT_L3_CACHE / TEST_BUFS)
+#define TEST_LOOPS    20
+#define TEST_TYPE_STR "_cold"
+#endif
+
+int
+main(void)
+{
+        ISAL_SHA256_HASH_CTX_MGR *sha_mgr = NULL;
+        ISAL_AES_GCM_SHA256_CTX_MGR *mgr = NULL;
+        ISAL_SHA256_HASH_CTX sha_ctxpool[TEST_BUFS], *sha_ctx;
+        ISAL_AES_GCM_SHA256_CTX *ctxpool = NULL, *ctx;
+        struct isal_gcm_context_data gctx;
+        struct isal_gcm_key_data gkey;
+        uint8_t key[ISAL_GCM_128_KEY_LEN], iv[ISAL_GCM_IV_LEN];
+        uint8_t tag[TEST_BUFS][ISAL_GCM_MAX_TAG_LEN], ref_tag[TEST_BUFS][ISAL_GCM_MAX_TAG_LEN];
+        uint8_t *bufs[TEST_BUFS], *outs[TEST_BUFS];
+        uint32_t i, t, fail = 0;
+        struct perf start, stop;
+
+        if (posix_memalign((void **) &sha_mgr, 64, sizeof(*sha_mgr)) != 0 ||
+            posix_memalign((void **) &mgr, 64, sizeof(*mgr)) != 0 ||
+            posix_memalign((void **) &ctxpool, 16, sizeof(*ctxpool) * TEST_BUFS) != 0) {
+                printf("alloc error: Fail");
+                return -1;
+        }
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                bufs[i] = (uint8_t *) malloc(TEST_LEN);
+                outs[i] = (uint8_t *) malloc(TEST_LEN);
+                if (bufs[i] == NULL || outs[i] == NULL) {
+                        printf("malloc failed test aborted\n");
+                        return 1;
+                }
+                memset(bufs[i], i, TEST_LEN);
+                isal_hash_ctx_init(&sha_ctxpool[i]);
+                isal_hash_ctx_init(&ctxpool[i]);
+        }
+        memset(key, 0x5a, sizeof(key));
+        memset(iv, 0xa5, sizeof(iv));
+
+        if (isal_aes_gcm_pre_128(key, &gkey) || isal_sha256_ctx_mgr_init(sha_mgr) ||
+            isal_aes_gcm_sha256_ctx_mgr_init(mgr, ISAL_GCM_128_KEY_LEN))
+                return 1;
+
+        // Start separate pass tests, data read by AES-GCM then again by SHA256
+        perf_start(&start);
+        for (t = 0; t < TEST_LOOPS; t++) {
+                for (i = 0; i < TEST_BUFS; i++)
+                        isal_aes_gcm_enc_128(&gkey, &gctx, outs[i], bufs[i], TEST_LEN, iv, NULL, 0,
+                                             ref_tag[i], ISAL_GCM_MAX_TAG_LEN);
+                for (i = 0; i < TEST_BUFS; i++)
+                        isal_sha256_ctx_mgr_submit(sha_mgr, &sha_ctxpool[i], &sha_ctx, bufs[i],
+                                                   TEST_LEN, ISAL_HASH_ENTIRE);
+                do {
+                        isal_sha256_ctx_mgr_flush(sha_mgr, &sha_ctx);
+                } while (sha_ctx != NULL);
+        }
+        perf_stop(&stop);
+
+        printf("aes_gcm_enc_128_sha256_separate" TEST_TYPE_STR ": ");
+        perf_print(stop, start, (long long) TEST_LEN * i * t);
+
+        // Start stitched tests, one pass over the data
+        perf_start(&start);
+        for (t = 0; t < TEST_LOOPS; t++) {
+                for (i = 0; i < TEST_BUFS; i++) {
+                        isal_aes_gcm_init_128(&gkey, &ctxpool[i].gcm, iv, NULL, 0);
+                        if (isal_aes_gcm_sha256_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, &gkey,
+                                                               outs[i], bufs[i], TEST_LEN,
+                                                               ISAL_HASH_ENTIRE))
+                                return 1;
+                }
+                do {
+                        if (isal_aes_gcm_sha256_ctx_mgr_flush(mgr, &ctx))
+                                return 1;
+                } while (ctx != NULL);
+                for (i = 0; i < TEST_BUFS; i++)
+                        isal_aes_gcm_enc_128_finalize(&gkey, &ctxpool[i].gcm, tag[i],
+                                                      ISAL_GCM_MAX_TAG_LEN);
+        }
+        perf_stop(&stop);
+
+        printf("aes_gcm_enc_128_sha256_stitched" TEST_TYPE_STR ": ");
+        perf_print(stop, start, (long long) TEST_LEN * i * t);
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                if (memcmp(tag[i], ref_tag[i], ISAL_GCM_MAX_TAG_LEN) ||
+                    memcmp(ctxpool[i].sha256.job.result_digest, sha_ctxpool[i].job.result_digest,
+                           sizeof(sha_ctxpool[i].job.result_digest))) {
+                        fail++;
+                        printf("Test%d, tag or digest mismatch\n", i);
+                }
+        }
+
+        printf("AES-GCM + SHA256 test complete %d buffers of %d B with "
+               "%d iterations\n",
+               TEST_BUFS, TEST_LEN, TEST_LOOPS);
+
+        if (fail)
+                printf("Test failed function check %d\n", fail);
+        else
+                printf(" gcm_sha256_perf: Pass\n");
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                free(bufs[i]);
+                free(outs[i]);
+        }
+        aligned_free(ctxpool);
+        aligned_free(mgr);
+        aligned_free(sha_mgr);
+
+        return fail;
+}
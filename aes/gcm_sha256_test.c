@@ -0,0 +1,316 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <aes_gcm.h>
+#include <aes_gcm_sha256.h>
+#include "types.h"
+#include "test.h"
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+#ifndef RANDOMS
+#define RANDOMS 2
+#endif
+#define TEST_BUFS       23
+#define TEST_LEN        (3 * ISAL_AES_GCM_SHA256_TILE_SIZE + 33)
+#define MAX_AAD_LEN     80
+#define IN_PLACE_STRIDE 5 // every 5th packet is processed in place
+
+static const uint32_t Klen[] = { ISAL_GCM_128_KEY_LEN, ISAL_GCM_256_KEY_LEN };
+
+struct packet {
+        uint8_t *pt;
+        uint8_t *ct;
+        uint8_t *out;
+        uint8_t key[ISAL_GCM_256_KEY_LEN];
+        uint8_t iv[ISAL_GCM_IV_LEN];
+        uint8_t aad[MAX_AAD_LEN];
+        uint8_t ref_tag[ISAL_GCM_MAX_TAG_LEN];
+        uint8_t tag[ISAL_GCM_MAX_TAG_LEN];
+        uint32_t ref_digest[ISAL_SHA256_DIGEST_NWORDS];
+        uint64_t len;
+        uint64_t aad_len;
+        int done;
+};
+
+static struct isal_gcm_key_data key_data[TEST_BUFS];
+static struct packet packets[TEST_BUFS];
+
+static void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        uint32_t i;
+        for (i = 0; i < size; i++)
+                *data++ = rand();
+}
+
+static int
+ref_gcm_enc(const uint32_t klen, struct packet *p, const struct isal_gcm_key_data *kd)
+{
+        struct isal_gcm_context_data gctx;
+
+        if (klen == ISAL_GCM_128_KEY_LEN)
+                return isal_aes_gcm_enc_128(kd, &gctx, p->ct, p->pt, p->len, p->iv, p->aad,
+                                            p->aad_len, p->ref_tag, ISAL_GCM_MAX_TAG_LEN);
+        return isal_aes_gcm_enc_256(kd, &gctx, p->ct, p->pt, p->len, p->iv, p->aad, p->aad_len,
+                                    p->ref_tag, ISAL_GCM_MAX_TAG_LEN);
+}
+
+static int
+ref_sha256(ISAL_SHA256_HASH_CTX_MGR *mgr, struct packet *p)
+{
+        ISAL_SHA256_HASH_CTX ctx, *ctx_out;
+
+        isal_hash_ctx_init(&ctx);
+        if (isal_sha256_ctx_mgr_submit(mgr, &ctx, &ctx_out, p->pt, (uint32_t) p->len,
+                                       ISAL_HASH_ENTIRE) != 0)
+                return 1;
+        while (ctx_out == NULL)
+                if (isal_sha256_ctx_mgr_flush(mgr, &ctx_out) != 0)
+                        return 1;
+        memcpy(p->ref_digest, ctx.job.result_digest, sizeof(p->ref_digest));
+
+        return 0;
+}
+
+static int
+key_pre(const uint32_t klen, const uint8_t *key, struct isal_gcm_key_data *kd)
+{
+        if (klen == ISAL_GCM_128_KEY_LEN)
+                return isal_aes_gcm_pre_128(key, kd);
+        return isal_aes_gcm_pre_256(key, kd);
+}
+
+static int
+gcm_init(const uint32_t klen, ISAL_AES_GCM_SHA256_CTX *ctx, struct packet *p,
+         const struct isal_gcm_key_data *kd)
+{
+        if (klen == ISAL_GCM_128_KEY_LEN)
+                return isal_aes_gcm_init_128(kd, &ctx->gcm, p->iv, p->aad, p->aad_len);
+        return isal_aes_gcm_init_256(kd, &ctx->gcm, p->iv, p->aad, p->aad_len);
+}
+
+static int
+gcm_finalize(const uint32_t klen, ISAL_AES_GCM_SHA256_CTX *ctx, struct packet *p,
+             const struct isal_gcm_key_data *kd)
+{
+        if (klen == ISAL_GCM_128_KEY_LEN)
+                return isal_aes_gcm_enc_128_finalize(kd, &ctx->gcm, p->tag, ISAL_GCM_MAX_TAG_LEN);
+        return isal_aes_gcm_enc_256_finalize(kd, &ctx->gcm, p->tag, ISAL_GCM_MAX_TAG_LEN);
+}
+
+static void
+ctx_done(ISAL_AES_GCM_SHA256_CTX *ctx)
+{
+        packets[(uintptr_t) ctx->user_data].done++;
+}
+
+static int
+check_packet(const uint32_t klen, ISAL_AES_GCM_SHA256_CTX *ctxpool, const int i)
+{
+        struct packet *p = &packets[i];
+
+        if (p->done != 1 || !isal_hash_ctx_complete(&ctxpool[i])) {
+                printf("Packet %d not complete\n", i);
+                return 1;
+        }
+        if (gcm_finalize(klen, &ctxpool[i], p, &key_data[i]) != 0)
+                return 1;
+        if (memcmp(p->out, p->ct, p->len) != 0) {
+                printf("Packet %d output mismatch, len %lu\n", i, (unsigned long) p->len);
+                return 1;
+        }
+        if (memcmp(p->tag, p->ref_tag, ISAL_GCM_MAX_TAG_LEN) != 0) {
+                printf("Packet %d tag mismatch, len %lu aad_len %lu\n", i,
+                       (unsigned long) p->len, (unsigned long) p->aad_len);
+                return 1;
+        }
+        if (memcmp(ctxpool[i].sha256.job.result_digest, p->ref_digest, sizeof(p->ref_digest))) {
+                printf("Packet %d digest mismatch, len %lu\n", i, (unsigned long) p->len);
+                return 1;
+        }
+        return 0;
+}
+
+static int
+run_test(ISAL_AES_GCM_SHA256_CTX_MGR *mgr, ISAL_SHA256_HASH_CTX_MGR *sha_mgr,
+         ISAL_AES_GCM_SHA256_CTX *ctxpool, const uint32_t klen)
+{
+        ISAL_AES_GCM_SHA256_CTX *ctx;
+        uint64_t pos, update_len;
+        ISAL_HASH_CTX_FLAG flags;
+        int i;
+
+        if (isal_aes_gcm_sha256_ctx_mgr_init(mgr, klen) != 0)
+                return 1;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                struct packet *p = &packets[i];
+
+                mk_rand_data(p->key, sizeof(p->key));
+                mk_rand_data(p->iv, sizeof(p->iv));
+                mk_rand_data(p->aad, sizeof(p->aad));
+                mk_rand_data(p->pt, TEST_LEN);
+                if (key_pre(klen, p->key, &key_data[i]) != 0)
+                        return 1;
+
+                // Mix of short and multi-tile packets, including empty ones
+                p->len = (i % 4 == 0) ? rand() % 64 : rand() % (TEST_LEN + 1);
+                p->aad_len = rand() % (MAX_AAD_LEN + 1);
+                p->done = 0;
+                if (ref_gcm_enc(klen, p, &key_data[i]) != 0 || ref_sha256(sha_mgr, p) != 0)
+                        return 1;
+
+                if (i % IN_PLACE_STRIDE == 0)
+                        memcpy(p->out, p->pt, p->len);
+                else
+                        memset(p->out, 0, TEST_LEN);
+                memset(p->tag, 0, sizeof(p->tag));
+
+                isal_hash_ctx_init(&ctxpool[i]);
+                ctxpool[i].user_data = (void *) (uintptr_t) i;
+                if (gcm_init(klen, &ctxpool[i], p, &key_data[i]) != 0)
+                        return 1;
+        }
+
+        // All packets in flight at once
+        for (i = 0; i < TEST_BUFS; i++) {
+                struct packet *p = &packets[i];
+                const uint8_t *src = (i % IN_PLACE_STRIDE == 0) ? p->out : p->pt;
+
+                if (isal_aes_gcm_sha256_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, &key_data[i],
+                                                       p->out, src, p->len,
+                                                       ISAL_HASH_ENTIRE) != 0)
+                        return 1;
+                if (ctx != NULL)
+                        ctx_done(ctx);
+        }
+
+        if (isal_aes_gcm_sha256_ctx_mgr_flush(mgr, &ctx) != 0)
+                return 1;
+        while (ctx != NULL) {
+                ctx_done(ctx);
+                if (isal_aes_gcm_sha256_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return 1;
+        }
+
+        for (i = 0; i < TEST_BUFS; i++)
+                if (check_packet(klen, ctxpool, i))
+                        return 1;
+
+        // One packet streamed in random sized updates
+        i = TEST_BUFS - 1;
+        packets[i].done = 0;
+        memset(packets[i].out, 0, TEST_LEN);
+        isal_hash_ctx_init(&ctxpool[i]);
+        if (gcm_init(klen, &ctxpool[i], &packets[i], &key_data[i]) != 0)
+                return 1;
+        pos = 0;
+        do {
+                update_len = rand() % (2 * ISAL_AES_GCM_SHA256_TILE_SIZE + 1);
+                flags = (pos == 0) ? ISAL_HASH_FIRST : ISAL_HASH_UPDATE;
+                if (update_len >= packets[i].len - pos) {
+                        update_len = packets[i].len - pos;
+                        flags |= ISAL_HASH_LAST;
+                }
+                if (isal_aes_gcm_sha256_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, &key_data[i],
+                                                       packets[i].out + pos, packets[i].pt + pos,
+                                                       update_len, flags) != 0)
+                        return 1;
+                while (ctx == NULL)
+                        if (isal_aes_gcm_sha256_ctx_mgr_flush(mgr, &ctx) != 0 || ctx == NULL)
+                                return 1;
+                pos += update_len;
+        } while (!(flags & ISAL_HASH_LAST));
+        packets[i].done = 1;
+
+        return check_packet(klen, ctxpool, i);
+}
+
+int
+main(void)
+{
+        ISAL_AES_GCM_SHA256_CTX_MGR *mgr = NULL;
+        ISAL_SHA256_HASH_CTX_MGR *sha_mgr = NULL;
+        ISAL_AES_GCM_SHA256_CTX *ctxpool = NULL;
+        int i, k, fail = 0;
+
+        printf("AES-GCM + SHA256 test, %d sets of %d packets: ", RANDOMS, TEST_BUFS);
+        srand(TEST_SEED);
+
+        if (posix_memalign((void **) &mgr, 64, sizeof(*mgr)) != 0 ||
+            posix_memalign((void **) &sha_mgr, 64, sizeof(*sha_mgr)) != 0 ||
+            posix_memalign((void **) &ctxpool, 16, sizeof(*ctxpool) * TEST_BUFS) != 0) {
+                printf("alloc error: Fail");
+                return 1;
+        }
+        if (isal_sha256_ctx_mgr_init(sha_mgr) != 0) {
+                printf("init error: Fail");
+                return 1;
+        }
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                packets[i].pt = malloc(TEST_LEN);
+                packets[i].ct = malloc(TEST_LEN);
+                packets[i].out = malloc(TEST_LEN);
+                if (packets[i].pt == NULL || packets[i].ct == NULL || packets[i].out == NULL) {
+                        printf("malloc error: Fail");
+                        fail = 1;
+                        goto exit;
+                }
+        }
+
+        for (i = 0; i < RANDOMS; i++) {
+                for (k = 0; k < (int) DIM(Klen); k++) {
+                        fail = run_test(mgr, sha_mgr, ctxpool, Klen[k]);
+                        if (fail) {
+                                printf("Key size %d: Fail\n", (int) Klen[k] * 8);
+                                goto exit;
+                        }
+                        printf(".");
+                }
+        }
+        printf(" Pass\n");
+
+exit:
+        for (i = 0; i < TEST_BUFS; i++) {
+                free(packets[i].pt);
+                free(packets[i].ct);
+                free(packets[i].out);
+        }
+        aligned_free(ctxpool);
+        aligned_free(sha_mgr);
+        aligned_free(mgr);
+
+        return fail;
+}
@@ -269,3 +269,57 @@ FN_NAME(dec,_):
 %endif ;; SAFE_DATA
         FUNC_RESTORE
         ret
+
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;void   _ghash_vaes_avx512 / _ghash_ctx_vaes_avx512
+;        const struct isal_gcm_key_data *key_data,
+;        u8      *hash,
+;        const   u8 *in,
+;        u64     len);
+; _ghash takes the hash in GCM byte order, _ghash_ctx in the aad_hash layout of
+; isal_gcm_context_data. len must be a multiple of 16.
+; Only depends on the hash key powers, so it is emitted once for all key sizes.
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+%ifdef GCM128_MODE
+%ifnidn FUNCT_EXTENSION, _nt
+%macro GHASH_UPDATE 1
+%define %%HASH_ORDER %1  ; gcm: GCM byte order, ctx: isal_gcm_context_data aad_hash layout
+
+        FUNC_SAVE small_frame
+
+        vmovdqu         xmm14, [arg2]
+%ifidn %%HASH_ORDER, gcm
+        vpshufb         xmm14, [rel SHUF_MASK]
+%endif
+
+        ;; 32/16 block aggregated GHASH shared with the AAD path
+        CALC_AAD_HASH   arg3, arg4, xmm14, arg1, \
+                        zmm1, zmm3, zmm4, zmm5, zmm6, zmm7, zmm8, zmm9, zmm10, zmm11, \
+                        zmm12, zmm13, zmm15, zmm16, zmm17, zmm18, zmm19, zmm20, \
+                        r10, r11, r12, k1
+
+%ifidn %%HASH_ORDER, gcm
+        vpshufb         xmm14, [rel SHUF_MASK]
+%endif
+        vmovdqu         [arg2], xmm14
+
+%ifdef SAFE_DATA
+        clear_scratch_zmms_asm
+%endif ;; SAFE_DATA
+        FUNC_RESTORE
+%endmacro
+
+global _ghash_vaes_avx512
+_ghash_vaes_avx512:
+        endbranch
+        GHASH_UPDATE gcm
+        ret
+
+global _ghash_ctx_vaes_avx512
+_ghash_ctx_vaes_avx512:
+        endbranch
+        GHASH_UPDATE ctx
+        ret
+
+%endif	; _nt
+%endif	; GCM128_MODE
@@ -0,0 +1,163 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h> // for rand
+#include <string.h> // for memcmp
+#include <aes_gcm.h>
+#include <test.h>
+#include "ossl_helper.h"
+
+#ifndef GT_L3_CACHE
+#define GT_L3_CACHE 32 * 1024 * 1024 /* some number > last level cache */
+#endif
+
+#if !defined(COLD_TEST) && !defined(TEST_CUSTOM)
+// Cached test, loop many times over small dataset
+#define TEST_LEN      8 * 1024
+#define TEST_LOOPS    400000
+#define TEST_TYPE_STR "_warm"
+#elif defined(COLD_TEST)
+// Uncached test.  Pull from large mem base.
+#define TEST_LEN      (2 * GT_L3_CACHE)
+#define TEST_LOOPS    50
+#define TEST_TYPE_STR "_cold"
+#endif
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+typedef int (*gcm_pre_func)(const void *, struct isal_gcm_key_data *);
+typedef int (*gmac_init_func)(const struct isal_gcm_key_data *, struct isal_gmac_context_data *,
+                              const uint8_t *);
+typedef int (*ossl_gcm_func)(uint8_t *, uint8_t *, uint64_t, uint8_t *, uint64_t, uint8_t *,
+                             uint64_t, uint8_t *, uint64_t, uint8_t *);
+
+static unsigned char *aad = NULL;
+
+static uint8_t test_key[ISAL_GCM_256_KEY_LEN];
+static uint8_t test_iv[ISAL_GCM_IV_LEN];
+
+void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        unsigned int i;
+        for (i = 0; i < size; i++) {
+                *data++ = rand();
+        }
+}
+
+static void
+isal_gmac(const struct isal_gcm_key_data *gkey, gmac_init_func gmac_init, uint8_t *tag)
+{
+        struct isal_gmac_context_data gctx;
+
+        gmac_init(gkey, &gctx, test_iv);
+        isal_aes_gmac_update(gkey, &gctx, aad, TEST_LEN);
+        isal_aes_gmac_finalize(gkey, &gctx, tag, ISAL_GCM_MAX_TAG_LEN);
+}
+
+int
+aes_gmac_perf(const int key_bits, gcm_pre_func gcm_pre, gmac_init_func gmac_init,
+              ossl_gcm_func ossl_gcm)
+{
+        int i;
+        struct isal_gcm_key_data gkey;
+        uint8_t tag[ISAL_GCM_MAX_TAG_LEN], ossl_tag[ISAL_GCM_MAX_TAG_LEN];
+        uint8_t dummy[ISAL_GCM_BLOCK_LEN];
+
+        gcm_pre(test_key, &gkey);
+
+        // Preload code cache and check results
+        isal_gmac(&gkey, gmac_init, tag);
+        ossl_gcm(test_key, test_iv, sizeof(test_iv), aad, TEST_LEN, ossl_tag, sizeof(ossl_tag),
+                 dummy, 0, dummy);
+        if (memcmp(tag, ossl_tag, sizeof(tag))) {
+                printf("ISA-L vs OpenSSL aes_gmac_%d mismatch\n", key_bits);
+                return 1;
+        }
+
+        {
+                struct perf start, stop;
+
+                perf_start(&start);
+                for (i = 0; i < TEST_LOOPS; i++) {
+                        isal_gmac(&gkey, gmac_init, tag);
+                }
+
+                perf_stop(&stop);
+                printf("ISA-L__aes_gmac_%d" TEST_TYPE_STR ":   ", key_bits);
+                perf_print(stop, start, (long long) TEST_LEN * i);
+        }
+        {
+                struct perf start, stop;
+
+                perf_start(&start);
+                for (i = 0; i < TEST_LOOPS; i++) {
+                        ossl_gcm(test_key, test_iv, sizeof(test_iv), aad, TEST_LEN, ossl_tag,
+                                 sizeof(ossl_tag), dummy, 0, dummy);
+                }
+
+                perf_stop(&stop);
+                printf("OpenSSL_aes_gmac_%d" TEST_TYPE_STR ":  ", key_bits);
+                perf_print(stop, start, (long long) TEST_LEN * i);
+        }
+        printf("\n");
+
+        return 0;
+}
+
+int
+main(void)
+{
+        uint32_t OK = 0;
+
+        srand(TEST_SEED);
+
+        aad = malloc(TEST_LEN);
+        if (NULL == aad) {
+                printf("malloc of testsize:0x%x failed\n", TEST_LEN);
+                return 1;
+        }
+
+        mk_rand_data(aad, TEST_LEN);
+        mk_rand_data(test_key, sizeof(test_key));
+        mk_rand_data(test_iv, sizeof(test_iv));
+        printf("AES GMAC ISA-L vs OpenSSL performance:\n");
+
+        OK += aes_gmac_perf(128, isal_aes_gcm_pre_128, isal_aes_gmac_init_128,
+                            openssl_aes_gcm_enc);
+        OK += aes_gmac_perf(256, isal_aes_gcm_pre_256, isal_aes_gmac_init_256,
+                            openssl_aes_256_gcm_enc);
+
+        free(aad);
+
+        return OK;
+}
@@ -0,0 +1,312 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <aes_gcm.h>
+#include "test.h"
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+#define MAX_TEST_LEN  (4 * 1024 + 64)
+#define RANDOMS       200
+
+typedef struct gmac_vector {
+        const uint8_t *K;
+        uint64_t Klen;
+        const uint8_t *IV;
+        const uint8_t *A;
+        uint64_t Alen;
+        const uint8_t *T;
+} gmac_vector;
+
+/* GCM specification test case 1: zero key and IV, no data */
+static const uint8_t K1[16] = { 0 };
+static const uint8_t IV1[12] = { 0 };
+static const uint8_t T1[16] = { 0x58, 0xe2, 0xfc, 0xce, 0xfa, 0x7e, 0x30, 0x61,
+                                0x36, 0x7f, 0x1d, 0x57, 0xa4, 0xe7, 0x45, 0x5a };
+
+/* GCM specification test case 13: zero 256 bit key and IV, no data */
+static const uint8_t K2[32] = { 0 };
+static const uint8_t T2[16] = { 0x53, 0x0f, 0x8a, 0xfb, 0xc7, 0x45, 0x36, 0xb9,
+                                0xa9, 0x63, 0xb4, 0xf1, 0xc4, 0xcb, 0x73, 0x8b };
+
+/* NIST CAVP gcmEncryptExtIV128, Keylen = 128, PTlen = 0, AADlen = 128, Count = 0 */
+static const uint8_t K3[16] = { 0x77, 0xbe, 0x63, 0x70, 0x89, 0x71, 0xc4, 0xe2,
+                                0x40, 0xd1, 0xcb, 0x79, 0xe8, 0xd7, 0x7f, 0xeb };
+static const uint8_t IV3[12] = { 0xe0, 0xe0, 0x0f, 0x19, 0xfe, 0xd7,
+                                 0xba, 0x01, 0x36, 0xa7, 0x97, 0xf3 };
+static const uint8_t A3[16] = { 0x7a, 0x43, 0xec, 0x1d, 0x9c, 0x0a, 0x5a, 0x78,
+                                0xa0, 0xb1, 0x65, 0x33, 0xa6, 0x21, 0x3c, 0xab };
+static const uint8_t T3[16] = { 0x20, 0x9f, 0xcc, 0x8d, 0x36, 0x75, 0xed, 0x93,
+                                0x8e, 0x9c, 0x71, 0x66, 0x70, 0x9d, 0xd9, 0x46 };
+
+static const gmac_vector gmac_vectors[] = {
+        { K1, sizeof(K1), IV1, NULL, 0, T1 },
+        { K2, sizeof(K2), IV1, NULL, 0, T2 },
+        { K3, sizeof(K3), IV3, A3, sizeof(A3), T3 },
+};
+
+static void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        uint32_t i;
+
+        for (i = 0; i < size; i++)
+                *data++ = rand();
+}
+
+static void
+gcm_pre(const uint8_t *key, uint64_t key_len, struct isal_gcm_key_data *gkey)
+{
+        if (key_len == ISAL_GCM_256_KEY_LEN)
+                isal_aes_gcm_pre_256(key, gkey);
+        else
+                isal_aes_gcm_pre_128(key, gkey);
+}
+
+static void
+gmac_init(uint64_t key_len, const struct isal_gcm_key_data *gkey,
+          struct isal_gmac_context_data *ctx, const uint8_t *iv)
+{
+        if (key_len == ISAL_GCM_256_KEY_LEN)
+                isal_aes_gmac_init_256(gkey, ctx, iv);
+        else
+                isal_aes_gmac_init_128(gkey, ctx, iv);
+}
+
+/* Reference tag from the GCM API with an empty plaintext */
+static void
+gcm_aad_only(uint64_t key_len, const struct isal_gcm_key_data *gkey, const uint8_t *iv,
+             const uint8_t *aad, uint64_t aad_len, uint8_t *tag)
+{
+        struct isal_gcm_context_data gctx;
+
+        if (key_len == ISAL_GCM_256_KEY_LEN)
+                isal_aes_gcm_enc_256(gkey, &gctx, NULL, NULL, 0, iv, aad, aad_len, tag,
+                                     ISAL_GCM_MAX_TAG_LEN);
+        else
+                isal_aes_gcm_enc_128(gkey, &gctx, NULL, NULL, 0, iv, aad, aad_len, tag,
+                                     ISAL_GCM_MAX_TAG_LEN);
+}
+
+/* Feed the message to GMAC in random sized pieces */
+static void
+gmac_split(uint64_t key_len, const struct isal_gcm_key_data *gkey, const uint8_t *iv,
+           const uint8_t *in, uint64_t len, uint8_t *tag, uint64_t tag_len)
+{
+        struct isal_gmac_context_data ctx;
+        uint64_t done = 0;
+
+        gmac_init(key_len, gkey, &ctx, iv);
+        while (done < len) {
+                uint64_t piece = rand() % (len - done + 1);
+
+                if (rand() & 1)
+                        piece %= 2 * ISAL_GCM_BLOCK_LEN;
+                isal_aes_gmac_update(gkey, &ctx, in + done, piece);
+                done += piece;
+        }
+        isal_aes_gmac_finalize(gkey, &ctx, tag, tag_len);
+}
+
+static int
+test_gmac_std_vectors(void)
+{
+        struct isal_gcm_key_data gkey;
+        struct isal_gmac_context_data ctx;
+        uint8_t tag[ISAL_GCM_MAX_TAG_LEN];
+        int errors = 0;
+        size_t i;
+
+        printf("AES-GMAC standard test vectors:");
+        for (i = 0; i < DIM(gmac_vectors); i++) {
+                const gmac_vector *v = &gmac_vectors[i];
+
+                gcm_pre(v->K, v->Klen, &gkey);
+
+                gmac_init(v->Klen, &gkey, &ctx, v->IV);
+                isal_aes_gmac_update(&gkey, &ctx, v->A, v->Alen);
+                isal_aes_gmac_finalize(&gkey, &ctx, tag, sizeof(tag));
+                if (memcmp(tag, v->T, sizeof(tag)) != 0) {
+                        printf("\n  vector %zu: tag mismatch", i);
+                        errors++;
+                }
+
+                memset(tag, 0, sizeof(tag));
+                gmac_split(v->Klen, &gkey, v->IV, v->A, v->Alen, tag, 8);
+                if (memcmp(tag, v->T, 8) != 0) {
+                        printf("\n  vector %zu: split/truncated tag mismatch", i);
+                        errors++;
+                }
+                printf(".");
+        }
+        printf("\n");
+
+        return errors;
+}
+
+static int
+test_gmac_vs_gcm(uint64_t key_len)
+{
+        struct isal_gcm_key_data gkey;
+        uint8_t key[ISAL_GCM_256_KEY_LEN], iv[ISAL_GCM_IV_LEN];
+        uint8_t tag[ISAL_GCM_MAX_TAG_LEN], ref_tag[ISAL_GCM_MAX_TAG_LEN];
+        uint8_t *aad;
+        int errors = 0;
+        int t;
+
+        aad = malloc(MAX_TEST_LEN);
+        if (aad == NULL) {
+                printf("alloc error: Fail");
+                return 1;
+        }
+
+        printf("AES-%d-GMAC random tests vs AES-GCM:", (int) key_len * 8);
+        for (t = 0; t < RANDOMS; t++) {
+                const uint64_t len = (t < 64) ? t : rand() % MAX_TEST_LEN;
+
+                mk_rand_data(key, sizeof(key));
+                mk_rand_data(iv, sizeof(iv));
+                mk_rand_data(aad, len);
+                gcm_pre(key, key_len, &gkey);
+
+                gcm_aad_only(key_len, &gkey, iv, aad, len, ref_tag);
+                gmac_split(key_len, &gkey, iv, aad, len, tag, sizeof(tag));
+                if (memcmp(tag, ref_tag, sizeof(tag)) != 0) {
+                        printf("\n  len %llu: tag mismatch", (unsigned long long) len);
+                        errors++;
+                }
+                if (t % 20 == 0)
+                        printf(".");
+        }
+        printf("\n");
+        free(aad);
+
+        return errors;
+}
+
+static int
+test_ghash_update(uint64_t key_len)
+{
+        struct isal_gcm_key_data gkey;
+        uint8_t key[ISAL_GCM_256_KEY_LEN], iv[ISAL_GCM_IV_LEN];
+        uint8_t hash[ISAL_GCM_BLOCK_LEN], hash2[ISAL_GCM_BLOCK_LEN];
+        uint8_t len_block[ISAL_GCM_BLOCK_LEN];
+        uint8_t ek_j0[ISAL_GCM_MAX_TAG_LEN], ref_tag[ISAL_GCM_MAX_TAG_LEN];
+        uint8_t *aad;
+        int errors = 0;
+        int t, i;
+
+        aad = malloc(MAX_TEST_LEN);
+        if (aad == NULL) {
+                printf("alloc error: Fail");
+                return 1;
+        }
+
+        printf("AES-%d GHASH update tests:", (int) key_len * 8);
+        for (t = 0; t < RANDOMS; t++) {
+                const uint64_t len = rand() % MAX_TEST_LEN;
+                const uint64_t bits = len * 8;
+                uint64_t split = (rand() % (len + 1)) & ~(uint64_t) (ISAL_GCM_BLOCK_LEN - 1);
+
+                mk_rand_data(key, sizeof(key));
+                mk_rand_data(iv, sizeof(iv));
+                mk_rand_data(aad, len);
+                gcm_pre(key, key_len, &gkey);
+
+                /* tag = E(K, J0) ^ GHASH(A || pad || len(A) || 0) */
+                gcm_aad_only(key_len, &gkey, iv, NULL, 0, ek_j0);
+                gcm_aad_only(key_len, &gkey, iv, aad, len, ref_tag);
+
+                memset(len_block, 0, sizeof(len_block));
+                for (i = 0; i < 8; i++)
+                        len_block[i] = (uint8_t) (bits >> (56 - 8 * i));
+
+                memset(hash, 0, sizeof(hash));
+                isal_aes_gcm_ghash_update(&gkey, hash, aad, len);
+                isal_aes_gcm_ghash_update(&gkey, hash, len_block, sizeof(len_block));
+                for (i = 0; i < ISAL_GCM_BLOCK_LEN; i++)
+                        hash[i] ^= ek_j0[i];
+                if (memcmp(hash, ref_tag, sizeof(hash)) != 0) {
+                        printf("\n  len %llu: GHASH mismatch", (unsigned long long) len);
+                        errors++;
+                }
+
+                /* chaining over block aligned pieces matches one call */
+                memset(hash, 0, sizeof(hash));
+                memset(hash2, 0, sizeof(hash2));
+                isal_aes_gcm_ghash_update(&gkey, hash, aad, len);
+                isal_aes_gcm_ghash_update(&gkey, hash2, aad, split);
+                isal_aes_gcm_ghash_update(&gkey, hash2, aad + split, len - split);
+                if (memcmp(hash, hash2, sizeof(hash)) != 0) {
+                        printf("\n  len %llu split %llu: chained GHASH mismatch",
+                               (unsigned long long) len, (unsigned long long) split);
+                        errors++;
+                }
+                if (t % 20 == 0)
+                        printf(".");
+        }
+        printf("\n");
+        free(aad);
+
+        return errors;
+}
+
+int
+main(int argc, char **argv)
+{
+        int errors = 0;
+        int seed;
+
+        if (argc == 1)
+                seed = TEST_SEED;
+        else
+                seed = atoi(argv[1]);
+
+        srand(seed);
+        printf("SEED: %d\n", seed);
+
+        errors += test_gmac_std_vectors();
+        errors += test_gmac_vs_gcm(ISAL_GCM_128_KEY_LEN);
+        errors += test_gmac_vs_gcm(ISAL_GCM_256_KEY_LEN);
+        errors += test_ghash_update(ISAL_GCM_128_KEY_LEN);
+        errors += test_ghash_update(ISAL_GCM_256_KEY_LEN);
+
+        if (0 == errors)
+                printf("...Pass\n");
+        else
+                printf("...Fail\n");
+
+        return errors;
+}
@@ -424,4 +424,58 @@ openssl_aes_256_xts_dec(EVP_CIPHER_CTX *ctx, unsigned char *key, unsigned char *
         return 0;
 }
 
+static inline int
+openssl_aes_128_ctr(uint8_t *key, uint8_t *iv, uint64_t len, uint8_t *in, uint8_t *out)
+{
+        int outlen, tmplen;
+        EVP_CIPHER_CTX *ctx;
+        ctx = EVP_CIPHER_CTX_new();
+
+        if (!EVP_EncryptInit_ex(ctx, EVP_aes_128_ctr(), NULL, key, iv))
+                printf("\n ERROR!! EVP_EncryptInit_ex - EVP_aes_128_ctr\n");
+        if (!EVP_EncryptUpdate(ctx, out, &outlen, (const unsigned char *) in, (int) len))
+                printf("\n ERROR!! EVP_EncryptUpdate - EVP_aes_128_ctr\n");
+        if (!EVP_EncryptFinal_ex(ctx, out + outlen, &tmplen))
+                printf("\n ERROR!! EVP_EncryptFinal_ex - EVP_aes_128_ctr\n");
+
+        EVP_CIPHER_CTX_free(ctx);
+        return tmplen;
+}
+
+static inline int
+openssl_aes_192_ctr(uint8_t *key, uint8_t *iv, uint64_t len, uint8_t *in, uint8_t *out)
+{
+        int outlen, tmplen;
+        EVP_CIPHER_CTX *ctx;
+        ctx = EVP_CIPHER_CTX_new();
+
+        if (!EVP_EncryptInit_ex(ctx, EVP_aes_192_ctr(), NULL, key, iv))
+                printf("\n ERROR!! EVP_EncryptInit_ex - EVP_aes_192_ctr\n");
+        if (!EVP_EncryptUpdate(ctx, out, &outlen, (const unsigned char *) in, (int) len))
+                printf("\n ERROR!! EVP_EncryptUpdate - EVP_aes_192_ctr\n");
+        if (!EVP_EncryptFinal_ex(ctx, out + outlen, &tmplen))
+                printf("\n ERROR!! EVP_EncryptFinal_ex - EVP_aes_192_ctr\n");
+
+        EVP_CIPHER_CTX_free(ctx);
+        return tmplen;
+}
+
+static inline int
+openssl_aes_256_ctr(uint8_t *key, uint8_t *iv, uint64_t len, uint8_t *in, uint8_t *out)
+{
+        int outlen, tmplen;
+        EVP_CIPHER_CTX *ctx;
+        ctx = EVP_CIPHER_CTX_new();
+
+        if (!EVP_EncryptInit_ex(ctx, EVP_aes_256_ctr(), NULL, key, iv))
+                printf("\n ERROR!! EVP_EncryptInit_ex - EVP_aes_256_ctr\n");
+        if (!EVP_EncryptUpdate(ctx, out, &outlen, (const unsigned char *) in, (int) len))
+                printf("\n ERROR!! EVP_EncryptUpdate - EVP_aes_256_ctr\n");
+        if (!EVP_EncryptFinal_ex(ctx, out + outlen, &tmplen))
+                printf("\n ERROR!! EVP_EncryptFinal_ex - EVP_aes_256_ctr\n");
+
+        EVP_CIPHER_CTX_free(ctx);
+        return tmplen;
+}
+
 #endif /* AES_OSSL_HELPER_H_ */
@@ -0,0 +1,83 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("aes,avx"))), apply_to = function)
+#elif defined(__ICC)
+#pragma intel optimization_parameter target_arch = AVX
+#elif defined(__ICL)
+#pragma[intel] optimization_parameter target_arch = AVX
+#elif (__GNUC__ >= 5)
+#pragma GCC target("aes,avx")
+#endif
+
+#define XTS_MB_AVX_LANES        8
+#define XTS_MB_FOR_EACH_LANE(M) M(0) M(1) M(2) M(3) M(4) M(5) M(6) M(7)
+
+#include "xts_mb_lane_x86.h"
+
+void
+_aes_xts_128_enc_mb_x8_avx(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        xts_mb_lanes_x128(args, num_blocks, 10, ISAL_AES_XTS_ENCRYPT);
+}
+
+void
+_aes_xts_128_dec_mb_x8_avx(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        xts_mb_lanes_x128(args, num_blocks, 10, ISAL_AES_XTS_DECRYPT);
+}
+
+void
+_aes_xts_256_enc_mb_x8_avx(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        xts_mb_lanes_x128(args, num_blocks, 14, ISAL_AES_XTS_ENCRYPT);
+}
+
+void
+_aes_xts_256_dec_mb_x8_avx(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        xts_mb_lanes_x128(args, num_blocks, 14, ISAL_AES_XTS_DECRYPT);
+}
+
+#define XTS_MB_CTX_MGR_INIT_FUNCTION   _aes_xts_ctx_mgr_init_avx
+#define XTS_MB_CTX_MGR_SUBMIT_FUNCTION _aes_xts_ctx_mgr_submit_avx
+#define XTS_MB_CTX_MGR_FLUSH_FUNCTION  _aes_xts_ctx_mgr_flush_avx
+#define XTS_MB_128_ENC_FUNCTION        _aes_xts_128_enc_mb_x8_avx
+#define XTS_MB_128_DEC_FUNCTION        _aes_xts_128_dec_mb_x8_avx
+#define XTS_MB_256_ENC_FUNCTION        _aes_xts_256_enc_mb_x8_avx
+#define XTS_MB_256_DEC_FUNCTION        _aes_xts_256_dec_mb_x8_avx
+#define XTS_MB_JOB_START_FUNCTION      xts_mb_lane_job_start
+#define XTS_MB_JOB_END_FUNCTION        xts_mb_lane_job_end
+#define XTS_MB_LANES                   XTS_MB_AVX_LANES
+#include "xts_mb_ctx_base.c"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
@@ -0,0 +1,183 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("aes,avx512f,avx512bw,vaes"))),             \
+                             apply_to = function)
+#elif defined(__ICC)
+#pragma intel optimization_parameter target_arch = CORE-AVX512
+#elif defined(__ICL)
+#pragma[intel] optimization_parameter target_arch = CORE-AVX512
+#elif (__GNUC__ >= 5)
+#pragma GCC target("aes,avx512f,avx512bw,vaes")
+#endif
+
+#include "xts_mb_lane_x86.h"
+
+#define XTS_MB_AVX512_LANES             16
+#define XTS_MB_AVX512_FOR_EACH_GROUP(M) M(0) M(1) M(2) M(3)
+
+/* T = T * alpha on 4 lanes at once, see xts_mb_mul_alpha() */
+static inline __m512i
+xts_mb_mul_alpha_x4(const __m512i t, const __m512i poly)
+{
+        const __m512i c = _mm512_shuffle_epi32(_mm512_srai_epi32(t, 31), 0x93);
+
+        return _mm512_ternarylogic_epi32(_mm512_add_epi32(t, t), c, poly, 0x78);
+}
+
+/*
+ * Each ZMM register carries the tweaks or AES state of 4 lanes, one per 128-bit
+ * slot. Round keys are interleaved by lane in args, so the keys of 4 lanes for
+ * one round are a single 64-byte load. All groups load their input before any
+ * group stores, so lanes duplicated by flush may work in place.
+ */
+#define XTS_GROUP_DECLARE(g)                                                                       \
+        __m512i t##g = _mm512_loadu_si512((const void *) args->tweak[4 * (g)]);                    \
+        __m512i s##g;
+
+#define XTS_GROUP_START(g)                                                                         \
+        s##g = _mm512_castsi128_si512(_mm_loadu_si128((const __m128i *) (in[4 * (g)] + offset))); \
+        s##g = _mm512_inserti32x4(                                                                 \
+                s##g, _mm_loadu_si128((const __m128i *) (in[4 * (g) + 1] + offset)), 1);           \
+        s##g = _mm512_inserti32x4(                                                                 \
+                s##g, _mm_loadu_si128((const __m128i *) (in[4 * (g) + 2] + offset)), 2);           \
+        s##g = _mm512_inserti32x4(                                                                 \
+                s##g, _mm_loadu_si128((const __m128i *) (in[4 * (g) + 3] + offset)), 3);           \
+        s##g = _mm512_ternarylogic_epi64(                                                          \
+                s##g, t##g, _mm512_loadu_si512((const void *) keys[0][4 * (g)]), 0x96);
+
+#define XTS_GROUP_ENC_ROUND(g)                                                                     \
+        s##g = _mm512_aesenc_epi128(s##g, _mm512_loadu_si512((const void *) keys[r][4 * (g)]));
+
+#define XTS_GROUP_DEC_ROUND(g)                                                                     \
+        s##g = _mm512_aesdec_epi128(s##g, _mm512_loadu_si512((const void *) keys[r][4 * (g)]));
+
+#define XTS_GROUP_ENC_LAST(g)                                                                      \
+        s##g = _mm512_aesenclast_epi128(                                                           \
+                s##g, _mm512_loadu_si512((const void *) keys[num_rounds][4 * (g)]));
+
+#define XTS_GROUP_DEC_LAST(g)                                                                      \
+        s##g = _mm512_aesdeclast_epi128(                                                           \
+                s##g, _mm512_loadu_si512((const void *) keys[num_rounds][4 * (g)]));
+
+#define XTS_GROUP_STORE(g)                                                                         \
+        s##g = _mm512_xor_si512(s##g, t##g);                                                       \
+        _mm_storeu_si128((__m128i *) (out[4 * (g)] + offset), _mm512_castsi512_si128(s##g));      \
+        _mm_storeu_si128((__m128i *) (out[4 * (g) + 1] + offset),                                  \
+                         _mm512_extracti32x4_epi32(s##g, 1));                                      \
+        _mm_storeu_si128((__m128i *) (out[4 * (g) + 2] + offset),                                  \
+                         _mm512_extracti32x4_epi32(s##g, 2));                                      \
+        _mm_storeu_si128((__m128i *) (out[4 * (g) + 3] + offset),                                  \
+                         _mm512_extracti32x4_epi32(s##g, 3));                                      \
+        t##g = xts_mb_mul_alpha_x4(t##g, poly);
+
+#define XTS_GROUP_SAVE(g) _mm512_storeu_si512((void *) args->tweak[4 * (g)], t##g);
+
+static inline void
+aes_xts_mb_x16_vaes_avx512(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks,
+                           const int num_rounds, const ISAL_AES_XTS_DIR dir)
+{
+        const uint8_t(*keys)[ISAL_AES_XTS_MAX_LANES][ISAL_AES_XTS_ROUND_KEY_LEN] = args->keys;
+        const __m512i poly = _mm512_broadcast_i32x4(XTS_MB_POLY);
+        const uint8_t *in[XTS_MB_AVX512_LANES];
+        uint8_t *out[XTS_MB_AVX512_LANES];
+        uint64_t offset;
+        int i, r;
+
+        for (i = 0; i < XTS_MB_AVX512_LANES; i++) {
+                in[i] = args->in[i];
+                out[i] = args->out[i];
+        }
+
+        XTS_MB_AVX512_FOR_EACH_GROUP(XTS_GROUP_DECLARE)
+
+        for (offset = 0; offset < num_blocks * 16; offset += 16) {
+                XTS_MB_AVX512_FOR_EACH_GROUP(XTS_GROUP_START)
+                if (dir == ISAL_AES_XTS_DECRYPT) {
+                        for (r = 1; r < num_rounds; r++) {
+                                XTS_MB_AVX512_FOR_EACH_GROUP(XTS_GROUP_DEC_ROUND)
+                        }
+                        XTS_MB_AVX512_FOR_EACH_GROUP(XTS_GROUP_DEC_LAST)
+                } else {
+                        for (r = 1; r < num_rounds; r++) {
+                                XTS_MB_AVX512_FOR_EACH_GROUP(XTS_GROUP_ENC_ROUND)
+                        }
+                        XTS_MB_AVX512_FOR_EACH_GROUP(XTS_GROUP_ENC_LAST)
+                }
+                XTS_MB_AVX512_FOR_EACH_GROUP(XTS_GROUP_STORE)
+        }
+
+        XTS_MB_AVX512_FOR_EACH_GROUP(XTS_GROUP_SAVE)
+
+        for (i = 0; i < XTS_MB_AVX512_LANES; i++) {
+                args->in[i] = in[i] + num_blocks * 16;
+                args->out[i] = out[i] + num_blocks * 16;
+        }
+}
+
+void
+_aes_xts_128_enc_mb_x16_vaes_avx512(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_xts_mb_x16_vaes_avx512(args, num_blocks, 10, ISAL_AES_XTS_ENCRYPT);
+}
+
+void
+_aes_xts_128_dec_mb_x16_vaes_avx512(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_xts_mb_x16_vaes_avx512(args, num_blocks, 10, ISAL_AES_XTS_DECRYPT);
+}
+
+void
+_aes_xts_256_enc_mb_x16_vaes_avx512(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_xts_mb_x16_vaes_avx512(args, num_blocks, 14, ISAL_AES_XTS_ENCRYPT);
+}
+
+void
+_aes_xts_256_dec_mb_x16_vaes_avx512(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks)
+{
+        aes_xts_mb_x16_vaes_avx512(args, num_blocks, 14, ISAL_AES_XTS_DECRYPT);
+}
+
+#define XTS_MB_CTX_MGR_INIT_FUNCTION   _aes_xts_ctx_mgr_init_avx512
+#define XTS_MB_CTX_MGR_SUBMIT_FUNCTION _aes_xts_ctx_mgr_submit_avx512
+#define XTS_MB_CTX_MGR_FLUSH_FUNCTION  _aes_xts_ctx_mgr_flush_avx512
+#define XTS_MB_128_ENC_FUNCTION        _aes_xts_128_enc_mb_x16_vaes_avx512
+#define XTS_MB_128_DEC_FUNCTION        _aes_xts_128_dec_mb_x16_vaes_avx512
+#define XTS_MB_256_ENC_FUNCTION        _aes_xts_256_enc_mb_x16_vaes_avx512
+#define XTS_MB_256_DEC_FUNCTION        _aes_xts_256_dec_mb_x16_vaes_avx512
+#define XTS_MB_JOB_START_FUNCTION      xts_mb_lane_job_start
+#define XTS_MB_JOB_END_FUNCTION        xts_mb_lane_job_end
+#define XTS_MB_LANES                   XTS_MB_AVX512_LANES
+#include "xts_mb_ctx_base.c"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
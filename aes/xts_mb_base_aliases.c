@@ -0,0 +1,50 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+#include <stdint.h>
+#include "aes_xts_mb_internal.h"
+
+void
+_aes_xts_ctx_mgr_init(ISAL_AES_XTS_CTX_MGR *mgr, const uint32_t key_len,
+                      const ISAL_AES_XTS_DIR dir)
+{
+        _aes_xts_ctx_mgr_init_base(mgr, key_len, dir);
+}
+
+ISAL_AES_XTS_CTX *
+_aes_xts_ctx_mgr_submit(ISAL_AES_XTS_CTX_MGR *mgr, ISAL_AES_XTS_CTX *ctx, uint8_t *out,
+                        const uint8_t *in, uint64_t len, const uint8_t *tweak)
+{
+        return _aes_xts_ctx_mgr_submit_base(mgr, ctx, out, in, len, tweak);
+}
+
+ISAL_AES_XTS_CTX *
+_aes_xts_ctx_mgr_flush(ISAL_AES_XTS_CTX_MGR *mgr)
+{
+        return _aes_xts_ctx_mgr_flush_base(mgr);
+}
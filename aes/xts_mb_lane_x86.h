@@ -0,0 +1,224 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+/*
+ * Helpers shared by the x86 multi-buffer AES-XTS implementations.
+ *
+ * This file is included by the architecture files after their target pragmas, so
+ * the helpers are compiled for the instruction set of the including file. The
+ * tweak of each lane is kept as a little-endian 128-bit value and multiplied by
+ * alpha once per block.
+ */
+
+#ifndef _XTS_MB_LANE_X86_H
+#define _XTS_MB_LANE_X86_H
+
+#include <string.h>
+#include <immintrin.h>
+#include "aes_xts_mb_internal.h"
+
+#define XTS_MB_POLY _mm_set_epi32(1, 1, 1, 0x87)
+
+/*
+ * T = T * alpha in GF(2^128): shift left by one bit, carrying between the 32-bit
+ * elements, and reduce with 0x87 if the top bit was set.
+ */
+static inline __m128i
+xts_mb_mul_alpha(const __m128i t)
+{
+        __m128i c = _mm_shuffle_epi32(_mm_srai_epi32(t, 31), 0x93);
+
+        return _mm_xor_si128(_mm_add_epi32(t, t), _mm_and_si128(c, XTS_MB_POLY));
+}
+
+/* Encrypt or decrypt one block with the round keys of a lane */
+static inline __m128i
+xts_mb_lane_cipher(const ISAL_AES_XTS_MB_ARGS_X16 *args, const unsigned int lane, __m128i b,
+                   const uint32_t num_rounds, const ISAL_AES_XTS_DIR dir)
+{
+        uint32_t r;
+
+        b = _mm_xor_si128(b, _mm_loadu_si128((const __m128i *) args->keys[0][lane]));
+        if (dir == ISAL_AES_XTS_DECRYPT) {
+                for (r = 1; r < num_rounds; r++)
+                        b = _mm_aesdec_si128(
+                                b, _mm_loadu_si128((const __m128i *) args->keys[r][lane]));
+                return _mm_aesdeclast_si128(b,
+                                            _mm_loadu_si128((const __m128i *) args->keys[r][lane]));
+        }
+        for (r = 1; r < num_rounds; r++)
+                b = _mm_aesenc_si128(b, _mm_loadu_si128((const __m128i *) args->keys[r][lane]));
+
+        return _mm_aesenclast_si128(b, _mm_loadu_si128((const __m128i *) args->keys[r][lane]));
+}
+
+/* One XTS block: C = E(K1, P ^ T) ^ T */
+static inline void
+xts_mb_lane_block(const ISAL_AES_XTS_MB_ARGS_X16 *args, const unsigned int lane, uint8_t *out,
+                  const uint8_t *in, const __m128i t, const uint32_t num_rounds,
+                  const ISAL_AES_XTS_DIR dir)
+{
+        __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i *) in), t);
+
+        b = xts_mb_lane_cipher(args, lane, b, num_rounds, dir);
+        _mm_storeu_si128((__m128i *) out, _mm_xor_si128(b, t));
+}
+
+/*
+ * Set up a lane for a new job: round keys of the data key and the initial tweak
+ * encrypted with the tweak key.
+ */
+static inline void
+xts_mb_lane_job_start(ISAL_AES_XTS_MB_ARGS_X16 *args, const unsigned int lane,
+                      const ISAL_AES_XTS_JOB *job, const uint32_t num_rounds)
+{
+        __m128i t;
+        uint32_t r;
+
+        for (r = 0; r <= num_rounds; r++)
+                memcpy(args->keys[r][lane], job->k1 + r * ISAL_AES_XTS_ROUND_KEY_LEN,
+                       ISAL_AES_XTS_ROUND_KEY_LEN);
+
+        t = _mm_xor_si128(_mm_loadu_si128((const __m128i *) job->tweak),
+                          _mm_loadu_si128((const __m128i *) job->k2));
+        for (r = 1; r < num_rounds; r++)
+                t = _mm_aesenc_si128(
+                        t, _mm_loadu_si128((const __m128i *) (job->k2 +
+                                                              r * ISAL_AES_XTS_ROUND_KEY_LEN)));
+        t = _mm_aesenclast_si128(
+                t, _mm_loadu_si128((const __m128i *) (job->k2 + r * ISAL_AES_XTS_ROUND_KEY_LEN)));
+        _mm_storeu_si128((__m128i *) args->tweak[lane], t);
+
+        args->in[lane] = job->in;
+        args->out[lane] = job->out;
+}
+
+/*
+ * Finish a job once the lane kernel has processed all its full blocks but the
+ * last one when there is a trailing partial block: those two are processed here
+ * with ciphertext stealing.
+ */
+static inline void
+xts_mb_lane_job_end(ISAL_AES_XTS_MB_ARGS_X16 *args, const unsigned int lane,
+                    ISAL_AES_XTS_JOB *job, const uint32_t num_rounds, const ISAL_AES_XTS_DIR dir)
+{
+        const uint64_t tail = job->len % ISAL_AES_XTS_BLOCK_LEN;
+        const uint8_t *in = args->in[lane];
+        uint8_t *out = args->out[lane];
+        uint8_t last[ISAL_AES_XTS_BLOCK_LEN], stolen[ISAL_AES_XTS_BLOCK_LEN];
+        __m128i t, t_next;
+
+        if (tail == 0)
+                return;
+
+        /* Decryption uses the tweaks of the last two blocks in reverse order */
+        t = _mm_loadu_si128((const __m128i *) args->tweak[lane]);
+        t_next = xts_mb_mul_alpha(t);
+        if (dir == ISAL_AES_XTS_DECRYPT) {
+                const __m128i tmp = t;
+
+                t = t_next;
+                t_next = tmp;
+        }
+
+        xts_mb_lane_block(args, lane, last, in, t, num_rounds, dir);
+        memcpy(stolen, in + ISAL_AES_XTS_BLOCK_LEN, tail);
+        memcpy(stolen + tail, last + tail, ISAL_AES_XTS_BLOCK_LEN - tail);
+        memcpy(out + ISAL_AES_XTS_BLOCK_LEN, last, tail);
+        xts_mb_lane_block(args, lane, out, stolen, t_next, num_rounds, dir);
+}
+
+/*
+ * Generic kernel for lanes of 128-bit registers. The including file lists its
+ * lanes in XTS_MB_FOR_EACH_LANE, so every lane state is a separate register
+ * variable. All lane inputs of a block are loaded before any output is stored,
+ * so lanes duplicated by flush may work in place.
+ */
+#ifdef XTS_MB_FOR_EACH_LANE
+#define XTS_LANE_DECLARE(l)                                                                        \
+        __m128i t##l = _mm_loadu_si128((const __m128i *) args->tweak[l]);                          \
+        __m128i s##l;
+
+#define XTS_LANE_START(l)                                                                          \
+        s##l = _mm_loadu_si128((const __m128i *) (args->in[l] + offset));                          \
+        s##l = _mm_xor_si128(_mm_xor_si128(s##l, t##l),                                            \
+                             _mm_loadu_si128((const __m128i *) args->keys[0][l]));
+
+#define XTS_LANE_ENC_ROUND(l)                                                                      \
+        s##l = _mm_aesenc_si128(s##l, _mm_loadu_si128((const __m128i *) args->keys[r][l]));
+
+#define XTS_LANE_DEC_ROUND(l)                                                                      \
+        s##l = _mm_aesdec_si128(s##l, _mm_loadu_si128((const __m128i *) args->keys[r][l]));
+
+#define XTS_LANE_ENC_LAST(l)                                                                       \
+        s##l = _mm_aesenclast_si128(s##l, _mm_loadu_si128((const __m128i *) args->keys[r][l]));
+
+#define XTS_LANE_DEC_LAST(l)                                                                       \
+        s##l = _mm_aesdeclast_si128(s##l, _mm_loadu_si128((const __m128i *) args->keys[r][l]));
+
+#define XTS_LANE_STORE(l)                                                                          \
+        _mm_storeu_si128((__m128i *) (args->out[l] + offset), _mm_xor_si128(s##l, t##l));          \
+        t##l = xts_mb_mul_alpha(t##l);
+
+#define XTS_LANE_SAVE(l)                                                                           \
+        _mm_storeu_si128((__m128i *) args->tweak[l], t##l);                                        \
+        args->in[l] += num_blocks * ISAL_AES_XTS_BLOCK_LEN;                                        \
+        args->out[l] += num_blocks * ISAL_AES_XTS_BLOCK_LEN;
+
+static inline void
+xts_mb_lanes_x128(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks, const uint32_t num_rounds,
+                  const ISAL_AES_XTS_DIR dir)
+{
+        uint64_t offset;
+        uint32_t r;
+
+        XTS_MB_FOR_EACH_LANE(XTS_LANE_DECLARE)
+
+        for (offset = 0; offset < num_blocks * ISAL_AES_XTS_BLOCK_LEN;
+             offset += ISAL_AES_XTS_BLOCK_LEN) {
+                XTS_MB_FOR_EACH_LANE(XTS_LANE_START)
+                if (dir == ISAL_AES_XTS_DECRYPT) {
+                        for (r = 1; r < num_rounds; r++) {
+                                XTS_MB_FOR_EACH_LANE(XTS_LANE_DEC_ROUND)
+                        }
+                        XTS_MB_FOR_EACH_LANE(XTS_LANE_DEC_LAST)
+                } else {
+                        for (r = 1; r < num_rounds; r++) {
+                                XTS_MB_FOR_EACH_LANE(XTS_LANE_ENC_ROUND)
+                        }
+                        XTS_MB_FOR_EACH_LANE(XTS_LANE_ENC_LAST)
+                }
+                XTS_MB_FOR_EACH_LANE(XTS_LANE_STORE)
+        }
+
+        XTS_MB_FOR_EACH_LANE(XTS_LANE_SAVE)
+}
+#endif // XTS_MB_FOR_EACH_LANE
+
+#endif // ifndef _XTS_MB_LANE_X86_H
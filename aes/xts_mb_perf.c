@@ -0,0 +1,188 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <aes_xts.h>
+#include <aes_xts_mb.h>
+#include <aes_keyexp.h>
+#include <test.h>
+#include "types.h"
+
+// Cached test, loop many times over sectors of many tenants
+#define MAX_SECTOR_LEN 4096
+#define TEST_BYTES     (64 * 1024 * 1024)
+#define TEST_TYPE_STR  "_warm"
+
+#define TEST_BUFS (4 * ISAL_AES_XTS_MAX_LANES) // one key pair per sector
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+static const uint32_t Klen[] = { ISAL_AES_XTS_128_KEY_LEN, ISAL_AES_XTS_256_KEY_LEN };
+static const uint64_t Sector_len[] = { 512, 4096 };
+
+static uint8_t *plaintext[TEST_BUFS];
+static uint8_t *ciphertext[TEST_BUFS];
+static uint8_t *mb_ciphertext[TEST_BUFS];
+static DECLARE_ALIGNED(uint8_t k1_exp[TEST_BUFS][16 * 15], 16);
+static DECLARE_ALIGNED(uint8_t k2_exp[TEST_BUFS][16 * 15], 16);
+static uint8_t tweak[TEST_BUFS][ISAL_AES_XTS_TWEAK_LEN];
+
+static void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        unsigned int i;
+        for (i = 0; i < size; i++)
+                *data++ = rand();
+}
+
+static int
+sb_xts_enc(const uint32_t klen, const int i, const uint64_t len)
+{
+        if (klen == ISAL_AES_XTS_128_KEY_LEN)
+                return isal_aes_xts_enc_128_expanded_key(k2_exp[i], k1_exp[i], tweak[i], len,
+                                                         plaintext[i], ciphertext[i]);
+        return isal_aes_xts_enc_256_expanded_key(k2_exp[i], k1_exp[i], tweak[i], len,
+                                                 plaintext[i], ciphertext[i]);
+}
+
+static int
+mb_xts_enc(ISAL_AES_XTS_CTX_MGR *mgr, ISAL_AES_XTS_CTX *ctxpool, const uint64_t len)
+{
+        ISAL_AES_XTS_CTX *ctx;
+        int i;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                if (isal_aes_xts_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, mb_ciphertext[i],
+                                                plaintext[i], len, tweak[i]) != 0)
+                        return 1;
+        }
+        do {
+                if (isal_aes_xts_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return 1;
+        } while (ctx != NULL);
+
+        return 0;
+}
+
+int
+main(void)
+{
+        ISAL_AES_XTS_CTX_MGR *mgr = NULL;
+        ISAL_AES_XTS_CTX *ctxpool = NULL;
+        uint8_t key[ISAL_AES_XTS_256_KEY_LEN], key_dec[16 * 15];
+        int i, k, s, t, loops, ret = 1;
+
+        printf("AES-XTS multi-buffer encrypt perf, %d key pairs\n", TEST_BUFS);
+        srand(TEST_SEED);
+
+        if (posix_memalign((void **) &mgr, 64, sizeof(*mgr)) != 0 ||
+            posix_memalign((void **) &ctxpool, 16, sizeof(*ctxpool) * TEST_BUFS) != 0) {
+                printf("alloc error: Fail");
+                goto exit;
+        }
+        for (i = 0; i < TEST_BUFS; i++) {
+                plaintext[i] = malloc(MAX_SECTOR_LEN);
+                ciphertext[i] = malloc(MAX_SECTOR_LEN);
+                mb_ciphertext[i] = malloc(MAX_SECTOR_LEN);
+                if (plaintext[i] == NULL || ciphertext[i] == NULL || mb_ciphertext[i] == NULL) {
+                        printf("malloc error: Fail");
+                        goto exit;
+                }
+                mk_rand_data(plaintext[i], MAX_SECTOR_LEN);
+                mk_rand_data(tweak[i], ISAL_AES_XTS_TWEAK_LEN);
+        }
+
+        for (k = 0; k < (int) DIM(Klen); k++) {
+                const int kbits = (int) Klen[k] * 8;
+
+                for (i = 0; i < TEST_BUFS; i++) {
+                        if (Klen[k] == ISAL_AES_XTS_128_KEY_LEN) {
+                                mk_rand_data(key, sizeof(key));
+                                isal_aes_keyexp_128(key, k1_exp[i], key_dec);
+                                mk_rand_data(key, sizeof(key));
+                                isal_aes_keyexp_128(key, k2_exp[i], key_dec);
+                        } else {
+                                mk_rand_data(key, sizeof(key));
+                                isal_aes_keyexp_256(key, k1_exp[i], key_dec);
+                                mk_rand_data(key, sizeof(key));
+                                isal_aes_keyexp_256(key, k2_exp[i], key_dec);
+                        }
+                        isal_aes_xts_ctx_init(&ctxpool[i], k2_exp[i], k1_exp[i]);
+                }
+                if (isal_aes_xts_ctx_mgr_init(mgr, Klen[k], ISAL_AES_XTS_ENCRYPT) != 0)
+                        goto exit;
+
+                for (s = 0; s < (int) DIM(Sector_len); s++) {
+                        const uint64_t len = Sector_len[s];
+                        struct perf start, stop;
+
+                        loops = TEST_BYTES / (len * TEST_BUFS);
+
+                        perf_start(&start);
+                        for (t = 0; t < loops; t++)
+                                for (i = 0; i < TEST_BUFS; i++)
+                                        sb_xts_enc(Klen[k], i, len);
+                        perf_stop(&stop);
+                        printf("aes_xts_%d_enc_sb_%d" TEST_TYPE_STR ": ", kbits, (int) len);
+                        perf_print(stop, start, (long long) len * TEST_BUFS * t);
+
+                        perf_start(&start);
+                        for (t = 0; t < loops; t++)
+                                if (mb_xts_enc(mgr, ctxpool, len) != 0)
+                                        goto exit;
+                        perf_stop(&stop);
+                        printf("aes_xts_%d_enc_mb_%d" TEST_TYPE_STR ": ", kbits, (int) len);
+                        perf_print(stop, start, (long long) len * TEST_BUFS * t);
+
+                        for (i = 0; i < TEST_BUFS; i++) {
+                                if (memcmp(ciphertext[i], mb_ciphertext[i], len) != 0) {
+                                        printf("aes_xts_%d multi-buffer mismatch: Fail\n",
+                                               kbits);
+                                        goto exit;
+                                }
+                        }
+                }
+        }
+        ret = 0;
+
+exit:
+        for (i = 0; i < TEST_BUFS; i++) {
+                free(plaintext[i]);
+                free(ciphertext[i]);
+                free(mb_ciphertext[i]);
+        }
+        aligned_free(ctxpool);
+        aligned_free(mgr);
+
+        return ret;
+}
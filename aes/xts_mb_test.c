@@ -0,0 +1,238 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <aes_xts.h>
+#include <aes_xts_mb.h>
+#include <aes_keyexp.h>
+#include "types.h"
+#include "test.h"
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+#ifndef RANDOMS
+#define RANDOMS 4
+#endif
+#define TEST_BUFS       37
+#define TEST_LEN        (4 * 1024 + 15)
+#define IN_PLACE_STRIDE 5 // every 5th sector is processed in place
+
+typedef int (*xts_func)(const uint8_t *, const uint8_t *, const uint8_t *, const uint64_t,
+                        const void *, void *);
+
+struct xts_mb_test {
+        uint32_t key_len;
+        ISAL_AES_XTS_DIR dir;
+        xts_func ref;
+        const char *name;
+};
+
+static const struct xts_mb_test Tests[] = {
+        { ISAL_AES_XTS_128_KEY_LEN, ISAL_AES_XTS_ENCRYPT, isal_aes_xts_enc_128, "enc_128" },
+        { ISAL_AES_XTS_128_KEY_LEN, ISAL_AES_XTS_DECRYPT, isal_aes_xts_dec_128, "dec_128" },
+        { ISAL_AES_XTS_256_KEY_LEN, ISAL_AES_XTS_ENCRYPT, isal_aes_xts_enc_256, "enc_256" },
+        { ISAL_AES_XTS_256_KEY_LEN, ISAL_AES_XTS_DECRYPT, isal_aes_xts_dec_256, "dec_256" },
+};
+
+// Sector sizes seen by storage stacks, mixed with random lengths
+static const uint64_t Sector_size[] = { 16, 512, 520, 4096 };
+
+struct sector {
+        uint8_t *in;
+        uint8_t *ref;
+        uint8_t *out;
+        uint8_t key1[ISAL_AES_XTS_256_KEY_LEN];
+        uint8_t key2[ISAL_AES_XTS_256_KEY_LEN];
+        uint8_t tweak[ISAL_AES_XTS_TWEAK_LEN];
+        uint64_t len;
+        int done;
+};
+
+static DECLARE_ALIGNED(uint8_t k1_exp[TEST_BUFS][16 * 15], 16);
+static DECLARE_ALIGNED(uint8_t k2_exp[TEST_BUFS][16 * 15], 16);
+static struct sector sectors[TEST_BUFS];
+
+static void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        uint32_t i;
+        for (i = 0; i < size; i++)
+                *data++ = rand();
+}
+
+/* Expand k2 for encryption and k1 in the form used by the direction */
+static int
+key_exp(const struct xts_mb_test *t, const int i)
+{
+        uint8_t k_enc[16 * 15], k_dec[16 * 15];
+        int (*keyexp)(const uint8_t *, uint8_t *, uint8_t *) =
+                (t->key_len == ISAL_AES_XTS_128_KEY_LEN) ? isal_aes_keyexp_128
+                                                         : isal_aes_keyexp_256;
+
+        if (keyexp(sectors[i].key2, k2_exp[i], k_dec) != 0)
+                return 1;
+        if (keyexp(sectors[i].key1, k_enc, k_dec) != 0)
+                return 1;
+        memcpy(k1_exp[i], (t->dir == ISAL_AES_XTS_DECRYPT) ? k_dec : k_enc, sizeof(k_enc));
+        return 0;
+}
+
+static void
+ctx_done(ISAL_AES_XTS_CTX *ctx)
+{
+        sectors[(uintptr_t) ctx->user_data].done++;
+}
+
+static int
+run_test(ISAL_AES_XTS_CTX_MGR *mgr, ISAL_AES_XTS_CTX *ctxpool, const struct xts_mb_test *t)
+{
+        ISAL_AES_XTS_CTX *ctx;
+        int i;
+
+        if (isal_aes_xts_ctx_mgr_init(mgr, t->key_len, t->dir) != 0)
+                return 1;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                struct sector *s = &sectors[i];
+
+                // Each sector has its own key pair
+                mk_rand_data(s->key1, sizeof(s->key1));
+                mk_rand_data(s->key2, sizeof(s->key2));
+                mk_rand_data(s->tweak, sizeof(s->tweak));
+                mk_rand_data(s->in, TEST_LEN);
+                if (key_exp(t, i) != 0)
+                        return 1;
+
+                if (i % 2)
+                        s->len = Sector_size[rand() % DIM(Sector_size)];
+                else
+                        s->len = ISAL_AES_XTS_MIN_LEN + rand() % (TEST_LEN + 1 - 16);
+                s->done = 0;
+                if (t->ref(s->key2, s->key1, s->tweak, s->len, s->in, s->ref) != 0)
+                        return 1;
+
+                if (i % IN_PLACE_STRIDE == 0)
+                        memcpy(s->out, s->in, s->len);
+                else
+                        memset(s->out, 0, TEST_LEN);
+
+                if (isal_aes_xts_ctx_init(&ctxpool[i], k2_exp[i], k1_exp[i]) != 0)
+                        return 1;
+                ctxpool[i].user_data = (void *) (uintptr_t) i;
+        }
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                struct sector *s = &sectors[i];
+                const uint8_t *src = (i % IN_PLACE_STRIDE == 0) ? s->out : s->in;
+
+                if (isal_aes_xts_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, s->out, src, s->len,
+                                                s->tweak) != 0)
+                        return 1;
+                if (ctx != NULL)
+                        ctx_done(ctx);
+        }
+
+        if (isal_aes_xts_ctx_mgr_flush(mgr, &ctx) != 0)
+                return 1;
+        while (ctx != NULL) {
+                ctx_done(ctx);
+                if (isal_aes_xts_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return 1;
+        }
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                struct sector *s = &sectors[i];
+
+                if (s->done != 1 || !isal_hash_ctx_complete(&ctxpool[i])) {
+                        printf("Sector %d not complete\n", i);
+                        return 1;
+                }
+                if (memcmp(s->out, s->ref, s->len) != 0) {
+                        printf("Sector %d %s mismatch, len %lu\n", i, t->name,
+                               (unsigned long) s->len);
+                        return 1;
+                }
+        }
+        return 0;
+}
+
+int
+main(void)
+{
+        ISAL_AES_XTS_CTX_MGR *mgr = NULL;
+        ISAL_AES_XTS_CTX *ctxpool = NULL;
+        int i, k, fail = 0;
+
+        printf("AES-XTS multi-buffer test, %d sets of %d sectors: ", RANDOMS, TEST_BUFS);
+        srand(TEST_SEED);
+
+        if (posix_memalign((void **) &mgr, 64, sizeof(*mgr)) != 0 ||
+            posix_memalign((void **) &ctxpool, 16, sizeof(*ctxpool) * TEST_BUFS) != 0) {
+                printf("alloc error: Fail");
+                return 1;
+        }
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                sectors[i].in = malloc(TEST_LEN);
+                sectors[i].ref = malloc(TEST_LEN);
+                sectors[i].out = malloc(TEST_LEN);
+                if (sectors[i].in == NULL || sectors[i].ref == NULL || sectors[i].out == NULL) {
+                        printf("malloc error: Fail");
+                        fail = 1;
+                        goto exit;
+                }
+        }
+
+        for (i = 0; i < RANDOMS; i++) {
+                for (k = 0; k < (int) DIM(Tests); k++) {
+                        fail = run_test(mgr, ctxpool, &Tests[k]);
+                        if (fail) {
+                                printf("%s: Fail\n", Tests[k].name);
+                                goto exit;
+                        }
+                        printf(".");
+                }
+        }
+        printf(" Pass\n");
+
+exit:
+        for (i = 0; i < TEST_BUFS; i++) {
+                free(sectors[i].in);
+                free(sectors[i].ref);
+                free(sectors[i].out);
+        }
+        aligned_free(ctxpool);
+        aligned_free(mgr);
+
+        return fail;
+}
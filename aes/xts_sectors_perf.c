@@ -0,0 +1,143 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "aes_xts.h"
+#include "test.h"
+
+// One I/O of consecutive sectors
+#define SECTOR_SIZE   4096
+#define NUM_SECTORS   256
+#define TEST_LEN      (SECTOR_SIZE * NUM_SECTORS)
+#define TEST_LOOPS    1000
+#define TEST_TYPE_STR "_warm"
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+typedef int (*xts_func)(const uint8_t *, const uint8_t *, const uint8_t *, const uint64_t,
+                        const void *, void *);
+typedef int (*xts_sectors_func)(const uint8_t *, const uint8_t *, const uint64_t, const uint64_t,
+                                const uint64_t, const void *, void *);
+
+static void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        uint32_t i;
+        for (i = 0; i < size; i++)
+                *data++ = rand();
+}
+
+/* One call per sector, building each tweak from the sector number */
+static void
+xts_per_sector(xts_func func, const uint8_t *k2, const uint8_t *k1, const uint64_t start_lba,
+               const uint8_t *in, uint8_t *out)
+{
+        uint8_t tweak[16] = { 0 };
+        uint64_t i, lba;
+        int j;
+
+        for (i = 0; i < NUM_SECTORS; i++) {
+                lba = start_lba + i;
+                for (j = 0; j < 8; j++)
+                        tweak[j] = (uint8_t) (lba >> (8 * j));
+                func(k2, k1, tweak, SECTOR_SIZE, in + i * SECTOR_SIZE, out + i * SECTOR_SIZE);
+        }
+}
+
+static int
+run_perf(xts_func func, xts_sectors_func sectors_func, const char *name, const uint8_t *k2,
+         const uint8_t *k1, const uint8_t *in, uint8_t *out, uint8_t *ref)
+{
+        struct perf start, stop;
+        int i;
+
+        perf_start(&start);
+        for (i = 0; i < TEST_LOOPS; i++)
+                xts_per_sector(func, k2, k1, 1000, in, ref);
+        perf_stop(&stop);
+        printf("%s_per_sector" TEST_TYPE_STR ": ", name);
+        perf_print(stop, start, (long long) TEST_LEN * i);
+
+        perf_start(&start);
+        for (i = 0; i < TEST_LOOPS; i++)
+                sectors_func(k2, k1, 1000, SECTOR_SIZE, NUM_SECTORS, in, out);
+        perf_stop(&stop);
+        printf("%s_sectors" TEST_TYPE_STR ":    ", name);
+        perf_print(stop, start, (long long) TEST_LEN * i);
+
+        if (memcmp(out, ref, TEST_LEN) != 0) {
+                printf("%s mismatch: Fail\n", name);
+                return 1;
+        }
+        return 0;
+}
+
+int
+main(void)
+{
+        uint8_t key1[32], key2[32];
+        uint8_t *in, *out, *ref;
+        int fail = 0;
+
+        printf("aes_xts_sectors_perf: %d sectors of %d bytes\n", NUM_SECTORS, SECTOR_SIZE);
+        srand(TEST_SEED);
+
+        in = malloc(TEST_LEN);
+        out = malloc(TEST_LEN);
+        ref = malloc(TEST_LEN);
+        if (in == NULL || out == NULL || ref == NULL) {
+                printf("malloc of testsize failed\n");
+                fail = 1;
+                goto exit;
+        }
+
+        mk_rand_data(key1, sizeof(key1));
+        mk_rand_data(key2, sizeof(key2));
+        mk_rand_data(in, TEST_LEN);
+
+        fail |= run_perf(isal_aes_xts_enc_128, isal_aes_xts_enc_128_sectors, "aes_xts_128_enc",
+                         key2, key1, in, out, ref);
+        fail |= run_perf(isal_aes_xts_dec_128, isal_aes_xts_dec_128_sectors, "aes_xts_128_dec",
+                         key2, key1, in, out, ref);
+        fail |= run_perf(isal_aes_xts_enc_256, isal_aes_xts_enc_256_sectors, "aes_xts_256_enc",
+                         key2, key1, in, out, ref);
+        fail |= run_perf(isal_aes_xts_dec_256, isal_aes_xts_dec_256_sectors, "aes_xts_256_dec",
+                         key2, key1, in, out, ref);
+
+exit:
+        free(in);
+        free(out);
+        free(ref);
+
+        return fail;
+}
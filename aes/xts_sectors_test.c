@@ -0,0 +1,162 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <aes_xts.h>
+#include "test.h"
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+#define MAX_SECTORS 64
+#define TEST_LEN    (MAX_SECTORS * 4096)
+
+typedef int (*xts_func)(const uint8_t *, const uint8_t *, const uint8_t *, const uint64_t,
+                        const void *, void *);
+typedef int (*xts_sectors_func)(const uint8_t *, const uint8_t *, const uint64_t, const uint64_t,
+                                const uint64_t, const void *, void *);
+
+struct xts_sectors_test {
+        xts_func single;
+        xts_sectors_func sectors;
+        const char *name;
+};
+
+static const struct xts_sectors_test Funcs[] = {
+        { isal_aes_xts_enc_128, isal_aes_xts_enc_128_sectors, "isal_aes_xts_enc_128_sectors" },
+        { isal_aes_xts_dec_128, isal_aes_xts_dec_128_sectors, "isal_aes_xts_dec_128_sectors" },
+        { isal_aes_xts_enc_256, isal_aes_xts_enc_256_sectors, "isal_aes_xts_enc_256_sectors" },
+        { isal_aes_xts_dec_256, isal_aes_xts_dec_256_sectors, "isal_aes_xts_dec_256_sectors" },
+};
+
+// Sector sizes, including ones that need ciphertext stealing
+static const uint64_t Sector_size[] = { 16, 512, 520, 4096 };
+
+// First sector numbers, including a run that wraps the low 64 bits of the tweak
+static const uint64_t Start_lba[] = { 0, 1, 0x123456789abcULL, UINT64_MAX - 5 };
+
+static void
+mk_rand_data(uint8_t *data, uint32_t size)
+{
+        uint32_t i;
+        for (i = 0; i < size; i++)
+                *data++ = rand();
+}
+
+/* Reference: one call per sector with the tweak built from the sector number */
+static int
+ref_sectors(const struct xts_sectors_test *f, const uint8_t *k2, const uint8_t *k1,
+            const uint64_t start_lba, const uint64_t sector_size, const uint64_t num_sectors,
+            const uint8_t *in, uint8_t *out)
+{
+        uint8_t tweak[16];
+        uint64_t i, lba;
+        int j;
+
+        for (i = 0; i < num_sectors; i++) {
+                lba = start_lba + i;
+                memset(tweak, 0, sizeof(tweak));
+                for (j = 0; j < 8; j++)
+                        tweak[j] = (uint8_t) (lba >> (8 * j));
+                if (lba < start_lba)
+                        tweak[8] = 1;
+                if (f->single(k2, k1, tweak, sector_size, in + i * sector_size,
+                              out + i * sector_size) != 0)
+                        return 1;
+        }
+        return 0;
+}
+
+int
+main(void)
+{
+        uint8_t key1[32], key2[32];
+        uint8_t *in = NULL, *out = NULL, *ref = NULL;
+        uint64_t num_sectors, len;
+        int f, s, l, fail = 1;
+
+        printf("AES-XTS multi-sector test: ");
+        srand(TEST_SEED);
+
+        in = malloc(TEST_LEN);
+        out = malloc(TEST_LEN);
+        ref = malloc(TEST_LEN);
+        if (in == NULL || out == NULL || ref == NULL) {
+                printf("malloc error: Fail");
+                goto exit;
+        }
+
+        for (f = 0; f < (int) DIM(Funcs); f++) {
+                for (s = 0; s < (int) DIM(Sector_size); s++) {
+                        for (l = 0; l < (int) DIM(Start_lba); l++) {
+                                mk_rand_data(key1, sizeof(key1));
+                                mk_rand_data(key2, sizeof(key2));
+                                mk_rand_data(in, TEST_LEN);
+                                num_sectors = 1 + rand() % MAX_SECTORS;
+                                len = num_sectors * Sector_size[s];
+
+                                if (ref_sectors(&Funcs[f], key2, key1, Start_lba[l],
+                                                Sector_size[s], num_sectors, in, ref) != 0)
+                                        goto exit;
+
+                                if (Funcs[f].sectors(key2, key1, Start_lba[l], Sector_size[s],
+                                                     num_sectors, in, out) != 0 ||
+                                    memcmp(out, ref, len) != 0) {
+                                        printf("%s: sector size %lu, lba %llx: Fail\n",
+                                               Funcs[f].name, (unsigned long) Sector_size[s],
+                                               (unsigned long long) Start_lba[l]);
+                                        goto exit;
+                                }
+
+                                // In place
+                                memcpy(out, in, len);
+                                if (Funcs[f].sectors(key2, key1, Start_lba[l], Sector_size[s],
+                                                     num_sectors, out, out) != 0 ||
+                                    memcmp(out, ref, len) != 0) {
+                                        printf("%s: in place, sector size %lu: Fail\n",
+                                               Funcs[f].name, (unsigned long) Sector_size[s]);
+                                        goto exit;
+                                }
+                        }
+                        printf(".");
+                }
+        }
+        printf(" Pass\n");
+        fail = 0;
+
+exit:
+        free(in);
+        free(out);
+        free(ref);
+
+        return fail;
+}
@@ -0,0 +1,237 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <string.h>
+#include "chunk_hash.h"
+#include "sha256_mb_internal.h"
+#include "isal_crypto_api.h"
+#include "multi_buffer.h"
+
+#ifndef FIPS_MODE
+/* Boundaries searched for between submissions to the manager */
+#define CH_CUTS_PER_RUN 16
+
+/* Report the completed chunks at the head of the ring, the open chunk is never complete */
+static void
+ch_report(ISAL_CHUNK_HASH *ch)
+{
+        ISAL_CHUNK_HASH_RECORD record;
+        ISAL_SHA256_HASH_CTX *ctx;
+
+        while (ch->count != 0) {
+                ctx = &ch->ctx[ch->head];
+                if (!isal_hash_ctx_complete(ctx))
+                        break;
+
+                record.offset = ch->offset[ch->head];
+                record.len = ctx->total_length;
+                memcpy(record.digest, isal_hash_ctx_digest(ctx), sizeof(record.digest));
+                ch->callback(&record, ch->cb_arg);
+
+                ch->head = (ch->head + 1) % ISAL_CHUNK_HASH_POOL_SIZE;
+                ch->count--;
+        }
+}
+
+/* Finish all submitted chunks, releasing the caller's buffer */
+static void
+ch_flush(ISAL_CHUNK_HASH *ch)
+{
+        while (_sha256_ctx_mgr_flush(&ch->mgr) != NULL)
+                ch_report(ch);
+        ch_report(ch);
+}
+
+static void
+ch_submit(ISAL_CHUNK_HASH *ch, ISAL_SHA256_HASH_CTX *ctx, const uint8_t *buffer,
+          const uint64_t len, const ISAL_HASH_CTX_FLAG flags)
+{
+        /* Chunks are at most max_size bytes, so len fits the 32-bit submit */
+        _sha256_ctx_mgr_submit(&ch->mgr, ctx, buffer, (uint32_t) len, flags);
+        ch_report(ch);
+}
+
+/* Take the context of a new chunk, waiting for the oldest chunk when the ring is full */
+static ISAL_SHA256_HASH_CTX *
+ch_new_chunk(ISAL_CHUNK_HASH *ch, const uint64_t offset)
+{
+        uint32_t slot;
+
+        /* The oldest chunk has ended, so flushing eventually completes it */
+        while (ch->count == ISAL_CHUNK_HASH_POOL_SIZE) {
+                _sha256_ctx_mgr_flush(&ch->mgr);
+                ch_report(ch);
+        }
+
+        slot = (ch->head + ch->count) % ISAL_CHUNK_HASH_POOL_SIZE;
+        ch->offset[slot] = offset;
+        ch->count++;
+
+        return &ch->ctx[slot];
+}
+
+static ISAL_SHA256_HASH_CTX *
+ch_open_chunk(ISAL_CHUNK_HASH *ch)
+{
+        return &ch->ctx[(ch->head + ch->count - 1) % ISAL_CHUNK_HASH_POOL_SIZE];
+}
+
+static void
+ch_start(ISAL_CHUNK_HASH *ch)
+{
+        isal_chunker_reset(&ch->chunker);
+        ch->stream_len = 0;
+        ch->head = 0;
+        ch->count = 0;
+        ch->open = 0;
+}
+
+static int
+ch_update(ISAL_CHUNK_HASH *ch, const uint8_t *buffer, const uint64_t len)
+{
+        uint64_t cuts[CH_CUTS_PER_RUN];
+        uint64_t pos = 0, start = 0, end, consumed;
+        uint32_t c, num_cuts;
+        ISAL_SHA256_HASH_CTX *ctx;
+        int ret;
+
+        while (pos < len) {
+                ret = isal_chunker_run(&ch->chunker, buffer + pos, len - pos, cuts,
+                                       CH_CUTS_PER_RUN, &num_cuts, &consumed);
+                if (ret != 0)
+                        return ret;
+
+                /* Hash the chunks found so far before looking for the next boundaries */
+                for (c = 0; c < num_cuts; c++) {
+                        end = pos + cuts[c];
+                        if (ch->open) {
+                                ch->open = 0;
+                                ch_submit(ch, ch_open_chunk(ch), buffer + start, end - start,
+                                          ISAL_HASH_LAST);
+                        } else {
+                                ctx = ch_new_chunk(ch, ch->stream_len + start);
+                                ch_submit(ch, ctx, buffer + start, end - start,
+                                          ISAL_HASH_ENTIRE);
+                        }
+                        start = end;
+                }
+                pos += consumed;
+        }
+
+        /* The rest of the buffer starts or continues the open chunk */
+        if (start < len) {
+                if (ch->open) {
+                        ch_submit(ch, ch_open_chunk(ch), buffer + start, len - start,
+                                  ISAL_HASH_UPDATE);
+                } else {
+                        ctx = ch_new_chunk(ch, ch->stream_len + start);
+                        ch->open = 1;
+                        ch_submit(ch, ctx, buffer + start, len - start, ISAL_HASH_FIRST);
+                }
+        }
+
+        ch_flush(ch);
+        ch->stream_len += len;
+
+        return 0;
+}
+
+static void
+ch_final(ISAL_CHUNK_HASH *ch)
+{
+        if (ch->open) {
+                ch->open = 0;
+                ch_submit(ch, ch_open_chunk(ch), NULL, 0, ISAL_HASH_LAST);
+        }
+        ch_flush(ch);
+        ch_start(ch);
+}
+#endif
+
+int
+isal_chunk_hash_init(ISAL_CHUNK_HASH *ch, const struct isal_chunker *chunker,
+                     ISAL_CHUNK_HASH_CALLBACK callback, void *cb_arg)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+        uint32_t i;
+
+#ifdef SAFE_PARAM
+        if (ch == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (chunker == NULL)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        if (callback == NULL)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+#endif
+        _sha256_ctx_mgr_init(&ch->mgr);
+        for (i = 0; i < ISAL_CHUNK_HASH_POOL_SIZE; i++)
+                isal_hash_ctx_init(&ch->ctx[i]);
+
+        ch->chunker = *chunker;
+        ch->callback = callback;
+        ch->cb_arg = cb_arg;
+        ch_start(ch);
+
+        return 0;
+#endif
+}
+
+int
+isal_chunk_hash_update(ISAL_CHUNK_HASH *ch, const uint8_t *buffer, const uint64_t len)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        if (ch == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (buffer == NULL && len != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+#endif
+        return ch_update(ch, buffer, len);
+#endif
+}
+
+int
+isal_chunk_hash_final(ISAL_CHUNK_HASH *ch)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        if (ch == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+        ch_final(ch);
+
+        return 0;
+#endif
+}
@@ -0,0 +1,196 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "isal_crypto_api.h"
+#include "chunk_hash.h"
+#include "test.h"
+
+#ifdef SAFE_PARAM
+static uint8_t msg[] = "Test message";
+
+static void
+record_cb(const ISAL_CHUNK_HASH_RECORD *record, void *cb_arg)
+{
+        (void) record;
+        (void) cb_arg;
+}
+
+static int
+test_chunk_hash_init_api(void)
+{
+        ISAL_CHUNK_HASH *ch = NULL;
+        struct isal_chunker chunker = { 0 };
+        int rc, ret = -1;
+        const char *fn_name = "isal_chunk_hash_init";
+
+        rc = posix_memalign((void *) &ch, 16, sizeof(ISAL_CHUNK_HASH));
+        if ((rc != 0) || (ch == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(isal_chunk_hash_init(ch, &chunker, record_cb, NULL),
+                          ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_init);
+#else
+        rc = isal_chunker_init(&chunker, 32, 1024, 4096, 16384);
+        if (rc != ISAL_CRYPTO_ERR_NONE)
+                goto end_init;
+
+        // check null pipeline
+        CHECK_RETURN_GOTO(isal_chunk_hash_init(NULL, &chunker, record_cb, NULL),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_init);
+
+        // check null chunker
+        CHECK_RETURN_GOTO(isal_chunk_hash_init(ch, NULL, record_cb, NULL), ISAL_CRYPTO_ERR_NULL_SRC,
+                          fn_name, end_init);
+
+        // check null callback
+        CHECK_RETURN_GOTO(isal_chunk_hash_init(ch, &chunker, NULL, NULL), ISAL_CRYPTO_ERR_NULL_DST,
+                          fn_name, end_init);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_chunk_hash_init(ch, &chunker, record_cb, NULL), ISAL_CRYPTO_ERR_NONE,
+                          fn_name, end_init);
+#endif
+        ret = 0;
+
+end_init:
+        aligned_free(ch);
+
+        return ret;
+}
+
+static int
+test_chunk_hash_update_api(void)
+{
+        ISAL_CHUNK_HASH *ch = NULL;
+        int rc, ret = -1;
+        const char *fn_name = "isal_chunk_hash_update";
+
+        rc = posix_memalign((void *) &ch, 16, sizeof(ISAL_CHUNK_HASH));
+        if ((rc != 0) || (ch == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(isal_chunk_hash_update(ch, msg, sizeof(msg)),
+                          ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_update);
+#else
+        struct isal_chunker chunker;
+
+        rc = isal_chunker_init(&chunker, 32, 1024, 4096, 16384);
+        rc |= isal_chunk_hash_init(ch, &chunker, record_cb, NULL);
+        if (rc != ISAL_CRYPTO_ERR_NONE)
+                goto end_update;
+
+        // check null pipeline
+        CHECK_RETURN_GOTO(isal_chunk_hash_update(NULL, msg, sizeof(msg)), ISAL_CRYPTO_ERR_NULL_CTX,
+                          fn_name, end_update);
+
+        // check null source ptr
+        CHECK_RETURN_GOTO(isal_chunk_hash_update(ch, NULL, sizeof(msg)), ISAL_CRYPTO_ERR_NULL_SRC,
+                          fn_name, end_update);
+
+        // check null source ptr with no data, OK
+        CHECK_RETURN_GOTO(isal_chunk_hash_update(ch, NULL, 0), ISAL_CRYPTO_ERR_NONE, fn_name,
+                          end_update);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_chunk_hash_update(ch, msg, sizeof(msg)), ISAL_CRYPTO_ERR_NONE,
+                          fn_name, end_update);
+#endif
+        ret = 0;
+
+end_update:
+        aligned_free(ch);
+
+        return ret;
+}
+
+static int
+test_chunk_hash_final_api(void)
+{
+        ISAL_CHUNK_HASH *ch = NULL;
+        int rc, ret = -1;
+        const char *fn_name = "isal_chunk_hash_final";
+
+        rc = posix_memalign((void *) &ch, 16, sizeof(ISAL_CHUNK_HASH));
+        if ((rc != 0) || (ch == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(isal_chunk_hash_final(ch), ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name,
+                          end_final);
+#else
+        struct isal_chunker chunker;
+
+        rc = isal_chunker_init(&chunker, 32, 1024, 4096, 16384);
+        rc |= isal_chunk_hash_init(ch, &chunker, record_cb, NULL);
+        if (rc != ISAL_CRYPTO_ERR_NONE)
+                goto end_final;
+
+        // check null pipeline
+        CHECK_RETURN_GOTO(isal_chunk_hash_final(NULL), ISAL_CRYPTO_ERR_NULL_CTX, fn_name,
+                          end_final);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_chunk_hash_final(ch), ISAL_CRYPTO_ERR_NONE, fn_name, end_final);
+#endif
+        ret = 0;
+
+end_final:
+        aligned_free(ch);
+
+        return ret;
+}
+#endif /* SAFE_PARAM */
+
+int
+main(void)
+{
+        int fail = 0;
+
+#ifdef SAFE_PARAM
+        fail |= test_chunk_hash_init_api();
+        fail |= test_chunk_hash_update_api();
+        fail |= test_chunk_hash_final_api();
+
+        printf(fail ? "Fail\n" : "Pass\n");
+#else
+        printf("Not Executed\n");
+#endif
+        return fail;
+}
@@ -0,0 +1,164 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "chunk_hash.h"
+#include "test.h"
+
+#ifndef FIPS_MODE
+#ifndef GT_L3_CACHE
+#define GT_L3_CACHE 32 * 1024 * 1024 /* some number > last level cache */
+#endif
+
+#if !defined(COLD_TEST) && !defined(TEST_CUSTOM)
+// Cached test, loop many times over small dataset
+#define TEST_LEN      (1024 * 1024)
+#define TEST_LOOPS    100
+#define TEST_TYPE_STR "_warm"
+#elif defined(COLD_TEST)
+// Uncached test.  Pull from large mem base.
+#define TEST_LEN      (2 * GT_L3_CACHE)
+#define TEST_LOOPS    5
+#define TEST_TYPE_STR "_cold"
+#endif
+
+#define MIN_CHUNK (2 * 1024)
+#define AVG_CHUNK (8 * 1024)
+#define MAX_CHUNK (64 * 1024)
+#define MAX_CUTS  (TEST_LEN / MIN_CHUNK + 1)
+
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+static uint32_t num_records;
+static uint32_t record_digest[ISAL_SHA256_DIGEST_NWORDS];
+
+static void
+count_record(const ISAL_CHUNK_HASH_RECORD *record, void *cb_arg)
+{
+        (void) cb_arg;
+        num_records++;
+        memcpy(record_digest, record->digest, sizeof(record_digest));
+}
+#endif /* !FIPS_MODE */
+
+int
+main(void)
+{
+#ifndef FIPS_MODE
+        int ret;
+        ISAL_SHA256_HASH_CTX_MGR *mgr = NULL;
+        ISAL_SHA256_HASH_CTX *ctxpool = NULL, *ctx = NULL;
+        ISAL_CHUNK_HASH *ch = NULL;
+        struct isal_chunker chunker;
+        uint8_t *buf;
+        uint64_t *cuts, consumed, start;
+        uint32_t i, t, num_cuts, fail = 0;
+        struct perf begin, stop;
+
+        ret = posix_memalign((void *) &mgr, 16, sizeof(*mgr));
+        ret |= posix_memalign((void *) &ctxpool, 16, sizeof(*ctxpool) * (MAX_CUTS + 1));
+        ret |= posix_memalign((void *) &ch, 16, sizeof(*ch));
+        buf = (uint8_t *) malloc(TEST_LEN);
+        cuts = (uint64_t *) malloc(sizeof(*cuts) * MAX_CUTS);
+        if (ret || buf == NULL || cuts == NULL) {
+                printf("alloc error: Fail");
+                return -1;
+        }
+
+        srand(TEST_SEED);
+        for (i = 0; i < TEST_LEN; i++)
+                buf[i] = rand();
+        for (i = 0; i <= MAX_CUTS; i++)
+                isal_hash_ctx_init(&ctxpool[i]);
+
+        if (isal_sha256_ctx_mgr_init(mgr) ||
+            isal_chunker_init_gear(&chunker, MIN_CHUNK, AVG_CHUNK, MAX_CHUNK) ||
+            isal_chunk_hash_init(ch, &chunker, count_record, NULL))
+                return 1;
+
+        // Start separate pass tests, find all chunks then hash them
+        perf_start(&begin);
+        for (t = 0; t < TEST_LOOPS; t++) {
+                isal_chunker_reset(&chunker);
+                isal_chunker_run(&chunker, buf, TEST_LEN, cuts, MAX_CUTS, &num_cuts, &consumed);
+
+                for (i = 0, start = 0; i < num_cuts; i++) {
+                        isal_sha256_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, buf + start,
+                                                   (uint32_t) (cuts[i] - start), ISAL_HASH_ENTIRE);
+                        start = cuts[i];
+                }
+                isal_sha256_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, buf + start,
+                                           (uint32_t) (TEST_LEN - start), ISAL_HASH_ENTIRE);
+                do {
+                        isal_sha256_ctx_mgr_flush(mgr, &ctx);
+                } while (ctx != NULL);
+        }
+        perf_stop(&stop);
+
+        printf("chunk_then_sha256" TEST_TYPE_STR ": ");
+        perf_print(stop, begin, (long long) TEST_LEN * t);
+
+        // Start chunk hash tests, chunks are hashed as they are found
+        perf_start(&begin);
+        for (t = 0; t < TEST_LOOPS; t++) {
+                num_records = 0;
+                ret = isal_chunk_hash_update(ch, buf, TEST_LEN);
+                ret |= isal_chunk_hash_final(ch);
+                if (ret)
+                        return 1;
+        }
+        perf_stop(&stop);
+
+        printf("chunk_hash" TEST_TYPE_STR ": ");
+        perf_print(stop, begin, (long long) TEST_LEN * t);
+
+        if (num_records != num_cuts + 1 ||
+            memcmp(record_digest, ctxpool[num_cuts].job.result_digest, sizeof(record_digest))) {
+                fail++;
+                printf("found %u chunks, expected %u\n", num_records, num_cuts + 1);
+        }
+
+        printf("Chunk hash test complete %d B with %d iterations, %u chunks\n", TEST_LEN,
+               TEST_LOOPS, num_cuts + 1);
+
+        if (fail)
+                printf("Test failed function check %d\n", fail);
+        else
+                printf(" chunk_hash_perf: Pass\n");
+
+        return fail;
+#else
+        printf("Not Executed\n");
+        return 0;
+#endif /* FIPS_MODE */
+}
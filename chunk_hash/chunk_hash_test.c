@@ -0,0 +1,274 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "isal_crypto_api.h"
+#include "chunk_hash.h"
+#include "test.h"
+
+#ifndef FIPS_MODE
+#define TEST_LEN    (3 * 1024 * 1024)
+#define RANDOMS     20
+#define CUTS_PER_IT 1024
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+// Compare against reference function
+extern void
+sha256_ref(const uint8_t *input_data, uint32_t *digest, const uint32_t len);
+
+struct records {
+        ISAL_CHUNK_HASH_RECORD *ref; // Expected records
+        uint32_t num;                // Number of expected records
+        uint32_t seen;               // Records reported so far
+        int fail;
+};
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+// Chunk the whole stream in one go then hash each chunk on its own
+static int
+records_ref(const struct isal_chunker *init, const uint8_t *buf, const uint64_t len,
+            struct records *r)
+{
+        struct isal_chunker chunker = *init;
+        uint64_t cuts[CUTS_PER_IT], pos = 0, start = 0, consumed;
+        uint32_t c, num_cuts;
+        ISAL_CHUNK_HASH_RECORD *rec;
+
+        r->num = 0;
+        r->seen = 0;
+        r->fail = 0;
+        isal_chunker_reset(&chunker);
+        while (pos < len) {
+                if (isal_chunker_run(&chunker, buf + pos, len - pos, cuts, CUTS_PER_IT, &num_cuts,
+                                     &consumed) != 0)
+                        return -1;
+                for (c = 0; c < num_cuts; c++) {
+                        rec = &r->ref[r->num++];
+                        rec->offset = start;
+                        rec->len = pos + cuts[c] - start;
+                        start += rec->len;
+                }
+                pos += consumed;
+        }
+        if (start < len) {
+                rec = &r->ref[r->num++];
+                rec->offset = start;
+                rec->len = len - start;
+        }
+        for (c = 0; c < r->num; c++) {
+                rec = &r->ref[c];
+                sha256_ref(buf + rec->offset, rec->digest, (uint32_t) rec->len);
+        }
+
+        return 0;
+}
+
+static void
+check_record(const ISAL_CHUNK_HASH_RECORD *record, void *cb_arg)
+{
+        struct records *r = (struct records *) cb_arg;
+        const ISAL_CHUNK_HASH_RECORD *ref = &r->ref[r->seen];
+
+        if (r->fail)
+                return;
+        if (r->seen == r->num) {
+                printf("unexpected record at offset %lu\n", (unsigned long) record->offset);
+                r->fail = 1;
+                return;
+        }
+        if (record->offset != ref->offset || record->len != ref->len) {
+                printf("record %u: offset %lu len %lu, expected offset %lu len %lu\n", r->seen,
+                       (unsigned long) record->offset, (unsigned long) record->len,
+                       (unsigned long) ref->offset, (unsigned long) ref->len);
+                r->fail = 1;
+                return;
+        }
+        if (memcmp(record->digest, ref->digest, sizeof(ref->digest))) {
+                printf("record %u: digest fail\n", r->seen);
+                r->fail = 1;
+                return;
+        }
+        r->seen++;
+}
+
+// Feed a stream to the pipeline in pieces of up to max_piece bytes, 0 for random sizes
+static int
+run_stream(ISAL_CHUNK_HASH *ch, const uint8_t *buf, const uint64_t len, const uint64_t max_piece,
+           struct records *r)
+{
+        uint64_t pos = 0, piece;
+
+        while (pos < len) {
+                piece = max_piece ? max_piece : (uint64_t) rand() % (64 * 1024);
+                if (max_piece == 0 && rand() % 4 == 0)
+                        piece %= 64;
+                if (piece > len - pos)
+                        piece = len - pos;
+                if (isal_chunk_hash_update(ch, buf + pos, piece) != 0)
+                        return -1;
+                pos += piece;
+                // Chunks ending before the end of a buffer are reported by the same call
+                if (r->fail || (r->seen != r->num && r->ref[r->seen].offset +
+                                                             r->ref[r->seen].len < pos)) {
+                        printf("chunk ending at %lu not reported\n", (unsigned long) pos);
+                        return -1;
+                }
+        }
+        if (isal_chunk_hash_final(ch) != 0)
+                return -1;
+        if (r->fail || r->seen != r->num) {
+                printf("reported %u of %u records\n", r->seen, r->num);
+                return -1;
+        }
+
+        return 0;
+}
+
+static int
+run_case(ISAL_CHUNK_HASH *ch, const struct isal_chunker *chunker, const uint8_t *buf,
+         const uint64_t len, struct records *r)
+{
+        const uint64_t pieces[] = { TEST_LEN, 1000 * 1000, 4096, 0 };
+        uint32_t i;
+
+        if (records_ref(chunker, buf, len, r) != 0)
+                return -1;
+        if (isal_chunk_hash_init(ch, chunker, check_record, r) != 0)
+                return -1;
+
+        // The same pipeline runs the stream several times, split in different ways
+        for (i = 0; i < sizeof(pieces) / sizeof(pieces[0]); i++) {
+                r->seen = 0;
+                if (run_stream(ch, buf, len, pieces[i], r) != 0) {
+                        printf("failed with pieces of %lu bytes\n", (unsigned long) pieces[i]);
+                        return -1;
+                }
+        }
+        putchar('.');
+        fflush(0);
+
+        return 0;
+}
+#endif
+
+int
+main(void)
+{
+#ifndef FIPS_MODE
+        ISAL_CHUNK_HASH *ch = NULL;
+        struct isal_chunker chunker;
+        struct records r;
+        uint8_t *buf = NULL;
+        uint32_t i, min_size, avg_size, max_size;
+        uint64_t len;
+        int ret, fail = 0;
+
+        printf("chunk_hash test: ");
+
+        ret = posix_memalign((void *) &ch, 16, sizeof(*ch));
+        buf = (uint8_t *) malloc(TEST_LEN);
+        // All test chunkers have min_size >= 32
+        r.ref = (ISAL_CHUNK_HASH_RECORD *) malloc(sizeof(*r.ref) * (TEST_LEN / 32 + 2));
+        if (ret != 0 || ch == NULL || buf == NULL || r.ref == NULL) {
+                printf("alloc failed test aborted\n");
+                fail++;
+                goto end;
+        }
+
+        srand(TEST_SEED);
+        rand_buffer(buf, TEST_LEN);
+
+        // Rolling hash and Gear chunkers with typical sizes
+        if (isal_chunker_init(&chunker, 32, 2 * 1024, 8 * 1024, 64 * 1024) != 0 ||
+            run_case(ch, &chunker, buf, TEST_LEN, &r) != 0) {
+                fail++;
+                goto end;
+        }
+        if (isal_chunker_init_gear(&chunker, 2 * 1024, 8 * 1024, 64 * 1024) != 0 ||
+            run_case(ch, &chunker, buf, TEST_LEN, &r) != 0) {
+                fail++;
+                goto end;
+        }
+
+        // Fixed size chunks, the stream ends on a chunk boundary
+        if (isal_chunker_init(&chunker, 16, 1000, 1000, 1000) != 0 ||
+            run_case(ch, &chunker, buf, 3000 * 1000, &r) != 0) {
+                fail++;
+                goto end;
+        }
+
+        // Empty stream
+        if (run_case(ch, &chunker, buf, 0, &r) != 0) {
+                fail++;
+                goto end;
+        }
+
+        // Random chunk sizes and stream lengths, small chunks keep many in flight
+        for (i = 0; i < RANDOMS; i++) {
+                min_size = 32 + rand() % 4096;
+                avg_size = min_size + rand() % 8192;
+                max_size = avg_size + rand() % 16384;
+                len = rand() % (TEST_LEN + 1);
+                if (i & 1)
+                        ret = isal_chunker_init_gear(&chunker, min_size, avg_size, max_size);
+                else
+                        ret = isal_chunker_init(&chunker, 1 + rand() % 32, min_size, avg_size,
+                                                max_size);
+                if (ret != 0 || run_case(ch, &chunker, buf, len, &r) != 0) {
+                        printf("min=%u avg=%u max=%u len=%lu\n", min_size, avg_size, max_size,
+                               (unsigned long) len);
+                        fail++;
+                        goto end;
+                }
+        }
+
+end:
+        aligned_free(ch);
+        free(buf);
+        free(r.ref);
+
+        printf(fail ? " Fail\n" : " Pass\n");
+        return fail;
+#else
+        printf("Not Executed\n");
+        return 0;
+#endif /* FIPS_MODE */
+}
@@ -34,6 +34,16 @@ set(AES_BASE_SOURCES
     aes/aes_cbc.c
     aes/aes_xts.c
     aes/aes_gcm.c
+    aes/aes_cbc_mb.c
+    aes/cbc_enc_mb_ctx_base.c
+    aes/aes_gcm_mb.c
+    aes/gcm_mb_ctx_base.c
+    aes/aes_gcm_sha256.c
+    aes/aes_xts_mb.c
+    aes/xts_mb_ctx_base.c
+    aes/aes_ctr.c
+    aes/ctr_base.c
+    aes/aes_gmac.c
 )
 
 set(AES_X86_64_SOURCES
@@ -73,6 +83,23 @@ set(AES_X86_64_SOURCES
     aes/cbc_enc_256_x4_sb.asm
     aes/cbc_enc_256_x8_sb.asm
     aes/cbc_dec_vaes_avx512.asm
+    aes/cbc_enc_vaes_avx512.c
+    aes/cbc_enc_mb_multibinary.asm
+    aes/cbc_enc_mb_sse.c
+    aes/cbc_enc_mb_avx.c
+    aes/cbc_enc_mb_avx512.c
+    aes/gcm_mb_multibinary.asm
+    aes/gcm_mb_sse.c
+    aes/gcm_mb_avx.c
+    aes/gcm_mb_avx512.c
+    aes/xts_mb_multibinary.asm
+    aes/xts_mb_sse.c
+    aes/xts_mb_avx.c
+    aes/xts_mb_avx512.c
+    aes/ctr_multibinary.asm
+    aes/ctr_sse.c
+    aes/ctr_avx.c
+    aes/ctr_vaes_avx512.c
     aes/xts_aes_128_multibinary.asm
     aes/XTS_AES_128_dec_sse.asm
     aes/XTS_AES_128_dec_expanded_key_sse.asm
@@ -111,6 +138,7 @@ set(AES_AARCH64_SOURCES
     aes/aarch64/keyexp_256_aarch64_aes.S
     aes/aarch64/aes_gcm_aes_finalize_128.S
     aes/aarch64/aes_gcm_aes_init.S
+    aes/aarch64/aes_gcm_ghash.S
     aes/aarch64/aes_gcm_enc_dec_128.S
     aes/aarch64/aes_gcm_precomp_128.S
     aes/aarch64/aes_gcm_update_128.S
@@ -133,6 +161,10 @@ set(AES_AARCH64_SOURCES
     aes/aarch64/cbc_aarch64_dispatcher.c
     aes/aarch64/cbc_enc_aes.S
     aes/aarch64/cbc_dec_aes.S
+    aes/cbc_enc_mb_base_aliases.c
+    aes/gcm_mb_base_aliases.c
+    aes/xts_mb_base_aliases.c
+    aes/ctr_base_aliases.c
 )
 
 # Build source list based on architecture
@@ -148,6 +180,11 @@ endif()
 set(AES_HEADERS
     include/isa-l_crypto/aes_gcm.h
     include/isa-l_crypto/aes_cbc.h
+    include/isa-l_crypto/aes_cbc_mb.h
+    include/isa-l_crypto/aes_gcm_mb.h
+    include/isa-l_crypto/aes_gcm_sha256.h
+    include/isa-l_crypto/aes_xts_mb.h
+    include/isa-l_crypto/aes_ctr.h
     include/isa-l_crypto/aes_xts.h
     include/isa-l_crypto/aes_keyexp.h
     include/isa-l_crypto/isal_crypto_api.h
@@ -166,13 +203,21 @@ if(BUILD_TESTS OR BUILD_PERF)
         aes/xts_256_test
         aes/xts_128_expanded_key_test
         aes/xts_256_expanded_key_test
+        aes/xts_sectors_test
         aes/aes_param_test
+        aes/cbc_mb_test
+        aes/gcm_mb_test
+        aes/gcm_sha256_test
+        aes/xts_mb_test
+        aes/ctr_std_vectors_test
+        aes/gmac_std_vectors_test
     )
 
     set(AES_UNIT_TESTS
         aes/cbc_std_vectors_random_test
         aes/gcm_std_vectors_random_test
         aes/gcm_nt_rand_test
+        aes/gcm_aad_update_test
         aes/xts_128_rand
         aes/xts_128_rand_ossl_test
         aes/xts_256_rand
@@ -190,7 +235,14 @@ if(BUILD_TESTS OR BUILD_PERF)
         aes/xts_256_enc_perf
         aes/xts_256_dec_perf
         aes/xts_256_dec_ossl_perf
+        aes/xts_sectors_perf
         aes/aes_perf
+        aes/cbc_mb_perf
+        aes/gcm_mb_perf
+        aes/gcm_sha256_perf
+        aes/xts_mb_perf
+        aes/ctr_ossl_perf
+        aes/gmac_ossl_perf
     )
 
     set(AES_EXAMPLES
@@ -0,0 +1,76 @@
+# cmake-format: off
+# Copyright (c) 2026, Intel Corporation
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#     * Redistributions of source code must retain the above copyright notice,
+#       this list of conditions and the following disclaimer.
+#     * Redistributions in binary form must reproduce the above copyright
+#       notice, this list of conditions and the following disclaimer in the
+#       documentation and/or other materials provided with the distribution.
+#     * Neither the name of Intel Corporation nor the names of its contributors
+#       may be used to endorse or promote products derived from this software
+#       without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+# cmake-format: on
+
+# Chunk hash (content-defined chunking + SHA256) CMake configuration
+
+set(CHUNK_HASH_SOURCES
+    chunk_hash/chunk_hash.c
+)
+
+# Headers exported by chunk_hash module
+set(CHUNK_HASH_HEADERS
+    include/isa-l_crypto/chunk_hash.h
+)
+
+# Add to main extern headers list
+list(APPEND EXTERN_HEADERS ${CHUNK_HASH_HEADERS})
+
+# Test applications
+if(BUILD_TESTS OR BUILD_PERF)
+    set(CHUNK_HASH_CHECK_TESTS
+        chunk_hash/chunk_hash_test
+        chunk_hash/chunk_hash_param_test
+    )
+
+    set(CHUNK_HASH_PERF_TESTS
+        chunk_hash/chunk_hash_perf
+    )
+
+    if(BUILD_TESTS)
+        foreach(test_name ${CHUNK_HASH_CHECK_TESTS})
+            get_filename_component(test_exec ${test_name} NAME)
+            # chunk_hash_test needs sha256_ref.c
+            if(test_exec STREQUAL "chunk_hash_test")
+                add_executable(${test_exec} ${test_name}.c sha256_mb/sha256_ref.c)
+            else()
+                add_executable(${test_exec} ${test_name}.c)
+            endif()
+            target_link_libraries(${test_exec} PRIVATE isal_crypto)
+            target_include_directories(${test_exec} PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/include/isa-l_crypto ${CMAKE_CURRENT_SOURCE_DIR}/include/internal ${CMAKE_CURRENT_SOURCE_DIR}/chunk_hash)
+            add_test(NAME ${test_exec} COMMAND ${test_exec})
+        endforeach()
+    endif()
+
+    if(BUILD_PERF)
+        foreach(test_name ${CHUNK_HASH_PERF_TESTS})
+            get_filename_component(test_exec ${test_name} NAME)
+            add_executable(${test_exec} ${test_name}.c)
+            target_link_libraries(${test_exec} PRIVATE isal_crypto)
+            target_include_directories(${test_exec} PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/include/isa-l_crypto ${CMAKE_CURRENT_SOURCE_DIR}/include/internal ${CMAKE_CURRENT_SOURCE_DIR}/chunk_hash)
+        endforeach()
+    endif()
+endif()
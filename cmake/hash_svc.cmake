@@ -0,0 +1,70 @@
+# cmake-format: off
+# Copyright (c) 2026, Intel Corporation
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#     * Redistributions of source code must retain the above copyright notice,
+#       this list of conditions and the following disclaimer.
+#     * Redistributions in binary form must reproduce the above copyright
+#       notice, this list of conditions and the following disclaimer in the
+#       documentation and/or other materials provided with the distribution.
+#     * Neither the name of Intel Corporation nor the names of its contributors
+#       may be used to endorse or promote products derived from this software
+#       without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+# cmake-format: on
+
+# Multi-buffer hashing service CMake configuration
+
+set(HASH_SVC_SOURCES
+    hash_svc/hash_svc.c
+)
+
+# Headers exported by hash_svc module
+set(HASH_SVC_HEADERS
+    include/isa-l_crypto/hash_svc.h
+)
+
+# Add to main extern headers list
+list(APPEND EXTERN_HEADERS ${HASH_SVC_HEADERS})
+
+# Test applications
+if(BUILD_TESTS)
+    set(HASH_SVC_CHECK_TESTS
+        hash_svc/hash_svc_test
+        hash_svc/hash_svc_param_test
+    )
+
+    # The multi-threaded test needs pthreads
+    find_package(Threads)
+    if(CMAKE_USE_PTHREADS_INIT)
+        list(APPEND HASH_SVC_CHECK_TESTS hash_svc/hash_svc_thread_test)
+    endif()
+
+    foreach(test_name ${HASH_SVC_CHECK_TESTS})
+        get_filename_component(test_exec ${test_name} NAME)
+        # hash_svc_test and hash_svc_thread_test need sha256_ref.c
+        if(test_exec STREQUAL "hash_svc_param_test")
+            add_executable(${test_exec} ${test_name}.c)
+        else()
+            add_executable(${test_exec} ${test_name}.c sha256_mb/sha256_ref.c)
+        endif()
+        target_link_libraries(${test_exec} PRIVATE isal_crypto)
+        if(test_exec STREQUAL "hash_svc_thread_test")
+            target_link_libraries(${test_exec} PRIVATE Threads::Threads)
+        endif()
+        target_include_directories(${test_exec} PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/include/isa-l_crypto ${CMAKE_CURRENT_SOURCE_DIR}/include/internal ${CMAKE_CURRENT_SOURCE_DIR}/hash_svc)
+        add_test(NAME ${test_exec} COMMAND ${test_exec})
+    endforeach()
+endif()
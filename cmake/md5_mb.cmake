@@ -29,6 +29,7 @@
 
 set(MD5_MB_BASE_SOURCES
     md5_mb/md5_mb.c
+    md5_mb/md5_hash_batch.c
 )
 
 set(MD5_MB_X86_64_SOURCES
@@ -108,6 +109,7 @@ if(BUILD_TESTS OR BUILD_PERF)
         md5_mb/md5_mb_test
         md5_mb/md5_mb_rand_test
         md5_mb/md5_mb_rand_update_test
+        md5_mb/md5_hash_batch_test
         md5_mb/md5_mb_param_test
     )
 
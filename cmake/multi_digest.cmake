@@ -0,0 +1,76 @@
+# cmake-format: off
+# Copyright (c) 2026, Intel Corporation
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#     * Redistributions of source code must retain the above copyright notice,
+#       this list of conditions and the following disclaimer.
+#     * Redistributions in binary form must reproduce the above copyright
+#       notice, this list of conditions and the following disclaimer in the
+#       documentation and/or other materials provided with the distribution.
+#     * Neither the name of Intel Corporation nor the names of its contributors
+#       may be used to endorse or promote products derived from this software
+#       without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+# cmake-format: on
+
+# Multi-digest (MD5 + SHA1 + SHA256 in one pass) CMake configuration
+
+set(MULTI_DIGEST_SOURCES
+    multi_digest/multi_digest.c
+)
+
+# Headers exported by multi_digest module
+set(MULTI_DIGEST_HEADERS
+    include/isa-l_crypto/multi_digest.h
+)
+
+# Add to main extern headers list
+list(APPEND EXTERN_HEADERS ${MULTI_DIGEST_HEADERS})
+
+# Test applications
+if(BUILD_TESTS OR BUILD_PERF)
+    set(MULTI_DIGEST_CHECK_TESTS
+        multi_digest/multi_digest_test
+        multi_digest/multi_digest_param_test
+    )
+
+    set(MULTI_DIGEST_PERF_TESTS
+        multi_digest/multi_digest_perf
+    )
+
+    if(BUILD_TESTS)
+        foreach(test_name ${MULTI_DIGEST_CHECK_TESTS})
+            get_filename_component(test_exec ${test_name} NAME)
+            # multi_digest_test needs md5_ref.c, sha1_ref.c and sha256_ref.c
+            if(test_exec STREQUAL "multi_digest_test")
+                add_executable(${test_exec} ${test_name}.c md5_mb/md5_ref.c sha1_mb/sha1_ref.c sha256_mb/sha256_ref.c)
+            else()
+                add_executable(${test_exec} ${test_name}.c)
+            endif()
+            target_link_libraries(${test_exec} PRIVATE isal_crypto)
+            target_include_directories(${test_exec} PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/include/isa-l_crypto ${CMAKE_CURRENT_SOURCE_DIR}/include/internal ${CMAKE_CURRENT_SOURCE_DIR}/multi_digest)
+            add_test(NAME ${test_exec} COMMAND ${test_exec})
+        endforeach()
+    endif()
+
+    if(BUILD_PERF)
+        foreach(test_name ${MULTI_DIGEST_PERF_TESTS})
+            get_filename_component(test_exec ${test_name} NAME)
+            add_executable(${test_exec} ${test_name}.c)
+            target_link_libraries(${test_exec} PRIVATE isal_crypto)
+            target_include_directories(${test_exec} PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/include/isa-l_crypto ${CMAKE_CURRENT_SOURCE_DIR}/include/internal ${CMAKE_CURRENT_SOURCE_DIR}/multi_digest)
+        endforeach()
+    endif()
+endif()
@@ -30,12 +30,19 @@
 set(ROLLING_HASH_BASE_SOURCES
     rolling_hash/rolling_hashx_base.c
     rolling_hash/rolling_hash2.c
+    rolling_hash/rolling_hash2_chunker.c
+    rolling_hash/rolling_hash2_multi.c
 )
 
 set(ROLLING_HASH_X86_64_SOURCES
     rolling_hash/rolling_hash2_until_04.asm
     rolling_hash/rolling_hash2_until_00.asm
     rolling_hash/rolling_hash2_multibinary.asm
+    rolling_hash/gear_run_until_avx512.c
+    rolling_hash/gear_multibinary.asm
+    rolling_hash/rolling_hash2_multi_avx2.c
+    rolling_hash/rolling_hash2_multi_avx512.c
+    rolling_hash/rolling_hash2_multi_multibinary.asm
 )
 
 set(ROLLING_HASH_AARCH64_SOURCES
@@ -77,6 +84,8 @@ list(APPEND EXTERN_HEADERS ${ROLLING_HASH_HEADERS})
 if(BUILD_TESTS OR BUILD_PERF)
     set(ROLLING_HASH_CHECK_TESTS
         rolling_hash/rolling_hash2_test
+        rolling_hash/rolling_hash2_chunker_test
+        rolling_hash/rolling_hash2_multi_test
         rolling_hash/rolling_hash2_param_test
     )
 
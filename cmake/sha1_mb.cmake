@@ -29,6 +29,8 @@
 
 set(SHA1_MB_BASE_SOURCES
     sha1_mb/sha1_mb.c
+    sha1_mb/sha1_hmac_mb.c
+    sha1_mb/sha1_hash_batch.c
 )
 
 set(SHA1_MB_X86_64_SOURCES
@@ -118,6 +120,8 @@ if(BUILD_TESTS OR BUILD_PERF)
         sha1_mb/sha1_mb_test
         sha1_mb/sha1_mb_rand_test
         sha1_mb/sha1_mb_rand_update_test
+        sha1_mb/sha1_hmac_mb_test
+        sha1_mb/sha1_hash_batch_test
         sha1_mb/sha1_mb_param_test
     )
 
@@ -133,8 +137,9 @@ if(BUILD_TESTS OR BUILD_PERF)
     if(BUILD_TESTS)
         foreach(test_name ${SHA1_MB_CHECK_TESTS})
             get_filename_component(test_exec ${test_name} NAME)
-            # sha1_mb_rand_test, sha1_mb_rand_ssl_test, sha1_mb_rand_update_test need sha1_ref.c
-            if(test_exec MATCHES "sha1_mb_rand.*test")
+            # sha1_mb_rand_test, sha1_mb_rand_ssl_test, sha1_mb_rand_update_test, sha1_hmac_mb_test
+            # need sha1_ref.c
+            if(test_exec MATCHES "sha1_mb_rand.*test" OR test_exec STREQUAL "sha1_hmac_mb_test")
                 add_executable(${test_exec} ${test_name}.c sha1_mb/sha1_ref.c)
             else()
                 add_executable(${test_exec} ${test_name}.c)
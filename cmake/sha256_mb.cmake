@@ -29,6 +29,10 @@
 
 set(SHA256_MB_BASE_SOURCES
     sha256_mb/sha256_mb.c
+    sha256_mb/sha256_hmac_mb.c
+    sha256_mb/sha256_pbkdf2.c
+    sha256_mb/sha256_hash_batch.c
+    sha256_mb/sha256_merkle.c
 )
 
 set(SHA256_MB_X86_64_SOURCES
@@ -114,6 +118,13 @@ if(BUILD_TESTS OR BUILD_PERF)
         sha256_mb/sha256_mb_test
         sha256_mb/sha256_mb_rand_test
         sha256_mb/sha256_mb_rand_update_test
+        sha256_mb/sha256_mb_deadline_test
+        sha256_mb/sha256_mb_slice_test
+        sha256_mb/sha256_mb_iov_test
+        sha256_mb/sha256_hmac_mb_test
+        sha256_mb/sha256_pbkdf2_test
+        sha256_mb/sha256_hash_batch_test
+        sha256_mb/sha256_merkle_test
         sha256_mb/sha256_mb_param_test
     )
 
@@ -124,13 +135,20 @@ if(BUILD_TESTS OR BUILD_PERF)
     set(SHA256_MB_PERF_TESTS
         sha256_mb/sha256_mb_vs_ossl_perf
         sha256_mb/sha256_mb_vs_ossl_shortage_perf
+        sha256_mb/sha256_mb_submit_batch_perf
     )
 
     if(BUILD_TESTS)
         foreach(test_name ${SHA256_MB_CHECK_TESTS})
             get_filename_component(test_exec ${test_name} NAME)
-            # sha256_mb_rand_test, sha256_mb_rand_ssl_test, sha256_mb_rand_update_test need sha256_ref.c
-            if(test_exec MATCHES "sha256_mb_rand.*test")
+            # sha256_mb_rand_test, sha256_mb_rand_update_test, sha256_mb_deadline_test,
+            # sha256_mb_slice_test, sha256_mb_iov_test, sha256_hmac_mb_test, sha256_pbkdf2_test,
+            # sha256_merkle_test
+            # need sha256_ref.c
+            if(test_exec MATCHES "sha256_mb_rand.*test" OR test_exec STREQUAL "sha256_mb_deadline_test"
+               OR test_exec STREQUAL "sha256_mb_slice_test" OR test_exec STREQUAL "sha256_mb_iov_test"
+               OR test_exec STREQUAL "sha256_hmac_mb_test" OR test_exec STREQUAL "sha256_pbkdf2_test"
+               OR test_exec STREQUAL "sha256_merkle_test")
                 add_executable(${test_exec} ${test_name}.c sha256_mb/sha256_ref.c)
             else()
                 add_executable(${test_exec} ${test_name}.c)
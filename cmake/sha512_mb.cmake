@@ -29,6 +29,9 @@
 
 set(SHA512_MB_BASE_SOURCES
     sha512_mb/sha512_mb.c
+    sha512_mb/sha512_hmac_mb.c
+    sha512_mb/sha512_pbkdf2.c
+    sha512_mb/sha512_hash_batch.c
 )
 
 set(SHA512_MB_X86_64_SOURCES
@@ -111,6 +114,9 @@ if(BUILD_TESTS OR BUILD_PERF)
         sha512_mb/sha512_mb_test
         sha512_mb/sha512_mb_rand_test
         sha512_mb/sha512_mb_rand_update_test
+        sha512_mb/sha512_hmac_mb_test
+        sha512_mb/sha512_pbkdf2_test
+        sha512_mb/sha512_hash_batch_test
         sha512_mb/sha512_mb_param_test
     )
 
@@ -125,8 +131,10 @@ if(BUILD_TESTS OR BUILD_PERF)
     if(BUILD_TESTS)
         foreach(test_name ${SHA512_MB_CHECK_TESTS})
             get_filename_component(test_exec ${test_name} NAME)
-            # sha512_mb_rand_test, sha512_mb_rand_ssl_test, sha512_mb_rand_update_test need sha512_ref.c
-            if(test_exec MATCHES "sha512_mb_rand.*test")
+            # sha512_mb_rand_test, sha512_mb_rand_ssl_test, sha512_mb_rand_update_test, sha512_hmac_mb_test,
+            # sha512_pbkdf2_test need sha512_ref.c
+            if(test_exec MATCHES "sha512_mb_rand.*test" OR test_exec STREQUAL "sha512_hmac_mb_test"
+               OR test_exec STREQUAL "sha512_pbkdf2_test")
                 add_executable(${test_exec} ${test_name}.c sha512_mb/sha512_ref.c)
             else()
                 add_executable(${test_exec} ${test_name}.c)
@@ -29,6 +29,7 @@
 
 set(SM3_MB_BASE_SOURCES
     sm3_mb/sm3_mb.c
+    sm3_mb/sm3_hash_batch.c
 )
 
 set(SM3_MB_X86_64_SOURCES
@@ -106,6 +107,7 @@ if(BUILD_TESTS OR BUILD_PERF)
     set(SM3_MB_CHECK_TESTS
         sm3_mb/sm3_ref_test
         sm3_mb/sm3_mb_test
+        sm3_mb/sm3_hash_batch_test
         sm3_mb/sm3_mb_param_test
     )
 
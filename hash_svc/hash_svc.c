@@ -0,0 +1,413 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stddef.h>
+#include "hash_svc.h"
+#include "isal_crypto_api.h"
+#include "multi_buffer.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/*
+ * Atomic helpers. Queue links and locks are plain fields in the public
+ * structures, so they are accessed with compiler intrinsics rather than C11
+ * atomic types.
+ */
+#ifdef _MSC_VER
+static inline ISAL_HASH_SVC_NODE *
+svc_exchange(ISAL_HASH_SVC_NODE **ptr, ISAL_HASH_SVC_NODE *val)
+{
+        return (ISAL_HASH_SVC_NODE *) _InterlockedExchangePointer((void *volatile *) ptr, val);
+}
+
+static inline ISAL_HASH_SVC_NODE *
+svc_load(ISAL_HASH_SVC_NODE **ptr)
+{
+        return *(ISAL_HASH_SVC_NODE *volatile *) ptr;
+}
+
+static inline void
+svc_store(ISAL_HASH_SVC_NODE **ptr, ISAL_HASH_SVC_NODE *val)
+{
+        _InterlockedExchangePointer((void *volatile *) ptr, val);
+}
+
+static inline int
+svc_trylock(uint32_t *lock)
+{
+        return _InterlockedCompareExchange((volatile long *) lock, 1, 0) == 0;
+}
+
+static inline void
+svc_unlock(uint32_t *lock)
+{
+        _InterlockedExchange((volatile long *) lock, 0);
+}
+#else
+static inline ISAL_HASH_SVC_NODE *
+svc_exchange(ISAL_HASH_SVC_NODE **ptr, ISAL_HASH_SVC_NODE *val)
+{
+        return __atomic_exchange_n(ptr, val, __ATOMIC_ACQ_REL);
+}
+
+static inline ISAL_HASH_SVC_NODE *
+svc_load(ISAL_HASH_SVC_NODE **ptr)
+{
+        return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+static inline void
+svc_store(ISAL_HASH_SVC_NODE **ptr, ISAL_HASH_SVC_NODE *val)
+{
+        __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+}
+
+static inline int
+svc_trylock(uint32_t *lock)
+{
+        uint32_t unlocked = 0;
+
+        return __atomic_compare_exchange_n(lock, &unlocked, 1, 0, __ATOMIC_ACQUIRE,
+                                           __ATOMIC_RELAXED);
+}
+
+static inline void
+svc_unlock(uint32_t *lock)
+{
+        __atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+}
+#endif
+
+/* Only for the completion queue, where pops are short and never contended for long */
+static inline void
+svc_lock(uint32_t *lock)
+{
+        while (!svc_trylock(lock))
+                ;
+}
+
+#define SVC_NODE_TO_JOB(n)                                                                         \
+        ((ISAL_HASH_SVC_JOB *) ((uint8_t *) (n) - offsetof(ISAL_HASH_SVC_JOB, node)))
+
+/*
+ * Intrusive multi-producer queue (Vyukov). Push is wait-free; pop must be
+ * serialized by the caller through the queue lock.
+ */
+static void
+svc_queue_init(ISAL_HASH_SVC_QUEUE *q)
+{
+        q->stub.next = NULL;
+        q->head = &q->stub;
+        q->tail = &q->stub;
+        q->lock = 0;
+}
+
+static void
+svc_queue_push(ISAL_HASH_SVC_QUEUE *q, ISAL_HASH_SVC_NODE *node)
+{
+        ISAL_HASH_SVC_NODE *prev;
+
+        node->next = NULL;
+        prev = svc_exchange(&q->head, node);
+        svc_store(&prev->next, node);
+}
+
+/*
+ * The stub is requeued whenever the last node is popped, so the head points to it exactly
+ * when there is nothing left to pop. Safe to call without the queue lock.
+ */
+static int
+svc_queue_empty(ISAL_HASH_SVC_QUEUE *q)
+{
+        return svc_load(&q->head) == &q->stub;
+}
+
+static ISAL_HASH_SVC_NODE *
+svc_queue_pop(ISAL_HASH_SVC_QUEUE *q)
+{
+        ISAL_HASH_SVC_NODE *tail = q->tail;
+        ISAL_HASH_SVC_NODE *next = svc_load(&tail->next);
+
+        if (tail == &q->stub) {
+                if (next == NULL)
+                        return NULL;
+                q->tail = next;
+                tail = next;
+                next = svc_load(&tail->next);
+        }
+        if (next != NULL) {
+                q->tail = next;
+                return tail;
+        }
+        /* A producer has swapped the head but not linked its node yet */
+        if (tail != svc_load(&q->head))
+                return NULL;
+
+        /* Last node: requeue the stub so that tail can be detached */
+        svc_queue_push(q, &q->stub);
+        next = svc_load(&tail->next);
+        if (next != NULL) {
+                q->tail = next;
+                return tail;
+        }
+
+        return NULL;
+}
+
+/*
+ * Per-algorithm glue to the context managers. Jobs are always submitted whole,
+ * and the job is found back from the completed context through user_data.
+ */
+typedef struct {
+        int (*init)(ISAL_HASH_SVC_SHARD *shard);
+        int (*submit)(ISAL_HASH_SVC_SHARD *shard, ISAL_HASH_SVC_JOB *job,
+                      ISAL_HASH_SVC_JOB **done);
+        int (*flush)(ISAL_HASH_SVC_SHARD *shard, ISAL_HASH_SVC_JOB **done);
+        uint32_t max_lanes;
+} HASH_SVC_OPS;
+
+#define HASH_SVC_GLUE(name, NAME)                                                                  \
+        static int name##_svc_init(ISAL_HASH_SVC_SHARD *shard)                                     \
+        {                                                                                          \
+                return isal_##name##_ctx_mgr_init(&shard->mgr.name);                               \
+        }                                                                                          \
+                                                                                                   \
+        static int name##_svc_submit(ISAL_HASH_SVC_SHARD *shard, ISAL_HASH_SVC_JOB *job,           \
+                                     ISAL_HASH_SVC_JOB **done)                                     \
+        {                                                                                          \
+                ISAL_##NAME##_HASH_CTX *ctx = &job->ctx.name, *ctx_out = NULL;                     \
+                int ret;                                                                           \
+                                                                                                   \
+                isal_hash_ctx_init(ctx);                                                           \
+                ctx->user_data = job;                                                              \
+                ret = isal_##name##_ctx_mgr_submit(&shard->mgr.name, ctx, &ctx_out, job->buffer,   \
+                                                   job->len, ISAL_HASH_ENTIRE);                    \
+                *done = (ctx_out != NULL) ? (ISAL_HASH_SVC_JOB *) ctx_out->user_data : NULL;       \
+                return ret;                                                                        \
+        }                                                                                          \
+                                                                                                   \
+        static int name##_svc_flush(ISAL_HASH_SVC_SHARD *shard, ISAL_HASH_SVC_JOB **done)          \
+        {                                                                                          \
+                ISAL_##NAME##_HASH_CTX *ctx_out = NULL;                                            \
+                int ret;                                                                           \
+                                                                                                   \
+                ret = isal_##name##_ctx_mgr_flush(&shard->mgr.name, &ctx_out);                     \
+                *done = (ctx_out != NULL) ? (ISAL_HASH_SVC_JOB *) ctx_out->user_data : NULL;       \
+                return ret;                                                                        \
+        }
+
+HASH_SVC_GLUE(sha1, SHA1)
+HASH_SVC_GLUE(sha256, SHA256)
+HASH_SVC_GLUE(sha512, SHA512)
+HASH_SVC_GLUE(md5, MD5)
+HASH_SVC_GLUE(sm3, SM3)
+
+static const HASH_SVC_OPS hash_svc_ops[ISAL_HASH_SVC_NUM_ALGOS] = {
+        [ISAL_HASH_SVC_SHA1] = { sha1_svc_init, sha1_svc_submit, sha1_svc_flush,
+                                 ISAL_SHA1_MAX_LANES },
+        [ISAL_HASH_SVC_SHA256] = { sha256_svc_init, sha256_svc_submit, sha256_svc_flush,
+                                   ISAL_SHA256_MAX_LANES },
+        [ISAL_HASH_SVC_SHA512] = { sha512_svc_init, sha512_svc_submit, sha512_svc_flush,
+                                   ISAL_SHA512_MAX_LANES },
+        [ISAL_HASH_SVC_MD5] = { md5_svc_init, md5_svc_submit, md5_svc_flush, ISAL_MD5_MAX_LANES },
+        [ISAL_HASH_SVC_SM3] = { sm3_svc_init, sm3_svc_submit, sm3_svc_flush, ISAL_SM3_MAX_LANES },
+};
+
+static void
+svc_deliver(ISAL_HASH_SVC *svc, ISAL_HASH_SVC_JOB *job)
+{
+        if (svc->callback != NULL)
+                svc->callback(job, svc->cb_arg);
+        else
+                svc_queue_push(&svc->completed, &job->node);
+}
+
+/*
+ * Move up to max_jobs jobs from queue q into the manager of shard. Returns the
+ * number of jobs taken; completed jobs are delivered and counted in *completed.
+ */
+static uint32_t
+svc_take_jobs(ISAL_HASH_SVC *svc, ISAL_HASH_SVC_SHARD *shard, ISAL_HASH_SVC_QUEUE *q,
+              const uint32_t max_jobs, uint32_t *completed)
+{
+        const HASH_SVC_OPS *ops = &hash_svc_ops[svc->algo];
+        ISAL_HASH_SVC_NODE *node;
+        ISAL_HASH_SVC_JOB *job, *done;
+        uint32_t taken = 0;
+
+        if (!svc_trylock(&q->lock))
+                return 0;
+
+        while (taken < max_jobs && (node = svc_queue_pop(q)) != NULL) {
+                job = SVC_NODE_TO_JOB(node);
+                taken++;
+
+                job->error = ops->submit(shard, job, &done);
+                if (job->error != ISAL_CRYPTO_ERR_NONE) {
+                        /* The job was rejected and returned as is */
+                        svc_deliver(svc, job);
+                        (*completed)++;
+                        continue;
+                }
+                shard->num_in_mgr++;
+                if (done != NULL) {
+                        shard->num_in_mgr--;
+                        svc_deliver(svc, done);
+                        (*completed)++;
+                }
+        }
+
+        svc_unlock(&q->lock);
+
+        return taken;
+}
+
+int
+isal_hash_svc_init(ISAL_HASH_SVC *svc, ISAL_HASH_SVC_SHARD *shards, const uint32_t num_shards,
+                   const ISAL_HASH_SVC_ALGO algo, ISAL_HASH_SVC_CALLBACK callback, void *cb_arg)
+{
+        uint32_t i;
+        int ret;
+
+#ifdef SAFE_PARAM
+        if (svc == NULL || shards == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (num_shards == 0)
+                return ISAL_CRYPTO_ERR_SHARD;
+        if ((unsigned) algo >= ISAL_HASH_SVC_NUM_ALGOS)
+                return ISAL_CRYPTO_ERR_HASH_ALGO;
+#endif
+
+        for (i = 0; i < num_shards; i++) {
+                ret = hash_svc_ops[algo].init(&shards[i]);
+                if (ret != ISAL_CRYPTO_ERR_NONE)
+                        return ret;
+                svc_queue_init(&shards[i].queue);
+                shards[i].num_in_mgr = 0;
+        }
+
+        svc->shards = shards;
+        svc->num_shards = num_shards;
+        svc->algo = algo;
+        svc->callback = callback;
+        svc->cb_arg = cb_arg;
+        svc_queue_init(&svc->completed);
+
+        return 0;
+}
+
+int
+isal_hash_svc_submit(ISAL_HASH_SVC *svc, ISAL_HASH_SVC_JOB *job, const void *buffer,
+                     const uint32_t len, const uint32_t shard_hint)
+{
+#ifdef SAFE_PARAM
+        if (svc == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (job == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (buffer == NULL && len != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+#endif
+
+        job->buffer = buffer;
+        job->len = len;
+        job->error = ISAL_CRYPTO_ERR_NONE;
+        svc_queue_push(&svc->shards[shard_hint % svc->num_shards].queue, &job->node);
+
+        return 0;
+}
+
+int
+isal_hash_svc_run(ISAL_HASH_SVC *svc, const uint32_t shard, uint32_t *num_completed)
+{
+        ISAL_HASH_SVC_SHARD *own;
+        ISAL_HASH_SVC_JOB *done;
+        const HASH_SVC_OPS *ops;
+        uint32_t i, taken, completed = 0;
+        int ret = 0;
+
+#ifdef SAFE_PARAM
+        if (svc == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (shard >= svc->num_shards)
+                return ISAL_CRYPTO_ERR_SHARD;
+#endif
+        own = &svc->shards[shard];
+        ops = &hash_svc_ops[svc->algo];
+
+        /* Own queue first, a few lane-fulls at a time to bound the call latency */
+        taken = svc_take_jobs(svc, own, &own->queue, 4 * ops->max_lanes, &completed);
+
+        /* Steal at most a lane-full from the next non-empty shard */
+        for (i = 1; taken == 0 && i < svc->num_shards; i++)
+                taken = svc_take_jobs(svc, own, &svc->shards[(shard + i) % svc->num_shards].queue,
+                                      ops->max_lanes, &completed);
+
+        /*
+         * Nothing left to fill the lanes with: drain the manager. A thief may hold the lock of
+         * our own queue, in which case jobs are still coming and the lanes are left to fill.
+         */
+        if (taken == 0 && svc_queue_empty(&own->queue)) {
+                while (own->num_in_mgr > 0) {
+                        ret = ops->flush(own, &done);
+                        if (ret != ISAL_CRYPTO_ERR_NONE || done == NULL)
+                                break;
+                        own->num_in_mgr--;
+                        svc_deliver(svc, done);
+                        completed++;
+                }
+        }
+
+        if (num_completed != NULL)
+                *num_completed = completed;
+
+        return ret;
+}
+
+int
+isal_hash_svc_get_completed(ISAL_HASH_SVC *svc, ISAL_HASH_SVC_JOB **job_out)
+{
+        ISAL_HASH_SVC_NODE *node;
+
+#ifdef SAFE_PARAM
+        if (svc == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (job_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+
+        svc_lock(&svc->completed.lock);
+        node = svc_queue_pop(&svc->completed);
+        svc_unlock(&svc->completed.lock);
+        *job_out = (node != NULL) ? SVC_NODE_TO_JOB(node) : NULL;
+
+        return 0;
+}
@@ -0,0 +1,182 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "isal_crypto_api.h"
+#include "hash_svc.h"
+#include "test.h"
+
+#ifdef SAFE_PARAM
+
+static int
+test_hash_svc_init_api(void)
+{
+        ISAL_HASH_SVC svc;
+        ISAL_HASH_SVC_SHARD *shards = NULL;
+        int rc, ret = -1;
+        const char *fn_name = "isal_hash_svc_init";
+
+        rc = posix_memalign((void *) &shards, 64, sizeof(*shards) * 2);
+        if ((rc != 0) || (shards == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+
+        // check null service
+        CHECK_RETURN_GOTO(isal_hash_svc_init(NULL, shards, 2, ISAL_HASH_SVC_SHA256, NULL, NULL),
+                          ISAL_CRYPTO_ERR_NULL_MGR, fn_name, end_init);
+
+        // check null shards
+        CHECK_RETURN_GOTO(isal_hash_svc_init(&svc, NULL, 2, ISAL_HASH_SVC_SHA256, NULL, NULL),
+                          ISAL_CRYPTO_ERR_NULL_MGR, fn_name, end_init);
+
+        // check zero shards
+        CHECK_RETURN_GOTO(isal_hash_svc_init(&svc, shards, 0, ISAL_HASH_SVC_SHA256, NULL, NULL),
+                          ISAL_CRYPTO_ERR_SHARD, fn_name, end_init);
+
+        // check invalid algorithm
+        CHECK_RETURN_GOTO(isal_hash_svc_init(&svc, shards, 2, ISAL_HASH_SVC_NUM_ALGOS, NULL, NULL),
+                          ISAL_CRYPTO_ERR_HASH_ALGO, fn_name, end_init);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_hash_svc_init(&svc, shards, 2, ISAL_HASH_SVC_SHA256, NULL, NULL),
+                          ISAL_CRYPTO_ERR_NONE, fn_name, end_init);
+
+#ifdef FIPS_MODE
+        // check invalid algorithm
+        CHECK_RETURN_GOTO(isal_hash_svc_init(&svc, shards, 2, ISAL_HASH_SVC_MD5, NULL, NULL),
+                          ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_init);
+#endif
+        ret = 0;
+
+end_init:
+        aligned_free(shards);
+
+        return ret;
+}
+
+static int
+test_hash_svc_submit_run_api(void)
+{
+        ISAL_HASH_SVC svc;
+        ISAL_HASH_SVC_SHARD *shards = NULL;
+        ISAL_HASH_SVC_JOB *job = NULL, *job_out;
+        uint32_t num;
+        int rc, ret = -1;
+        const char *fn_name = "isal_hash_svc_submit";
+        static uint8_t msg[] = "Test message";
+
+        rc = posix_memalign((void *) &shards, 64, sizeof(*shards) * 2);
+        rc |= posix_memalign((void *) &job, 16, sizeof(*job));
+        if ((rc != 0) || (shards == NULL) || (job == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                goto end_submit;
+        }
+
+        rc = isal_hash_svc_init(&svc, shards, 2, ISAL_HASH_SVC_SHA256, NULL, NULL);
+        if (rc != ISAL_CRYPTO_ERR_NONE)
+                goto end_submit;
+
+        // check null service
+        CHECK_RETURN_GOTO(isal_hash_svc_submit(NULL, job, msg, sizeof(msg), 0),
+                          ISAL_CRYPTO_ERR_NULL_MGR, fn_name, end_submit);
+
+        // check null job
+        CHECK_RETURN_GOTO(isal_hash_svc_submit(&svc, NULL, msg, sizeof(msg), 0),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_submit);
+
+        // check null source
+        CHECK_RETURN_GOTO(isal_hash_svc_submit(&svc, job, NULL, sizeof(msg), 0),
+                          ISAL_CRYPTO_ERR_NULL_SRC, fn_name, end_submit);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_hash_svc_submit(&svc, job, msg, sizeof(msg), 0),
+                          ISAL_CRYPTO_ERR_NONE, fn_name, end_submit);
+
+        fn_name = "isal_hash_svc_run";
+
+        // check null service
+        CHECK_RETURN_GOTO(isal_hash_svc_run(NULL, 0, &num), ISAL_CRYPTO_ERR_NULL_MGR, fn_name,
+                          end_submit);
+
+        // check invalid shard
+        CHECK_RETURN_GOTO(isal_hash_svc_run(&svc, 2, &num), ISAL_CRYPTO_ERR_SHARD, fn_name,
+                          end_submit);
+
+        // check valid args, second run flushes the job taken by the first one
+        CHECK_RETURN_GOTO(isal_hash_svc_run(&svc, 1, &num), ISAL_CRYPTO_ERR_NONE, fn_name,
+                          end_submit);
+        CHECK_RETURN_GOTO(isal_hash_svc_run(&svc, 1, NULL), ISAL_CRYPTO_ERR_NONE, fn_name,
+                          end_submit);
+
+        fn_name = "isal_hash_svc_get_completed";
+
+        // check null service
+        CHECK_RETURN_GOTO(isal_hash_svc_get_completed(NULL, &job_out), ISAL_CRYPTO_ERR_NULL_MGR,
+                          fn_name, end_submit);
+
+        // check null job
+        CHECK_RETURN_GOTO(isal_hash_svc_get_completed(&svc, NULL), ISAL_CRYPTO_ERR_NULL_CTX,
+                          fn_name, end_submit);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_hash_svc_get_completed(&svc, &job_out), ISAL_CRYPTO_ERR_NONE,
+                          fn_name, end_submit);
+
+        if (job_out != job) {
+                printf("test: %s() - expected completed job\n", fn_name);
+                goto end_submit;
+        }
+
+        ret = 0;
+
+end_submit:
+        aligned_free(shards);
+        aligned_free(job);
+
+        return ret;
+}
+#endif /* SAFE_PARAM */
+
+int
+main(void)
+{
+        int fail = 0;
+
+#ifdef SAFE_PARAM
+        fail |= test_hash_svc_init_api();
+        fail |= test_hash_svc_submit_run_api();
+
+        printf(fail ? "Fail\n" : "Pass\n");
+#else
+        printf("Not Executed\n");
+#endif
+        return fail;
+}
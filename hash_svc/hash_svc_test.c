@@ -0,0 +1,213 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "isal_crypto_api.h"
+#include "hash_svc.h"
+#include "test.h"
+
+#define TEST_SHARDS 4
+#define TEST_JOBS   200
+#define TEST_LEN    (4 * 1024)
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+static uint32_t digest_ref[TEST_JOBS][ISAL_SHA256_DIGEST_NWORDS];
+
+// Compare against reference function
+extern void
+sha256_ref(uint8_t *input_data, uint32_t *digest, uint32_t len);
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+static void
+count_cb(ISAL_HASH_SVC_JOB *job, void *cb_arg)
+{
+        (void) job;
+        (*(uint32_t *) cb_arg)++;
+}
+
+static int
+check_jobs(ISAL_HASH_SVC_JOB *jobs, const uint32_t num)
+{
+        uint32_t i, j;
+        int fail = 0;
+
+        for (i = 0; i < num; i++) {
+                if (jobs[i].error != ISAL_CRYPTO_ERR_NONE) {
+                        printf("Job %d error %d\n", i, jobs[i].error);
+                        fail++;
+                        continue;
+                }
+                for (j = 0; j < ISAL_SHA256_DIGEST_NWORDS; j++) {
+                        if (jobs[i].ctx.sha256.job.result_digest[j] != digest_ref[i][j]) {
+                                printf("Job %d, digest%d fail 0x%08X <=> 0x%08X\n", i, j,
+                                       jobs[i].ctx.sha256.job.result_digest[j], digest_ref[i][j]);
+                                fail++;
+                        }
+                }
+        }
+
+        return fail;
+}
+
+int
+main(void)
+{
+        ISAL_HASH_SVC svc;
+        ISAL_HASH_SVC_SHARD *shards = NULL;
+        ISAL_HASH_SVC_JOB *jobs = NULL, *job;
+        unsigned char *buf = NULL;
+        uint32_t lens[TEST_JOBS], offsets[TEST_JOBS];
+        uint32_t i, n, completed, stolen = 0, cb_count = 0, rounds;
+        int ret, fail = 0;
+
+        printf("hash_svc test, %d shards, %d jobs: ", TEST_SHARDS, TEST_JOBS);
+
+        ret = posix_memalign((void *) &shards, 64, sizeof(*shards) * TEST_SHARDS);
+        ret |= posix_memalign((void *) &jobs, 16, sizeof(*jobs) * TEST_JOBS);
+        buf = (unsigned char *) malloc(TEST_JOBS * TEST_LEN);
+        if (ret != 0 || shards == NULL || jobs == NULL || buf == NULL) {
+                printf("alloc failed test aborted\n");
+                fail++;
+                goto end;
+        }
+
+        srand(TEST_SEED);
+        rand_buffer(buf, TEST_JOBS * TEST_LEN);
+        for (i = 0; i < TEST_JOBS; i++) {
+                lens[i] = rand() % (TEST_LEN + 1);
+                offsets[i] = i * TEST_LEN;
+                sha256_ref(buf + offsets[i], digest_ref[i], lens[i]);
+        }
+
+        // Completion queue: all jobs submitted to shard 0, other shards steal them
+        ret = isal_hash_svc_init(&svc, shards, TEST_SHARDS, ISAL_HASH_SVC_SHA256, NULL, NULL);
+        if (ret) {
+                printf("init failed %d\n", ret);
+                fail++;
+                goto end;
+        }
+
+        for (i = 0; i < TEST_JOBS; i++) {
+                jobs[i].user_data = (void *) (uintptr_t) i;
+                ret = isal_hash_svc_submit(&svc, &jobs[i], buf + offsets[i], lens[i], 0);
+                if (ret) {
+                        fail++;
+                        goto end;
+                }
+        }
+
+        completed = 0;
+        for (rounds = 0; completed < TEST_JOBS && rounds < 10 * TEST_JOBS; rounds++) {
+                // Run the thieves before the owner of the queue
+                for (i = 1; i <= TEST_SHARDS; i++) {
+                        ret = isal_hash_svc_run(&svc, i % TEST_SHARDS, &n);
+                        if (ret) {
+                                fail++;
+                                goto end;
+                        }
+                        if (i < TEST_SHARDS)
+                                stolen += n;
+                }
+                do {
+                        ret = isal_hash_svc_get_completed(&svc, &job);
+                        if (ret) {
+                                fail++;
+                                goto end;
+                        }
+                        if (job != NULL) {
+                                if (job != &jobs[(uintptr_t) job->user_data]) {
+                                        printf("job mismatch\n");
+                                        fail++;
+                                        goto end;
+                                }
+                                completed++;
+                        }
+                } while (job != NULL);
+        }
+
+        if (completed != TEST_JOBS || stolen == 0) {
+                printf("completed %d of %d jobs, %d stolen\n", completed, TEST_JOBS, stolen);
+                fail++;
+                goto end;
+        }
+        fail += check_jobs(jobs, TEST_JOBS);
+
+        // Callback delivery, jobs spread over all shards
+        memset(jobs, 0, sizeof(*jobs) * TEST_JOBS);
+        ret = isal_hash_svc_init(&svc, shards, TEST_SHARDS, ISAL_HASH_SVC_SHA256, count_cb,
+                                 &cb_count);
+        if (ret) {
+                fail++;
+                goto end;
+        }
+        for (i = 0; i < TEST_JOBS; i++) {
+                ret = isal_hash_svc_submit(&svc, &jobs[i], buf + offsets[i], lens[i], i);
+                if (ret) {
+                        fail++;
+                        goto end;
+                }
+        }
+        for (rounds = 0; cb_count < TEST_JOBS && rounds < 10 * TEST_JOBS; rounds++)
+                for (i = 0; i < TEST_SHARDS; i++)
+                        isal_hash_svc_run(&svc, i, NULL);
+
+        if (cb_count != TEST_JOBS) {
+                printf("callback called for %d of %d jobs\n", cb_count, TEST_JOBS);
+                fail++;
+                goto end;
+        }
+        fail += check_jobs(jobs, TEST_JOBS);
+
+        isal_hash_svc_get_completed(&svc, &job);
+        if (job != NULL) {
+                printf("completion queue used with a callback\n");
+                fail++;
+        }
+
+end:
+        aligned_free(shards);
+        aligned_free(jobs);
+        free(buf);
+
+        printf(fail ? "Fail\n" : "Pass\n");
+
+        return fail;
+}
@@ -0,0 +1,299 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include "isal_crypto_api.h"
+#include "hash_svc.h"
+#include "test.h"
+
+#define TEST_SHARDS    4
+#define TEST_PRODUCERS 4
+#define TEST_CONSUMERS 2
+#define TEST_JOBS      4000
+#define TEST_LEN       (2 * 1024)
+#define TEST_TIMEOUT   60 // seconds
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+static uint32_t digest_ref[TEST_JOBS][ISAL_SHA256_DIGEST_NWORDS];
+static uint32_t delivered[TEST_JOBS];
+
+struct test_ctx {
+        ISAL_HASH_SVC svc;
+        ISAL_HASH_SVC_JOB *jobs;
+        unsigned char *buf;
+        uint32_t lens[TEST_JOBS];
+        uint32_t completed;
+        uint32_t stop;
+        uint32_t errors;
+};
+
+struct thread_arg {
+        struct test_ctx *t;
+        uint32_t id;
+};
+
+// Compare against reference function
+extern void
+sha256_ref(uint8_t *input_data, uint32_t *digest, uint32_t len);
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+static void
+record_job(ISAL_HASH_SVC_JOB *job, void *cb_arg)
+{
+        struct test_ctx *t = (struct test_ctx *) cb_arg;
+
+        __atomic_fetch_add(&delivered[(uintptr_t) job->user_data], 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&t->completed, 1, __ATOMIC_RELEASE);
+}
+
+// Producers submit interleaved slices of the jobs, most of them to shard 0 so that it is stolen
+static void *
+producer(void *arg)
+{
+        struct thread_arg *a = (struct thread_arg *) arg;
+        struct test_ctx *t = a->t;
+        uint32_t i, hint;
+
+        for (i = a->id; i < TEST_JOBS; i += TEST_PRODUCERS) {
+                hint = (i % 3 == 0) ? i : 0;
+                t->jobs[i].user_data = (void *) (uintptr_t) i;
+                if (isal_hash_svc_submit(&t->svc, &t->jobs[i], t->buf + i * TEST_LEN,
+                                         t->lens[i], hint) != 0)
+                        __atomic_fetch_add(&t->errors, 1, __ATOMIC_RELAXED);
+        }
+
+        return NULL;
+}
+
+// One runner per shard, until the main thread has seen every job completed
+static void *
+runner(void *arg)
+{
+        struct thread_arg *a = (struct thread_arg *) arg;
+        struct test_ctx *t = a->t;
+
+        while (!__atomic_load_n(&t->stop, __ATOMIC_ACQUIRE))
+                if (isal_hash_svc_run(&t->svc, a->id, NULL) != 0)
+                        __atomic_fetch_add(&t->errors, 1, __ATOMIC_RELAXED);
+
+        return NULL;
+}
+
+// Several threads pop the completion queue at the same time
+static void *
+consumer(void *arg)
+{
+        struct thread_arg *a = (struct thread_arg *) arg;
+        struct test_ctx *t = a->t;
+        ISAL_HASH_SVC_JOB *job;
+
+        while (!__atomic_load_n(&t->stop, __ATOMIC_ACQUIRE)) {
+                if (isal_hash_svc_get_completed(&t->svc, &job) != 0)
+                        __atomic_fetch_add(&t->errors, 1, __ATOMIC_RELAXED);
+                else if (job != NULL)
+                        record_job(job, t);
+                else
+                        sched_yield();
+        }
+
+        return NULL;
+}
+
+static int
+check_jobs(struct test_ctx *t)
+{
+        uint32_t i, j;
+        int fail = 0;
+
+        for (i = 0; i < TEST_JOBS; i++) {
+                if (delivered[i] != 1) {
+                        printf("Job %d delivered %d times\n", i, delivered[i]);
+                        fail++;
+                        continue;
+                }
+                if (t->jobs[i].error != ISAL_CRYPTO_ERR_NONE) {
+                        printf("Job %d error %d\n", i, t->jobs[i].error);
+                        fail++;
+                        continue;
+                }
+                for (j = 0; j < ISAL_SHA256_DIGEST_NWORDS; j++) {
+                        if (t->jobs[i].ctx.sha256.job.result_digest[j] != digest_ref[i][j]) {
+                                printf("Job %d, digest%d fail 0x%08X <=> 0x%08X\n", i, j,
+                                       t->jobs[i].ctx.sha256.job.result_digest[j],
+                                       digest_ref[i][j]);
+                                fail++;
+                        }
+                }
+        }
+
+        return fail;
+}
+
+/*
+ * Run the service with TEST_PRODUCERS submitting threads and one runner per shard. Completed
+ * jobs go to the callback, or to the completion queue read by TEST_CONSUMERS threads.
+ */
+static int
+run_threads(struct test_ctx *t, ISAL_HASH_SVC_SHARD *shards, const int use_callback)
+{
+        pthread_t producers[TEST_PRODUCERS], runners[TEST_SHARDS], consumers[TEST_CONSUMERS];
+        struct thread_arg pa[TEST_PRODUCERS], ra[TEST_SHARDS], ca[TEST_CONSUMERS];
+        uint32_t i, np = 0, nr = 0, nc = 0;
+        ISAL_HASH_SVC_JOB *job;
+        time_t deadline;
+        int fail = 0;
+
+        memset(t->jobs, 0, sizeof(*t->jobs) * TEST_JOBS);
+        memset(delivered, 0, sizeof(delivered));
+        t->completed = 0;
+        t->stop = 0;
+        t->errors = 0;
+        if (isal_hash_svc_init(&t->svc, shards, TEST_SHARDS, ISAL_HASH_SVC_SHA256,
+                               use_callback ? record_job : NULL, t) != 0)
+                return 1;
+
+        for (i = 0; i < TEST_SHARDS; i++) {
+                ra[i].t = t;
+                ra[i].id = i;
+                if (pthread_create(&runners[i], NULL, runner, &ra[i]) != 0)
+                        goto stop;
+                nr++;
+        }
+        for (i = 0; !use_callback && i < TEST_CONSUMERS; i++) {
+                ca[i].t = t;
+                ca[i].id = i;
+                if (pthread_create(&consumers[i], NULL, consumer, &ca[i]) != 0)
+                        goto stop;
+                nc++;
+        }
+        for (i = 0; i < TEST_PRODUCERS; i++) {
+                pa[i].t = t;
+                pa[i].id = i;
+                if (pthread_create(&producers[i], NULL, producer, &pa[i]) != 0)
+                        goto stop;
+                np++;
+        }
+
+        deadline = time(NULL) + TEST_TIMEOUT;
+        while (__atomic_load_n(&t->completed, __ATOMIC_ACQUIRE) < TEST_JOBS &&
+               time(NULL) < deadline)
+                sched_yield();
+
+stop:
+        for (i = 0; i < np; i++)
+                pthread_join(producers[i], NULL);
+        __atomic_store_n(&t->stop, 1, __ATOMIC_RELEASE);
+        for (i = 0; i < nr; i++)
+                pthread_join(runners[i], NULL);
+        for (i = 0; i < nc; i++)
+                pthread_join(consumers[i], NULL);
+
+        if (np != TEST_PRODUCERS || nr != TEST_SHARDS || (!use_callback && nc != TEST_CONSUMERS)) {
+                printf("thread create failed\n");
+                return 1;
+        }
+        if (t->errors != 0 || t->completed != TEST_JOBS) {
+                printf("%s: completed %d of %d jobs, %d errors\n",
+                       use_callback ? "callback" : "queue", t->completed, TEST_JOBS, t->errors);
+                fail++;
+        }
+        fail += check_jobs(t);
+
+        isal_hash_svc_get_completed(&t->svc, &job);
+        if (job != NULL) {
+                printf("completion queue not empty after all jobs\n");
+                fail++;
+        }
+
+        return fail;
+}
+
+int
+main(void)
+{
+        ISAL_HASH_SVC_SHARD *shards = NULL;
+        struct test_ctx *t = NULL;
+        uint32_t i;
+        int ret, fail = 0;
+
+        printf("hash_svc thread test, %d shards, %d producers, %d jobs: ", TEST_SHARDS,
+               TEST_PRODUCERS, TEST_JOBS);
+
+        ret = posix_memalign((void *) &shards, 64, sizeof(*shards) * TEST_SHARDS);
+        t = (struct test_ctx *) calloc(1, sizeof(*t));
+        if (ret != 0 || shards == NULL || t == NULL) {
+                printf("alloc failed test aborted\n");
+                fail++;
+                goto end;
+        }
+        ret = posix_memalign((void *) &t->jobs, 16, sizeof(*t->jobs) * TEST_JOBS);
+        t->buf = (unsigned char *) malloc(TEST_JOBS * TEST_LEN);
+        if (ret != 0 || t->jobs == NULL || t->buf == NULL) {
+                printf("alloc failed test aborted\n");
+                fail++;
+                goto end;
+        }
+
+        srand(TEST_SEED);
+        rand_buffer(t->buf, TEST_JOBS * TEST_LEN);
+        for (i = 0; i < TEST_JOBS; i++) {
+                t->lens[i] = rand() % (TEST_LEN + 1);
+                sha256_ref(t->buf + i * TEST_LEN, digest_ref[i], t->lens[i]);
+        }
+
+        fail += run_threads(t, shards, 0);
+        fail += run_threads(t, shards, 1);
+
+end:
+        aligned_free(shards);
+        if (t != NULL) {
+                aligned_free(t->jobs);
+                free(t->buf);
+                free(t);
+        }
+
+        printf(fail ? "Fail\n" : "Pass\n");
+
+        return fail;
+}
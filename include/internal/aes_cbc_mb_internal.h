@@ -0,0 +1,152 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+/**
+ *  @file aes_cbc_mb_internal.h
+ *  @brief Multi-buffer AES-CBC encryption internal function prototypes.
+ *
+ */
+#ifndef _AES_CBC_MB_INTERNAL_H
+#define _AES_CBC_MB_INTERNAL_H
+
+#include <stdint.h>
+#include "aes_cbc_mb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************
+ * Multibinary CTX level functions
+ ******************************************************************/
+
+/**
+ * @brief Initialize the AES-CBC encryption multi-buffer manager structure.
+ *
+ * @param mgr      Structure holding context level state info
+ * @param key_size Key size shared by all jobs of this manager
+ * @returns void
+ */
+void
+_aes_cbc_enc_ctx_mgr_init(ISAL_AES_CBC_CTX_MGR *mgr, const isal_cbc_key_size key_size);
+
+/**
+ * @brief Submit a new AES-CBC encryption job to the multi-buffer manager.
+ *
+ * @param mgr Structure holding context level state info
+ * @param ctx Structure holding ctx job info
+ * @param in  Pointer to plaintext
+ * @param out Pointer to ciphertext
+ * @param len Length of plaintext in bytes (multiple of 16)
+ * @returns NULL if no jobs complete or pointer to jobs structure.
+ */
+ISAL_AES_CBC_CTX *
+_aes_cbc_enc_ctx_mgr_submit(ISAL_AES_CBC_CTX_MGR *mgr, ISAL_AES_CBC_CTX *ctx, const void *in,
+                            void *out, uint64_t len);
+
+/**
+ * @brief Finish all submitted AES-CBC encryption jobs and return when complete.
+ *
+ * @param mgr Structure holding context level state info
+ * @returns NULL if no jobs to complete or pointer to jobs structure.
+ */
+ISAL_AES_CBC_CTX *
+_aes_cbc_enc_ctx_mgr_flush(ISAL_AES_CBC_CTX_MGR *mgr);
+
+/*******************************************************************
+ * Architecture specific CTX level functions
+ ******************************************************************/
+
+void
+_aes_cbc_enc_ctx_mgr_init_base(ISAL_AES_CBC_CTX_MGR *mgr, const isal_cbc_key_size key_size);
+ISAL_AES_CBC_CTX *
+_aes_cbc_enc_ctx_mgr_submit_base(ISAL_AES_CBC_CTX_MGR *mgr, ISAL_AES_CBC_CTX *ctx, const void *in,
+                                 void *out, uint64_t len);
+ISAL_AES_CBC_CTX *
+_aes_cbc_enc_ctx_mgr_flush_base(ISAL_AES_CBC_CTX_MGR *mgr);
+
+void
+_aes_cbc_enc_ctx_mgr_init_sse(ISAL_AES_CBC_CTX_MGR *mgr, const isal_cbc_key_size key_size);
+ISAL_AES_CBC_CTX *
+_aes_cbc_enc_ctx_mgr_submit_sse(ISAL_AES_CBC_CTX_MGR *mgr, ISAL_AES_CBC_CTX *ctx, const void *in,
+                                void *out, uint64_t len);
+ISAL_AES_CBC_CTX *
+_aes_cbc_enc_ctx_mgr_flush_sse(ISAL_AES_CBC_CTX_MGR *mgr);
+
+void
+_aes_cbc_enc_ctx_mgr_init_avx(ISAL_AES_CBC_CTX_MGR *mgr, const isal_cbc_key_size key_size);
+ISAL_AES_CBC_CTX *
+_aes_cbc_enc_ctx_mgr_submit_avx(ISAL_AES_CBC_CTX_MGR *mgr, ISAL_AES_CBC_CTX *ctx, const void *in,
+                                void *out, uint64_t len);
+ISAL_AES_CBC_CTX *
+_aes_cbc_enc_ctx_mgr_flush_avx(ISAL_AES_CBC_CTX_MGR *mgr);
+
+void
+_aes_cbc_enc_ctx_mgr_init_avx512(ISAL_AES_CBC_CTX_MGR *mgr, const isal_cbc_key_size key_size);
+ISAL_AES_CBC_CTX *
+_aes_cbc_enc_ctx_mgr_submit_avx512(ISAL_AES_CBC_CTX_MGR *mgr, ISAL_AES_CBC_CTX *ctx,
+                                   const void *in, void *out, uint64_t len);
+ISAL_AES_CBC_CTX *
+_aes_cbc_enc_ctx_mgr_flush_avx512(ISAL_AES_CBC_CTX_MGR *mgr);
+
+/*******************************************************************
+ * Lane kernels
+ ******************************************************************/
+
+/**
+ * @brief Encrypt num_blocks 16-byte blocks in every lane of the AES-CBC manager.
+ *
+ * Input, output and IV of each lane are advanced/updated in args.
+ * All lanes are processed; the manager fills unused lanes with copies of a used one.
+ */
+void
+_aes_cbc_enc_128_mb_x4_sse(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_cbc_enc_192_mb_x4_sse(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_cbc_enc_256_mb_x4_sse(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks);
+
+void
+_aes_cbc_enc_128_mb_x8_avx(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_cbc_enc_192_mb_x8_avx(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_cbc_enc_256_mb_x8_avx(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks);
+
+void
+_aes_cbc_enc_128_mb_x16_vaes_avx512(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_cbc_enc_192_mb_x16_vaes_avx512(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_cbc_enc_256_mb_x16_vaes_avx512(ISAL_AES_CBC_MB_ARGS_X16 *args, uint64_t num_blocks);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+#endif // ifndef _AES_CBC_MB_INTERNAL_H
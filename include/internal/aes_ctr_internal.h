@@ -0,0 +1,109 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+/**
+ *  @file aes_ctr_internal.h
+ *  @brief AES CTR encryption/decryption internal function prototypes.
+ *
+ */
+#ifndef _AES_CTR_INTERNAL_H
+#define _AES_CTR_INTERNAL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief CTR-AES 128 bit key Encryption/Decryption of whole blocks
+ *
+ * arg 1: in:      pointer to input
+ * arg 2: counter: pointer to first counter block (16 bytes, big-endian), not updated
+ * arg 3: keys:    pointer to expanded encryption keys
+ * arg 4: out:     pointer to output (in-place allowed)
+ * arg 5: num_blocks: number of 16-byte blocks. The low 64 bits of the counter must
+ *                    not wrap within the call, the caller splits the data there.
+ */
+void
+_aes_ctr_128(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+             uint64_t num_blocks);
+/** @brief CTR-AES 192 bit key Encryption/Decryption of whole blocks, see _aes_ctr_128() */
+void
+_aes_ctr_192(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+             uint64_t num_blocks);
+/** @brief CTR-AES 256 bit key Encryption/Decryption of whole blocks, see _aes_ctr_128() */
+void
+_aes_ctr_256(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+             uint64_t num_blocks);
+
+/* Architecture specific versions */
+void
+_aes_ctr_128_base(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                  uint64_t num_blocks);
+void
+_aes_ctr_192_base(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                  uint64_t num_blocks);
+void
+_aes_ctr_256_base(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                  uint64_t num_blocks);
+
+void
+_aes_ctr_128_sse(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                 uint64_t num_blocks);
+void
+_aes_ctr_192_sse(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                 uint64_t num_blocks);
+void
+_aes_ctr_256_sse(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                 uint64_t num_blocks);
+
+void
+_aes_ctr_128_avx(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                 uint64_t num_blocks);
+void
+_aes_ctr_192_avx(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                 uint64_t num_blocks);
+void
+_aes_ctr_256_avx(const uint8_t *in, const uint8_t *counter, const uint8_t *keys, uint8_t *out,
+                 uint64_t num_blocks);
+
+void
+_aes_ctr_128_vaes_avx512(const uint8_t *in, const uint8_t *counter, const uint8_t *keys,
+                         uint8_t *out, uint64_t num_blocks);
+void
+_aes_ctr_192_vaes_avx512(const uint8_t *in, const uint8_t *counter, const uint8_t *keys,
+                         uint8_t *out, uint64_t num_blocks);
+void
+_aes_ctr_256_vaes_avx512(const uint8_t *in, const uint8_t *counter, const uint8_t *keys,
+                         uint8_t *out, uint64_t num_blocks);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+#endif // ifndef _AES_CTR_INTERNAL_H
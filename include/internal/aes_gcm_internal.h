@@ -479,6 +479,35 @@ _aes_gcm_precomp_128(struct isal_gcm_key_data *key_data);
 void
 _aes_gcm_precomp_256(struct isal_gcm_key_data *key_data);
 
+/**
+ * @brief GHASH whole blocks using the hash key powers in key data
+ *
+ * The hash is read and written in GCM byte order.
+ *
+ * @requires SSE4.1 and PCLMULQDQ
+ */
+void
+_ghash(const struct isal_gcm_key_data *key_data, //!< GCM expanded key data
+       uint8_t *hash,                            //!< 16 byte GHASH value, updated in place
+       const uint8_t *in,                        //!< Input data
+       uint64_t len                              //!< Length in bytes, multiple of 16
+);
+
+/**
+ * @brief GHASH whole blocks into the aad_hash of a GCM context
+ *
+ * Same as _ghash() but the hash is read and written in the native layout of
+ * isal_gcm_context_data.aad_hash.
+ *
+ * @requires SSE4.1 and PCLMULQDQ
+ */
+void
+_ghash_ctx(const struct isal_gcm_key_data *key_data, //!< GCM expanded key data
+           uint8_t *hash,                            //!< Context aad_hash, updated in place
+           const uint8_t *in,                        //!< Input data
+           uint64_t len                              //!< Length in bytes, multiple of 16
+);
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
@@ -0,0 +1,165 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+/**
+ *  @file aes_xts_mb_internal.h
+ *  @brief Multi-buffer AES-XTS internal function prototypes.
+ *
+ */
+#ifndef _AES_XTS_MB_INTERNAL_H
+#define _AES_XTS_MB_INTERNAL_H
+
+#include <stdint.h>
+#include "aes_xts_mb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************
+ * Multibinary CTX level functions
+ ******************************************************************/
+
+/**
+ * @brief Initialize the AES-XTS multi-buffer manager structure.
+ *
+ * @param mgr     Structure holding context level state info
+ * @param key_len Key length in bytes shared by all jobs of this manager
+ * @param dir     Direction shared by all jobs of this manager
+ * @returns void
+ */
+void
+_aes_xts_ctx_mgr_init(ISAL_AES_XTS_CTX_MGR *mgr, const uint32_t key_len,
+                      const ISAL_AES_XTS_DIR dir);
+
+/**
+ * @brief Submit a new AES-XTS job to the multi-buffer manager.
+ *
+ * @param mgr   Structure holding context level state info
+ * @param ctx   Structure holding ctx job info
+ * @param out   Output buffer
+ * @param in    Input buffer
+ * @param len   Length of input in bytes
+ * @param tweak Pointer to 16 byte initial tweak
+ * @returns NULL if no jobs complete or pointer to jobs structure.
+ */
+ISAL_AES_XTS_CTX *
+_aes_xts_ctx_mgr_submit(ISAL_AES_XTS_CTX_MGR *mgr, ISAL_AES_XTS_CTX *ctx, uint8_t *out,
+                        const uint8_t *in, uint64_t len, const uint8_t *tweak);
+
+/**
+ * @brief Finish all submitted AES-XTS jobs and return when complete.
+ *
+ * @param mgr Structure holding context level state info
+ * @returns NULL if no jobs to complete or pointer to jobs structure.
+ */
+ISAL_AES_XTS_CTX *
+_aes_xts_ctx_mgr_flush(ISAL_AES_XTS_CTX_MGR *mgr);
+
+/*******************************************************************
+ * Architecture specific CTX level functions
+ ******************************************************************/
+
+void
+_aes_xts_ctx_mgr_init_base(ISAL_AES_XTS_CTX_MGR *mgr, const uint32_t key_len,
+                           const ISAL_AES_XTS_DIR dir);
+ISAL_AES_XTS_CTX *
+_aes_xts_ctx_mgr_submit_base(ISAL_AES_XTS_CTX_MGR *mgr, ISAL_AES_XTS_CTX *ctx, uint8_t *out,
+                             const uint8_t *in, uint64_t len, const uint8_t *tweak);
+ISAL_AES_XTS_CTX *
+_aes_xts_ctx_mgr_flush_base(ISAL_AES_XTS_CTX_MGR *mgr);
+
+void
+_aes_xts_ctx_mgr_init_sse(ISAL_AES_XTS_CTX_MGR *mgr, const uint32_t key_len,
+                          const ISAL_AES_XTS_DIR dir);
+ISAL_AES_XTS_CTX *
+_aes_xts_ctx_mgr_submit_sse(ISAL_AES_XTS_CTX_MGR *mgr, ISAL_AES_XTS_CTX *ctx, uint8_t *out,
+                            const uint8_t *in, uint64_t len, const uint8_t *tweak);
+ISAL_AES_XTS_CTX *
+_aes_xts_ctx_mgr_flush_sse(ISAL_AES_XTS_CTX_MGR *mgr);
+
+void
+_aes_xts_ctx_mgr_init_avx(ISAL_AES_XTS_CTX_MGR *mgr, const uint32_t key_len,
+                          const ISAL_AES_XTS_DIR dir);
+ISAL_AES_XTS_CTX *
+_aes_xts_ctx_mgr_submit_avx(ISAL_AES_XTS_CTX_MGR *mgr, ISAL_AES_XTS_CTX *ctx, uint8_t *out,
+                            const uint8_t *in, uint64_t len, const uint8_t *tweak);
+ISAL_AES_XTS_CTX *
+_aes_xts_ctx_mgr_flush_avx(ISAL_AES_XTS_CTX_MGR *mgr);
+
+void
+_aes_xts_ctx_mgr_init_avx512(ISAL_AES_XTS_CTX_MGR *mgr, const uint32_t key_len,
+                             const ISAL_AES_XTS_DIR dir);
+ISAL_AES_XTS_CTX *
+_aes_xts_ctx_mgr_submit_avx512(ISAL_AES_XTS_CTX_MGR *mgr, ISAL_AES_XTS_CTX *ctx, uint8_t *out,
+                               const uint8_t *in, uint64_t len, const uint8_t *tweak);
+ISAL_AES_XTS_CTX *
+_aes_xts_ctx_mgr_flush_avx512(ISAL_AES_XTS_CTX_MGR *mgr);
+
+/*******************************************************************
+ * Lane kernels
+ ******************************************************************/
+
+/**
+ * @brief Encrypt or decrypt num_blocks 16-byte blocks in every lane of the AES-XTS manager.
+ *
+ * Input, output and tweak of each lane are advanced in args.
+ * All lanes are processed; the manager fills unused lanes with copies of a used one.
+ */
+void
+_aes_xts_128_enc_mb_x4_sse(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_xts_128_dec_mb_x4_sse(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_xts_256_enc_mb_x4_sse(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_xts_256_dec_mb_x4_sse(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks);
+
+void
+_aes_xts_128_enc_mb_x8_avx(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_xts_128_dec_mb_x8_avx(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_xts_256_enc_mb_x8_avx(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_xts_256_dec_mb_x8_avx(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks);
+
+void
+_aes_xts_128_enc_mb_x16_vaes_avx512(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_xts_128_dec_mb_x16_vaes_avx512(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_xts_256_enc_mb_x16_vaes_avx512(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks);
+void
+_aes_xts_256_dec_mb_x16_vaes_avx512(ISAL_AES_XTS_MB_ARGS_X16 *args, uint64_t num_blocks);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+#endif // ifndef _AES_XTS_MB_INTERNAL_H
@@ -0,0 +1,217 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#ifndef _AES_CBC_MB_H_
+#define _AES_CBC_MB_H_
+
+/**
+ *  @file aes_cbc_mb.h
+ *  @brief Multi-buffer CTX API AES-CBC encryption function prototypes and structures
+ *
+ * Interface for multi-buffer AES-CBC encryption functions
+ *
+ * CBC encryption of a single stream is serial: every block depends on the
+ * ciphertext of the previous one, so a single stream can only issue one AES
+ * round at a time and is bound by the AES instruction latency. The multi-buffer
+ * interface interleaves the rounds of several independent CBC streams, keeping
+ * all AES units busy.
+ *
+ * The interface is carried out through the context-level (CTX) init, submit and
+ * flush functions and the ISAL_AES_CBC_CTX_MGR and ISAL_AES_CBC_CTX objects,
+ * following the same model as the multi-buffer hash managers (see sha256_mb.h).
+ * Numerous ISAL_AES_CBC_CTX objects may be instantiated by the application for
+ * use with a single ISAL_AES_CBC_CTX_MGR. All streams handled by one manager
+ * must use the same key size, selected when the manager is initialized, but
+ * each stream has its own expanded key and IV.
+ *
+ * Up to 4 (SSE), 8 (AVX) or 16 (VAES/AVX512) streams are processed at a time.
+ * The architecture-specific implementation is selected at runtime.
+ *
+ * <b>Usage:</b> The application creates a ISAL_AES_CBC_CTX_MGR object and
+ * initializes it with isal_aes_cbc_enc_ctx_mgr_init(). Each ISAL_AES_CBC_CTX is
+ * initialized with isal_aes_cbc_enc_ctx_init(), which sets the expanded
+ * encryption keys (as generated by isal_aes_keyexp_128/192/256()) and the IV of
+ * the stream. Buffers are then handed to the manager with
+ * isal_aes_cbc_enc_ctx_mgr_submit(). When the ISAL_AES_CBC_CTX is returned to
+ * the application (via this or a later call to submit or
+ * isal_aes_cbc_enc_ctx_mgr_flush()), its output buffer holds the ciphertext and
+ * its IV has been updated to the last ciphertext block, so the next buffer of the
+ * same stream can be submitted with the same ISAL_AES_CBC_CTX.
+ *
+ * The order in which ISAL_AES_CBC_CTX objects are returned is in general
+ * different from the order in which they are submitted.
+ *
+ * Submitting a context that is currently being managed by a
+ * ISAL_AES_CBC_CTX_MGR is reported by returning the context immediately with
+ * its error member set to ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING.
+ */
+
+#include <stdint.h>
+#include "aes_cbc.h"
+#include "multi_buffer.h"
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ISAL_AES_CBC_MAX_LANES 16
+#define ISAL_AES_CBC_MIN_LANES 4
+
+/** @brief Scheduler layer - Holds info describing a single AES-CBC encryption job for the
+ * multi-buffer manager */
+
+typedef struct {
+        const uint8_t *in; //!< pointer to plaintext for this job
+        uint8_t *out;      //!< pointer to ciphertext for this job (in-place allowed)
+        uint64_t len;      //!< length of this job in 16-byte blocks
+        DECLARE_ALIGNED(uint8_t iv[ISAL_CBC_IV_DATA_LEN], 16); //!< chaining value
+        const uint8_t *keys;                                   //!< expanded encryption keys
+        ISAL_JOB_STS status;                                   //!< output job status
+        void *user_data; //!< pointer for user's job-related data
+} ISAL_AES_CBC_JOB;
+
+/** @brief Scheduler layer - Holds arguments for submitted AES-CBC jobs
+ *
+ * Round keys are stored interleaved by lane, so round r of lanes 4n..4n+3 can be
+ * loaded as a single 64-byte vector.
+ */
+
+typedef struct {
+        DECLARE_ALIGNED(uint8_t iv[ISAL_AES_CBC_MAX_LANES][ISAL_CBC_IV_DATA_LEN], 64);
+        DECLARE_ALIGNED(uint8_t keys[ISAL_CBC_256_KEY_ROUNDS][ISAL_AES_CBC_MAX_LANES]
+                                    [ISAL_CBC_ROUND_KEY_LEN],
+                        64);
+        const uint8_t *in[ISAL_AES_CBC_MAX_LANES];
+        uint8_t *out[ISAL_AES_CBC_MAX_LANES];
+} ISAL_AES_CBC_MB_ARGS_X16;
+
+/** @brief Scheduler layer - Lane data */
+
+typedef struct {
+        ISAL_AES_CBC_JOB *job_in_lane;
+} ISAL_AES_CBC_LANE_DATA;
+
+/** @brief Scheduler layer - Holds state for multi-buffer AES-CBC jobs */
+
+typedef struct {
+        ISAL_AES_CBC_MB_ARGS_X16 args;
+        uint64_t lens[ISAL_AES_CBC_MAX_LANES]; //!< remaining blocks in each lane
+        uint64_t unused_lanes; //!< each nibble is index of an unused lane
+        ISAL_AES_CBC_LANE_DATA ldata[ISAL_AES_CBC_MAX_LANES];
+        uint32_t num_lanes_inuse;
+        uint32_t num_rounds; //!< number of AES rounds (10, 12 or 14)
+} ISAL_AES_CBC_MB_JOB_MGR;
+
+/** @brief Context layer - Holds state for multi-buffer AES-CBC jobs. This structure must be
+ * allocated to 64-byte aligned memory */
+
+typedef struct {
+        ISAL_AES_CBC_MB_JOB_MGR mgr;
+} ISAL_AES_CBC_CTX_MGR;
+
+/** @brief Context layer - Holds info describing a single AES-CBC stream for the multi-buffer
+ * CTX manager. This structure must be allocated to 16-byte aligned memory */
+
+typedef struct {
+        ISAL_AES_CBC_JOB job;     // Must be at struct offset 0.
+        ISAL_HASH_CTX_STS status; //!< Context status flag
+        ISAL_HASH_CTX_ERROR error; //!< Context error flag
+        void *user_data;           //!< pointer for user to keep any job-related data
+} ISAL_AES_CBC_CTX;
+
+/**
+ * @brief Initialize the AES-CBC encryption multi-buffer manager structure.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info, on a 64 byte boundary
+ * @param[in] key_size Key size shared by all streams of this manager
+ *                     (ISAL_CBC_128_BITS, ISAL_CBC_192_BITS or ISAL_CBC_256_BITS)
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_cbc_enc_ctx_mgr_init(ISAL_AES_CBC_CTX_MGR *mgr, const isal_cbc_key_size key_size);
+
+/**
+ * @brief Initialize an AES-CBC encryption context with its key and IV.
+ *
+ * @param[in] ctx Structure holding ctx job info
+ * @param[in] keys Expanded encryption keys. Must be on a 16 byte boundary and stay valid
+ *                 while the context is being processed.
+ * @param[in] iv Initialization vector (16 bytes)
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_cbc_enc_ctx_init(ISAL_AES_CBC_CTX *ctx, const void *keys, const void *iv);
+
+/**
+ * @brief Submit a new AES-CBC encryption job to the multi-buffer manager.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctx_in Structure holding ctx job info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *			Modified to point to completed job structure or
+ *			NULL if no jobs completed.
+ * @param[in] in Pointer to plaintext
+ * @param[out] out Pointer to ciphertext (in-place allowed)
+ * @param[in] len_bytes Length of plaintext. Must be a multiple of 16 bytes
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_cbc_enc_ctx_mgr_submit(ISAL_AES_CBC_CTX_MGR *mgr, ISAL_AES_CBC_CTX *ctx_in,
+                                ISAL_AES_CBC_CTX **ctx_out, const void *in, void *out,
+                                const uint64_t len_bytes);
+
+/**
+ * @brief Finish all submitted AES-CBC encryption jobs and return when complete.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *			Modified to point to completed job structure or
+ *			NULL if no jobs completed.
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_cbc_enc_ctx_mgr_flush(ISAL_AES_CBC_CTX_MGR *mgr, ISAL_AES_CBC_CTX **ctx_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AES_CBC_MB_H_
@@ -0,0 +1,196 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+/**
+ *  @file aes_ctr.h
+ *  @brief AES CTR encryption/decryption function prototypes.
+ *
+ * The counter block is the full 16-byte IV, incremented as a 128-bit big-endian
+ * integer for every block (NIST SP 800-38A), as done by OpenSSL's AES-CTR ciphers.
+ * Encryption and decryption are the same operation.
+ *
+ * Data can be processed in one call (isal_aes_ctr_128/192/256()) or as a stream
+ * with isal_aes_ctr_init(), any number of isal_aes_ctr_128/192/256_update() calls
+ * of arbitrary length and isal_aes_ctr_finalize(). Keystream bytes left over from
+ * a partial block are used by the next update, so splitting a message across
+ * updates gives the same result as processing it in one call.
+ *
+ * Keys are the expanded encryption keys generated by isal_aes_keyexp_128/192/256().
+ */
+#ifndef _AES_CTR_h
+#define _AES_CTR_h
+
+#include <stdint.h>
+
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ISAL_AES_CTR_BLOCK_LEN (16)
+#define ISAL_AES_CTR_IV_LEN    (16)
+
+/**
+ * @brief holds AES-CTR operation context
+ */
+struct isal_aes_ctr_context_data {
+        uint8_t current_counter[ISAL_AES_CTR_BLOCK_LEN];       //!< Next counter block
+        uint8_t partial_block_enc_key[ISAL_AES_CTR_BLOCK_LEN]; //!< Keystream of last block
+        uint64_t partial_block_length; //!< Keystream bytes of last block already used
+        uint64_t in_length;            //!< Total length of data processed
+};
+
+/** @brief CTR-AES 128 bit key Encryption/Decryption
+ *
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return  Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_ctr_128(const void *in,          //!< Input plaintext/ciphertext
+                 const void *iv,          //!< Initial counter block (16 bytes)
+                 const void *keys,        //!< Expanded encryption keys
+                 void *out,               //!< Output ciphertext/plaintext. In-place allowed.
+                 const uint64_t len_bytes //!< Input length in bytes
+);
+
+/** @brief CTR-AES 192 bit key Encryption/Decryption
+ *
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return  Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_ctr_192(const void *in,          //!< Input plaintext/ciphertext
+                 const void *iv,          //!< Initial counter block (16 bytes)
+                 const void *keys,        //!< Expanded encryption keys
+                 void *out,               //!< Output ciphertext/plaintext. In-place allowed.
+                 const uint64_t len_bytes //!< Input length in bytes
+);
+
+/** @brief CTR-AES 256 bit key Encryption/Decryption
+ *
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return  Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_ctr_256(const void *in,          //!< Input plaintext/ciphertext
+                 const void *iv,          //!< Initial counter block (16 bytes)
+                 const void *keys,        //!< Expanded encryption keys
+                 void *out,               //!< Output ciphertext/plaintext. In-place allowed.
+                 const uint64_t len_bytes //!< Input length in bytes
+);
+
+/** @brief Start an AES-CTR stream, for any key size
+ *
+ * @return  Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_ctr_init(struct isal_aes_ctr_context_data *context_data, //!< CTR operation context data
+                  const void *iv //!< Initial counter block (16 bytes)
+);
+
+/** @brief Encrypt/decrypt the next part of an AES-128-CTR stream
+ *
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return  Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_ctr_128_update(
+        const void *keys,                               //!< Expanded encryption keys
+        struct isal_aes_ctr_context_data *context_data, //!< CTR operation context data
+        void *out,                                      //!< Output. In-place allowed.
+        const void *in,                                 //!< Input
+        const uint64_t len_bytes                        //!< Input length in bytes, any value
+);
+
+/** @brief Encrypt/decrypt the next part of an AES-192-CTR stream
+ *
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return  Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_ctr_192_update(
+        const void *keys,                               //!< Expanded encryption keys
+        struct isal_aes_ctr_context_data *context_data, //!< CTR operation context data
+        void *out,                                      //!< Output. In-place allowed.
+        const void *in,                                 //!< Input
+        const uint64_t len_bytes                        //!< Input length in bytes, any value
+);
+
+/** @brief Encrypt/decrypt the next part of an AES-256-CTR stream
+ *
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return  Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_ctr_256_update(
+        const void *keys,                               //!< Expanded encryption keys
+        struct isal_aes_ctr_context_data *context_data, //!< CTR operation context data
+        void *out,                                      //!< Output. In-place allowed.
+        const void *in,                                 //!< Input
+        const uint64_t len_bytes                        //!< Input length in bytes, any value
+);
+
+/** @brief End an AES-CTR stream, for any key size
+ *
+ * Clears the counter and leftover keystream held in the context.
+ *
+ * @return  Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_ctr_finalize(
+        struct isal_aes_ctr_context_data *context_data //!< CTR operation context data
+);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+#endif // ifndef _AES_CTR_h
@@ -181,6 +181,17 @@ struct isal_gcm_context_data {
         uint64_t partial_block_length;
 };
 
+/**
+ * @brief holds AES-GMAC (authenticate-only GCM) operation context
+ */
+struct isal_gmac_context_data {
+        uint8_t hash[ISAL_GCM_BLOCK_LEN];          //!< running GHASH value, GCM byte order
+        uint8_t enc_j0[ISAL_GCM_BLOCK_LEN];        //!< E(K, IV || 0^31 || 1)
+        uint8_t partial_block[ISAL_GCM_BLOCK_LEN]; //!< bytes of an incomplete block
+        uint64_t aad_length;                       //!< total authenticated length in bytes
+        uint64_t partial_block_length;             //!< number of bytes in partial_block
+};
+
 /* ------------------ New interface for separate expanded keys ------------ */
 
 /**
@@ -792,6 +803,46 @@ isal_aes_gcm_init_256(const struct isal_gcm_key_data *key_data,   //!< GCM expan
                       const uint64_t aad_len //!< Length of AAD
 );
 
+/**
+ * @brief Add AAD to a AES-128-GCM message started with isal_aes_gcm_init_128()
+ *
+ * AAD may be streamed in pieces of any length after init and before the first
+ * encrypt/decrypt update or finalize call. AAD passed to init itself must then
+ * be NULL or a multiple of 16 bytes.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gcm_aad_update_128(
+        const struct isal_gcm_key_data *key_data,   //!< GCM expanded key data
+        struct isal_gcm_context_data *context_data, //!< GCM operation context data
+        const uint8_t *aad,                         //!< Additional Authenticated Data (AAD)
+        const uint64_t aad_len                      //!< Length of AAD
+);
+
+/**
+ * @brief Add AAD to a AES-256-GCM message started with isal_aes_gcm_init_256()
+ *
+ * AAD may be streamed in pieces of any length after init and before the first
+ * encrypt/decrypt update or finalize call. AAD passed to init itself must then
+ * be NULL or a multiple of 16 bytes.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gcm_aad_update_256(
+        const struct isal_gcm_key_data *key_data,   //!< GCM expanded key data
+        struct isal_gcm_context_data *context_data, //!< GCM operation context data
+        const uint8_t *aad,                         //!< Additional Authenticated Data (AAD)
+        const uint64_t aad_len                      //!< Length of AAD
+);
+
 /**
  * @brief Encrypt a block of a AES-128-GCM Encryption message
  * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
@@ -1183,6 +1234,95 @@ isal_aes_gcm_dec_256_update_nt(
         const uint64_t len //!< Length of data in Bytes for decryption
 );
 
+/**
+ * @brief Start an AES-128-GMAC (authenticate-only GCM) message
+ *
+ * GMAC is GCM with an empty plaintext: the whole message is authenticated
+ * as AAD and only the tag is produced. Key data must be prepared with
+ * isal_aes_gcm_pre_128().
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gmac_init_128(const struct isal_gcm_key_data *key_data,    //!< GCM expanded key data
+                       struct isal_gmac_context_data *context_data, //!< GMAC context data
+                       const uint8_t *iv //!< Pointer to 12 byte IV structure
+);
+
+/**
+ * @brief Start an AES-256-GMAC (authenticate-only GCM) message
+ *
+ * Key data must be prepared with isal_aes_gcm_pre_256().
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gmac_init_256(const struct isal_gcm_key_data *key_data,    //!< GCM expanded key data
+                       struct isal_gmac_context_data *context_data, //!< GMAC context data
+                       const uint8_t *iv //!< Pointer to 12 byte IV structure
+);
+
+/**
+ * @brief Authenticate a block of an AES-GMAC message
+ *
+ * Valid for both key sizes; data may be passed in pieces of any length.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gmac_update(const struct isal_gcm_key_data *key_data,    //!< GCM expanded key data
+                     struct isal_gmac_context_data *context_data, //!< GMAC context data
+                     const uint8_t *in,                           //!< Data to authenticate
+                     const uint64_t len                           //!< Length of data in bytes
+);
+
+/**
+ * @brief End an AES-GMAC message and produce the authentication tag
+ *
+ * Valid for both key sizes.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gmac_finalize(const struct isal_gcm_key_data *key_data,    //!< GCM expanded key data
+                       struct isal_gmac_context_data *context_data, //!< GMAC context data
+                       uint8_t *auth_tag,                           //!< Authenticated Tag output
+                       const uint64_t auth_tag_len //!< Authenticated Tag Length in bytes.
+                                                   //!< Valid values are 16 (most likely), 12 or 8
+);
+
+/**
+ * @brief Raw GHASH update over the hash key powers held in GCM key data
+ *
+ * Computes hash = (hash ^ X_1) * H ... for each 16 byte block X_i of the input,
+ * with H taken from key data prepared by isal_aes_gcm_pre_128() or
+ * isal_aes_gcm_pre_256(). The hash is read and written in GCM byte order.
+ * A trailing partial block is padded with zeros.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gcm_ghash_update(const struct isal_gcm_key_data *key_data, //!< GCM expanded key data
+                          uint8_t *hash,      //!< 16 byte GHASH value, updated in place
+                          const uint8_t *in,  //!< Input data
+                          const uint64_t len  //!< Length of input data in bytes
+);
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
@@ -0,0 +1,244 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#ifndef _AES_GCM_MB_H_
+#define _AES_GCM_MB_H_
+
+/**
+ *  @file aes_gcm_mb.h
+ *  @brief Multi-buffer CTX API AES-GCM function prototypes and structures
+ *
+ * Interface for multi-buffer AES-GCM encryption and decryption functions
+ *
+ * For short packets the cost of a single-buffer AES-GCM call is dominated by
+ * the per-call setup, the key-independent GHASH tail and the final tag
+ * computation rather than by the bulk CTR/GHASH loop. The multi-buffer
+ * interface processes several independent packets at once, interleaving their
+ * AES rounds and GHASH multiplications across the lanes of the vector
+ * registers.
+ *
+ * The interface is carried out through the context-level (CTX) init, submit and
+ * flush functions and the ISAL_AES_GCM_CTX_MGR and ISAL_AES_GCM_CTX objects,
+ * following the same model as the multi-buffer hash managers (see sha256_mb.h)
+ * and the multi-buffer AES-CBC manager (see aes_cbc_mb.h). All packets handled
+ * by one manager must use the same key size, selected when the manager is
+ * initialized, but each packet has its own key, IV, AAD and length.
+ *
+ * Up to 4 (SSE), 8 (AVX) or 16 (VAES/AVX512) packets are processed at a time.
+ * The architecture-specific implementation is selected at runtime.
+ *
+ * <b>Usage:</b> The application creates a ISAL_AES_GCM_CTX_MGR object and
+ * initializes it with isal_aes_gcm_ctx_mgr_init(). Each ISAL_AES_GCM_CTX is
+ * initialized with isal_aes_gcm_ctx_init(), which sets the GCM key data (as
+ * generated by isal_aes_gcm_pre_128/256()) and the direction. Packets are then
+ * handed to the manager with isal_aes_gcm_ctx_mgr_submit(). When the
+ * ISAL_AES_GCM_CTX is returned to the application (via this or a later call to
+ * submit or isal_aes_gcm_ctx_mgr_flush()), its output buffer holds the result
+ * and its authentication tag has been written. As with isal_aes_gcm_dec_128/256(),
+ * decryption outputs the computed tag; comparing it with the received tag is
+ * left to the application.
+ *
+ * The order in which ISAL_AES_GCM_CTX objects are returned is in general
+ * different from the order in which they are submitted.
+ *
+ * Submitting a context that is currently being managed by a
+ * ISAL_AES_GCM_CTX_MGR is reported by returning the context immediately with
+ * its error member set to ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING.
+ */
+
+#include <stdint.h>
+#include "aes_gcm.h"
+#include "multi_buffer.h"
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ISAL_AES_GCM_MAX_LANES 16
+#define ISAL_AES_GCM_MIN_LANES 4
+
+/** @brief Direction of a multi-buffer AES-GCM job */
+typedef enum {
+        ISAL_AES_GCM_ENCRYPT = 0, //!< encrypt, authenticate the ciphertext output
+        ISAL_AES_GCM_DECRYPT = 1, //!< decrypt, authenticate the ciphertext input
+} ISAL_AES_GCM_DIR;
+
+/** @brief Scheduler layer - Holds info describing a single AES-GCM job for the
+ * multi-buffer manager */
+
+typedef struct {
+        const uint8_t *in;                        //!< pointer to input for this job
+        uint8_t *out;                             //!< pointer to output (in-place allowed)
+        uint64_t len;                             //!< length of this job in bytes
+        const uint8_t *aad;                       //!< pointer to Additional Authenticated Data
+        uint64_t aad_len;                         //!< length of AAD in bytes
+        uint8_t iv[ISAL_GCM_IV_LEN];              //!< 12 byte IV
+        const struct isal_gcm_key_data *key_data; //!< GCM expanded key data
+        uint8_t *auth_tag;                        //!< pointer to authentication tag output
+        uint64_t auth_tag_len;                    //!< authentication tag length in bytes
+        ISAL_AES_GCM_DIR dir;                     //!< encrypt or decrypt
+        ISAL_JOB_STS status;                      //!< output job status
+        void *user_data;                          //!< pointer for user's job-related data
+} ISAL_AES_GCM_JOB;
+
+/** @brief Scheduler layer - Holds arguments for submitted AES-GCM jobs
+ *
+ * Round keys are stored interleaved by lane, so round r of lanes 4n..4n+3 can be
+ * loaded as a single 64-byte vector. Hash keys, hash values and counter blocks
+ * are kept byte reflected, the form used by the PCLMULQDQ based GHASH.
+ */
+
+typedef struct {
+        DECLARE_ALIGNED(uint8_t keys[ISAL_GCM_KEY_SETS][ISAL_AES_GCM_MAX_LANES]
+                                    [ISAL_GCM_ENC_KEY_LEN],
+                        64);
+        DECLARE_ALIGNED(uint8_t hkey[ISAL_AES_GCM_MAX_LANES][ISAL_GCM_BLOCK_LEN], 64);
+        DECLARE_ALIGNED(uint8_t hash[ISAL_AES_GCM_MAX_LANES][ISAL_GCM_BLOCK_LEN], 64);
+        DECLARE_ALIGNED(uint8_t ctr[ISAL_AES_GCM_MAX_LANES][ISAL_GCM_BLOCK_LEN], 64);
+        DECLARE_ALIGNED(uint8_t enc_j0[ISAL_AES_GCM_MAX_LANES][ISAL_GCM_BLOCK_LEN], 64);
+        const uint8_t *in[ISAL_AES_GCM_MAX_LANES];
+        uint8_t *out[ISAL_AES_GCM_MAX_LANES];
+        uint64_t dec_lanes; //!< bit n set when lane n decrypts
+} ISAL_AES_GCM_MB_ARGS_X16;
+
+/** @brief Scheduler layer - Lane data */
+
+typedef struct {
+        ISAL_AES_GCM_JOB *job_in_lane;
+} ISAL_AES_GCM_LANE_DATA;
+
+/** @brief Scheduler layer - Holds state for multi-buffer AES-GCM jobs */
+
+typedef struct {
+        ISAL_AES_GCM_MB_ARGS_X16 args;
+        uint64_t lens[ISAL_AES_GCM_MAX_LANES]; //!< remaining full blocks in each lane
+        uint64_t unused_lanes; //!< each nibble is index of an unused lane
+        ISAL_AES_GCM_LANE_DATA ldata[ISAL_AES_GCM_MAX_LANES];
+        uint32_t num_lanes_inuse;
+        uint32_t num_rounds; //!< number of AES rounds (10 or 14)
+} ISAL_AES_GCM_MB_JOB_MGR;
+
+/** @brief Context layer - Holds state for multi-buffer AES-GCM jobs. This structure must be
+ * allocated to 64-byte aligned memory */
+
+typedef struct {
+        ISAL_AES_GCM_MB_JOB_MGR mgr;
+} ISAL_AES_GCM_CTX_MGR;
+
+/** @brief Context layer - Holds info describing a single AES-GCM packet for the multi-buffer
+ * CTX manager. This structure must be allocated to 16-byte aligned memory */
+
+typedef struct {
+        ISAL_AES_GCM_JOB job;      // Must be at struct offset 0.
+        ISAL_HASH_CTX_STS status;  //!< Context status flag
+        ISAL_HASH_CTX_ERROR error; //!< Context error flag
+        void *user_data;           //!< pointer for user to keep any job-related data
+} ISAL_AES_GCM_CTX;
+
+/**
+ * @brief Initialize the AES-GCM multi-buffer manager structure.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info, on a 64 byte boundary
+ * @param[in] key_len Key length in bytes shared by all packets of this manager
+ *                    (ISAL_GCM_128_KEY_LEN or ISAL_GCM_256_KEY_LEN)
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gcm_ctx_mgr_init(ISAL_AES_GCM_CTX_MGR *mgr, const uint32_t key_len);
+
+/**
+ * @brief Initialize an AES-GCM context with its key data and direction.
+ *
+ * @param[in] ctx Structure holding ctx job info
+ * @param[in] key_data GCM expanded key data from isal_aes_gcm_pre_128/256(). Must stay
+ *                     valid while the context is being processed.
+ * @param[in] dir ISAL_AES_GCM_ENCRYPT or ISAL_AES_GCM_DECRYPT
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gcm_ctx_init(ISAL_AES_GCM_CTX *ctx, const struct isal_gcm_key_data *key_data,
+                      const ISAL_AES_GCM_DIR dir);
+
+/**
+ * @brief Submit a new AES-GCM packet to the multi-buffer manager.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * The IV is copied on submit; the input, output, AAD and tag buffers must stay
+ * valid until the context is returned.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctx_in Structure holding ctx job info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *			Modified to point to completed job structure or
+ *			NULL if no jobs completed.
+ * @param[out] out Output buffer (in-place allowed)
+ * @param[in] in Input buffer
+ * @param[in] len Length of input in bytes
+ * @param[in] iv Pointer to 12 byte IV
+ * @param[in] aad Additional Authenticated Data (AAD)
+ * @param[in] aad_len Length of AAD in bytes
+ * @param[out] auth_tag Authenticated Tag output
+ * @param[in] auth_tag_len Authenticated Tag Length in bytes. Valid values are 16, 12 or 8
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gcm_ctx_mgr_submit(ISAL_AES_GCM_CTX_MGR *mgr, ISAL_AES_GCM_CTX *ctx_in,
+                            ISAL_AES_GCM_CTX **ctx_out, uint8_t *out, const uint8_t *in,
+                            const uint64_t len, const uint8_t *iv, const uint8_t *aad,
+                            const uint64_t aad_len, uint8_t *auth_tag,
+                            const uint64_t auth_tag_len);
+
+/**
+ * @brief Finish all submitted AES-GCM packets and return when complete.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *			Modified to point to completed job structure or
+ *			NULL if no jobs completed.
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gcm_ctx_mgr_flush(ISAL_AES_GCM_CTX_MGR *mgr, ISAL_AES_GCM_CTX **ctx_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AES_GCM_MB_H_
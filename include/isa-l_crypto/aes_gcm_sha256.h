@@ -0,0 +1,171 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#ifndef _AES_GCM_SHA256_H_
+#define _AES_GCM_SHA256_H_
+
+/**
+ *  @file aes_gcm_sha256.h
+ *  @brief AES-GCM encryption stitched with a SHA256 digest of the plaintext
+ *
+ * Applications that encrypt data with AES-GCM and also keep a SHA256 of the
+ * plaintext (e.g. for deduplication) would otherwise read every byte twice.
+ *
+ * The AES-GCM/SHA256 manager updates a GCM stream and a SHA256 job over the
+ * same input in one pass. The input of a job is cut into tiles of
+ * ISAL_AES_GCM_SHA256_TILE_SIZE bytes. Each tile is first hashed by the SHA256
+ * multi-buffer manager and then encrypted with isal_aes_gcm_enc_128/256_update()
+ * while it is still in cache, before the job moves on to its next tile. Hashing
+ * before encrypting also allows the data to be encrypted in place.
+ *
+ * As with the other context managers, several jobs should be submitted so that
+ * the SHA256 lanes are filled with tiles of different jobs. All jobs of one
+ * manager use the same key size, selected when the manager is initialized.
+ *
+ * <b>Usage:</b> The GCM stream of a job lives in ctx->gcm. The application
+ * starts it with isal_aes_gcm_init_128/256(), optionally adding AAD with
+ * isal_aes_gcm_aad_update_128/256(), then submits the plaintext with
+ * isal_aes_gcm_sha256_ctx_mgr_submit(). The hash flags follow the SHA256
+ * managers: ISAL_HASH_FIRST starts the digest and ISAL_HASH_LAST ends it. Once
+ * the last submit of a job has been returned (via this or a later call to
+ * submit or isal_aes_gcm_sha256_ctx_mgr_flush()), the ciphertext has been written
+ * and the application computes the tag with isal_aes_gcm_enc_128/256_finalize() on
+ * ctx->gcm. The SHA256 digest is found in ctx->sha256.job.result_digest.
+ */
+
+#include <stdint.h>
+#include "aes_gcm.h"
+#include "sha256_mb.h"
+#include "multi_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Bytes of a job hashed and encrypted before moving on to the next ones */
+#define ISAL_AES_GCM_SHA256_TILE_SIZE (8 * 1024)
+
+/**
+ * @brief Context layer - Holds info describing a single AES-GCM/SHA256 job.
+ * This structure must be allocated to 16-byte aligned memory.
+ */
+typedef struct ISAL_AES_GCM_SHA256_CTX {
+        ISAL_SHA256_HASH_CTX sha256;              //!< SHA256 of the plaintext
+        struct isal_gcm_context_data gcm;         //!< GCM operation context data
+        const struct isal_gcm_key_data *key_data; //!< GCM expanded key data
+        ISAL_HASH_CTX_STS status;                 //!< Context status flag
+        ISAL_HASH_CTX_ERROR error;                //!< Context error flag
+        const uint8_t *data_buffer;               //!< input not hashed yet
+        uint8_t *data_out;                        //!< output for data_buffer
+        uint64_t data_len;                        //!< length of data_buffer in bytes
+        ISAL_HASH_CTX_FLAG data_flags;            //!< flags for the next tile of the input
+        uint32_t tile_len;                        //!< length of the tile being hashed
+        struct ISAL_AES_GCM_SHA256_CTX *next;     //!< link in the manager lists
+        void *user_data;                          //!< pointer for user to keep any job-related data
+} ISAL_AES_GCM_SHA256_CTX;
+
+/**
+ * @brief Context layer - Holds state for the AES-GCM/SHA256 manager.
+ * This structure must be allocated to 16-byte aligned memory.
+ */
+typedef struct {
+        ISAL_SHA256_HASH_CTX_MGR sha256;    //!< SHA256 multi-buffer manager
+        uint32_t key_len;                   //!< key length in bytes of all jobs
+        ISAL_AES_GCM_SHA256_CTX *ready;     //!< jobs whose current tile has been hashed
+        ISAL_AES_GCM_SHA256_CTX *done_head; //!< completed jobs not returned yet
+        ISAL_AES_GCM_SHA256_CTX *done_tail; //!< last completed job not returned yet
+} ISAL_AES_GCM_SHA256_CTX_MGR;
+
+/**
+ * @brief Initialize the AES-GCM/SHA256 manager.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] key_len Key length in bytes shared by all jobs of this manager
+ *                    (ISAL_GCM_128_KEY_LEN or ISAL_GCM_256_KEY_LEN)
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gcm_sha256_ctx_mgr_init(ISAL_AES_GCM_SHA256_CTX_MGR *mgr, const uint32_t key_len);
+
+/**
+ * @brief Submit plaintext of a job to the AES-GCM/SHA256 manager.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Encrypts the input into the GCM stream in ctx->gcm, which must have been
+ * initialized, and hashes it into the SHA256 job of the context. Several jobs may
+ * complete during one call; one is returned in \a ctx_out and the others by the next
+ * calls to isal_aes_gcm_sha256_ctx_mgr_submit() or isal_aes_gcm_sha256_ctx_mgr_flush().
+ * The input and output buffers must stay valid until the job is returned.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctx_in Structure holding ctx job info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no jobs completed.
+ * @param[in] key_data GCM expanded key data from isal_aes_gcm_pre_128/256()
+ * @param[out] out Ciphertext output. Encrypt in-place is allowed
+ * @param[in] in Plaintext input
+ * @param[in] len Length of input in bytes
+ * @param[in] flags Input flag specifying SHA256 job type (first, update, last or entire)
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gcm_sha256_ctx_mgr_submit(ISAL_AES_GCM_SHA256_CTX_MGR *mgr,
+                                   ISAL_AES_GCM_SHA256_CTX *ctx_in,
+                                   ISAL_AES_GCM_SHA256_CTX **ctx_out,
+                                   const struct isal_gcm_key_data *key_data, uint8_t *out,
+                                   const uint8_t *in, const uint64_t len,
+                                   const ISAL_HASH_CTX_FLAG flags);
+
+/**
+ * @brief Finish submitted AES-GCM/SHA256 jobs, returning one completed job per call.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no jobs are left in the manager.
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_gcm_sha256_ctx_mgr_flush(ISAL_AES_GCM_SHA256_CTX_MGR *mgr,
+                                  ISAL_AES_GCM_SHA256_CTX **ctx_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AES_GCM_SHA256_H_
@@ -89,6 +89,13 @@
  * The functions accept a 128-bit initial tweak value. The user is responsible for
  * padding the initial tweak value to this length.
  *
+ * <b>Multi-sector Functions</b>
+ *
+ * The isal_aes_xts_*_sectors() functions process a run of consecutive sectors of
+ * the same size with one call. The initial tweak of each sector is its sector
+ * number (LBA) as a 128-bit little-endian value, starting from start_lba, and the
+ * keys are expanded once for the whole run.
+ *
  * <b>Data Alignment</b>
  *
  * The input and output buffers, keys, pre-expanded keys and initial tweak value
@@ -385,6 +392,90 @@ isal_aes_xts_dec_256_expanded_key(
         const void *in,               //!<  ciphertext sector input data
         void *out                     //!< plaintext sector output data
 );
+
+/** @brief XTS-AES-128 Encryption of consecutive sectors
+ *
+ * Sector i of the run is processed with the initial tweak start_lba + i.
+ *
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ * @return  Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+
+int
+isal_aes_xts_enc_128_sectors(
+        const uint8_t *k2,          //!<  key used for tweaking, 16 bytes
+        const uint8_t *k1,          //!<  key used for encryption of tweaked plaintext, 16 bytes
+        const uint64_t start_lba,   //!<  sector number of the first sector
+        const uint64_t sector_size, //!<  sector size, in bytes
+        const uint64_t num_sectors, //!<  number of sectors
+        const void *in,             //!<  plaintext input data, num_sectors * sector_size bytes
+        void *out                   //!<  ciphertext output data, num_sectors * sector_size bytes
+);
+
+/** @brief XTS-AES-128 Decryption of consecutive sectors
+ *
+ * Sector i of the run is processed with the initial tweak start_lba + i.
+ *
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ * @return  Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+
+int
+isal_aes_xts_dec_128_sectors(
+        const uint8_t *k2,          //!<  key used for tweaking, 16 bytes
+        const uint8_t *k1,          //!<  key used for decryption of tweaked ciphertext, 16 bytes
+        const uint64_t start_lba,   //!<  sector number of the first sector
+        const uint64_t sector_size, //!<  sector size, in bytes
+        const uint64_t num_sectors, //!<  number of sectors
+        const void *in,             //!<  ciphertext input data, num_sectors * sector_size bytes
+        void *out                   //!<  plaintext output data, num_sectors * sector_size bytes
+);
+
+/** @brief XTS-AES-256 Encryption of consecutive sectors
+ *
+ * Sector i of the run is processed with the initial tweak start_lba + i.
+ *
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ * @return  Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+
+int
+isal_aes_xts_enc_256_sectors(
+        const uint8_t *k2,          //!<  key used for tweaking, 16*2 bytes
+        const uint8_t *k1,          //!<  key used for encryption of tweaked plaintext, 16*2 bytes
+        const uint64_t start_lba,   //!<  sector number of the first sector
+        const uint64_t sector_size, //!<  sector size, in bytes
+        const uint64_t num_sectors, //!<  number of sectors
+        const void *in,             //!<  plaintext input data, num_sectors * sector_size bytes
+        void *out                   //!<  ciphertext output data, num_sectors * sector_size bytes
+);
+
+/** @brief XTS-AES-256 Decryption of consecutive sectors
+ *
+ * Sector i of the run is processed with the initial tweak start_lba + i.
+ *
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ * @return  Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+
+int
+isal_aes_xts_dec_256_sectors(
+        const uint8_t *k2,          //!<  key used for tweaking, 16*2 bytes
+        const uint8_t *k1,          //!<  key used for decryption of tweaked ciphertext, 16*2 bytes
+        const uint64_t start_lba,   //!<  sector number of the first sector
+        const uint64_t sector_size, //!<  sector size, in bytes
+        const uint64_t num_sectors, //!<  number of sectors
+        const void *in,             //!<  ciphertext input data, num_sectors * sector_size bytes
+        void *out                   //!<  plaintext output data, num_sectors * sector_size bytes
+);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,245 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#ifndef _AES_XTS_MB_H_
+#define _AES_XTS_MB_H_
+
+/**
+ *  @file aes_xts_mb.h
+ *  @brief Multi-buffer CTX API AES-XTS function prototypes and structures
+ *
+ * Interface for multi-buffer AES-XTS encryption and decryption functions
+ *
+ * The single-buffer AES-XTS functions process one data unit (sector) with one
+ * key pair per call. Sectors of a few hundred bytes, each belonging to a
+ * different volume and therefore to a different key pair, leave most of the
+ * AES pipeline idle. The multi-buffer interface processes several independent
+ * sectors at once, each with its own expanded keys and tweak, interleaving
+ * their AES rounds across the lanes of the vector registers.
+ *
+ * The interface is carried out through the context-level (CTX) init, submit and
+ * flush functions and the ISAL_AES_XTS_CTX_MGR and ISAL_AES_XTS_CTX objects,
+ * following the same model as the multi-buffer hash managers (see sha256_mb.h)
+ * and the multi-buffer AES-GCM manager (see aes_gcm_mb.h). All sectors handled
+ * by one manager must use the same key size and direction, selected when the
+ * manager is initialized, but each sector has its own keys, tweak and length.
+ *
+ * Up to 4 (SSE), 8 (AVX) or 16 (VAES/AVX512) sectors are processed at a time.
+ * The architecture-specific implementation is selected at runtime.
+ *
+ * <b>Usage:</b> The application creates a ISAL_AES_XTS_CTX_MGR object and
+ * initializes it with isal_aes_xts_ctx_mgr_init(). Each ISAL_AES_XTS_CTX is
+ * initialized with isal_aes_xts_ctx_init(), which sets the expanded keys of
+ * the key pair, as used by isal_aes_xts_enc/dec_128/256_expanded_key(). Sectors
+ * are then handed to the manager with isal_aes_xts_ctx_mgr_submit(). When the
+ * ISAL_AES_XTS_CTX is returned to the application (via this or a later call to
+ * submit or isal_aes_xts_ctx_mgr_flush()), its output buffer holds the result.
+ * The user_data member of the context can be used to find the request the
+ * sector belongs to.
+ *
+ * The order in which ISAL_AES_XTS_CTX objects are returned is in general
+ * different from the order in which they are submitted.
+ *
+ * Submitting a context that is currently being managed by a
+ * ISAL_AES_XTS_CTX_MGR is reported by returning the context immediately with
+ * its error member set to ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING.
+ */
+
+#include <stdint.h>
+#include "aes_xts.h"
+#include "multi_buffer.h"
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ISAL_AES_XTS_MAX_LANES 16
+#define ISAL_AES_XTS_MIN_LANES 4
+
+#define ISAL_AES_XTS_128_KEY_LEN    16 //!< length of each of the two AES-XTS-128 keys
+#define ISAL_AES_XTS_256_KEY_LEN    32 //!< length of each of the two AES-XTS-256 keys
+#define ISAL_AES_XTS_BLOCK_LEN      16
+#define ISAL_AES_XTS_TWEAK_LEN      16
+#define ISAL_AES_XTS_ROUND_KEY_LEN  16
+#define ISAL_AES_XTS_256_KEY_ROUNDS (14 + 1) //!< expanded key holds 14 key rounds plus original key
+
+/** @brief Direction of a multi-buffer AES-XTS manager */
+typedef enum {
+        ISAL_AES_XTS_ENCRYPT = 0, //!< encrypt
+        ISAL_AES_XTS_DECRYPT = 1, //!< decrypt
+} ISAL_AES_XTS_DIR;
+
+/** @brief Scheduler layer - Holds info describing a single AES-XTS job for the
+ * multi-buffer manager */
+
+typedef struct {
+        const uint8_t *in;                     //!< pointer to input for this job
+        uint8_t *out;                          //!< pointer to output (in-place allowed)
+        uint64_t len;                          //!< length of this job in bytes
+        uint8_t tweak[ISAL_AES_XTS_TWEAK_LEN]; //!< initial tweak, before encryption with k2
+        const uint8_t *k2;                     //!< expanded encryption keys of the tweak key
+        const uint8_t *k1;                     //!< expanded keys of the data key
+        ISAL_JOB_STS status;                   //!< output job status
+        void *user_data;                       //!< pointer for user's job-related data
+} ISAL_AES_XTS_JOB;
+
+/** @brief Scheduler layer - Holds arguments for submitted AES-XTS jobs
+ *
+ * Round keys are stored interleaved by lane, so round r of lanes 4n..4n+3 can be
+ * loaded as a single 64-byte vector. The tweak of each lane is the encrypted
+ * tweak of its next block.
+ */
+
+typedef struct {
+        DECLARE_ALIGNED(uint8_t keys[ISAL_AES_XTS_256_KEY_ROUNDS][ISAL_AES_XTS_MAX_LANES]
+                                    [ISAL_AES_XTS_ROUND_KEY_LEN],
+                        64);
+        DECLARE_ALIGNED(uint8_t tweak[ISAL_AES_XTS_MAX_LANES][ISAL_AES_XTS_TWEAK_LEN], 64);
+        const uint8_t *in[ISAL_AES_XTS_MAX_LANES];
+        uint8_t *out[ISAL_AES_XTS_MAX_LANES];
+} ISAL_AES_XTS_MB_ARGS_X16;
+
+/** @brief Scheduler layer - Lane data */
+
+typedef struct {
+        ISAL_AES_XTS_JOB *job_in_lane;
+} ISAL_AES_XTS_LANE_DATA;
+
+/** @brief Scheduler layer - Holds state for multi-buffer AES-XTS jobs */
+
+typedef struct {
+        ISAL_AES_XTS_MB_ARGS_X16 args;
+        uint64_t lens[ISAL_AES_XTS_MAX_LANES]; //!< remaining lane blocks in each lane
+        uint64_t unused_lanes; //!< each nibble is index of an unused lane
+        ISAL_AES_XTS_LANE_DATA ldata[ISAL_AES_XTS_MAX_LANES];
+        uint32_t num_lanes_inuse;
+        uint32_t num_rounds; //!< number of AES rounds (10 or 14)
+        ISAL_AES_XTS_DIR dir;
+} ISAL_AES_XTS_MB_JOB_MGR;
+
+/** @brief Context layer - Holds state for multi-buffer AES-XTS jobs. This structure must be
+ * allocated to 64-byte aligned memory */
+
+typedef struct {
+        ISAL_AES_XTS_MB_JOB_MGR mgr;
+} ISAL_AES_XTS_CTX_MGR;
+
+/** @brief Context layer - Holds info describing a single AES-XTS sector for the multi-buffer
+ * CTX manager. This structure must be allocated to 16-byte aligned memory */
+
+typedef struct {
+        ISAL_AES_XTS_JOB job;      // Must be at struct offset 0.
+        ISAL_HASH_CTX_STS status;  //!< Context status flag
+        ISAL_HASH_CTX_ERROR error; //!< Context error flag
+        void *user_data;           //!< pointer for user to keep any job-related data
+} ISAL_AES_XTS_CTX;
+
+/**
+ * @brief Initialize the AES-XTS multi-buffer manager structure.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info, on a 64 byte boundary
+ * @param[in] key_len Length in bytes of each key of the key pairs used with this manager
+ *                    (ISAL_AES_XTS_128_KEY_LEN or ISAL_AES_XTS_256_KEY_LEN)
+ * @param[in] dir ISAL_AES_XTS_ENCRYPT or ISAL_AES_XTS_DECRYPT, for all sectors of this manager
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_xts_ctx_mgr_init(ISAL_AES_XTS_CTX_MGR *mgr, const uint32_t key_len,
+                          const ISAL_AES_XTS_DIR dir);
+
+/**
+ * @brief Initialize an AES-XTS context with the expanded keys of its key pair.
+ *
+ * The keys are expanded with isal_aes_keyexp_128/256(). As with
+ * isal_aes_xts_dec_128/256_expanded_key(), the data key k1 must be in the
+ * form matching the direction of the manager the context is submitted to:
+ * the encryption keys for an encrypting manager, the decryption keys for a
+ * decrypting one. The tweak key k2 is always in encryption form.
+ *
+ * @param[in] ctx Structure holding ctx job info
+ * @param[in] k2 Expanded encryption keys of the tweak key. Must stay valid while the
+ *               context is being processed.
+ * @param[in] k1 Expanded encryption or decryption keys of the data key. Must stay valid
+ *               while the context is being processed.
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_xts_ctx_init(ISAL_AES_XTS_CTX *ctx, const uint8_t *k2, const uint8_t *k1);
+
+/**
+ * @brief Submit a new AES-XTS sector to the multi-buffer manager.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * The tweak is copied on submit; the input and output buffers must stay valid
+ * until the context is returned.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctx_in Structure holding ctx job info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *			Modified to point to completed job structure or
+ *			NULL if no jobs completed.
+ * @param[out] out Output buffer (in-place allowed)
+ * @param[in] in Input buffer
+ * @param[in] len Length of input in bytes, ISAL_AES_XTS_MIN_LEN to ISAL_AES_XTS_MAX_LEN
+ * @param[in] initial_tweak Pointer to 16 byte initial tweak, before encryption with k2
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_xts_ctx_mgr_submit(ISAL_AES_XTS_CTX_MGR *mgr, ISAL_AES_XTS_CTX *ctx_in,
+                            ISAL_AES_XTS_CTX **ctx_out, uint8_t *out, const uint8_t *in,
+                            const uint64_t len, const uint8_t *initial_tweak);
+
+/**
+ * @brief Finish all submitted AES-XTS sectors and return when complete.
+ * @requires AES extensions and SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *			Modified to point to completed job structure or
+ *			NULL if no jobs completed.
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_aes_xts_ctx_mgr_flush(ISAL_AES_XTS_CTX_MGR *mgr, ISAL_AES_XTS_CTX **ctx_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AES_XTS_MB_H_
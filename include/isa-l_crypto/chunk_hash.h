@@ -0,0 +1,153 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#ifndef _CHUNK_HASH_H_
+#define _CHUNK_HASH_H_
+
+/**
+ *  @file chunk_hash.h
+ *  @brief Content-defined chunking fused with multi-buffer SHA256 hashing
+ *
+ * Deduplicating applications cut a stream into content-defined chunks and
+ * fingerprint each chunk with SHA256. Chunking a whole buffer and hashing its
+ * chunks afterwards reads the data from memory twice, and feeding the chunks
+ * to a multi-buffer manager by hand means keeping a pool of contexts and
+ * reporting the digests in stream order.
+ *
+ * The chunk hash pipeline does both. Each call to isal_chunk_hash_update()
+ * searches the buffer for a few chunk boundaries at a time and submits the
+ * chunks found to a SHA256 multi-buffer manager right away, so that chunks are
+ * hashed while still in cache and the search for the next boundaries runs
+ * between the hashing of earlier chunks. A chunk that runs past the end of the
+ * buffer is carried over to the next call. The pipeline owns the manager and a
+ * ring of ISAL_CHUNK_HASH_POOL_SIZE contexts, and reports every chunk through
+ * a callback as an (offset, length, digest) record, in stream order.
+ *
+ * All the chunks of a buffer are reported by the time isal_chunk_hash_update()
+ * returns, so the buffer may be reused right after the call. The lanes of the
+ * manager are only kept full within a call, so buffers should hold many chunks,
+ * e.g. at least ISAL_CHUNK_HASH_POOL_SIZE times the average chunk size.
+ */
+
+#include <stdint.h>
+#include "rolling_hashx.h"
+#include "sha256_mb.h"
+#include "multi_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Number of chunks the pipeline may have in flight */
+#define ISAL_CHUNK_HASH_POOL_SIZE (2 * ISAL_SHA256_MAX_LANES)
+
+/** @brief Chunk reported by the pipeline */
+typedef struct {
+        uint64_t offset;                            //!< Offset of the chunk in the stream
+        uint64_t len;                               //!< Length of the chunk in bytes
+        uint32_t digest[ISAL_SHA256_DIGEST_NWORDS]; //!< SHA256 digest of the chunk
+} ISAL_CHUNK_HASH_RECORD;
+
+/** @brief Record callback, called once per chunk in stream order */
+typedef void (*ISAL_CHUNK_HASH_CALLBACK)(const ISAL_CHUNK_HASH_RECORD *record, void *cb_arg);
+
+/**
+ * @brief Chunk hash pipeline state.
+ * This structure must be allocated to 16-byte aligned memory.
+ */
+typedef struct {
+        ISAL_SHA256_HASH_CTX_MGR mgr;                        //!< SHA256 multi-buffer manager
+        ISAL_SHA256_HASH_CTX ctx[ISAL_CHUNK_HASH_POOL_SIZE]; //!< Ring of chunk contexts
+        uint64_t offset[ISAL_CHUNK_HASH_POOL_SIZE];          //!< Stream offset of each chunk
+        struct isal_chunker chunker;                         //!< Chunk boundary search state
+        ISAL_CHUNK_HASH_CALLBACK callback;                   //!< Record callback
+        void *cb_arg;                                        //!< Argument passed to the callback
+        uint64_t stream_len;                                 //!< Bytes of the stream seen so far
+        uint32_t head;                                       //!< Oldest chunk in the ring
+        uint32_t count;                                      //!< Chunks in the ring
+        uint32_t open;                                       //!< Newest chunk not ended yet
+} ISAL_CHUNK_HASH;
+
+/**
+ * @brief Initialize a chunk hash pipeline
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * The pipeline takes a copy of the chunker, set up by isal_chunker_init() or
+ * isal_chunker_init_gear(), and starts a new stream.
+ *
+ * @param[in] ch Structure holding pipeline state
+ * @param[in] chunker Initialized chunker giving the chunk boundary hash and sizes
+ * @param[in] callback Function receiving the record of each chunk
+ * @param[in] cb_arg Argument passed to the callback
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_chunk_hash_init(ISAL_CHUNK_HASH *ch, const struct isal_chunker *chunker,
+                     ISAL_CHUNK_HASH_CALLBACK callback, void *cb_arg);
+
+/**
+ * @brief Chunk and hash the next buffer of a stream
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Reports the record of every chunk ending in this buffer before returning. The
+ * last chunk of the buffer may carry on into the next buffer, in which case it
+ * is reported by a later call.
+ *
+ * @param[in] ch Structure holding pipeline state
+ * @param[in] buffer Pointer to next part of the stream
+ * @param[in] len Length of buffer in bytes
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_chunk_hash_update(ISAL_CHUNK_HASH *ch, const uint8_t *buffer, const uint64_t len);
+
+/**
+ * @brief End the stream
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Reports the last chunk of the stream, if any, and resets the pipeline so that
+ * the next call to isal_chunk_hash_update() starts a new stream.
+ *
+ * @param[in] ch Structure holding pipeline state
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_chunk_hash_final(ISAL_CHUNK_HASH *ch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _CHUNK_HASH_H_
@@ -0,0 +1,248 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#ifndef _HASH_SVC_H_
+#define _HASH_SVC_H_
+
+/**
+ *  @file hash_svc.h
+ *  @brief Sharded multi-buffer hashing service
+ *
+ * A multi-buffer context manager (e.g. ISAL_SHA256_HASH_CTX_MGR) is not thread
+ * safe, so multi-threaded applications usually give each thread its own
+ * manager. On lightly loaded threads these managers run with most lanes empty.
+ *
+ * The hashing service owns one manager per shard (typically one shard per
+ * core) and accepts jobs from any thread. Each shard has a lock-free
+ * multi-producer queue of pending jobs. A worker thread drives each shard by
+ * calling isal_hash_svc_run(), which moves pending jobs into the shard's
+ * manager. When its own queue is empty, a worker steals pending jobs from other
+ * shards so that the lanes of its manager stay full, and when there is no work
+ * to take at all, it flushes its manager so that no job is left waiting.
+ *
+ * Completed jobs are delivered either through a callback, called from the
+ * worker thread, or through a completion queue read with
+ * isal_hash_svc_get_completed(). All jobs of a service use the same hash
+ * algorithm, selected when the service is initialized.
+ *
+ * The service does not create threads. The application starts its own workers
+ * and decides how they wait for work, which keeps the library free of any
+ * threading dependency.
+ *
+ * <b>Thread safety:</b>
+ * <ul>
+ *  <li> isal_hash_svc_submit() and isal_hash_svc_get_completed() may be
+ *       called from any thread.
+ *  <li> isal_hash_svc_run() may be called from any thread, but only one
+ *       thread at a time may run a given shard.
+ * </ul>
+ */
+
+#include <stdint.h>
+#include "md5_mb.h"
+#include "sha1_mb.h"
+#include "sha256_mb.h"
+#include "sha512_mb.h"
+#include "sm3_mb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Hash algorithms supported by the hashing service */
+typedef enum {
+        ISAL_HASH_SVC_SHA1 = 0, //!< SHA1, digest in ctx.sha1.job.result_digest
+        ISAL_HASH_SVC_SHA256,   //!< SHA256, digest in ctx.sha256.job.result_digest
+        ISAL_HASH_SVC_SHA512,   //!< SHA512, digest in ctx.sha512.job.result_digest
+        ISAL_HASH_SVC_MD5,      //!< MD5, digest in ctx.md5.job.result_digest
+        ISAL_HASH_SVC_SM3,      //!< SM3, digest in ctx.sm3.job.result_digest
+        ISAL_HASH_SVC_NUM_ALGOS
+} ISAL_HASH_SVC_ALGO;
+
+/** @brief Intrusive link used by the service queues */
+typedef struct ISAL_HASH_SVC_NODE {
+        struct ISAL_HASH_SVC_NODE *next;
+} ISAL_HASH_SVC_NODE;
+
+/**
+ * @brief Hashing service job
+ *
+ * Holds one message to be hashed. This structure must be allocated to 16-byte
+ * aligned memory and must not be modified between submission and completion.
+ */
+typedef struct {
+        union {
+                ISAL_SHA1_HASH_CTX sha1;
+                ISAL_SHA256_HASH_CTX sha256;
+                ISAL_SHA512_HASH_CTX sha512;
+                ISAL_MD5_HASH_CTX md5;
+                ISAL_SM3_HASH_CTX sm3;
+        } ctx;                   //!< Hash context, holds the digest once the job is complete
+        ISAL_HASH_SVC_NODE node; //!< Queue link, internal use
+        const void *buffer;      //!< Message to be hashed
+        uint32_t len;            //!< Length of the message in bytes
+        int error;               //!< ISAL_CRYPTO_ERR_NONE, or error returned by the manager
+        void *user_data;         //!< Pointer for user to keep any job-related data
+} ISAL_HASH_SVC_JOB;
+
+/**
+ * @brief Lock-free multi-producer queue of jobs
+ *
+ * Producers only update the head. The consumer side is protected by a lock.
+ * Workers only ever try the lock of a job queue, so a shard owner and a thief
+ * never wait for each other.
+ */
+typedef struct {
+        ISAL_HASH_SVC_NODE *head;         //!< Last pushed node, updated atomically by producers
+        uint8_t pad[64 - sizeof(void *)]; //!< Keeps producers off the consumer cache line
+        ISAL_HASH_SVC_NODE *tail;         //!< Next node to pop, owned by the consumer
+        ISAL_HASH_SVC_NODE stub;          //!< Placeholder node keeping the queue non-empty
+        uint32_t lock;                    //!< Consumer lock
+} ISAL_HASH_SVC_QUEUE;
+
+/**
+ * @brief Hashing service shard
+ *
+ * One multi-buffer manager and its queue of pending jobs. An array of shards
+ * is allocated by the application, to 16-byte aligned memory, and handed to
+ * isal_hash_svc_init().
+ */
+typedef struct {
+        union {
+                ISAL_SHA1_HASH_CTX_MGR sha1;
+                ISAL_SHA256_HASH_CTX_MGR sha256;
+                ISAL_SHA512_HASH_CTX_MGR sha512;
+                ISAL_MD5_HASH_CTX_MGR md5;
+                ISAL_SM3_HASH_CTX_MGR sm3;
+        } mgr;                     //!< Multi-buffer manager of this shard
+        ISAL_HASH_SVC_QUEUE queue; //!< Jobs submitted to this shard and not yet taken
+        uint32_t num_in_mgr;       //!< Jobs held by the manager, owner use only
+} ISAL_HASH_SVC_SHARD;
+
+/** @brief Completion callback, called from the worker thread that completed the job */
+typedef void (*ISAL_HASH_SVC_CALLBACK)(ISAL_HASH_SVC_JOB *job, void *cb_arg);
+
+/** @brief Hashing service state */
+typedef struct {
+        ISAL_HASH_SVC_SHARD *shards;     //!< Array of shards
+        uint32_t num_shards;             //!< Number of shards
+        ISAL_HASH_SVC_ALGO algo;         //!< Hash algorithm of all jobs
+        ISAL_HASH_SVC_CALLBACK callback; //!< Completion callback, NULL to use the queue
+        void *cb_arg;                    //!< Argument passed to the callback
+        ISAL_HASH_SVC_QUEUE completed;   //!< Completed jobs, when there is no callback
+} ISAL_HASH_SVC;
+
+/**
+ * @brief Initialize the hashing service.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Initializes the multi-buffer manager and the job queue of each shard. Must
+ * be called before any other thread uses the service.
+ *
+ * @param[out] svc Structure holding the service state
+ * @param[in] shards Array of num_shards shards, 16-byte aligned
+ * @param[in] num_shards Number of shards, usually the number of worker threads
+ * @param[in] algo Hash algorithm used for all jobs
+ * @param[in] callback Completion callback, or NULL to deliver completed jobs
+ *                     through isal_hash_svc_get_completed()
+ * @param[in] cb_arg Argument passed to the callback
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_hash_svc_init(ISAL_HASH_SVC *svc, ISAL_HASH_SVC_SHARD *shards, const uint32_t num_shards,
+                   const ISAL_HASH_SVC_ALGO algo, ISAL_HASH_SVC_CALLBACK callback, void *cb_arg);
+
+/**
+ * @brief Submit a message to be hashed by the service.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Queues the job on shard (shard_hint % num_shards) and returns immediately.
+ * Passing the index of the calling thread or core as hint keeps jobs local to
+ * that shard's worker; other workers steal them when they run out of work.
+ * Safe to call from any thread.
+ *
+ * @param[in] svc Structure holding the service state
+ * @param[in] job Job to be queued, 16-byte aligned
+ * @param[in] buffer Message to be hashed
+ * @param[in] len Length of the message in bytes
+ * @param[in] shard_hint Preferred shard
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_hash_svc_submit(ISAL_HASH_SVC *svc, ISAL_HASH_SVC_JOB *job, const void *buffer,
+                     const uint32_t len, const uint32_t shard_hint);
+
+/**
+ * @brief Process pending jobs of one shard.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Moves jobs queued on the shard into its manager. If none could be taken,
+ * steals jobs queued on other shards. If the queue of the shard is empty and
+ * no job could be taken at all, flushes the manager. Completed jobs are
+ * delivered to the callback or the completion queue. Worker threads call this
+ * function in a loop; only one thread at a time may run a given shard.
+ *
+ * @param[in] svc Structure holding the service state
+ * @param[in] shard Index of the shard to run
+ * @param[out] num_completed Number of jobs completed by this call, may be NULL
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_hash_svc_run(ISAL_HASH_SVC *svc, const uint32_t shard, uint32_t *num_completed);
+
+/**
+ * @brief Get a completed job from the completion queue.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Only used when the service has no callback. Safe to call from any thread;
+ * concurrent callers wait for each other, so a NULL job means that no completed
+ * job was available.
+ *
+ * @param[in] svc Structure holding the service state
+ * @param[out] job_out Pointer address to output job.
+ *                     Modified to point to a completed job or NULL if no
+ *                     completed job is available.
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_hash_svc_get_completed(ISAL_HASH_SVC *svc, ISAL_HASH_SVC_JOB **job_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _HASH_SVC_H_
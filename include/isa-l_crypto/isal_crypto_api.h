@@ -82,6 +82,15 @@ typedef enum {
         ISAL_CRYPTO_ERR_NULL_MASK,          //!< Null Rolling hash mask pointer
         ISAL_CRYPTO_ERR_NULL_INIT_VAL,      //!< Null Rolling hash initial value pointer
         ISAL_CRYPTO_ERR_FIPS_DISABLED,      //!< FIPS Mode is not enabled
+        ISAL_CRYPTO_ERR_KEY_LEN,            //!< Invalid key length
+        ISAL_CRYPTO_ERR_AAD_ORDER,          //!< AAD update after message data or odd-sized AAD
+        ISAL_CRYPTO_ERR_HASH_ALGO,          //!< Invalid hash algorithm
+        ISAL_CRYPTO_ERR_SHARD,              //!< Invalid number of shards or shard index
+        ISAL_CRYPTO_ERR_ITERATIONS,         //!< Invalid iteration count
+        ISAL_CRYPTO_ERR_TREE_SHAPE,         //!< Invalid Merkle tree chunk size or fan-out
+        ISAL_CRYPTO_ERR_DST_LEN,            //!< Destination buffer too small
+        ISAL_CRYPTO_ERR_CHUNK_SIZE,         //!< Invalid chunker min/avg/max chunk size
+        ISAL_CRYPTO_ERR_NUM_STREAMS,        //!< Invalid number of rolling hash streams
         /* add new error types above this comment */
         ISAL_CRYPTO_ERR_MAX /* don't move this one */
 } ISAL_CRYPTO_ERROR;
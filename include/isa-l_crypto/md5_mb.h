@@ -186,6 +186,7 @@ typedef struct {
 
 typedef struct {
         ISAL_MD5_MB_JOB_MGR mgr;
+        uint64_t latency_budget; //!< deadline mode wait limit, 0 if disabled
 } ISAL_MD5_HASH_CTX_MGR;
 
 /** @brief Context layer - Holds info describing a single MD5 job for the multi-buffer CTX manager
@@ -200,7 +201,13 @@ typedef struct {
         uint32_t incoming_buffer_length; //!< length of buffer for this job in bytes.
         uint8_t partial_block_buffer[ISAL_MD5_BLOCK_SIZE * 2]; //!< CTX partial blocks
         uint32_t partial_block_buffer_length;
-        void *user_data; //!< pointer for user to keep any job-related data
+        void *user_data;               //!< pointer for user to keep any job-related data
+        uint64_t submit_time;          //!< time of the last timed submit (deadline mode)
+        const uint8_t *data_buffer;    //!< input not submitted yet (64-bit length or iovec submit)
+        uint64_t data_len;             //!< length of data_buffer in bytes
+        const ISAL_HASH_IOVEC *iov;    //!< segments not started yet (iovec submit)
+        uint32_t iov_cnt;              //!< number of segments left in iov
+        ISAL_HASH_CTX_FLAG data_flags; //!< flags for the next piece of the input
 } ISAL_MD5_HASH_CTX;
 
 /******************** multibinary function prototypes **********************/
@@ -293,6 +300,175 @@ isal_md5_ctx_mgr_submit(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx_in,
  */
 int
 isal_md5_ctx_mgr_flush(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX **ctx_out);
+
+/**
+ * @brief Set the latency budget of the MD5 multi-buffer manager (deadline mode).
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * In deadline mode, a job entered with isal_md5_ctx_mgr_submit_timed() is not left waiting
+ * in a partially filled manager for longer than the budget. Once the oldest job in a lane has
+ * waited \a budget time units, the next timed submit or isal_md5_ctx_mgr_poll() call flushes
+ * the manager. Time units are chosen by the application (e.g. nanoseconds or TSC ticks) and
+ * only need to be consistent between calls.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] budget Maximum time a job may wait in the manager, 0 to disable deadline mode
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_md5_ctx_mgr_set_deadline(ISAL_MD5_HASH_CTX_MGR *mgr, const uint64_t budget);
+
+/**
+ * @brief Submit a new MD5 job to the multi-buffer manager, recording its submit time.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Same as isal_md5_ctx_mgr_submit(), but if no job completed and a job in the manager has
+ * exceeded the latency budget, the manager is flushed and the completed job is returned.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctx_in Structure holding ctx job info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no jobs completed.
+ * @param[in] buffer Pointer to buffer to be processed
+ * @param[in] len Length of buffer (in bytes) to be processed
+ * @param[in] flags Input flag specifying job type (first, update, last or entire)
+ * @param[in] now Current time, in the units used for the latency budget
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_md5_ctx_mgr_submit_timed(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx_in,
+                              ISAL_MD5_HASH_CTX **ctx_out, const void *buffer, const uint32_t len,
+                              const ISAL_HASH_CTX_FLAG flags, const uint64_t now);
+
+/**
+ * @brief Flush the MD5 multi-buffer manager if a job has exceeded the latency budget.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Intended to be called periodically by applications with bursty input. Returns one completed
+ * job per call; the application should call it again until \a ctx_out is NULL.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no job is overdue.
+ * @param[in] now Current time, in the units used for the latency budget
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_md5_ctx_mgr_poll(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX **ctx_out, const uint64_t now);
+
+/**
+ * @brief Submit an array of MD5 jobs to the multi-buffer manager in a single call.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Same as calling isal_md5_ctx_mgr_submit() on each job in turn, but the parameters are
+ * checked once for the whole array, before any job is handed to the manager. Every job
+ * returned by the manager while the array is submitted is stored in \a completed, in the
+ * order it was returned. A job rejected by the manager (e.g. invalid flags) is returned in
+ * \a completed too and its error is reported once all jobs have been submitted.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctxs Array of \a num structures holding ctx job info
+ * @param[in] buffers Array of \a num pointers to buffers to be processed
+ * @param[in] lens Array of \a num buffer lengths (in bytes)
+ * @param[in] flags Array of \a num job types (first, update, last or entire)
+ * @param[in] num Number of jobs to submit
+ * @param[out] completed Array of at least \a num entries, filled with the completed jobs
+ * @param[out] num_completed Number of jobs stored in \a completed
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_md5_ctx_mgr_submit_batch(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *const *ctxs,
+                              const void *const *buffers, const uint32_t *lens,
+                              const ISAL_HASH_CTX_FLAG *flags, const uint32_t num,
+                              ISAL_MD5_HASH_CTX **completed, uint32_t *num_completed);
+
+/**
+ * @brief Submit a MD5 job whose data is split over several buffers (scatter-gather input).
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Same as isal_md5_ctx_mgr_submit() for the data of all \a iov segments in order, in a
+ * single call. The manager moves the job on to its next segment each time the lanes are done
+ * with the current one, and only returns it once the last segment has been hashed. Whole
+ * blocks are hashed in place from each segment; only a block that straddles two segments is
+ * copied to the context partial block buffer. Segments may be larger than 4GB, they are
+ * split as in isal_md5_ctx_mgr_submit64(). The \a iov array and the segments must stay
+ * valid until the job is returned.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctx_in Structure holding ctx job info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no jobs completed.
+ * @param[in] iov Array of segments to be processed
+ * @param[in] iov_cnt Number of segments in \a iov
+ * @param[in] flags Input flag specifying job type (first, update, last or entire)
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_md5_ctx_mgr_submit_iov(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx_in,
+                            ISAL_MD5_HASH_CTX **ctx_out, const ISAL_HASH_IOVEC *iov,
+                            const uint32_t iov_cnt, const ISAL_HASH_CTX_FLAG flags);
+
+/**
+ * @brief Submit a MD5 job whose buffer may be larger than 4GB.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Same as isal_md5_ctx_mgr_submit() with a 64-bit length. The manager hands the buffer to the
+ * lanes in block aligned pieces of up to 4GB and moves the job on to its next piece each time
+ * the lanes are done with the current one, so a buffer of any size (e.g. a whole file
+ * mapping) is submitted once and the job is only returned when all of it has been hashed.
+ * The buffer must stay valid until the job is returned.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctx_in Structure holding ctx job info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no jobs completed.
+ * @param[in] buffer Pointer to buffer to be processed
+ * @param[in] len Length of buffer (in bytes) to be processed
+ * @param[in] flags Input flag specifying job type (first, update, last or entire)
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_md5_ctx_mgr_submit64(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx_in,
+                          ISAL_MD5_HASH_CTX **ctx_out, const void *buffer, const uint64_t len,
+                          const ISAL_HASH_CTX_FLAG flags);
+
+/**
+ * @brief Hash an array of equal length messages with MD5.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Message \a i starts at \a msgs + \a i * \a stride. The padding is the same for every
+ * message, so it is built once and full blocks are hashed in place, without per-message
+ * contexts. Digests are written contiguously, \a ISAL_MD5_DIGEST_NWORDS words per
+ * message in the same format as the context \a result_digest.
+ *
+ * @param[in] msgs Pointer to the first message
+ * @param[in] stride Distance in bytes between the start of consecutive messages
+ * @param[in] len Length of each message in bytes
+ * @param[in] count Number of messages
+ * @param[out] digests Output array of \a count digests
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_md5_hash_batch(const void *msgs, const size_t stride, const uint32_t len, const uint32_t count,
+                    ISAL_MD5_WORD_T *digests);
 #ifdef __cplusplus
 }
 #endif
@@ -229,6 +229,23 @@ isal_mh_sha256_init(struct isal_mh_sha256_ctx *ctx);
 int
 isal_mh_sha256_update(struct isal_mh_sha256_ctx *ctx, const void *buffer, uint32_t len);
 
+/**
+ * @brief Multi-hash sha256 update for buffers larger than 4GB.
+ *
+ * Same as isal_mh_sha256_update() with a 64-bit length, so a whole file mapping
+ * can be hashed in one call. The buffer is processed in pieces of whole
+ * multi-hash blocks, which gives the same digests as a single update.
+ *
+ * @param  ctx Structure holding mh_sha256 info
+ * @param  buffer Pointer to buffer to be processed
+ * @param  len Length of buffer (in bytes) to be processed
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_mh_sha256_update64(struct isal_mh_sha256_ctx *ctx, const void *buffer, const uint64_t len);
+
 /**
  * @brief Finalize the message digests for multi-hash sha256.
  *
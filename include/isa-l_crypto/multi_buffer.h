@@ -117,6 +117,14 @@ typedef enum {
         ISAL_HASH_ENTIRE = 0x03, //!< ISAL_HASH_ENTIRE
 } ISAL_HASH_CTX_FLAG;
 
+/**
+ *  @brief Segment of a scatter-gather (iovec) hash input
+ */
+typedef struct {
+        const void *buffer; //!< pointer to the segment data
+        uint64_t len;       //!< length of the segment in bytes
+} ISAL_HASH_IOVEC;
+
 /**
  *  @enum ISAL_HASH_CTX_STS
  *  @brief CTX status flags
@@ -0,0 +1,157 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#ifndef _MULTI_DIGEST_H_
+#define _MULTI_DIGEST_H_
+
+/**
+ *  @file multi_digest.h
+ *  @brief One-pass MD5, SHA1 and SHA256 multi-buffer hashing
+ *
+ * Applications that publish several digests of the same data (e.g. an MD5
+ * ETag, a legacy SHA1 and a SHA256 for every stored object) would otherwise
+ * hash it three times, reading cold data from memory on each pass.
+ *
+ * The multi-digest manager hashes each job with all three algorithms in one
+ * pass. The input of a job is cut into tiles of ISAL_MULTI_DIGEST_TILE_SIZE
+ * bytes, and each tile is handed to the MD5, SHA1 and SHA256 multi-buffer
+ * managers back to back, so that it is read from memory once and hashed by the
+ * other two algorithms while it is still in cache. A job only moves on to its
+ * next tile once all three algorithms are done with the current one.
+ *
+ * As with the other context managers, several jobs can be submitted so that
+ * the lanes of the three managers are filled with tiles of different jobs.
+ * Once a job has completed, its digests are found in ctx->md5.job.result_digest,
+ * ctx->sha1.job.result_digest and ctx->sha256.job.result_digest.
+ */
+
+#include <stdint.h>
+#include "md5_mb.h"
+#include "sha1_mb.h"
+#include "sha256_mb.h"
+#include "multi_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Bytes of a job hashed by the three algorithms before moving on to the next ones */
+#define ISAL_MULTI_DIGEST_TILE_SIZE (8 * 1024)
+
+/**
+ * @brief Context layer - Holds info describing a single multi-digest job.
+ * This structure must be allocated to 16-byte aligned memory.
+ */
+typedef struct ISAL_MULTI_DIGEST_CTX {
+        ISAL_MD5_HASH_CTX md5;              //!< MD5 part of the job
+        ISAL_SHA1_HASH_CTX sha1;            //!< SHA1 part of the job
+        ISAL_SHA256_HASH_CTX sha256;        //!< SHA256 part of the job
+        ISAL_HASH_CTX_STS status;           //!< Context status flag
+        ISAL_HASH_CTX_ERROR error;          //!< Context error flag
+        uint64_t total_length;              //!< Running counter of length processed for this job
+        const uint8_t *data_buffer;         //!< input not handed to the managers yet
+        uint64_t data_len;                  //!< length of data_buffer in bytes
+        ISAL_HASH_CTX_FLAG data_flags;      //!< flags for the next tile of the input
+        uint32_t pending;                   //!< algorithms still hashing the current tile
+        struct ISAL_MULTI_DIGEST_CTX *next; //!< link in the manager lists
+        void *user_data;                    //!< pointer for user to keep any job-related data
+} ISAL_MULTI_DIGEST_CTX;
+
+/**
+ * @brief Context layer - Holds state for the multi-digest manager.
+ * This structure must be allocated to 16-byte aligned memory.
+ */
+typedef struct {
+        ISAL_MD5_HASH_CTX_MGR md5;        //!< MD5 multi-buffer manager
+        ISAL_SHA1_HASH_CTX_MGR sha1;      //!< SHA1 multi-buffer manager
+        ISAL_SHA256_HASH_CTX_MGR sha256;  //!< SHA256 multi-buffer manager
+        ISAL_MULTI_DIGEST_CTX *ready;     //!< jobs done with their current tile
+        ISAL_MULTI_DIGEST_CTX *done_head; //!< completed jobs not returned yet
+        ISAL_MULTI_DIGEST_CTX *done_tail; //!< last completed job not returned yet
+} ISAL_MULTI_DIGEST_CTX_MGR;
+
+/**
+ * @brief Initialize the multi-digest manager.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_multi_digest_ctx_mgr_init(ISAL_MULTI_DIGEST_CTX_MGR *mgr);
+
+/**
+ * @brief Submit a job to the multi-digest manager.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Same as isal_sha256_ctx_mgr_submit(), hashing the data with MD5, SHA1 and SHA256 at
+ * once. The length is 64-bit, so a whole object can be submitted in one call. Several
+ * jobs may complete during one call; one is returned in \a ctx_out and the others by the
+ * next calls to isal_multi_digest_ctx_mgr_submit() or isal_multi_digest_ctx_mgr_flush().
+ * The buffer must stay valid until the job is returned.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctx_in Structure holding ctx job info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no jobs completed.
+ * @param[in] buffer Pointer to buffer to be processed
+ * @param[in] len Length of buffer (in bytes) to be processed
+ * @param[in] flags Input flag specifying job type (first, update, last or entire)
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_multi_digest_ctx_mgr_submit(ISAL_MULTI_DIGEST_CTX_MGR *mgr, ISAL_MULTI_DIGEST_CTX *ctx_in,
+                                 ISAL_MULTI_DIGEST_CTX **ctx_out, const void *buffer,
+                                 const uint64_t len, const ISAL_HASH_CTX_FLAG flags);
+
+/**
+ * @brief Finish submitted multi-digest jobs, returning one completed job per call.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no jobs are left in the manager.
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_multi_digest_ctx_mgr_flush(ISAL_MULTI_DIGEST_CTX_MGR *mgr, ISAL_MULTI_DIGEST_CTX **ctx_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _MULTI_DIGEST_H_
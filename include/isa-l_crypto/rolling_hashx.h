@@ -69,10 +69,15 @@ enum {
         ISAL_FINGERPRINT_RET_OTHER    //!< Fingerprint function error returned
 };
 
-#define ISAL_FINGERPRINT_MAX_WINDOW 48
+#define ISAL_FINGERPRINT_MAX_WINDOW 256 //!< Max rolling_hash2 window width in bytes
+
+#define ISAL_ROLLING_HASH2_MAX_STREAMS 16 //!< Max streams for isal_rolling_hash2_run_multi()
 
 /**
  * @brief Context for rolling_hash2 functions
+ *
+ * The last w bytes hashed are kept in history, or left in the caller's buffer and pointed to
+ * by history_ref after isal_rolling_hash2_run_ref().
  */
 struct isal_rh_state2 {
         uint8_t history[ISAL_FINGERPRINT_MAX_WINDOW];
@@ -80,6 +85,35 @@ struct isal_rh_state2 {
         uint64_t table2[256];
         uint64_t hash;
         uint32_t w;
+        const uint8_t *history_ref; //!< Window history in the caller's buffer, or NULL
+};
+
+/**
+ *@brief content-defined chunker boundary hashes
+ */
+enum {
+        ISAL_CHUNKER_RH2 = 0, //!< rolling_hash2 over a window of w bytes
+        ISAL_CHUNKER_GEAR     //!< Gear hash with normalized chunking (FastCDC)
+};
+
+/**
+ * @brief Context for the content-defined chunker
+ *
+ * Cuts a stream into chunks of at least min_size and at most max_size bytes, with boundaries
+ * chosen by rolling_hash2 or by a Gear hash. The first min_size bytes of each chunk are never
+ * hashed.
+ */
+struct isal_chunker {
+        struct isal_rh_state2 state; //!< Rolling hash state, hash also holds the Gear hash
+        uint64_t gear_mask_s;        //!< Gear hash mask used before avg_size
+        uint64_t gear_mask_l;        //!< Gear hash mask used from avg_size on
+        uint32_t algo;               //!< Boundary hash, ISAL_CHUNKER_RH2 or ISAL_CHUNKER_GEAR
+        uint32_t min_size;           //!< Minimum chunk size in bytes
+        uint32_t avg_size;           //!< Target average chunk size in bytes
+        uint32_t max_size;           //!< Maximum chunk size in bytes
+        uint32_t mask;               //!< Rolling hash mask derived from the average chunk size
+        uint32_t trigger;            //!< Rolling hash trigger value
+        uint32_t chunk_len;          //!< Bytes of the current chunk seen so far
 };
 
 /**
@@ -139,8 +173,11 @@ rolling_hashx_mask_gen(long mean, int shift);
 /**
  * @brief Initialize state object for rolling hash2
  *
+ * Windows wider than 64 bytes are supported. The hash is 64 bits wide, so two equal bytes a
+ * multiple of 64 bytes apart in the window cancel out of the hash.
+ *
  * @param[in] state Structure holding state info on current rolling hash
- * @param[in] w Window width (1 <= w <= 32)
+ * @param[in] w Window width (1 <= w <= ISAL_FINGERPRINT_MAX_WINDOW)
  * @return Operation status
  * @retval 0 on success
  * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
@@ -182,6 +219,69 @@ int
 isal_rolling_hash2_run(struct isal_rh_state2 *state, const uint8_t *buffer, const uint32_t max_len,
                        const uint32_t mask, const uint32_t trigger, uint32_t *offset, int *match);
 
+/**
+ * @brief Run rolling hash function, keeping the window history in the caller's buffer
+ *
+ * Same as isal_rolling_hash2_run(), except that the last w bytes hashed are not copied into
+ * the state when they lie in buffer. The state points to them instead, so the w bytes before
+ * buffer + offset must stay unchanged until the next run on this state. This suits callers that
+ * stream from one mapping or through a ring of buffers, and avoids a copy per call when the
+ * buffers are short. A window that spans two buffers is assembled in the state unless buffer
+ * directly follows the previous one in memory. A run with max_len 0 copies the window into the
+ * state.
+ *
+ * @param[in] state Structure holding state info on current rolling hash
+ * @param[in] buffer Pointer to input buffer to run windowed hash on
+ * @param[in] max_len Max length to run over input
+ * @param[in] mask Mask bits ORed with hash before test with trigger
+ * @param[in] trigger Match value to compare with windowed hash at each input byte
+ * @param[out] offset Offset from buffer to match, set if match found
+ * @param[out] match Pointer to fingerprint result status to set
+ *                   ISAL_FINGERPRINT_RET_HIT - match found
+ *                   ISAL_FINGERPRINT_RET_MAX - exceeded max length
+ *                   ISAL_FINGERPRINT_RET_OTHER - error
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_rolling_hash2_run_ref(struct isal_rh_state2 *state, const uint8_t *buffer,
+                           const uint32_t max_len, const uint32_t mask, const uint32_t trigger,
+                           uint32_t *offset, int *match);
+
+/**
+ * @brief Run rolling hash on several independent streams in lockstep
+ *
+ * Each stream has its own state and input buffer and is checked for trigger as by
+ * isal_rolling_hash2_run(), with all streams sharing mask and trigger. Streams are advanced
+ * together one byte at a time so that the table lookups of all streams are done with vector
+ * gathers. The call returns once at least one stream has found a match or reached its
+ * max_len, so the caller can hand that stream its next buffer while the others continue.
+ * A stream that stopped early because of another one reports ISAL_FINGERPRINT_RET_MAX with
+ * offset less than max_len and carries on from buffer + offset on the next call, just like a
+ * stream that reached its max_len. Throughput is best with 8 or 16 streams.
+ *
+ * @param[in] state Array of num_streams rolling hash states, one per stream
+ * @param[in] buffer Array of num_streams input buffers
+ * @param[in] max_len Array of num_streams max lengths to run over each input
+ * @param[in] num_streams Number of streams (1 <= num_streams <= ISAL_ROLLING_HASH2_MAX_STREAMS)
+ * @param[in] mask Mask bits ORed with hash before test with trigger
+ * @param[in] trigger Match value to compare with windowed hash at each input byte
+ * @param[out] offset Array receiving, per stream, the offset from buffer after the match or the
+ *                    number of bytes processed when no match was found
+ * @param[out] match Array receiving, per stream, the fingerprint result status
+ *                   ISAL_FINGERPRINT_RET_HIT - match found
+ *                   ISAL_FINGERPRINT_RET_MAX - no match in the first offset bytes
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_rolling_hash2_run_multi(struct isal_rh_state2 *state[], const uint8_t *buffer[],
+                             const uint32_t max_len[], const uint32_t num_streams,
+                             const uint32_t mask, const uint32_t trigger, uint32_t offset[],
+                             int match[]);
+
 /**
  * @brief Generate an appropriate mask to target mean hit rate
  *
@@ -195,6 +295,84 @@ isal_rolling_hash2_run(struct isal_rh_state2 *state, const uint8_t *buffer, cons
 int
 isal_rolling_hashx_mask_gen(const uint32_t mean, const uint32_t shift, uint32_t *mask);
 
+/**
+ * @brief Initialize a content-defined chunker
+ *
+ * The rolling hash mask targets an average chunk size of avg_size. Since nothing is hashed
+ * before min_size bytes, the mask is derived from (avg_size - min_size).
+ *
+ * @param[in] chunker Structure holding chunker state
+ * @param[in] w Rolling hash window width (1 <= w <= ISAL_FINGERPRINT_MAX_WINDOW)
+ * @param[in] min_size Minimum chunk size (w <= min_size <= avg_size)
+ * @param[in] avg_size Target average chunk size (avg_size <= max_size)
+ * @param[in] max_size Maximum chunk size
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_chunker_init(struct isal_chunker *chunker, const uint32_t w, const uint32_t min_size,
+                  const uint32_t avg_size, const uint32_t max_size);
+
+/**
+ * @brief Initialize a content-defined chunker using a Gear hash
+ *
+ * Gear hashing (FastCDC) needs one table lookup, shift and add per byte and depends on the
+ * last 64 bytes of input. The hash starts from zero at min_size bytes into each chunk. Chunk
+ * sizes are normalized around avg_size: a mask with two more bits than avg_size calls for is
+ * used up to avg_size, and a mask with two fewer bits after it.
+ *
+ * @param[in] chunker Structure holding chunker state
+ * @param[in] min_size Minimum chunk size (min_size <= avg_size)
+ * @param[in] avg_size Target average chunk size (8 <= avg_size <= max_size)
+ * @param[in] max_size Maximum chunk size
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_chunker_init_gear(struct isal_chunker *chunker, const uint32_t min_size,
+                       const uint32_t avg_size, const uint32_t max_size);
+
+/**
+ * @brief Reset a chunker to the start of a new stream
+ *
+ * Keeps the hash and size configuration from isal_chunker_init() or isal_chunker_init_gear().
+ *
+ * @param[in] chunker Structure holding chunker state
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_chunker_reset(struct isal_chunker *chunker);
+
+/**
+ * @brief Find the chunk boundaries in the next buffer of a stream
+ *
+ * Writes the end offset of every chunk completed in this buffer to cuts, relative to buffer.
+ * A chunk may start in an earlier buffer of the stream; the chunker carries its length and
+ * hash history across calls. Processing stops early once max_cuts boundaries have been
+ * found, in which case consumed is less than len and the caller continues from
+ * buffer + consumed. The last chunk of a stream ends at the end of the stream and is not
+ * reported as a cut.
+ *
+ * @param[in] chunker Structure holding chunker state
+ * @param[in] buffer Pointer to next part of the stream
+ * @param[in] len Length of buffer in bytes
+ * @param[out] cuts Array receiving the chunk end offsets
+ * @param[in] max_cuts Number of entries in cuts, a buffer produces at most
+ *                     (len / min_size + 1) cuts
+ * @param[out] num_cuts Number of entries written to cuts
+ * @param[out] consumed Number of bytes of buffer processed
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_chunker_run(struct isal_chunker *chunker, const uint8_t *buffer, const uint64_t len,
+                 uint64_t *cuts, const uint32_t max_cuts, uint32_t *num_cuts, uint64_t *consumed);
+
 #ifdef __cplusplus
 }
 #endif
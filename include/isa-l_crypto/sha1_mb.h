@@ -189,6 +189,7 @@ typedef struct {
 
 typedef struct {
         ISAL_SHA1_MB_JOB_MGR mgr;
+        uint64_t latency_budget; //!< deadline mode wait limit, 0 if disabled
 } ISAL_SHA1_HASH_CTX_MGR;
 
 /** @brief Context layer - Holds info describing a single SHA1 job for the multi-buffer CTX manager.
@@ -203,9 +204,40 @@ typedef struct {
         uint32_t incoming_buffer_length; //!< length of buffer for this job in bytes.
         uint8_t partial_block_buffer[ISAL_SHA1_BLOCK_SIZE * 2]; //!< CTX partial blocks
         uint32_t partial_block_buffer_length;
-        void *user_data; //!< pointer for user to keep any job-related data
+        void *user_data;               //!< pointer for user to keep any job-related data
+        uint64_t submit_time;          //!< time of the last timed submit (deadline mode)
+        const uint8_t *data_buffer;    //!< input not submitted yet (64-bit length or iovec submit)
+        uint64_t data_len;             //!< length of data_buffer in bytes
+        const ISAL_HASH_IOVEC *iov;    //!< segments not started yet (iovec submit)
+        uint32_t iov_cnt;              //!< number of segments left in iov
+        ISAL_HASH_CTX_FLAG data_flags; //!< flags for the next piece of the input
 } ISAL_SHA1_HASH_CTX;
 
+/** @brief HMAC-SHA1 key - hash states after absorbing the inner and outer padded key blocks */
+
+typedef struct {
+        ISAL_SHA1_WORD_T ipad_digest[ISAL_SHA1_DIGEST_NWORDS]; //!< state after K ^ ipad
+        ISAL_SHA1_WORD_T opad_digest[ISAL_SHA1_DIGEST_NWORDS]; //!< state after K ^ opad
+} ISAL_HMAC_SHA1_KEY;
+
+/** @brief Context layer - Holds state for multi-buffer HMAC-SHA1 jobs */
+
+typedef struct {
+        ISAL_SHA1_HASH_CTX_MGR mgr;
+} ISAL_HMAC_SHA1_CTX_MGR;
+
+/** @brief Context layer - Holds info describing a single HMAC-SHA1 job for the multi-buffer
+ * HMAC manager. This structure must be allocated to 16-byte aligned memory */
+
+typedef struct {
+        ISAL_SHA1_HASH_CTX hash_ctx;   // Must be at struct offset 0.
+        const ISAL_HMAC_SHA1_KEY *key; //!< precomputed key of the job in progress
+        uint32_t stage;                //!< inner or outer hash in progress
+        void *user_data;               //!< pointer for user to keep any job-related data
+        uint8_t inner_digest[ISAL_SHA1_DIGEST_NWORDS * sizeof(ISAL_SHA1_WORD_T)];
+        uint8_t mac[ISAL_SHA1_DIGEST_NWORDS * sizeof(ISAL_SHA1_WORD_T)]; //!< HMAC result
+} ISAL_HMAC_SHA1_CTX;
+
 /******************** multibinary function prototypes **********************/
 
 /**
@@ -296,6 +328,246 @@ isal_sha1_ctx_mgr_submit(ISAL_SHA1_HASH_CTX_MGR *mgr, ISAL_SHA1_HASH_CTX *ctx_in
 int
 isal_sha1_ctx_mgr_flush(ISAL_SHA1_HASH_CTX_MGR *mgr, ISAL_SHA1_HASH_CTX **ctx_out);
 
+/**
+ * @brief Set the latency budget of the SHA1 multi-buffer manager (deadline mode).
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * In deadline mode, a job entered with isal_sha1_ctx_mgr_submit_timed() is not left waiting
+ * in a partially filled manager for longer than the budget. Once the oldest job in a lane has
+ * waited \a budget time units, the next timed submit or isal_sha1_ctx_mgr_poll() call flushes
+ * the manager. Time units are chosen by the application (e.g. nanoseconds or TSC ticks) and
+ * only need to be consistent between calls.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] budget Maximum time a job may wait in the manager, 0 to disable deadline mode
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_sha1_ctx_mgr_set_deadline(ISAL_SHA1_HASH_CTX_MGR *mgr, const uint64_t budget);
+
+/**
+ * @brief Submit a new SHA1 job to the multi-buffer manager, recording its submit time.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Same as isal_sha1_ctx_mgr_submit(), but if no job completed and a job in the manager has
+ * exceeded the latency budget, the manager is flushed and the completed job is returned.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctx_in Structure holding ctx job info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no jobs completed.
+ * @param[in] buffer Pointer to buffer to be processed
+ * @param[in] len Length of buffer (in bytes) to be processed
+ * @param[in] flags Input flag specifying job type (first, update, last or entire)
+ * @param[in] now Current time, in the units used for the latency budget
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_sha1_ctx_mgr_submit_timed(ISAL_SHA1_HASH_CTX_MGR *mgr, ISAL_SHA1_HASH_CTX *ctx_in,
+                               ISAL_SHA1_HASH_CTX **ctx_out, const void *buffer, const uint32_t len,
+                               const ISAL_HASH_CTX_FLAG flags, const uint64_t now);
+
+/**
+ * @brief Flush the SHA1 multi-buffer manager if a job has exceeded the latency budget.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Intended to be called periodically by applications with bursty input. Returns one completed
+ * job per call; the application should call it again until \a ctx_out is NULL.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no job is overdue.
+ * @param[in] now Current time, in the units used for the latency budget
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_sha1_ctx_mgr_poll(ISAL_SHA1_HASH_CTX_MGR *mgr, ISAL_SHA1_HASH_CTX **ctx_out,
+                       const uint64_t now);
+
+/**
+ * @brief Submit an array of SHA1 jobs to the multi-buffer manager in a single call.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Same as calling isal_sha1_ctx_mgr_submit() on each job in turn, but the parameters are
+ * checked once for the whole array, before any job is handed to the manager. Every job
+ * returned by the manager while the array is submitted is stored in \a completed, in the
+ * order it was returned. A job rejected by the manager (e.g. invalid flags) is returned in
+ * \a completed too and its error is reported once all jobs have been submitted.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctxs Array of \a num structures holding ctx job info
+ * @param[in] buffers Array of \a num pointers to buffers to be processed
+ * @param[in] lens Array of \a num buffer lengths (in bytes)
+ * @param[in] flags Array of \a num job types (first, update, last or entire)
+ * @param[in] num Number of jobs to submit
+ * @param[out] completed Array of at least \a num entries, filled with the completed jobs
+ * @param[out] num_completed Number of jobs stored in \a completed
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_sha1_ctx_mgr_submit_batch(ISAL_SHA1_HASH_CTX_MGR *mgr, ISAL_SHA1_HASH_CTX *const *ctxs,
+                               const void *const *buffers, const uint32_t *lens,
+                               const ISAL_HASH_CTX_FLAG *flags, const uint32_t num,
+                               ISAL_SHA1_HASH_CTX **completed, uint32_t *num_completed);
+
+/**
+ * @brief Submit a SHA1 job whose data is split over several buffers (scatter-gather input).
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Same as isal_sha1_ctx_mgr_submit() for the data of all \a iov segments in order, in a
+ * single call. The manager moves the job on to its next segment each time the lanes are done
+ * with the current one, and only returns it once the last segment has been hashed. Whole
+ * blocks are hashed in place from each segment; only a block that straddles two segments is
+ * copied to the context partial block buffer. Segments may be larger than 4GB, they are
+ * split as in isal_sha1_ctx_mgr_submit64(). The \a iov array and the segments must stay
+ * valid until the job is returned.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctx_in Structure holding ctx job info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no jobs completed.
+ * @param[in] iov Array of segments to be processed
+ * @param[in] iov_cnt Number of segments in \a iov
+ * @param[in] flags Input flag specifying job type (first, update, last or entire)
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_sha1_ctx_mgr_submit_iov(ISAL_SHA1_HASH_CTX_MGR *mgr, ISAL_SHA1_HASH_CTX *ctx_in,
+                             ISAL_SHA1_HASH_CTX **ctx_out, const ISAL_HASH_IOVEC *iov,
+                             const uint32_t iov_cnt, const ISAL_HASH_CTX_FLAG flags);
+
+/**
+ * @brief Submit a SHA1 job whose buffer may be larger than 4GB.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Same as isal_sha1_ctx_mgr_submit() with a 64-bit length. The manager hands the buffer to the
+ * lanes in block aligned pieces of up to 4GB and moves the job on to its next piece each time
+ * the lanes are done with the current one, so a buffer of any size (e.g. a whole file
+ * mapping) is submitted once and the job is only returned when all of it has been hashed.
+ * The buffer must stay valid until the job is returned.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctx_in Structure holding ctx job info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no jobs completed.
+ * @param[in] buffer Pointer to buffer to be processed
+ * @param[in] len Length of buffer (in bytes) to be processed
+ * @param[in] flags Input flag specifying job type (first, update, last or entire)
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_sha1_ctx_mgr_submit64(ISAL_SHA1_HASH_CTX_MGR *mgr, ISAL_SHA1_HASH_CTX *ctx_in,
+                           ISAL_SHA1_HASH_CTX **ctx_out, const void *buffer, const uint64_t len,
+                           const ISAL_HASH_CTX_FLAG flags);
+
+/**
+ * @brief Precompute an HMAC-SHA1 key.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Hashes the key XORed with the inner and outer pads once, so that each message
+ * authenticated with the key only costs its own blocks plus one outer block.
+ *
+ * @param[out] key_data Structure holding the precomputed inner and outer hash states
+ * @param[in] key Pointer to the HMAC key
+ * @param[in] key_len Length of the HMAC key in bytes
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_hmac_sha1_key_init(ISAL_HMAC_SHA1_KEY *key_data, const void *key, const uint32_t key_len);
+
+/**
+ * @brief Initialize the HMAC-SHA1 multi-buffer manager structure.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_hmac_sha1_ctx_mgr_init(ISAL_HMAC_SHA1_CTX_MGR *mgr);
+
+/**
+ * @brief Submit a new HMAC-SHA1 job to the multi-buffer manager.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * The whole message is authenticated in one submit. When the inner hash of a job completes,
+ * the outer hash is resubmitted to the same manager, so a job is only returned once its
+ * HMAC is available in \a mac. Contexts must be initialized with isal_hash_ctx_init() on
+ * their \a hash_ctx member before first use.
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[in] ctx_in Structure holding ctx job info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no jobs completed.
+ * @param[in] key Precomputed HMAC key, must stay valid until the job completes
+ * @param[in] buffer Pointer to message to be authenticated
+ * @param[in] len Length of message (in bytes)
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_hmac_sha1_ctx_mgr_submit(ISAL_HMAC_SHA1_CTX_MGR *mgr, ISAL_HMAC_SHA1_CTX *ctx_in,
+                              ISAL_HMAC_SHA1_CTX **ctx_out, const ISAL_HMAC_SHA1_KEY *key,
+                              const void *buffer, const uint32_t len);
+
+/**
+ * @brief Finish all submitted HMAC-SHA1 jobs and return when complete.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * @param[in] mgr Structure holding context level state info
+ * @param[out] ctx_out Pointer address to output job ctx info.
+ *                     Modified to point to completed job structure or
+ *                     NULL if no jobs completed.
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_hmac_sha1_ctx_mgr_flush(ISAL_HMAC_SHA1_CTX_MGR *mgr, ISAL_HMAC_SHA1_CTX **ctx_out);
+
+/**
+ * @brief Hash an array of equal length messages with SHA1.
+ * @requires SSE4.1 for x86 or ASIMD for ARM
+ *
+ * Message \a i starts at \a msgs + \a i * \a stride. The padding is the same for every
+ * message, so it is built once and full blocks are hashed in place, without per-message
+ * contexts. Digests are written contiguously, \a ISAL_SHA1_DIGEST_NWORDS words per
+ * message in the same format as the context \a result_digest.
+ *
+ * @param[in] msgs Pointer to the first message
+ * @param[in] stride Distance in bytes between the start of consecutive messages
+ * @param[in] len Length of each message in bytes
+ * @param[in] count Number of messages
+ * @param[out] digests Output array of \a count digests
+ * @return Operation status
+ * @retval 0 on success
+ * @retval Non-zero \a ISAL_CRYPTO_ERR on failure
+ */
+int
+isal_sha1_hash_batch(const void *msgs, const size_t stride, const uint32_t len,
+                     const uint32_t count, ISAL_SHA1_WORD_T *digests);
+
 #ifdef __cplusplus
 }
 #endif
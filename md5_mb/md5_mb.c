@@ -27,6 +27,7 @@
   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 **********************************************************************/
 
+#include <string.h>
 #include "md5_mb_internal.h"
 #include "isal_crypto_api.h"
 #include "multi_buffer.h"
@@ -41,12 +42,103 @@ isal_md5_ctx_mgr_init(ISAL_MD5_HASH_CTX_MGR *mgr)
         if (mgr == NULL)
                 return ISAL_CRYPTO_ERR_NULL_MGR;
 #endif
+        /* Deadline mode scans all lanes, not only those the arch manager sets up */
+        memset(&mgr->mgr, 0, sizeof(mgr->mgr));
         _md5_ctx_mgr_init(mgr);
+        mgr->latency_budget = 0;
 
         return 0;
 #endif
 }
 
+/* Largest piece of a 64-bit length input handed to the lanes as one job, kept block aligned */
+#define MD5_MAX_PIECE (UINT32_MAX & ~(ISAL_MD5_BLOCK_SIZE - 1))
+
+/* submit_time of a job entered without a timestamp, it is never overdue */
+#define MD5_UNTIMED UINT64_MAX
+
+/*
+ * Long and scatter-gather input: a context submitted with isal_md5_ctx_mgr_submit64() or
+ * isal_md5_ctx_mgr_submit_iov() keeps the input not handed to the lanes yet in data_buffer /
+ * data_len and iov / iov_cnt. It comes back from the lanes after each piece of at most
+ * MD5_MAX_PIECE bytes and is given its next piece here, so it is only returned to the
+ * application once all of its input has been hashed.
+ */
+static ISAL_MD5_HASH_CTX *
+md5_submit_piece(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx)
+{
+        const uint8_t *buffer;
+        uint32_t len;
+        ISAL_HASH_CTX_FLAG flags;
+
+        /* Move on to the next segment with data, an empty input is still submitted once */
+        while (ctx->data_len == 0 && ctx->iov_cnt != 0) {
+                ctx->data_buffer = (const uint8_t *) ctx->iov->buffer;
+                ctx->data_len = ctx->iov->len;
+                ctx->iov++;
+                ctx->iov_cnt--;
+        }
+
+        buffer = ctx->data_buffer;
+        len = ctx->data_len < MD5_MAX_PIECE ? (uint32_t) ctx->data_len : MD5_MAX_PIECE;
+        ctx->data_buffer += len;
+        ctx->data_len -= len;
+
+        /* Only the first piece may start the job and only the last one may end it */
+        flags = ctx->data_flags;
+        if (ctx->data_len != 0 || ctx->iov_cnt != 0)
+                flags = (ISAL_HASH_CTX_FLAG) (flags & ~ISAL_HASH_LAST);
+        ctx->data_flags = (ISAL_HASH_CTX_FLAG) (ctx->data_flags & ISAL_HASH_LAST);
+
+        return _md5_ctx_mgr_submit(mgr, ctx, buffer, len, flags);
+}
+
+static ISAL_MD5_HASH_CTX *
+md5_data_next(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx)
+{
+        while (ctx != NULL && (ctx->data_len != 0 || ctx->iov_cnt != 0) &&
+               ctx->error == ISAL_HASH_CTX_ERROR_NONE)
+                ctx = md5_submit_piece(mgr, ctx);
+
+        return ctx;
+}
+
+#ifndef FIPS_MODE
+static ISAL_MD5_HASH_CTX *
+md5_submit_data(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx, const void *buffer,
+                const uint64_t len, const ISAL_HASH_IOVEC *iov, const uint32_t iov_cnt,
+                const ISAL_HASH_CTX_FLAG flags)
+{
+        /* Leave the input of a job still in the manager alone, the submit fails on it */
+        if (ctx->status & ISAL_HASH_CTX_STS_PROCESSING)
+                return _md5_ctx_mgr_submit(mgr, ctx, buffer, 0, flags);
+
+        ctx->submit_time = MD5_UNTIMED;
+        ctx->data_buffer = (const uint8_t *) buffer;
+        ctx->data_len = len;
+        ctx->iov = iov;
+        ctx->iov_cnt = iov_cnt;
+        ctx->data_flags = flags;
+
+        return md5_data_next(mgr, md5_submit_piece(mgr, ctx));
+}
+#endif
+
+static ISAL_MD5_HASH_CTX *
+md5_data_flush(ISAL_MD5_HASH_CTX_MGR *mgr)
+{
+        ISAL_MD5_HASH_CTX *ctx;
+
+        do {
+                ctx = _md5_ctx_mgr_flush(mgr);
+                if (ctx == NULL)
+                        return NULL;
+                ctx = md5_data_next(mgr, ctx);
+        } while (ctx == NULL);
+
+        return ctx;
+}
+
 int
 isal_md5_ctx_mgr_submit(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx_in,
                         ISAL_MD5_HASH_CTX **ctx_out, const void *buffer, const uint32_t len,
@@ -64,7 +156,7 @@ isal_md5_ctx_mgr_submit(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx_in,
         if (buffer == NULL && (flags == ISAL_HASH_UPDATE || flags == ISAL_HASH_ENTIRE))
                 return ISAL_CRYPTO_ERR_NULL_SRC;
 #endif
-        *ctx_out = _md5_ctx_mgr_submit(mgr, ctx_in, buffer, len, flags);
+        *ctx_out = md5_submit_data(mgr, ctx_in, buffer, len, NULL, 0, flags);
 
 #ifdef SAFE_PARAM
         if (*ctx_out != NULL &&
@@ -95,8 +187,221 @@ isal_md5_ctx_mgr_flush(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX **ctx_out)
         if (ctx_out == NULL)
                 return ISAL_CRYPTO_ERR_NULL_CTX;
 #endif
-        *ctx_out = _md5_ctx_mgr_flush(mgr);
+        *ctx_out = md5_data_flush(mgr);
+
+        return 0;
+#endif
+}
+
+/*
+ * Deadline mode: flush the manager if any job in a lane has waited longer than the
+ * latency budget. Jobs in lanes are identified by the job pointer, which is at offset 0
+ * of the context.
+ */
+static ISAL_MD5_HASH_CTX *
+md5_ctx_mgr_expired(ISAL_MD5_HASH_CTX_MGR *mgr, const uint64_t now)
+{
+        const ISAL_MD5_HASH_CTX *ctx;
+        uint32_t i;
+
+        if (mgr->latency_budget == 0)
+                return NULL;
+
+        for (i = 0; i < ISAL_MD5_MAX_LANES; i++) {
+                ctx = (const ISAL_MD5_HASH_CTX *) mgr->mgr.ldata[i].job_in_lane;
+                if (ctx != NULL && ctx->submit_time != MD5_UNTIMED && now >= ctx->submit_time &&
+                    now - ctx->submit_time >= mgr->latency_budget)
+                        return md5_data_flush(mgr);
+        }
+
+        return NULL;
+}
+
+int
+isal_md5_ctx_mgr_set_deadline(ISAL_MD5_HASH_CTX_MGR *mgr, const uint64_t budget)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+#endif
+        mgr->latency_budget = budget;
+
+        return 0;
+#endif
+}
+
+int
+isal_md5_ctx_mgr_submit_timed(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx_in,
+                              ISAL_MD5_HASH_CTX **ctx_out, const void *buffer, const uint32_t len,
+                              const ISAL_HASH_CTX_FLAG flags, const uint64_t now)
+{
+        int processing, ret;
+
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_in == NULL || ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+        /* Do not restart the clock of a job that is still in the manager */
+        processing = ctx_in->status & ISAL_HASH_CTX_STS_PROCESSING;
+
+        ret = isal_md5_ctx_mgr_submit(mgr, ctx_in, ctx_out, buffer, len, flags);
+        /* The submit marked the job untimed, stamp it now that it is in the manager */
+        if (!processing)
+                ctx_in->submit_time = now;
+        if (ret == 0 && *ctx_out == NULL)
+                *ctx_out = md5_ctx_mgr_expired(mgr, now);
+
+        return ret;
+}
+
+int
+isal_md5_ctx_mgr_poll(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX **ctx_out, const uint64_t now)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+        *ctx_out = md5_ctx_mgr_expired(mgr, now);
+
+        return 0;
+#endif
+}
+
+int
+isal_md5_ctx_mgr_submit_batch(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *const *ctxs,
+                              const void *const *buffers, const uint32_t *lens,
+                              const ISAL_HASH_CTX_FLAG *flags, const uint32_t num,
+                              ISAL_MD5_HASH_CTX **completed, uint32_t *num_completed)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+        ISAL_MD5_HASH_CTX *cp;
+        uint32_t i, n = 0;
+
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctxs == NULL || completed == NULL || num_completed == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (buffers == NULL || lens == NULL || flags == NULL)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        /* Validate every job before any of them reaches the lanes */
+        for (i = 0; i < num; i++) {
+                if (ctxs[i] == NULL)
+                        return ISAL_CRYPTO_ERR_NULL_CTX;
+                /* OK to have NULL source buffer when flags is ISAL_HASH_FIRST or ISAL_HASH_LAST */
+                if (buffers[i] == NULL &&
+                    (flags[i] == ISAL_HASH_UPDATE || flags[i] == ISAL_HASH_ENTIRE))
+                        return ISAL_CRYPTO_ERR_NULL_SRC;
+        }
+#endif
+
+        for (i = 0; i < num; i++) {
+                cp = md5_submit_data(mgr, ctxs[i], buffers[i], lens[i], NULL, 0, flags[i]);
+                if (cp != NULL)
+                        completed[n++] = cp;
+        }
+        *num_completed = n;
+
+#ifdef SAFE_PARAM
+        /* Report the first rejected job; the jobs after it have still been submitted */
+        for (i = 0; i < n; i++) {
+                cp = completed[i];
+                if (cp->error == ISAL_HASH_CTX_ERROR_INVALID_FLAGS)
+                        return ISAL_CRYPTO_ERR_INVALID_FLAGS;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING)
+                        return ISAL_CRYPTO_ERR_ALREADY_PROCESSING;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_COMPLETED)
+                        return ISAL_CRYPTO_ERR_ALREADY_COMPLETED;
+        }
+#endif
+        return 0;
+#endif
+}
+
+int
+isal_md5_ctx_mgr_submit_iov(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx_in,
+                            ISAL_MD5_HASH_CTX **ctx_out, const ISAL_HASH_IOVEC *iov,
+                            const uint32_t iov_cnt, const ISAL_HASH_CTX_FLAG flags)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        uint32_t i;
+
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_in == NULL || ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (iov == NULL && iov_cnt != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        for (i = 0; i < iov_cnt; i++)
+                if (iov[i].buffer == NULL && iov[i].len != 0)
+                        return ISAL_CRYPTO_ERR_NULL_SRC;
+#endif
+
+        *ctx_out = md5_submit_data(mgr, ctx_in, NULL, 0, iov, iov_cnt, flags);
 
+#ifdef SAFE_PARAM
+        if (*ctx_out != NULL && (*ctx_out)->error != ISAL_HASH_CTX_ERROR_NONE) {
+                ISAL_MD5_HASH_CTX *cp = *ctx_out;
+
+                if (cp->error == ISAL_HASH_CTX_ERROR_INVALID_FLAGS)
+                        return ISAL_CRYPTO_ERR_INVALID_FLAGS;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING)
+                        return ISAL_CRYPTO_ERR_ALREADY_PROCESSING;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_COMPLETED)
+                        return ISAL_CRYPTO_ERR_ALREADY_COMPLETED;
+        }
+#endif
+        return 0;
+#endif
+}
+
+int
+isal_md5_ctx_mgr_submit64(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx_in,
+                          ISAL_MD5_HASH_CTX **ctx_out, const void *buffer, const uint64_t len,
+                          const ISAL_HASH_CTX_FLAG flags)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_in == NULL || ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        /* OK to have NULL source buffer when flags is ISAL_HASH_FIRST or ISAL_HASH_LAST */
+        if (buffer == NULL && (flags == ISAL_HASH_UPDATE || flags == ISAL_HASH_ENTIRE))
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+#endif
+        *ctx_out = md5_submit_data(mgr, ctx_in, buffer, len, NULL, 0, flags);
+
+#ifdef SAFE_PARAM
+        if (*ctx_out != NULL &&
+            (ISAL_MD5_HASH_CTX *) (*ctx_out)->error != ISAL_HASH_CTX_ERROR_NONE) {
+                ISAL_MD5_HASH_CTX *cp = (ISAL_MD5_HASH_CTX *) (*ctx_out);
+
+                if (cp->error == ISAL_HASH_CTX_ERROR_INVALID_FLAGS)
+                        return ISAL_CRYPTO_ERR_INVALID_FLAGS;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING)
+                        return ISAL_CRYPTO_ERR_ALREADY_PROCESSING;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_COMPLETED)
+                        return ISAL_CRYPTO_ERR_ALREADY_COMPLETED;
+        }
+#endif
         return 0;
 #endif
 }
@@ -110,13 +415,18 @@ isal_md5_ctx_mgr_flush(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX **ctx_out)
 void
 md5_ctx_mgr_init(ISAL_MD5_HASH_CTX_MGR *mgr)
 {
+        /* Deadline mode scans all lanes, not only those the arch manager sets up */
+        memset(&mgr->mgr, 0, sizeof(mgr->mgr));
         _md5_ctx_mgr_init(mgr);
+        mgr->latency_budget = 0;
 }
 
 ISAL_MD5_HASH_CTX *
 md5_ctx_mgr_submit(ISAL_MD5_HASH_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *ctx, const void *buffer,
                    uint32_t len, ISAL_HASH_CTX_FLAG flags)
 {
+        if (!(ctx->status & ISAL_HASH_CTX_STS_PROCESSING))
+                ctx->submit_time = MD5_UNTIMED;
         return _md5_ctx_mgr_submit(mgr, ctx, buffer, len, flags);
 }
 
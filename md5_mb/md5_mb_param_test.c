@@ -215,6 +215,405 @@ end_flush:
 
         return ret;
 }
+
+static int
+test_md5_mb_deadline_api(void)
+{
+        ISAL_MD5_HASH_CTX_MGR *mgr = NULL;
+        ISAL_MD5_HASH_CTX ctx = { 0 }, *ctx_ptr = &ctx;
+        int rc, ret = -1;
+        const char *fn_name = "isal_md5_ctx_mgr_set_deadline";
+
+        rc = posix_memalign((void *) &mgr, 16, sizeof(ISAL_MD5_HASH_CTX_MGR));
+        if ((rc != 0) || (mgr == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_poll(mgr, &ctx_ptr, 0),
+                          ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_deadline);
+#else
+        rc = isal_md5_ctx_mgr_init(mgr);
+        if (rc != ISAL_CRYPTO_ERR_NONE)
+                goto end_deadline;
+
+        // Init context before first use
+        isal_hash_ctx_init(&ctx);
+
+        // check null mgr
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_set_deadline(NULL, 100), ISAL_CRYPTO_ERR_NULL_MGR,
+                          fn_name, end_deadline);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_set_deadline(mgr, 100), ISAL_CRYPTO_ERR_NONE, fn_name,
+                          end_deadline);
+
+        fn_name = "isal_md5_ctx_mgr_submit_timed";
+
+        // check null mgr
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_timed(NULL, ctx_ptr, &ctx_ptr, msg,
+                                                        (uint32_t) strlen((char *) msg),
+                                                        ISAL_HASH_ENTIRE, 0),
+                          ISAL_CRYPTO_ERR_NULL_MGR, fn_name, end_deadline);
+
+        // check null input ctx
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_timed(mgr, NULL, &ctx_ptr, msg,
+                                                        (uint32_t) strlen((char *) msg),
+                                                        ISAL_HASH_ENTIRE, 0),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_deadline);
+
+        // check null output ctx
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_timed(mgr, ctx_ptr, NULL, msg,
+                                                        (uint32_t) strlen((char *) msg),
+                                                        ISAL_HASH_ENTIRE, 0),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_deadline);
+
+        // check invalid flag
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_timed(mgr, ctx_ptr, &ctx_ptr, msg,
+                                                        (uint32_t) strlen((char *) msg), 999, 0),
+                          ISAL_CRYPTO_ERR_INVALID_FLAGS, fn_name, end_deadline);
+
+        fn_name = "isal_md5_ctx_mgr_poll";
+
+        // check null mgr
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_poll(NULL, &ctx_ptr, 0), ISAL_CRYPTO_ERR_NULL_MGR,
+                          fn_name, end_deadline);
+
+        // check null ctx
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_poll(mgr, NULL, 0), ISAL_CRYPTO_ERR_NULL_CTX, fn_name,
+                          end_deadline);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_poll(mgr, &ctx_ptr, 0), ISAL_CRYPTO_ERR_NONE, fn_name,
+                          end_deadline);
+
+        if (ctx_ptr != NULL) {
+                printf("test: %s() - expected NULL job ptr\n", fn_name);
+                goto end_deadline;
+        }
+#endif
+
+        ret = 0;
+
+end_deadline:
+        aligned_free(mgr);
+
+        return ret;
+}
+
+static int
+test_md5_mb_submit_batch_api(void)
+{
+        ISAL_MD5_HASH_CTX_MGR *mgr = NULL;
+        ISAL_MD5_HASH_CTX ctx[2], *ctxs[2] = { &ctx[0], &ctx[1] }, *done[2], *ctx_ptr;
+        ISAL_HASH_CTX_FLAG flags[2] = { ISAL_HASH_ENTIRE, ISAL_HASH_ENTIRE };
+        const void *bufs[2];
+        uint32_t lens[2], n;
+        int rc, ret = -1;
+        const char *fn_name = "isal_md5_ctx_mgr_submit_batch";
+
+        rc = posix_memalign((void *) &mgr, 16, sizeof(ISAL_MD5_HASH_CTX_MGR));
+        if ((rc != 0) || (mgr == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+
+        bufs[0] = bufs[1] = msg;
+        lens[0] = lens[1] = (uint32_t) sizeof(msg);
+
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_batch(mgr, ctxs, bufs, lens, flags, 2, done, &n),
+                          ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_submit_batch);
+#else
+        rc = isal_md5_ctx_mgr_init(mgr);
+        if (rc != ISAL_CRYPTO_ERR_NONE)
+                goto end_submit_batch;
+
+        // Init contexts before first use
+        memset(ctx, 0, sizeof(ctx));
+        isal_hash_ctx_init(&ctx[0]);
+        isal_hash_ctx_init(&ctx[1]);
+
+        // check null mgr
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_batch(NULL, ctxs, bufs, lens, flags, 2, done, &n),
+                          ISAL_CRYPTO_ERR_NULL_MGR, fn_name, end_submit_batch);
+
+        // check null ctx array
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_batch(mgr, NULL, bufs, lens, flags, 2, done, &n),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_submit_batch);
+
+        // check null completed array
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_batch(mgr, ctxs, bufs, lens, flags, 2, NULL, &n),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_submit_batch);
+
+        // check null source array
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_batch(mgr, ctxs, NULL, lens, flags, 2, done, &n),
+                          ISAL_CRYPTO_ERR_NULL_SRC, fn_name, end_submit_batch);
+
+        // check null ctx in the array
+        ctxs[1] = NULL;
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_batch(mgr, ctxs, bufs, lens, flags, 2, done, &n),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_submit_batch);
+        ctxs[1] = &ctx[1];
+
+        // check null source ptr in the array
+        bufs[1] = NULL;
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_batch(mgr, ctxs, bufs, lens, flags, 2, done, &n),
+                          ISAL_CRYPTO_ERR_NULL_SRC, fn_name, end_submit_batch);
+        bufs[1] = msg;
+
+        // no job may reach the manager when the array is rejected
+        if (ctx[0].total_length != 0) {
+                printf("test: %s() - job submitted from a rejected array\n", fn_name);
+                goto end_submit_batch;
+        }
+
+        // check invalid flag, the rejected job is returned with the completed ones
+        flags[1] = (ISAL_HASH_CTX_FLAG) 999;
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_batch(mgr, ctxs, bufs, lens, flags, 2, done, &n),
+                          ISAL_CRYPTO_ERR_INVALID_FLAGS, fn_name, end_submit_batch);
+        if (n == 0 || done[n - 1] != &ctx[1] ||
+            ctx[1].error != ISAL_HASH_CTX_ERROR_INVALID_FLAGS) {
+                printf("test: %s() - expected rejected job\n", fn_name);
+                goto end_submit_batch;
+        }
+        do {
+                rc = isal_md5_ctx_mgr_flush(mgr, &ctx_ptr);
+        } while (rc == ISAL_CRYPTO_ERR_NONE && ctx_ptr != NULL);
+
+        // check valid args
+        flags[1] = ISAL_HASH_ENTIRE;
+        isal_hash_ctx_init(&ctx[0]);
+        isal_hash_ctx_init(&ctx[1]);
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_batch(mgr, ctxs, bufs, lens, flags, 2, done, &n),
+                          ISAL_CRYPTO_ERR_NONE, fn_name, end_submit_batch);
+        do {
+                rc = isal_md5_ctx_mgr_flush(mgr, &ctx_ptr);
+        } while (rc == ISAL_CRYPTO_ERR_NONE && ctx_ptr != NULL);
+        if (ctx[0].status != ISAL_HASH_CTX_STS_COMPLETE ||
+            ctx[1].status != ISAL_HASH_CTX_STS_COMPLETE) {
+                printf("test: %s() - expected completed jobs\n", fn_name);
+                goto end_submit_batch;
+        }
+#endif
+
+        ret = 0;
+
+end_submit_batch:
+        aligned_free(mgr);
+
+        return ret;
+}
+
+static int
+test_md5_mb_submit_iov_api(void)
+{
+        ISAL_MD5_HASH_CTX_MGR *mgr = NULL;
+        ISAL_MD5_HASH_CTX ctx = { 0 }, *ctx_ptr = &ctx;
+        ISAL_HASH_IOVEC iov[2];
+        int rc, ret = -1;
+        const char *fn_name = "isal_md5_ctx_mgr_submit_iov";
+
+        rc = posix_memalign((void *) &mgr, 16, sizeof(ISAL_MD5_HASH_CTX_MGR));
+        if ((rc != 0) || (mgr == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+
+        iov[0].buffer = msg;
+        iov[0].len = 4;
+        iov[1].buffer = msg + 4;
+        iov[1].len = (uint32_t) sizeof(msg) - 4;
+
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_iov(mgr, ctx_ptr, &ctx_ptr, iov, 2,
+                                                      ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_submit_iov);
+#else
+        rc = isal_md5_ctx_mgr_init(mgr);
+        if (rc != ISAL_CRYPTO_ERR_NONE)
+                goto end_submit_iov;
+
+        // Init context before first use
+        isal_hash_ctx_init(&ctx);
+
+        // check null mgr
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_iov(NULL, ctx_ptr, &ctx_ptr, iov, 2,
+                                                      ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_NULL_MGR, fn_name, end_submit_iov);
+
+        // check null input ctx
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_iov(mgr, NULL, &ctx_ptr, iov, 2,
+                                                      ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_submit_iov);
+
+        // check null output ctx
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_iov(mgr, ctx_ptr, NULL, iov, 2, ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_submit_iov);
+
+        // check null segment array
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_iov(mgr, ctx_ptr, &ctx_ptr, NULL, 2,
+                                                      ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_NULL_SRC, fn_name, end_submit_iov);
+
+        // check null segment buffer
+        iov[1].buffer = NULL;
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_iov(mgr, ctx_ptr, &ctx_ptr, iov, 2,
+                                                      ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_NULL_SRC, fn_name, end_submit_iov);
+        iov[1].buffer = msg + 4;
+
+        // check invalid flag
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_iov(mgr, ctx_ptr, &ctx_ptr, iov, 2, 999),
+                          ISAL_CRYPTO_ERR_INVALID_FLAGS, fn_name, end_submit_iov);
+
+        // check valid args
+        isal_hash_ctx_init(&ctx);
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit_iov(mgr, ctx_ptr, &ctx_ptr, iov, 2,
+                                                      ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_NONE, fn_name, end_submit_iov);
+        do {
+                rc = isal_md5_ctx_mgr_flush(mgr, &ctx_ptr);
+        } while (rc == ISAL_CRYPTO_ERR_NONE && ctx_ptr != NULL);
+        if (ctx.status != ISAL_HASH_CTX_STS_COMPLETE) {
+                printf("test: %s() - expected completed job\n", fn_name);
+                goto end_submit_iov;
+        }
+#endif
+
+        ret = 0;
+
+end_submit_iov:
+        aligned_free(mgr);
+
+        return ret;
+}
+
+static int
+test_md5_mb_submit64_api(void)
+{
+        ISAL_MD5_HASH_CTX_MGR *mgr = NULL;
+        ISAL_MD5_HASH_CTX ctx = { 0 }, *ctx_ptr = &ctx;
+        int rc, ret = -1;
+        const char *fn_name = "isal_md5_ctx_mgr_submit64";
+
+        rc = posix_memalign((void *) &mgr, 16, sizeof(ISAL_MD5_HASH_CTX_MGR));
+        if ((rc != 0) || (mgr == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit64(mgr, ctx_ptr, &ctx_ptr, msg,
+                                                    strlen((char *) msg), ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_submit64);
+#else
+        rc = isal_md5_ctx_mgr_init(mgr);
+        if (rc != ISAL_CRYPTO_ERR_NONE)
+                goto end_submit64;
+
+        // Init context before first use
+        isal_hash_ctx_init(&ctx);
+
+        // check null mgr
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit64(NULL, ctx_ptr, &ctx_ptr, msg,
+                                                    strlen((char *) msg), ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_NULL_MGR, fn_name, end_submit64);
+
+        // check null input ctx
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit64(mgr, NULL, &ctx_ptr, msg, strlen((char *) msg),
+                                                    ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_submit64);
+
+        // check null output ctx
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit64(mgr, ctx_ptr, NULL, msg, strlen((char *) msg),
+                                                    ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_submit64);
+
+        // check null source ptr
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit64(mgr, ctx_ptr, &ctx_ptr, NULL,
+                                                    strlen((char *) msg), ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_NULL_SRC, fn_name, end_submit64);
+
+        // check invalid flag
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit64(mgr, ctx_ptr, &ctx_ptr, msg,
+                                                    strlen((char *) msg), 999),
+                          ISAL_CRYPTO_ERR_INVALID_FLAGS, fn_name, end_submit64);
+
+        // simulate internal error (submit in progress job)
+        ctx_ptr->status = ISAL_HASH_CTX_STS_PROCESSING;
+
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit64(mgr, ctx_ptr, &ctx_ptr, msg,
+                                                    strlen((char *) msg), ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_ALREADY_PROCESSING, fn_name, end_submit64);
+
+        CHECK_RETURN_GOTO(ctx_ptr->error, ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING, fn_name,
+                          end_submit64);
+
+        // simulate internal error (submit completed job)
+        ctx_ptr->error = ISAL_HASH_CTX_ERROR_NONE;
+        ctx_ptr->status = ISAL_HASH_CTX_STS_COMPLETE;
+
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit64(mgr, ctx_ptr, &ctx_ptr, msg,
+                                                    strlen((char *) msg), ISAL_HASH_UPDATE),
+                          ISAL_CRYPTO_ERR_ALREADY_COMPLETED, fn_name, end_submit64);
+
+        CHECK_RETURN_GOTO(ctx_ptr->error, ISAL_HASH_CTX_ERROR_ALREADY_COMPLETED, fn_name,
+                          end_submit64);
+
+        // check valid args
+        isal_hash_ctx_init(&ctx);
+        CHECK_RETURN_GOTO(isal_md5_ctx_mgr_submit64(mgr, ctx_ptr, &ctx_ptr, msg,
+                                                    strlen((char *) msg), ISAL_HASH_ENTIRE),
+                          ISAL_CRYPTO_ERR_NONE, fn_name, end_submit64);
+#endif
+        ret = 0;
+
+end_submit64:
+        aligned_free(mgr);
+
+        return ret;
+}
+
+static int
+test_md5_hash_batch_api(void)
+{
+        ISAL_MD5_WORD_T digest[ISAL_MD5_DIGEST_NWORDS];
+        int ret = -1;
+        const char *fn_name = "isal_md5_hash_batch";
+
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(isal_md5_hash_batch(msg, 0, sizeof(msg), 1, digest),
+                          ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_batch);
+#else
+        // check null messages
+        CHECK_RETURN_GOTO(isal_md5_hash_batch(NULL, 0, sizeof(msg), 1, digest),
+                          ISAL_CRYPTO_ERR_NULL_SRC, fn_name, end_batch);
+
+        // check null digests
+        CHECK_RETURN_GOTO(isal_md5_hash_batch(msg, 0, sizeof(msg), 1, NULL),
+                          ISAL_CRYPTO_ERR_NULL_DST, fn_name, end_batch);
+
+        // check empty batch
+        CHECK_RETURN_GOTO(isal_md5_hash_batch(NULL, 0, 0, 0, NULL), ISAL_CRYPTO_ERR_NONE, fn_name,
+                          end_batch);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_md5_hash_batch(msg, 0, sizeof(msg), 1, digest), ISAL_CRYPTO_ERR_NONE,
+                          fn_name, end_batch);
+#endif
+
+        ret = 0;
+
+end_batch:
+        return ret;
+}
 #endif /* SAFE_PARAM */
 
 int
@@ -226,6 +625,11 @@ main(void)
         fail |= test_md5_mb_init_api();
         fail |= test_md5_mb_submit_api();
         fail |= test_md5_mb_flush_api();
+        fail |= test_md5_mb_deadline_api();
+        fail |= test_md5_mb_submit_batch_api();
+        fail |= test_md5_mb_submit_iov_api();
+        fail |= test_md5_mb_submit64_api();
+        fail |= test_md5_hash_batch_api();
 
         printf(fail ? "Fail\n" : "Pass\n");
 #else
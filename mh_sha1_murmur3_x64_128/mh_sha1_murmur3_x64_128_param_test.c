@@ -116,6 +116,50 @@ exit_update:
         return retval;
 }
 
+static int
+test_mh_sha1_murmur3_x64_128_update64_api(void)
+{
+        int ret, retval = 1;
+        struct isal_mh_sha1_murmur3_x64_128_ctx *ctx = NULL;
+        uint8_t *buff = NULL;
+        const char *func_name = "isal_mh_sha1_murmur3_x64_128_update64";
+        const int len = 1024;
+
+        ctx = malloc(sizeof(*ctx));
+        buff = malloc(len);
+        if (ctx == NULL || buff == NULL) {
+                printf("malloc failed test aborted\n");
+                goto exit_update64;
+        }
+        memset(buff, 0xFF, len);
+
+#ifdef FIPS_MODE
+        // Check for invalid algorithm error
+        ret = isal_mh_sha1_murmur3_x64_128_update64(ctx, buff, len);
+        CHECK_RETURN_GOTO(ret, ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, func_name, exit_update64);
+#else
+        // check null ctx
+        ret = isal_mh_sha1_murmur3_x64_128_update64(NULL, buff, len);
+        CHECK_RETURN_GOTO(ret, ISAL_CRYPTO_ERR_NULL_CTX, func_name, exit_update64);
+
+        // check null src buffer
+        ret = isal_mh_sha1_murmur3_x64_128_update64(ctx, NULL, len);
+        CHECK_RETURN_GOTO(ret, ISAL_CRYPTO_ERR_NULL_SRC, func_name, exit_update64);
+
+        // check valid params
+        ret = isal_mh_sha1_murmur3_x64_128_update64(ctx, buff, len);
+        CHECK_RETURN_GOTO(ret, ISAL_CRYPTO_ERR_NONE, func_name, exit_update64);
+#endif
+
+        retval = 0;
+
+exit_update64:
+        free(ctx);
+        free(buff);
+
+        return retval;
+}
+
 static int
 test_mh_sha1_murmur3_x64_128_finalize_api(void)
 {
@@ -169,6 +213,7 @@ main(void)
 #ifdef SAFE_PARAM
         fail |= test_mh_sha1_murmur3_x64_128_init_api();
         fail |= test_mh_sha1_murmur3_x64_128_update_api();
+        fail |= test_mh_sha1_murmur3_x64_128_update64_api();
         fail |= test_mh_sha1_murmur3_x64_128_finalize_api();
         printf(fail ? "Fail\n" : "Pass\n");
 #else
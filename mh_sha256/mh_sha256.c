@@ -31,6 +31,9 @@
 #include "mh_sha256_internal.h"
 #include "isal_crypto_api.h"
 
+/* Largest piece of a 64-bit length update, a whole number of multi-hash blocks */
+#define MH_SHA256_MAX_PIECE (UINT32_MAX & ~(ISAL_MH_SHA256_BLOCK_SIZE - 1))
+
 int
 _mh_sha256_init(struct isal_mh_sha256_ctx *ctx)
 {
@@ -87,6 +90,39 @@ isal_mh_sha256_update(struct isal_mh_sha256_ctx *ctx, const void *buffer, uint32
 #endif
 }
 
+int
+isal_mh_sha256_update64(struct isal_mh_sha256_ctx *ctx, const void *buffer, const uint64_t len)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+        const uint8_t *input_data = (const uint8_t *) buffer;
+        uint64_t remaining = len;
+        uint32_t piece;
+        int ret;
+
+#ifdef SAFE_PARAM
+        if (ctx == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (buffer == NULL)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+#endif
+        /* Feed the 32-bit update whole multi-hash blocks at a time */
+        do {
+                piece = MH_SHA256_MAX_PIECE;
+                if (remaining < piece)
+                        piece = (uint32_t) remaining;
+                ret = _mh_sha256_update(ctx, input_data, piece);
+                if (ret != ISAL_MH_SHA256_CTX_ERROR_NONE)
+                        return ret;
+                input_data += piece;
+                remaining -= piece;
+        } while (remaining != 0);
+
+        return ISAL_MH_SHA256_CTX_ERROR_NONE;
+#endif
+}
+
 int
 isal_mh_sha256_finalize(struct isal_mh_sha256_ctx *ctx, void *mh_sha256_digest)
 {
@@ -109,6 +109,46 @@ exit_update:
         return retval;
 }
 
+static int
+test_mh_sha256_update64_api(void)
+{
+        int ret, retval = 1;
+        struct isal_mh_sha256_ctx *update_ctx = NULL;
+        uint8_t *buff = NULL;
+        const char *func_name = "isal_mh_sha256_update64";
+
+        update_ctx = malloc(sizeof(*update_ctx));
+        buff = malloc(TEST_LEN);
+        if (update_ctx == NULL || buff == NULL) {
+                printf("malloc failed test aborted\n");
+                goto exit_update64;
+        }
+        memset(buff, 0xFF, TEST_LEN);
+
+#ifdef FIPS_MODE
+        // Check for invalid algorithm error
+        ret = isal_mh_sha256_update64(update_ctx, buff, TEST_LEN);
+        CHECK_RETURN_GOTO(ret, ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, func_name, exit_update64);
+#else
+        ret = isal_mh_sha256_update64(NULL, buff, TEST_LEN);
+        CHECK_RETURN_GOTO(ret, ISAL_CRYPTO_ERR_NULL_CTX, func_name, exit_update64);
+
+        ret = isal_mh_sha256_update64(update_ctx, NULL, TEST_LEN);
+        CHECK_RETURN_GOTO(ret, ISAL_CRYPTO_ERR_NULL_SRC, func_name, exit_update64);
+
+        ret = isal_mh_sha256_update64(update_ctx, buff, TEST_LEN);
+        CHECK_RETURN_GOTO(ret, ISAL_CRYPTO_ERR_NONE, func_name, exit_update64);
+#endif
+
+        retval = 0;
+
+exit_update64:
+        free(update_ctx);
+        free(buff);
+
+        return retval;
+}
+
 static int
 test_mh_sha256_finalize_api(void)
 {
@@ -153,6 +193,7 @@ main(void)
 #ifdef SAFE_PARAM
         fail |= test_mh_sha256_init_api();
         fail |= test_mh_sha256_update_api();
+        fail |= test_mh_sha256_update64_api();
         fail |= test_mh_sha256_finalize_api();
         printf(fail ? "Fail\n" : "Pass\n");
 #else
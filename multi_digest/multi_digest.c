@@ -0,0 +1,281 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stddef.h>
+#include "multi_digest.h"
+#include "md5_mb_internal.h"
+#include "sha1_mb_internal.h"
+#include "sha256_mb_internal.h"
+#include "isal_crypto_api.h"
+#include "multi_buffer.h"
+
+#ifndef FIPS_MODE
+/* A sub-job came back from one of the managers, the job is ready once all three are done */
+static void
+md_sub_done(ISAL_MULTI_DIGEST_CTX_MGR *mgr, void *user_data, const ISAL_HASH_CTX_ERROR error)
+{
+        ISAL_MULTI_DIGEST_CTX *ctx = (ISAL_MULTI_DIGEST_CTX *) user_data;
+
+        if (error != ISAL_HASH_CTX_ERROR_NONE)
+                ctx->error = error;
+        if (--ctx->pending == 0) {
+                ctx->next = mgr->ready;
+                mgr->ready = ctx;
+        }
+}
+
+static void
+md_md5_done(ISAL_MULTI_DIGEST_CTX_MGR *mgr, ISAL_MD5_HASH_CTX *sub)
+{
+        if (sub != NULL)
+                md_sub_done(mgr, sub->user_data, sub->error);
+}
+
+static void
+md_sha1_done(ISAL_MULTI_DIGEST_CTX_MGR *mgr, ISAL_SHA1_HASH_CTX *sub)
+{
+        if (sub != NULL)
+                md_sub_done(mgr, sub->user_data, sub->error);
+}
+
+static void
+md_sha256_done(ISAL_MULTI_DIGEST_CTX_MGR *mgr, ISAL_SHA256_HASH_CTX *sub)
+{
+        if (sub != NULL)
+                md_sub_done(mgr, sub->user_data, sub->error);
+}
+
+/* Hand the next tile of a job to the three managers, one right after the other */
+static void
+md_submit_tile(ISAL_MULTI_DIGEST_CTX_MGR *mgr, ISAL_MULTI_DIGEST_CTX *ctx)
+{
+        const uint8_t *buffer = ctx->data_buffer;
+        uint32_t len = ISAL_MULTI_DIGEST_TILE_SIZE;
+        ISAL_HASH_CTX_FLAG flags = ctx->data_flags;
+
+        if (ctx->data_len < len)
+                len = (uint32_t) ctx->data_len;
+        ctx->data_buffer += len;
+        ctx->data_len -= len;
+        ctx->total_length += len;
+
+        /* Only the first tile may start the job and only the last one may end it */
+        if (ctx->data_len != 0)
+                flags = (ISAL_HASH_CTX_FLAG) (flags & ~ISAL_HASH_LAST);
+        ctx->data_flags = (ISAL_HASH_CTX_FLAG) (ctx->data_flags & ISAL_HASH_LAST);
+
+        ctx->pending = 3;
+        md_md5_done(mgr, _md5_ctx_mgr_submit(&mgr->md5, &ctx->md5, buffer, len, flags));
+        md_sha1_done(mgr, _sha1_ctx_mgr_submit(&mgr->sha1, &ctx->sha1, buffer, len, flags));
+        md_sha256_done(mgr, _sha256_ctx_mgr_submit(&mgr->sha256, &ctx->sha256, buffer, len, flags));
+}
+
+/*
+ * Move the jobs done with their current tile on to the next one. Jobs with no input left are
+ * queued for the application. Submitting a tile can make other jobs ready, so the list is
+ * drained in a loop rather than recursively.
+ */
+static void
+md_run_ready(ISAL_MULTI_DIGEST_CTX_MGR *mgr)
+{
+        ISAL_MULTI_DIGEST_CTX *ctx;
+
+        while (mgr->ready != NULL) {
+                ctx = mgr->ready;
+                mgr->ready = ctx->next;
+
+                if (ctx->data_len != 0 && ctx->error == ISAL_HASH_CTX_ERROR_NONE) {
+                        md_submit_tile(mgr, ctx);
+                        continue;
+                }
+
+                ctx->status = (ctx->data_flags & ISAL_HASH_LAST) ? ISAL_HASH_CTX_STS_COMPLETE
+                                                                 : ISAL_HASH_CTX_STS_IDLE;
+                ctx->next = NULL;
+                if (mgr->done_head == NULL)
+                        mgr->done_head = ctx;
+                else
+                        mgr->done_tail->next = ctx;
+                mgr->done_tail = ctx;
+        }
+}
+
+static ISAL_MULTI_DIGEST_CTX *
+md_pop_done(ISAL_MULTI_DIGEST_CTX_MGR *mgr)
+{
+        ISAL_MULTI_DIGEST_CTX *ctx = mgr->done_head;
+
+        if (ctx != NULL)
+                mgr->done_head = ctx->next;
+
+        return ctx;
+}
+
+static ISAL_MULTI_DIGEST_CTX *
+md_ctx_mgr_submit(ISAL_MULTI_DIGEST_CTX_MGR *mgr, ISAL_MULTI_DIGEST_CTX *ctx, const void *buffer,
+                  const uint64_t len, const ISAL_HASH_CTX_FLAG flags)
+{
+        if (flags & (~ISAL_HASH_ENTIRE)) {
+                // Cannot submit with an invalid flag combination
+                ctx->error = ISAL_HASH_CTX_ERROR_INVALID_FLAGS;
+                return ctx;
+        }
+
+        if (ctx->status & ISAL_HASH_CTX_STS_PROCESSING) {
+                // Cannot submit to a currently processing job.
+                ctx->error = ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING;
+                return ctx;
+        }
+
+        if ((ctx->status & ISAL_HASH_CTX_STS_COMPLETE) && !(flags & ISAL_HASH_FIRST)) {
+                // Cannot update a finished job.
+                ctx->error = ISAL_HASH_CTX_ERROR_ALREADY_COMPLETED;
+                return ctx;
+        }
+
+        if (flags & ISAL_HASH_FIRST) {
+                isal_hash_ctx_init(&ctx->md5);
+                isal_hash_ctx_init(&ctx->sha1);
+                isal_hash_ctx_init(&ctx->sha256);
+                ctx->md5.user_data = ctx;
+                ctx->sha1.user_data = ctx;
+                ctx->sha256.user_data = ctx;
+                ctx->total_length = 0;
+        }
+
+        ctx->error = ISAL_HASH_CTX_ERROR_NONE;
+        ctx->status = ISAL_HASH_CTX_STS_PROCESSING;
+        ctx->data_buffer = (const uint8_t *) buffer;
+        ctx->data_len = len;
+        ctx->data_flags = flags;
+
+        md_submit_tile(mgr, ctx);
+        md_run_ready(mgr);
+
+        return md_pop_done(mgr);
+}
+
+static ISAL_MULTI_DIGEST_CTX *
+md_ctx_mgr_flush(ISAL_MULTI_DIGEST_CTX_MGR *mgr)
+{
+        ISAL_MD5_HASH_CTX *md5;
+        ISAL_SHA1_HASH_CTX *sha1;
+        ISAL_SHA256_HASH_CTX *sha256;
+
+        while (mgr->done_head == NULL) {
+                /* Flush the managers in turn so that the three algorithms keep pace */
+                md5 = _md5_ctx_mgr_flush(&mgr->md5);
+                sha1 = _sha1_ctx_mgr_flush(&mgr->sha1);
+                sha256 = _sha256_ctx_mgr_flush(&mgr->sha256);
+                if (md5 == NULL && sha1 == NULL && sha256 == NULL)
+                        return NULL;
+
+                md_md5_done(mgr, md5);
+                md_sha1_done(mgr, sha1);
+                md_sha256_done(mgr, sha256);
+                md_run_ready(mgr);
+        }
+
+        return md_pop_done(mgr);
+}
+#endif
+
+int
+isal_multi_digest_ctx_mgr_init(ISAL_MULTI_DIGEST_CTX_MGR *mgr)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+#endif
+        _md5_ctx_mgr_init(&mgr->md5);
+        _sha1_ctx_mgr_init(&mgr->sha1);
+        _sha256_ctx_mgr_init(&mgr->sha256);
+        mgr->ready = NULL;
+        mgr->done_head = NULL;
+        mgr->done_tail = NULL;
+
+        return 0;
+#endif
+}
+
+int
+isal_multi_digest_ctx_mgr_submit(ISAL_MULTI_DIGEST_CTX_MGR *mgr, ISAL_MULTI_DIGEST_CTX *ctx_in,
+                                 ISAL_MULTI_DIGEST_CTX **ctx_out, const void *buffer,
+                                 const uint64_t len, const ISAL_HASH_CTX_FLAG flags)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_in == NULL || ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        /* OK to have NULL source buffer when flags is ISAL_HASH_FIRST or ISAL_HASH_LAST */
+        if (buffer == NULL && (flags == ISAL_HASH_UPDATE || flags == ISAL_HASH_ENTIRE))
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+#endif
+        *ctx_out = md_ctx_mgr_submit(mgr, ctx_in, buffer, len, flags);
+
+#ifdef SAFE_PARAM
+        if (*ctx_out != NULL && (*ctx_out)->error != ISAL_HASH_CTX_ERROR_NONE) {
+                ISAL_MULTI_DIGEST_CTX *cp = *ctx_out;
+
+                if (cp->error == ISAL_HASH_CTX_ERROR_INVALID_FLAGS)
+                        return ISAL_CRYPTO_ERR_INVALID_FLAGS;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING)
+                        return ISAL_CRYPTO_ERR_ALREADY_PROCESSING;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_COMPLETED)
+                        return ISAL_CRYPTO_ERR_ALREADY_COMPLETED;
+        }
+#endif
+        return 0;
+#endif
+}
+
+int
+isal_multi_digest_ctx_mgr_flush(ISAL_MULTI_DIGEST_CTX_MGR *mgr, ISAL_MULTI_DIGEST_CTX **ctx_out)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+        *ctx_out = md_ctx_mgr_flush(mgr);
+
+        return 0;
+#endif
+}
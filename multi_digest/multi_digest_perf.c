@@ -0,0 +1,179 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "multi_digest.h"
+#include "test.h"
+
+#ifndef FIPS_MODE
+// Set number of outstanding jobs
+#define TEST_BUFS 32
+
+#ifndef GT_L3_CACHE
+#define GT_L3_CACHE 32 * 1024 * 1024 /* some number > last level cache */
+#endif
+
+#if !defined(COLD_TEST) && !defined(TEST_CUSTOM)
+// Cached test, loop many times over small dataset
+#define TEST_LEN      64 * 1024
+#define TEST_LOOPS    100
+#define TEST_TYPE_STR "_warm"
+#elif defined(COLD_TEST)
+// Uncached test.  Pull from large mem base.
+#define TEST_LEN      (2 * GT_L3_CACHE / TEST_BUFS)
+#define TEST_LOOPS    20
+#define TEST_TYPE_STR "_cold"
+#endif
+#endif /* !FIPS_MODE */
+
+int
+main(void)
+{
+#ifndef FIPS_MODE
+        int ret;
+        ISAL_MD5_HASH_CTX_MGR *md5_mgr = NULL;
+        ISAL_SHA1_HASH_CTX_MGR *sha1_mgr = NULL;
+        ISAL_SHA256_HASH_CTX_MGR *sha256_mgr = NULL;
+        ISAL_MULTI_DIGEST_CTX_MGR *mgr = NULL;
+        ISAL_MD5_HASH_CTX md5_ctxpool[TEST_BUFS], *md5_ctx = NULL;
+        ISAL_SHA1_HASH_CTX sha1_ctxpool[TEST_BUFS], *sha1_ctx = NULL;
+        ISAL_SHA256_HASH_CTX sha256_ctxpool[TEST_BUFS], *sha256_ctx = NULL;
+        ISAL_MULTI_DIGEST_CTX *ctxpool = NULL, *ctx = NULL;
+        unsigned char *bufs[TEST_BUFS];
+        uint32_t i, t, fail = 0;
+        struct perf start, stop;
+
+        ret = posix_memalign((void *) &md5_mgr, 16, sizeof(*md5_mgr));
+        ret |= posix_memalign((void *) &sha1_mgr, 16, sizeof(*sha1_mgr));
+        ret |= posix_memalign((void *) &sha256_mgr, 16, sizeof(*sha256_mgr));
+        ret |= posix_memalign((void *) &mgr, 16, sizeof(*mgr));
+        ret |= posix_memalign((void *) &ctxpool, 16, sizeof(*ctxpool) * TEST_BUFS);
+        if (ret) {
+                printf("alloc error: Fail");
+                return -1;
+        }
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                bufs[i] = (unsigned char *) calloc((size_t) TEST_LEN, 1);
+                if (bufs[i] == NULL) {
+                        printf("calloc failed test aborted\n");
+                        return 1;
+                }
+                memset(bufs[i], i, TEST_LEN);
+                // Init ctx contents
+                isal_hash_ctx_init(&md5_ctxpool[i]);
+                isal_hash_ctx_init(&sha1_ctxpool[i]);
+                isal_hash_ctx_init(&sha256_ctxpool[i]);
+                isal_hash_ctx_init(&ctxpool[i]);
+        }
+
+        if (isal_md5_ctx_mgr_init(md5_mgr) || isal_sha1_ctx_mgr_init(sha1_mgr) ||
+            isal_sha256_ctx_mgr_init(sha256_mgr) || isal_multi_digest_ctx_mgr_init(mgr))
+                return 1;
+
+        // Start separate pass tests, each algorithm reads all the data again
+        perf_start(&start);
+        for (t = 0; t < TEST_LOOPS; t++) {
+                for (i = 0; i < TEST_BUFS; i++)
+                        isal_md5_ctx_mgr_submit(md5_mgr, &md5_ctxpool[i], &md5_ctx, bufs[i],
+                                                TEST_LEN, ISAL_HASH_ENTIRE);
+                do {
+                        isal_md5_ctx_mgr_flush(md5_mgr, &md5_ctx);
+                } while (md5_ctx != NULL);
+
+                for (i = 0; i < TEST_BUFS; i++)
+                        isal_sha1_ctx_mgr_submit(sha1_mgr, &sha1_ctxpool[i], &sha1_ctx, bufs[i],
+                                                 TEST_LEN, ISAL_HASH_ENTIRE);
+                do {
+                        isal_sha1_ctx_mgr_flush(sha1_mgr, &sha1_ctx);
+                } while (sha1_ctx != NULL);
+
+                for (i = 0; i < TEST_BUFS; i++)
+                        isal_sha256_ctx_mgr_submit(sha256_mgr, &sha256_ctxpool[i], &sha256_ctx,
+                                                   bufs[i], TEST_LEN, ISAL_HASH_ENTIRE);
+                do {
+                        isal_sha256_ctx_mgr_flush(sha256_mgr, &sha256_ctx);
+                } while (sha256_ctx != NULL);
+        }
+        perf_stop(&stop);
+
+        printf("md5_sha1_sha256_separate" TEST_TYPE_STR ": ");
+        perf_print(stop, start, (long long) TEST_LEN * i * t);
+
+        // Start multi-digest tests, one pass over the data
+        perf_start(&start);
+        for (t = 0; t < TEST_LOOPS; t++) {
+                for (i = 0; i < TEST_BUFS; i++) {
+                        ret = isal_multi_digest_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, bufs[i],
+                                                               TEST_LEN, ISAL_HASH_ENTIRE);
+                        if (ret)
+                                return 1;
+                }
+
+                do {
+                        ret = isal_multi_digest_ctx_mgr_flush(mgr, &ctx);
+                        if (ret)
+                                return 1;
+                } while (ctx != NULL);
+        }
+        perf_stop(&stop);
+
+        printf("multi_digest" TEST_TYPE_STR ": ");
+        perf_print(stop, start, (long long) TEST_LEN * i * t);
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                if (memcmp(ctxpool[i].md5.job.result_digest, md5_ctxpool[i].job.result_digest,
+                           sizeof(md5_ctxpool[i].job.result_digest)) ||
+                    memcmp(ctxpool[i].sha1.job.result_digest, sha1_ctxpool[i].job.result_digest,
+                           sizeof(sha1_ctxpool[i].job.result_digest)) ||
+                    memcmp(ctxpool[i].sha256.job.result_digest,
+                           sha256_ctxpool[i].job.result_digest,
+                           sizeof(sha256_ctxpool[i].job.result_digest))) {
+                        fail++;
+                        printf("Test%d, digest mismatch\n", i);
+                }
+        }
+
+        printf("Multi-digest test complete %d buffers of %d B with "
+               "%d iterations\n",
+               TEST_BUFS, TEST_LEN, TEST_LOOPS);
+
+        if (fail)
+                printf("Test failed function check %d\n", fail);
+        else
+                printf(" multi_digest_perf: Pass\n");
+
+        return fail;
+#else
+        printf("Not Executed\n");
+        return 0;
+#endif /* FIPS_MODE */
+}
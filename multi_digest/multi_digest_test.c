@@ -0,0 +1,208 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "isal_crypto_api.h"
+#include "multi_digest.h"
+#include "test.h"
+
+#ifndef FIPS_MODE
+#define TEST_JOBS 40
+#define TEST_LEN  (5 * ISAL_MULTI_DIGEST_TILE_SIZE + 100)
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+static uint32_t md5_digest_ref[TEST_JOBS][ISAL_MD5_DIGEST_NWORDS];
+static uint32_t sha1_digest_ref[TEST_JOBS][ISAL_SHA1_DIGEST_NWORDS];
+static uint32_t sha256_digest_ref[TEST_JOBS][ISAL_SHA256_DIGEST_NWORDS];
+
+// Compare against reference functions
+extern void
+md5_ref(uint8_t *input_data, uint32_t *digest, uint32_t len);
+extern void
+sha1_ref(const uint8_t *input_data, uint32_t *digest, const uint32_t len);
+extern void
+sha256_ref(const uint8_t *input_data, uint32_t *digest, const uint32_t len);
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+static int
+check_digests(ISAL_MULTI_DIGEST_CTX *ctxpool, const uint32_t i)
+{
+        ISAL_MULTI_DIGEST_CTX *ctx = &ctxpool[i];
+        int fail = 0;
+
+        if (ctx->status != ISAL_HASH_CTX_STS_COMPLETE || ctx->error != ISAL_HASH_CTX_ERROR_NONE) {
+                printf("Job %d status %d error %d\n", i, ctx->status, ctx->error);
+                return 1;
+        }
+        if (memcmp(ctx->md5.job.result_digest, md5_digest_ref[i], sizeof(md5_digest_ref[i]))) {
+                printf("Job %d, md5 digest fail\n", i);
+                fail++;
+        }
+        if (memcmp(ctx->sha1.job.result_digest, sha1_digest_ref[i], sizeof(sha1_digest_ref[i]))) {
+                printf("Job %d, sha1 digest fail\n", i);
+                fail++;
+        }
+        if (memcmp(ctx->sha256.job.result_digest, sha256_digest_ref[i],
+                   sizeof(sha256_digest_ref[i]))) {
+                printf("Job %d, sha256 digest fail\n", i);
+                fail++;
+        }
+
+        return fail;
+}
+#endif
+
+int
+main(void)
+{
+#ifndef FIPS_MODE
+        ISAL_MULTI_DIGEST_CTX_MGR *mgr = NULL;
+        ISAL_MULTI_DIGEST_CTX *ctxpool = NULL, *ctx;
+        unsigned char *buf = NULL;
+        uint32_t lens[TEST_JOBS];
+        uint32_t i, len, done = 0;
+        int ret, fail = 0;
+
+        printf("multi_digest test, %d jobs: ", TEST_JOBS);
+
+        ret = posix_memalign((void *) &mgr, 16, sizeof(*mgr));
+        ret |= posix_memalign((void *) &ctxpool, 16, sizeof(*ctxpool) * TEST_JOBS);
+        buf = (unsigned char *) malloc(TEST_JOBS * TEST_LEN);
+        if (ret != 0 || mgr == NULL || ctxpool == NULL || buf == NULL) {
+                printf("alloc failed test aborted\n");
+                fail++;
+                goto end;
+        }
+
+        srand(TEST_SEED);
+        rand_buffer(buf, TEST_JOBS * TEST_LEN);
+        for (i = 0; i < TEST_JOBS; i++) {
+                lens[i] = rand() % (TEST_LEN + 1);
+                md5_ref(buf + i * TEST_LEN, md5_digest_ref[i], lens[i]);
+                sha1_ref(buf + i * TEST_LEN, sha1_digest_ref[i], lens[i]);
+                sha256_ref(buf + i * TEST_LEN, sha256_digest_ref[i], lens[i]);
+        }
+        lens[0] = 0;
+        md5_ref(buf, md5_digest_ref[0], 0);
+        sha1_ref(buf, sha1_digest_ref[0], 0);
+        sha256_ref(buf, sha256_digest_ref[0], 0);
+
+        if (isal_multi_digest_ctx_mgr_init(mgr) != 0) {
+                fail++;
+                goto end;
+        }
+
+        // Whole jobs, many in flight at once
+        for (i = 0; i < TEST_JOBS; i++) {
+                isal_hash_ctx_init(&ctxpool[i]);
+                ctxpool[i].user_data = (void *) (uintptr_t) i;
+                if (isal_multi_digest_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, buf + i * TEST_LEN,
+                                                     lens[i], ISAL_HASH_ENTIRE) != 0) {
+                        fail++;
+                        goto end;
+                }
+                if (ctx != NULL) {
+                        fail += check_digests(ctxpool, (uint32_t) (uintptr_t) ctx->user_data);
+                        done++;
+                }
+        }
+        do {
+                if (isal_multi_digest_ctx_mgr_flush(mgr, &ctx) != 0) {
+                        fail++;
+                        goto end;
+                }
+                if (ctx != NULL) {
+                        fail += check_digests(ctxpool, (uint32_t) (uintptr_t) ctx->user_data);
+                        done++;
+                }
+        } while (ctx != NULL);
+
+        if (done != TEST_JOBS) {
+                printf("completed %d of %d jobs\n", done, TEST_JOBS);
+                fail++;
+                goto end;
+        }
+
+        // One job fed in random sized updates, a single stream through the manager
+        i = TEST_JOBS - 1;
+        isal_hash_ctx_init(&ctxpool[i]);
+        ctxpool[i].user_data = (void *) (uintptr_t) i;
+        ctx = &ctxpool[i];
+        for (len = 0; len < lens[i] || ctxpool[i].status != ISAL_HASH_CTX_STS_COMPLETE;) {
+                uint32_t update_len = rand() % (2 * ISAL_MULTI_DIGEST_TILE_SIZE + 1);
+                ISAL_HASH_CTX_FLAG flags = (len == 0) ? ISAL_HASH_FIRST : ISAL_HASH_UPDATE;
+
+                if (update_len >= lens[i] - len) {
+                        update_len = lens[i] - len;
+                        flags |= ISAL_HASH_LAST;
+                }
+                if (isal_multi_digest_ctx_mgr_submit(mgr, &ctxpool[i], &ctx,
+                                                     buf + i * TEST_LEN + len, update_len,
+                                                     flags) != 0) {
+                        fail++;
+                        goto end;
+                }
+                len += update_len;
+                while (ctx == NULL) {
+                        isal_multi_digest_ctx_mgr_flush(mgr, &ctx);
+                        if (ctx == NULL) {
+                                printf("lost job in update\n");
+                                fail++;
+                                goto end;
+                        }
+                }
+        }
+        fail += check_digests(ctxpool, i);
+
+end:
+        aligned_free(mgr);
+        aligned_free(ctxpool);
+        free(buf);
+
+        printf(fail ? "Fail\n" : "Pass\n");
+
+        return fail;
+#else
+        printf("Not Executed\n");
+
+        return 0;
+#endif /* FIPS_MODE */
+}
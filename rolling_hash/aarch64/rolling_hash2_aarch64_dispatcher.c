@@ -34,3 +34,13 @@ DEFINE_INTERFACE_DISPATCHER(_rolling_hash2_run_until)
 
         //~ return PROVIDER_BASIC(_rolling_hash2_run_until);
 }
+
+DEFINE_INTERFACE_DISPATCHER(_gear_run_until)
+{
+        return PROVIDER_BASIC(_gear_run_until);
+}
+
+DEFINE_INTERFACE_DISPATCHER(_rolling_hash2_multi_run_until)
+{
+        return PROVIDER_BASIC(_rolling_hash2_multi_run_until);
+}
@@ -0,0 +1,100 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,avx512f"))), apply_to = function)
+#elif defined(__ICC)
+#pragma intel optimization_parameter target_arch = CORE-AVX512
+#elif defined(__ICL)
+#pragma[intel] optimization_parameter target_arch = CORE-AVX512
+#elif (__GNUC__ >= 5)
+#pragma GCC target("avx2,avx512f")
+#endif
+
+#include <stdint.h>
+#include <immintrin.h>
+
+/*
+ * Gear hash cut point search, 8 positions per step.
+ *
+ * h[i] = (h[i-1] << 1) + g[i] unrolls to h[i+j] = (h[i-1] << (j+1)) + sum(g[i+k] << (j-k))
+ * for k = 0..j. The sums for all 8 lanes are a prefix scan done in three shift-and-add steps
+ * that does not depend on h, after which the cut condition is tested for 8 consecutive
+ * positions at once. Only h = (h << 8) + sum[7] is carried between steps, in a general purpose
+ * register. Table values are fetched with scalar loads, gathers are slower on CPUs with the
+ * gather data sampling mitigation.
+ */
+
+uint64_t
+_gear_run_until_base(uint32_t *idx, uint32_t max_idx, const uint64_t *table, const uint8_t *buf,
+                     uint64_t h, uint64_t mask);
+
+uint64_t
+_gear_run_until_avx512(uint32_t *idx, uint32_t max_idx, const uint64_t *table,
+                       const uint8_t *buf, uint64_t h, uint64_t mask)
+{
+        const __m512i shifts = _mm512_setr_epi64(1, 2, 3, 4, 5, 6, 7, 8);
+        const __m512i zero = _mm512_setzero_si512();
+        const __m512i vmask = _mm512_set1_epi64((long long) mask);
+        const uint8_t *p;
+        __m512i g, hv;
+        uint64_t lanes[8];
+        uint32_t i = *idx;
+        int j;
+
+        for (; i + 8 <= max_idx; i += 8) {
+                p = buf + i;
+                g = _mm512_set_epi64((long long) table[p[7]], (long long) table[p[6]],
+                                     (long long) table[p[5]], (long long) table[p[4]],
+                                     (long long) table[p[3]], (long long) table[p[2]],
+                                     (long long) table[p[1]], (long long) table[p[0]]);
+
+                g = _mm512_add_epi64(g, _mm512_slli_epi64(_mm512_alignr_epi64(g, zero, 7), 1));
+                g = _mm512_add_epi64(g, _mm512_slli_epi64(_mm512_alignr_epi64(g, zero, 6), 2));
+                g = _mm512_add_epi64(g, _mm512_slli_epi64(_mm512_alignr_epi64(g, zero, 4), 4));
+                hv = _mm512_add_epi64(
+                        g, _mm512_sllv_epi64(_mm512_set1_epi64((long long) h), shifts));
+
+                if (_mm512_testn_epi64_mask(hv, vmask)) {
+                        _mm512_storeu_si512((void *) lanes, hv);
+                        for (j = 0; (lanes[j] & mask) != 0; j++)
+                                ;
+                        *idx = i + j;
+                        return lanes[j];
+                }
+                h = (h << 8) + (uint64_t) _mm_extract_epi64(_mm512_extracti32x4_epi32(g, 3), 1);
+        }
+
+        *idx = i;
+        return _gear_run_until_base(idx, max_idx, table, buf, h, mask);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
@@ -38,6 +38,14 @@ extern uint64_t
 _rolling_hash2_run_until(uint32_t *idx, int max_idx, uint64_t *t1, uint64_t *t2, uint8_t *b1,
                          uint8_t *b2, uint64_t h, uint64_t mask, uint64_t trigger);
 
+/* Rotate left, also for r a multiple of 64 */
+static inline uint64_t
+rotl64(uint64_t v, uint32_t r)
+{
+        r &= 63;
+        return (v << r) | (v >> ((64 - r) & 63));
+}
+
 int
 _rolling_hash2_init(struct isal_rh_state2 *state, uint32_t w)
 {
@@ -50,34 +58,43 @@ _rolling_hash2_init(struct isal_rh_state2 *state, uint32_t w)
         for (i = 0; i < 256; i++) {
                 v = rolling_hash2_table1[i];
                 state->table1[i] = v;
-                state->table2[i] = (v << w) | (v >> (64 - w));
+                state->table2[i] = rotl64(v, w);
         }
         state->w = w;
+        state->history_ref = NULL;
         return 0;
 }
 
 void
-_rolling_hash2_reset(struct isal_rh_state2 *state, uint8_t *init_bytes)
+_rolling_hash2_reset_ref(struct isal_rh_state2 *state, const uint8_t *init_bytes)
 {
         uint64_t hash;
         uint32_t i, w;
 
+        /* Each byte is rotated once per later byte of the window, no need to chain the rotates */
         hash = 0;
         w = state->w;
-        for (i = 0; i < w; i++) {
-                hash = (hash << 1) | (hash >> (64 - 1));
-                hash ^= state->table1[init_bytes[i]];
-        }
+        for (i = 0; i < w; i++)
+                hash ^= rotl64(state->table1[init_bytes[i]], w - 1 - i);
         state->hash = hash;
-        memcpy(state->history, init_bytes, w);
+        state->history_ref = init_bytes;
 }
 
-static uint64_t
-hash_fn(struct isal_rh_state2 *state, uint64_t h, uint8_t new_char, uint8_t old_char)
+void
+_rolling_hash2_reset(struct isal_rh_state2 *state, uint8_t *init_bytes)
 {
-        h = (h << 1) | (h >> (64 - 1));
-        h ^= state->table1[new_char] ^ state->table2[old_char];
-        return h;
+        _rolling_hash2_reset_ref(state, init_bytes);
+        memcpy(state->history, init_bytes, state->w);
+        state->history_ref = NULL;
+}
+
+void
+_rolling_hash2_save_history(struct isal_rh_state2 *state)
+{
+        if (state->history_ref != NULL) {
+                memcpy(state->history, state->history_ref, state->w);
+                state->history_ref = NULL;
+        }
 }
 
 uint64_t
@@ -109,52 +126,77 @@ _rolling_hash2_run_until_base(uint32_t *idx, int max_idx, uint64_t *t1, uint64_t
         return h;
 }
 
-int
-_rolling_hash2_run(struct isal_rh_state2 *state, uint8_t *buffer, uint32_t buffer_length,
-                   uint32_t mask, uint32_t trigger, uint32_t *offset)
+/*
+ * The window history holds the w bytes before buffer, so the first w bytes of the buffer drop
+ * bytes of the history and the rest drop bytes of the buffer itself. Both parts run through the
+ * same optimized loop. With by_ref set the new history is left in the caller's buffer instead of
+ * being copied into the state, it is only assembled in the state when it spans two buffers.
+ */
+static int
+rolling_hash2_run_hist(struct isal_rh_state2 *state, uint8_t *buffer, uint32_t buffer_length,
+                       uint32_t mask, uint32_t trigger, uint32_t *offset, const int by_ref)
 {
-
-        uint32_t i;
-        uint32_t w = state->w;
+        const uint32_t w = state->w;
+        const uint8_t *history = state->history_ref ? state->history_ref : state->history;
+        uint32_t end = buffer_length < w ? buffer_length : w;
         uint64_t hash = state->hash;
-
-        for (i = 0; i < w; i++) {
-                if (i == buffer_length) {
-                        *offset = i;
-                        // update history
-                        memmove(state->history, state->history + i, w - i);
-                        memcpy(state->history + w - i, buffer, i);
-                        state->hash = hash;
-                        return ISAL_FINGERPRINT_RET_MAX;
-                }
-                hash = hash_fn(state, hash, buffer[i], state->history[i]);
-
-                if ((hash & mask) == trigger) {
-                        // found hit
-                        i++;
-                        *offset = i;
-                        memmove(state->history, state->history + i, w - i);
-                        memcpy(state->history + w - i, buffer, i);
-                        state->hash = hash;
-                        return ISAL_FINGERPRINT_RET_HIT;
-                }
+        uint32_t i = 0;
+        int ret = ISAL_FINGERPRINT_RET_MAX;
+
+        if (buffer_length == 0) {
+                // nothing to carry on from, keep the window out of the previous buffer
+                _rolling_hash2_save_history(state);
+                *offset = 0;
+                return ISAL_FINGERPRINT_RET_MAX;
         }
 
-        hash = _rolling_hash2_run_until(&i, buffer_length, state->table1, state->table2, buffer,
-                                        buffer - w, hash, mask, trigger);
+        hash = _rolling_hash2_run_until(&i, end, state->table1, state->table2, buffer,
+                                        (uint8_t *) history, hash, mask, trigger);
+        if (i == end && end < buffer_length && (hash & mask) != trigger) {
+                end = buffer_length;
+                hash = _rolling_hash2_run_until(&i, end, state->table1, state->table2, buffer,
+                                                buffer - w, hash, mask, trigger);
+        }
         if ((hash & mask) == trigger) {
-                // found hit
-                i++;
-                *offset = i;
-                memcpy(state->history, buffer + i - w, w);
-                state->hash = hash;
-                return ISAL_FINGERPRINT_RET_HIT;
+                // found hit, the loop stops on the hit byte or right after it on the last byte
+                if (i < end)
+                        i++;
+                ret = ISAL_FINGERPRINT_RET_HIT;
         }
-        // no hit
         *offset = i;
-        memcpy(state->history, buffer + i - w, w);
         state->hash = hash;
-        return ISAL_FINGERPRINT_RET_MAX;
+
+        // update history
+        if (i >= w) {
+                if (by_ref) {
+                        state->history_ref = buffer + i - w;
+                        return ret;
+                }
+                memcpy(state->history, buffer + i - w, w);
+        } else if (by_ref && state->history_ref != NULL && history + w == buffer) {
+                // buffer carries on right after the history, it is still one run of memory
+                state->history_ref = history + i;
+                return ret;
+        } else {
+                memmove(state->history, history + i, w - i);
+                memcpy(state->history + w - i, buffer, i);
+        }
+        state->history_ref = NULL;
+        return ret;
+}
+
+int
+_rolling_hash2_run(struct isal_rh_state2 *state, uint8_t *buffer, uint32_t buffer_length,
+                   uint32_t mask, uint32_t trigger, uint32_t *offset)
+{
+        return rolling_hash2_run_hist(state, buffer, buffer_length, mask, trigger, offset, 0);
+}
+
+int
+_rolling_hash2_run_ref(struct isal_rh_state2 *state, uint8_t *buffer, uint32_t buffer_length,
+                       uint32_t mask, uint32_t trigger, uint32_t *offset)
+{
+        return rolling_hash2_run_hist(state, buffer, buffer_length, mask, trigger, offset, 1);
 }
 
 int
@@ -215,6 +257,30 @@ isal_rolling_hash2_run(struct isal_rh_state2 *state, const uint8_t *buffer, cons
 #endif
 }
 
+int
+isal_rolling_hash2_run_ref(struct isal_rh_state2 *state, const uint8_t *buffer,
+                           const uint32_t max_len, const uint32_t mask, const uint32_t trigger,
+                           uint32_t *offset, int *match)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        if (state == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (buffer == NULL)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        if (offset == NULL)
+                return ISAL_CRYPTO_ERR_NULL_OFFSET;
+        if (match == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MATCH;
+#endif
+        *match = _rolling_hash2_run_ref(state, (uint8_t *) buffer, max_len, mask, trigger, offset);
+
+        return 0;
+#endif
+}
+
 int
 isal_rolling_hashx_mask_gen(const uint32_t mean, const uint32_t shift, uint32_t *mask)
 {
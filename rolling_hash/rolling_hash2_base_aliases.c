@@ -37,3 +37,28 @@ _rolling_hash2_run_until(uint32_t *idx, int max_idx, uint64_t *t1, uint64_t *t2,
 {
         return _rolling_hash2_run_until_base(idx, max_idx, t1, t2, b1, b2, h, mask, trigger);
 }
+
+uint64_t
+_gear_run_until_base(uint32_t *idx, uint32_t max_idx, const uint64_t *table, const uint8_t *buf,
+                     uint64_t h, uint64_t mask);
+uint64_t
+_gear_run_until(uint32_t *idx, uint32_t max_idx, const uint64_t *table, const uint8_t *buf,
+                uint64_t h, uint64_t mask)
+{
+        return _gear_run_until_base(idx, max_idx, table, buf, h, mask);
+}
+
+struct isal_rh_state2;
+
+uint32_t
+_rolling_hash2_multi_run_until_base(struct isal_rh_state2 **state, const uint8_t **buf,
+                                    const uint32_t num, const uint32_t len, uint64_t *hash,
+                                    const uint64_t mask, const uint64_t trigger, uint32_t *hits);
+uint32_t
+_rolling_hash2_multi_run_until(struct isal_rh_state2 **state, const uint8_t **buf,
+                               const uint32_t num, const uint32_t len, uint64_t *hash,
+                               const uint64_t mask, const uint64_t trigger, uint32_t *hits)
+{
+        return _rolling_hash2_multi_run_until_base(state, buf, num, len, hash, mask, trigger,
+                                                   hits);
+}
@@ -0,0 +1,330 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <string.h>
+#include "rolling_hashx.h"
+#include "rolling_hashx_internal.h"
+#include "isal_crypto_api.h"
+
+extern uint64_t rolling_hash2_table1[256];
+
+extern uint64_t
+_gear_run_until(uint32_t *idx, uint32_t max_idx, const uint64_t *table, const uint8_t *buf,
+                uint64_t h, uint64_t mask);
+
+uint64_t
+_gear_run_until_base(uint32_t *idx, uint32_t max_idx, const uint64_t *table, const uint8_t *buf,
+                     uint64_t h, uint64_t mask)
+{
+        uint32_t i = *idx;
+
+        for (; i < max_idx; i++) {
+                h = (h << 1) + table[buf[i]];
+                if ((h & mask) == 0)
+                        break;
+        }
+        *idx = i;
+        return h;
+}
+
+#ifndef FIPS_MODE
+/*
+ * Save the tail of a buffer that ended inside the skipped minimum region of a chunk. The
+ * history only needs to be correct once the chunk reaches min_size, when the window ending
+ * there may start in an earlier buffer.
+ */
+static void
+chunker_save_tail(struct isal_rh_state2 *state, const uint8_t *buffer, uint64_t len)
+{
+        uint32_t w = state->w;
+        uint32_t n = len < w ? (uint32_t) len : w;
+
+        _rolling_hash2_save_history(state);
+        memmove(state->history, state->history + n, w - n);
+        memcpy(state->history + w - n, buffer + len - n, n);
+}
+
+/*
+ * Seed the rolling hash with the w bytes before pos. When pos < w part of that window comes
+ * from the history saved by chunker_save_tail(); min_size >= w guarantees those bytes belong
+ * to the current chunk.
+ */
+static void
+chunker_seed(struct isal_rh_state2 *state, const uint8_t *buffer, uint64_t pos)
+{
+        uint8_t window[ISAL_FINGERPRINT_MAX_WINDOW];
+        uint32_t w = state->w;
+        uint32_t p;
+
+        if (pos >= w) {
+                _rolling_hash2_reset_ref(state, buffer + pos - w);
+                return;
+        }
+        p = (uint32_t) pos;
+        memcpy(window, state->history + p, w - p);
+        memcpy(window + w - p, buffer, p);
+        _rolling_hash2_reset(state, window);
+}
+
+static uint32_t
+_chunker_run_rh2(struct isal_chunker *chunker, const uint8_t *buffer, uint64_t len,
+                 uint64_t *cuts, uint32_t max_cuts, uint64_t *consumed)
+{
+        struct isal_rh_state2 *state = &chunker->state;
+        const uint32_t min_size = chunker->min_size;
+        const uint32_t max_size = chunker->max_size;
+        uint32_t chunk_len = chunker->chunk_len;
+        uint32_t n = 0, limit, offset;
+        uint64_t pos = 0;
+        int ret;
+
+        while (pos < len && n < max_cuts) {
+                if (chunk_len < min_size) {
+                        // Skip the minimum region without hashing it
+                        if (len - pos < min_size - chunk_len) {
+                                chunk_len += (uint32_t) (len - pos);
+                                chunker_save_tail(state, buffer, len);
+                                pos = len;
+                                break;
+                        }
+                        pos += min_size - chunk_len;
+                        chunk_len = min_size;
+
+                        if (chunk_len == max_size) {
+                                cuts[n++] = pos;
+                                chunk_len = 0;
+                                continue;
+                        }
+                        chunker_seed(state, buffer, pos);
+                }
+
+                limit = max_size - chunk_len;
+                if (len - pos < limit)
+                        limit = (uint32_t) (len - pos);
+
+                ret = _rolling_hash2_run_ref(state, (uint8_t *) buffer + pos, limit,
+                                             chunker->mask, chunker->trigger, &offset);
+                pos += offset;
+                chunk_len += offset;
+
+                if (ret == ISAL_FINGERPRINT_RET_HIT || chunk_len == max_size) {
+                        cuts[n++] = pos;
+                        chunk_len = 0;
+                }
+        }
+
+        // The window history may point into buffer, which the caller is free to reuse
+        _rolling_hash2_save_history(state);
+        chunker->chunk_len = chunk_len;
+        *consumed = pos;
+        return n;
+}
+
+static uint32_t
+_chunker_run_gear(struct isal_chunker *chunker, const uint8_t *buffer, uint64_t len,
+                  uint64_t *cuts, uint32_t max_cuts, uint64_t *consumed)
+{
+        const uint32_t min_size = chunker->min_size;
+        const uint32_t avg_size = chunker->avg_size;
+        const uint32_t max_size = chunker->max_size;
+        uint32_t chunk_len = chunker->chunk_len;
+        uint64_t h = chunker->state.hash;
+        uint64_t pos = 0, mask;
+        uint32_t n = 0, limit, i;
+
+        while (pos < len && n < max_cuts) {
+                if (chunk_len < min_size) {
+                        // Skip the minimum region, the hash starts from zero after it
+                        if (len - pos < min_size - chunk_len) {
+                                chunk_len += (uint32_t) (len - pos);
+                                pos = len;
+                                break;
+                        }
+                        pos += min_size - chunk_len;
+                        chunk_len = min_size;
+
+                        if (chunk_len == max_size) {
+                                cuts[n++] = pos;
+                                chunk_len = 0;
+                                h = 0;
+                                continue;
+                        }
+                }
+
+                // Normalized chunking, harder mask before avg_size and easier one after
+                if (chunk_len < avg_size) {
+                        limit = avg_size - chunk_len;
+                        mask = chunker->gear_mask_s;
+                } else {
+                        limit = max_size - chunk_len;
+                        mask = chunker->gear_mask_l;
+                }
+                if (len - pos < limit)
+                        limit = (uint32_t) (len - pos);
+
+                i = 0;
+                h = _gear_run_until(&i, limit, rolling_hash2_table1, buffer + pos, h, mask);
+                if (i < limit) {
+                        pos += i + 1;
+                        cuts[n++] = pos;
+                        chunk_len = 0;
+                        h = 0;
+                        continue;
+                }
+                pos += limit;
+                chunk_len += limit;
+                if (chunk_len == max_size) {
+                        cuts[n++] = pos;
+                        chunk_len = 0;
+                        h = 0;
+                }
+        }
+
+        chunker->state.hash = h;
+        chunker->chunk_len = chunk_len;
+        *consumed = pos;
+        return n;
+}
+
+static uint64_t
+gear_mask(int bits)
+{
+        if (bits < 1)
+                bits = 1;
+        if (bits > 63)
+                bits = 63;
+
+        // High bits depend on the most bytes of input
+        return ~0ULL << (64 - bits);
+}
+#endif /* !FIPS_MODE */
+
+int
+isal_chunker_init(struct isal_chunker *chunker, const uint32_t w, const uint32_t min_size,
+                  const uint32_t avg_size, const uint32_t max_size)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        if (chunker == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+        if (w == 0 || _rolling_hash2_init(&chunker->state, w) < 0)
+                return ISAL_CRYPTO_ERR_WINDOW_SIZE;
+
+        if (min_size < w || avg_size < min_size || max_size < avg_size)
+                return ISAL_CRYPTO_ERR_CHUNK_SIZE;
+
+        chunker->algo = ISAL_CHUNKER_RH2;
+        chunker->min_size = min_size;
+        chunker->avg_size = avg_size;
+        chunker->max_size = max_size;
+        chunker->mask = _rolling_hashx_mask_gen((long) (avg_size - min_size), 0);
+        chunker->trigger = 0;
+        chunker->chunk_len = 0;
+
+        return 0;
+#endif
+}
+
+int
+isal_chunker_init_gear(struct isal_chunker *chunker, const uint32_t min_size,
+                       const uint32_t avg_size, const uint32_t max_size)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+        int bits = 0;
+
+#ifdef SAFE_PARAM
+        if (chunker == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+        if (avg_size < 8 || avg_size < min_size || max_size < avg_size)
+                return ISAL_CRYPTO_ERR_CHUNK_SIZE;
+
+        while ((avg_size >> bits) > 1)
+                bits++;
+
+        chunker->algo = ISAL_CHUNKER_GEAR;
+        chunker->min_size = min_size;
+        chunker->avg_size = avg_size;
+        chunker->max_size = max_size;
+        chunker->gear_mask_s = gear_mask(bits + 2);
+        chunker->gear_mask_l = gear_mask(bits - 2);
+        chunker->state.hash = 0;
+        chunker->chunk_len = 0;
+
+        return 0;
+#endif
+}
+
+int
+isal_chunker_reset(struct isal_chunker *chunker)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        if (chunker == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+        chunker->chunk_len = 0;
+        chunker->state.hash = 0;
+
+        return 0;
+#endif
+}
+
+int
+isal_chunker_run(struct isal_chunker *chunker, const uint8_t *buffer, const uint64_t len,
+                 uint64_t *cuts, const uint32_t max_cuts, uint32_t *num_cuts, uint64_t *consumed)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        if (chunker == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (buffer == NULL && len != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        if (cuts == NULL && max_cuts != 0)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+        if (num_cuts == NULL || consumed == NULL)
+                return ISAL_CRYPTO_ERR_NULL_OFFSET;
+#endif
+        if (chunker->algo == ISAL_CHUNKER_GEAR)
+                *num_cuts = _chunker_run_gear(chunker, buffer, len, cuts, max_cuts, consumed);
+        else
+                *num_cuts = _chunker_run_rh2(chunker, buffer, len, cuts, max_cuts, consumed);
+
+        return 0;
+#endif
+}
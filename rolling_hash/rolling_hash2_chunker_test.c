@@ -0,0 +1,336 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "isal_crypto_api.h"
+#include "rolling_hashx.h"
+
+// Gear hash uses the rolling_hash2 table, keep a private copy for the reference
+#define rolling_hash2_table1 gear_table
+#include "rolling_hash2_table.h"
+
+#define TEST_LEN  (1024 * 1024)
+#define MAX_CUTS  (TEST_LEN / ISAL_FINGERPRINT_MAX_WINDOW + 1)
+#define MAX_PIECE 8192
+
+#ifndef RANDOMS
+#define RANDOMS 30
+#endif
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+#ifndef FIPS_MODE
+static uint64_t
+rolling_hash2_ref(struct isal_rh_state2 *state, const uint8_t *p, int len)
+{
+        int i;
+        uint64_t h = 0;
+
+        for (i = 0; i < len; i++) {
+                h = (h << 1) | (h >> (64 - 1));
+                h ^= state->table1[*p++];
+        }
+        return h;
+}
+
+/*
+ * Reference chunker, rehashes the whole window at every candidate boundary after min_size.
+ */
+static uint32_t
+chunker_ref(struct isal_chunker *chunker, const uint8_t *buf, uint64_t len, uint64_t *cuts)
+{
+        uint32_t w = chunker->state.w;
+        uint64_t start = 0, end;
+        uint32_t n = 0;
+        uint64_t h;
+
+        while (start + chunker->min_size <= len) {
+                end = start + chunker->min_size;
+                if (chunker->min_size < chunker->max_size) {
+                        for (end++; end <= len; end++) {
+                                h = rolling_hash2_ref(&chunker->state, buf + end - w, w);
+                                if ((h & chunker->mask) == chunker->trigger)
+                                        break;
+                                if (end - start == chunker->max_size)
+                                        break;
+                        }
+                        if (end > len)
+                                break;
+                }
+                cuts[n++] = end;
+                start = end;
+        }
+        return n;
+}
+
+/*
+ * Reference Gear chunker, FastCDC with normalized chunking.
+ */
+static uint32_t
+chunker_gear_ref(struct isal_chunker *chunker, const uint8_t *buf, uint64_t len, uint64_t *cuts)
+{
+        uint64_t start = 0, end, mask, h;
+        uint32_t n = 0;
+        int cut;
+
+        while (start + chunker->min_size <= len) {
+                end = start + chunker->min_size;
+                cut = (chunker->min_size == chunker->max_size);
+                h = 0;
+                while (!cut && end < len) {
+                        mask = (end - start < chunker->avg_size) ? chunker->gear_mask_s
+                                                                 : chunker->gear_mask_l;
+                        h = (h << 1) + gear_table[buf[end++]];
+                        if ((h & mask) == 0 || end - start == chunker->max_size)
+                                cut = 1;
+                }
+                if (!cut)
+                        break;
+                cuts[n++] = end;
+                start = end;
+        }
+        return n;
+}
+
+static int
+check_cuts(const char *name, uint64_t *ref, uint32_t n_ref, uint64_t *fut, uint32_t n_fut)
+{
+        uint32_t i;
+
+        if (n_ref != n_fut) {
+                printf("\n%s: found %u cuts, expected %u\n", name, n_fut, n_ref);
+                return 1;
+        }
+        for (i = 0; i < n_ref; i++) {
+                if (ref[i] != fut[i]) {
+                        printf("\n%s: cut %u at %llu, expected %llu\n", name, i,
+                               (unsigned long long) fut[i], (unsigned long long) ref[i]);
+                        return 1;
+                }
+        }
+        return 0;
+}
+
+/*
+ * Run the chunker over buf in pieces of random length up to max_piece, with at most
+ * max_cuts boundaries returned per call, collecting the cuts relative to buf.
+ */
+static int
+chunker_pieces(struct isal_chunker *chunker, const uint8_t *buf, uint64_t len, uint64_t *cuts,
+               uint32_t max_piece, uint32_t max_cuts, uint32_t *n_cuts)
+{
+        uint64_t pos = 0, piece, consumed, i;
+        uint32_t n = 0, found;
+        int ret;
+
+        while (pos < len) {
+                piece = (max_piece > 1) ? rand() % max_piece : max_piece;
+                if (piece > len - pos)
+                        piece = len - pos;
+
+                ret = isal_chunker_run(chunker, buf + pos, piece, cuts + n, max_cuts, &found,
+                                       &consumed);
+                if (ret != ISAL_CRYPTO_ERR_NONE) {
+                        printf("\nisal_chunker_run returned error %d\n", ret);
+                        return 1;
+                }
+                if (consumed > piece || (consumed < piece && found != max_cuts)) {
+                        printf("\nisal_chunker_run consumed %llu of %llu bytes\n",
+                               (unsigned long long) consumed, (unsigned long long) piece);
+                        return 1;
+                }
+                for (i = 0; i < found; i++)
+                        cuts[n + i] += pos;
+                n += found;
+                pos += consumed;
+        }
+        *n_cuts = n;
+        return 0;
+}
+#endif
+
+int
+main(void)
+{
+#ifndef FIPS_MODE
+        struct isal_chunker chunker;
+        uint8_t *buffer = NULL;
+        uint64_t *ref_cuts = NULL, *cuts = NULL;
+        uint32_t w, min_size, avg_size, max_size, n_ref, n_fut;
+        uint64_t consumed;
+        int i, r, ret, errors = 0;
+
+        printf("isal_chunker_run test: ");
+
+        buffer = malloc(TEST_LEN);
+        ref_cuts = malloc(MAX_CUTS * sizeof(uint64_t));
+        cuts = malloc(MAX_CUTS * sizeof(uint64_t));
+        if (buffer == NULL || ref_cuts == NULL || cuts == NULL) {
+                printf("cannot allocate mem\n");
+                errors++;
+                goto end;
+        }
+        srand(TEST_SEED);
+        for (i = 0; i < TEST_LEN; i++)
+                buffer[i] = rand();
+
+        // Test case 1, whole buffer in one call against reference
+        ret = isal_chunker_init(&chunker, 32, 1024, 4096, 16384);
+        if (ret != ISAL_CRYPTO_ERR_NONE) {
+                printf("isal_chunker_init returned error %d\n", ret);
+                errors++;
+                goto end;
+        }
+        n_ref = chunker_ref(&chunker, buffer, TEST_LEN, ref_cuts);
+        ret = isal_chunker_run(&chunker, buffer, TEST_LEN, cuts, MAX_CUTS, &n_fut, &consumed);
+        if (ret != ISAL_CRYPTO_ERR_NONE || consumed != TEST_LEN) {
+                printf("isal_chunker_run returned error %d\n", ret);
+                errors++;
+                goto end;
+        }
+        errors += check_cuts("case 1", ref_cuts, n_ref, cuts, n_fut);
+        if (errors)
+                goto end;
+        putchar('.');
+
+        // Test case 2, same stream fed in small pieces, including pieces shorter than w
+        isal_chunker_reset(&chunker);
+        errors += chunker_pieces(&chunker, buffer, TEST_LEN, cuts, 64, MAX_CUTS, &n_fut);
+        errors += check_cuts("case 2", ref_cuts, n_ref, cuts, n_fut);
+        if (errors)
+                goto end;
+        putchar('.');
+
+        // Test case 3, limited output array
+        isal_chunker_reset(&chunker);
+        errors += chunker_pieces(&chunker, buffer, TEST_LEN, cuts, MAX_PIECE, 1, &n_fut);
+        errors += check_cuts("case 3", ref_cuts, n_ref, cuts, n_fut);
+        if (errors)
+                goto end;
+        putchar('.');
+
+        // Test case 4, min == max gives fixed size chunks
+        isal_chunker_init(&chunker, 16, 1000, 1000, 1000);
+        errors += chunker_pieces(&chunker, buffer, TEST_LEN, cuts, MAX_PIECE, MAX_CUTS, &n_fut);
+        n_ref = chunker_ref(&chunker, buffer, TEST_LEN, ref_cuts);
+        errors += check_cuts("case 4", ref_cuts, n_ref, cuts, n_fut);
+        if (errors)
+                goto end;
+        putchar('.');
+
+        // Test case 5, random parameters and piece sizes
+        for (r = 0; r < RANDOMS; r++) {
+                w = 1 + rand() % ISAL_FINGERPRINT_MAX_WINDOW;
+                min_size = ISAL_FINGERPRINT_MAX_WINDOW + rand() % 2048;
+                avg_size = min_size + rand() % 4096;
+                max_size = avg_size + rand() % 8192;
+
+                ret = isal_chunker_init(&chunker, w, min_size, avg_size, max_size);
+                if (ret != ISAL_CRYPTO_ERR_NONE) {
+                        printf("\nisal_chunker_init returned error %d\n", ret);
+                        errors++;
+                        goto end;
+                }
+                n_ref = chunker_ref(&chunker, buffer, TEST_LEN, ref_cuts);
+                errors += chunker_pieces(&chunker, buffer, TEST_LEN, cuts, 1 + rand() % MAX_PIECE,
+                                         1 + rand() % 4, &n_fut);
+                if (check_cuts("case 5", ref_cuts, n_ref, cuts, n_fut)) {
+                        printf("  w=%u min=%u avg=%u max=%u\n", w, min_size, avg_size, max_size);
+                        errors++;
+                }
+                if (errors)
+                        goto end;
+                putchar('.');
+        }
+
+        // Test case 6, Gear chunker whole buffer and in pieces against reference
+        ret = isal_chunker_init_gear(&chunker, 2048, 8192, 65536);
+        if (ret != ISAL_CRYPTO_ERR_NONE) {
+                printf("\nisal_chunker_init_gear returned error %d\n", ret);
+                errors++;
+                goto end;
+        }
+        n_ref = chunker_gear_ref(&chunker, buffer, TEST_LEN, ref_cuts);
+        ret = isal_chunker_run(&chunker, buffer, TEST_LEN, cuts, MAX_CUTS, &n_fut, &consumed);
+        if (ret != ISAL_CRYPTO_ERR_NONE || consumed != TEST_LEN) {
+                printf("\nisal_chunker_run returned error %d\n", ret);
+                errors++;
+                goto end;
+        }
+        errors += check_cuts("case 6", ref_cuts, n_ref, cuts, n_fut);
+        isal_chunker_reset(&chunker);
+        errors += chunker_pieces(&chunker, buffer, TEST_LEN, cuts, 64, MAX_CUTS, &n_fut);
+        errors += check_cuts("case 6 pieces", ref_cuts, n_ref, cuts, n_fut);
+        if (errors)
+                goto end;
+        putchar('.');
+
+        // Test case 7, Gear chunker with random parameters and piece sizes
+        for (r = 0; r < RANDOMS; r++) {
+                avg_size = 2 * ISAL_FINGERPRINT_MAX_WINDOW + rand() % 8192;
+                min_size = ISAL_FINGERPRINT_MAX_WINDOW + rand() % (avg_size / 2);
+                max_size = avg_size + rand() % 16384;
+
+                ret = isal_chunker_init_gear(&chunker, min_size, avg_size, max_size);
+                if (ret != ISAL_CRYPTO_ERR_NONE) {
+                        printf("\nisal_chunker_init_gear returned error %d\n", ret);
+                        errors++;
+                        goto end;
+                }
+                n_ref = chunker_gear_ref(&chunker, buffer, TEST_LEN, ref_cuts);
+                errors += chunker_pieces(&chunker, buffer, TEST_LEN, cuts, 1 + rand() % MAX_PIECE,
+                                         1 + rand() % 4, &n_fut);
+                if (check_cuts("case 7", ref_cuts, n_ref, cuts, n_fut)) {
+                        printf("  min=%u avg=%u max=%u\n", min_size, avg_size, max_size);
+                        errors++;
+                }
+                if (errors)
+                        goto end;
+                putchar('.');
+        }
+
+end:
+        free(buffer);
+        free(ref_cuts);
+        free(cuts);
+
+        if (errors > 0)
+                printf(" Fail: %d\n", errors);
+        else
+                printf(" Pass\n");
+        return errors;
+#else
+        printf("FIPS Mode enabled. Test not run\n");
+
+        return 0;
+#endif
+}
@@ -0,0 +1,172 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <string.h>
+#include "rolling_hashx.h"
+#include "rolling_hashx_internal.h"
+#include "isal_crypto_api.h"
+
+extern uint32_t
+_rolling_hash2_multi_run_until(struct isal_rh_state2 **state, const uint8_t **buf,
+                               const uint32_t num, const uint32_t len, uint64_t *hash,
+                               const uint64_t mask, const uint64_t trigger, uint32_t *hits);
+
+/*
+ * Advance num streams together over len bytes, reading the byte leaving the window of stream j
+ * at buf[j] - w. Stops after the first byte where the hash of any stream matches, returning the
+ * number of bytes processed and the streams that matched there as a bit mask in hits.
+ */
+uint32_t
+_rolling_hash2_multi_run_until_base(struct isal_rh_state2 **state, const uint8_t **buf,
+                                    const uint32_t num, const uint32_t len, uint64_t *hash,
+                                    const uint64_t mask, const uint64_t trigger, uint32_t *hits)
+{
+        uint32_t i, j, m;
+        uint64_t h;
+
+        for (i = 0; i < len; i++) {
+                m = 0;
+                for (j = 0; j < num; j++) {
+                        h = hash[j];
+                        h = (h << 1) | (h >> (64 - 1));
+                        h ^= state[j]->table1[buf[j][i]] ^
+                             state[j]->table2[*(buf[j] + i - state[j]->w)];
+                        hash[j] = h;
+                        if ((h & mask) == trigger)
+                                m |= 1 << j;
+                }
+                if (m != 0) {
+                        *hits = m;
+                        return i + 1;
+                }
+        }
+        *hits = 0;
+        return len;
+}
+
+#ifndef FIPS_MODE
+static void
+_rolling_hash2_run_multi(struct isal_rh_state2 **state, const uint8_t **buffer,
+                         const uint32_t *max_len, const uint32_t num, const uint32_t mask,
+                         const uint32_t trigger, uint32_t *offset, int *match)
+{
+        struct isal_rh_state2 *lane_state[ISAL_ROLLING_HASH2_MAX_STREAMS];
+        const uint8_t *lane_buf[ISAL_ROLLING_HASH2_MAX_STREAMS];
+        uint64_t lane_hash[ISAL_ROLLING_HASH2_MAX_STREAMS];
+        uint32_t lane[ISAL_ROLLING_HASH2_MAX_STREAMS];
+        uint32_t i, j, w, len, n, hits;
+
+        /*
+         * The first w bytes of each buffer hash against the window history, run them one
+         * stream at a time. Streams that go on from there read the window from their buffer.
+         */
+        n = 0;
+        len = UINT32_MAX;
+        for (j = 0; j < num; j++) {
+                w = state[j]->w;
+                match[j] = _rolling_hash2_run_ref(state[j], (uint8_t *) buffer[j],
+                                                  max_len[j] < w ? max_len[j] : w, mask, trigger,
+                                                  &offset[j]);
+                if (match[j] == ISAL_FINGERPRINT_RET_HIT || offset[j] == max_len[j]) {
+                        _rolling_hash2_save_history(state[j]);
+                        continue;
+                }
+
+                /*
+                 * The kernel only reads w and the tables from the state, which depend on w
+                 * alone. Streams with the same window share one copy to keep the lookups in L1.
+                 */
+                lane[n] = j;
+                lane_state[n] = state[j];
+                for (i = 0; i < n; i++) {
+                        if (lane_state[i]->w == w) {
+                                lane_state[n] = lane_state[i];
+                                break;
+                        }
+                }
+                lane_buf[n] = buffer[j] + w;
+                lane_hash[n] = state[j]->hash;
+                if (max_len[j] - w < len)
+                        len = max_len[j] - w;
+                n++;
+        }
+        if (n == 0)
+                return;
+
+        len = _rolling_hash2_multi_run_until(lane_state, lane_buf, n, len, lane_hash, mask,
+                                             trigger, &hits);
+
+        for (i = 0; i < n; i++) {
+                j = lane[i];
+                w = state[j]->w;
+                offset[j] += len;
+                match[j] = (hits >> i) & 1 ? ISAL_FINGERPRINT_RET_HIT : ISAL_FINGERPRINT_RET_MAX;
+                memcpy(state[j]->history, buffer[j] + offset[j] - w, w);
+                state[j]->history_ref = NULL;
+                state[j]->hash = lane_hash[i];
+        }
+}
+#endif /* !FIPS_MODE */
+
+int
+isal_rolling_hash2_run_multi(struct isal_rh_state2 *state[], const uint8_t *buffer[],
+                             const uint32_t max_len[], const uint32_t num_streams,
+                             const uint32_t mask, const uint32_t trigger, uint32_t offset[],
+                             int match[])
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+#ifdef SAFE_PARAM
+        uint32_t j;
+#endif
+        if (num_streams == 0 || num_streams > ISAL_ROLLING_HASH2_MAX_STREAMS)
+                return ISAL_CRYPTO_ERR_NUM_STREAMS;
+#ifdef SAFE_PARAM
+        if (state == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (buffer == NULL || max_len == NULL)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        if (offset == NULL)
+                return ISAL_CRYPTO_ERR_NULL_OFFSET;
+        if (match == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MATCH;
+        for (j = 0; j < num_streams; j++) {
+                if (state[j] == NULL)
+                        return ISAL_CRYPTO_ERR_NULL_CTX;
+                if (buffer[j] == NULL)
+                        return ISAL_CRYPTO_ERR_NULL_SRC;
+        }
+#endif
+        _rolling_hash2_run_multi(state, buffer, max_len, num_streams, mask, trigger, offset,
+                                 match);
+
+        return 0;
+#endif
+}
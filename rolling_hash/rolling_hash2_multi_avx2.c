@@ -0,0 +1,217 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__ICC)
+#pragma intel optimization_parameter target_arch = CORE-AVX2
+#elif defined(__ICL)
+#pragma[intel] optimization_parameter target_arch = CORE-AVX2
+#elif (__GNUC__ >= 5)
+#pragma GCC target("avx2")
+#endif
+
+#include <stdint.h>
+#include <immintrin.h>
+#include "rolling_hashx.h"
+
+// The stream loop below must be inlined for each register count to keep its state in registers
+#if defined(__GNUC__)
+#define FORCE_INLINE static inline __attribute__((always_inline))
+#else
+#define FORCE_INLINE static __forceinline
+#endif
+
+/*
+ * Multi-stream rolling hash, 4 streams per ymm register. Same scheme as the AVX512 version:
+ * qword gathers fetch 8 input bytes per stream at a time and the table lookups are gathers
+ * indexed by table address plus byte value. Streams past num repeat stream 0.
+ */
+
+uint32_t
+_rolling_hash2_multi_run_until_base(struct isal_rh_state2 **state, const uint8_t **buf,
+                                    const uint32_t num, const uint32_t len, uint64_t *hash,
+                                    const uint64_t mask, const uint64_t trigger, uint32_t *hits);
+
+FORCE_INLINE __m256i
+hash_step(__m256i h, __m256i *q_new, __m256i *q_old, const __m256i t1, const __m256i t2)
+{
+        const __m256i byte_mask = _mm256_set1_epi64x(0xff);
+        __m256i g1, g2;
+
+        g1 = _mm256_i64gather_epi64(
+                NULL, _mm256_add_epi64(t1, _mm256_and_si256(*q_new, byte_mask)), 8);
+        g2 = _mm256_i64gather_epi64(
+                NULL, _mm256_add_epi64(t2, _mm256_and_si256(*q_old, byte_mask)), 8);
+        *q_new = _mm256_srli_epi64(*q_new, 8);
+        *q_old = _mm256_srli_epi64(*q_old, 8);
+        h = _mm256_or_si256(_mm256_slli_epi64(h, 1), _mm256_srli_epi64(h, 64 - 1));
+
+        return _mm256_xor_si256(h, _mm256_xor_si256(g1, g2));
+}
+
+FORCE_INLINE uint32_t
+hit_mask(const __m256i h, const __m256i vmask, const __m256i vtrigger)
+{
+        __m256i eq = _mm256_cmpeq_epi64(_mm256_and_si256(h, vmask), vtrigger);
+
+        return (uint32_t) _mm256_movemask_pd(_mm256_castsi256_pd(eq));
+}
+
+FORCE_INLINE __m256i
+load_qwords(const __m256i p, const __m256i pos)
+{
+        return _mm256_i64gather_epi64(NULL, _mm256_add_epi64(p, pos), 1);
+}
+
+FORCE_INLINE uint32_t
+multi_run_until(const int nv, struct isal_rh_state2 **state, const uint8_t **buf,
+                const uint32_t num, const uint32_t len, uint64_t *hash, const uint64_t mask,
+                const uint64_t trigger, uint32_t *hits)
+{
+        const __m256i vmask = _mm256_set1_epi64x((long long) mask);
+        const __m256i vtrigger = _mm256_set1_epi64x((long long) trigger);
+        const uint32_t active = (1 << num) - 1;
+        uint64_t a_new[16], a_old[16], a_t1[16], a_t2[16], a_h[16];
+        const uint8_t *tail_buf[16];
+        __m256i h0, p_new0, p_old0, t1_0, t2_0, q_new0, q_old0;
+        __m256i h1, p_new1, p_old1, t1_1, t2_1, q_new1, q_old1;
+        __m256i h2, p_new2, p_old2, t1_2, t2_2, q_new2, q_old2;
+        __m256i h3, p_new3, p_old3, t1_3, t2_3, q_new3, q_old3;
+        __m256i pos;
+        uint32_t i, j, s, m;
+
+        for (j = 0; j < 16; j++) {
+                i = j < num ? j : 0;
+                a_new[j] = (uint64_t) (uintptr_t) buf[i];
+                a_old[j] = (uint64_t) (uintptr_t) (buf[i] - state[i]->w);
+                a_t1[j] = (uint64_t) (uintptr_t) state[i]->table1 / 8;
+                a_t2[j] = (uint64_t) (uintptr_t) state[i]->table2 / 8;
+                a_h[j] = hash[i];
+        }
+        p_new0 = _mm256_loadu_si256((const __m256i *) &a_new[0]);
+        p_old0 = _mm256_loadu_si256((const __m256i *) &a_old[0]);
+        t1_0 = _mm256_loadu_si256((const __m256i *) &a_t1[0]);
+        t2_0 = _mm256_loadu_si256((const __m256i *) &a_t2[0]);
+        h0 = _mm256_loadu_si256((const __m256i *) &a_h[0]);
+        p_new1 = _mm256_loadu_si256((const __m256i *) &a_new[4]);
+        p_old1 = _mm256_loadu_si256((const __m256i *) &a_old[4]);
+        t1_1 = _mm256_loadu_si256((const __m256i *) &a_t1[4]);
+        t2_1 = _mm256_loadu_si256((const __m256i *) &a_t2[4]);
+        h1 = _mm256_loadu_si256((const __m256i *) &a_h[4]);
+        p_new2 = _mm256_loadu_si256((const __m256i *) &a_new[8]);
+        p_old2 = _mm256_loadu_si256((const __m256i *) &a_old[8]);
+        t1_2 = _mm256_loadu_si256((const __m256i *) &a_t1[8]);
+        t2_2 = _mm256_loadu_si256((const __m256i *) &a_t2[8]);
+        h2 = _mm256_loadu_si256((const __m256i *) &a_h[8]);
+        p_new3 = _mm256_loadu_si256((const __m256i *) &a_new[12]);
+        p_old3 = _mm256_loadu_si256((const __m256i *) &a_old[12]);
+        t1_3 = _mm256_loadu_si256((const __m256i *) &a_t1[12]);
+        t2_3 = _mm256_loadu_si256((const __m256i *) &a_t2[12]);
+        h3 = _mm256_loadu_si256((const __m256i *) &a_h[12]);
+        q_new1 = q_old1 = h1;
+        q_new2 = q_old2 = h2;
+        q_new3 = q_old3 = h3;
+
+        for (i = 0; i + 8 <= len; i += 8) {
+                pos = _mm256_set1_epi64x(i);
+                q_new0 = load_qwords(p_new0, pos);
+                q_old0 = load_qwords(p_old0, pos);
+                if (nv > 1) {
+                        q_new1 = load_qwords(p_new1, pos);
+                        q_old1 = load_qwords(p_old1, pos);
+                }
+                if (nv > 2) {
+                        q_new2 = load_qwords(p_new2, pos);
+                        q_old2 = load_qwords(p_old2, pos);
+                }
+                if (nv > 3) {
+                        q_new3 = load_qwords(p_new3, pos);
+                        q_old3 = load_qwords(p_old3, pos);
+                }
+                for (s = 0; s < 8; s++) {
+                        h0 = hash_step(h0, &q_new0, &q_old0, t1_0, t2_0);
+                        m = hit_mask(h0, vmask, vtrigger);
+                        if (nv > 1) {
+                                h1 = hash_step(h1, &q_new1, &q_old1, t1_1, t2_1);
+                                m |= hit_mask(h1, vmask, vtrigger) << 4;
+                        }
+                        if (nv > 2) {
+                                h2 = hash_step(h2, &q_new2, &q_old2, t1_2, t2_2);
+                                m |= hit_mask(h2, vmask, vtrigger) << 8;
+                        }
+                        if (nv > 3) {
+                                h3 = hash_step(h3, &q_new3, &q_old3, t1_3, t2_3);
+                                m |= hit_mask(h3, vmask, vtrigger) << 12;
+                        }
+                        if (m & active) {
+                                *hits = m & active;
+                                i += s + 1;
+                                goto done;
+                        }
+                }
+        }
+        *hits = 0;
+
+done:
+        _mm256_storeu_si256((__m256i *) &a_h[0], h0);
+        _mm256_storeu_si256((__m256i *) &a_h[4], h1);
+        _mm256_storeu_si256((__m256i *) &a_h[8], h2);
+        _mm256_storeu_si256((__m256i *) &a_h[12], h3);
+        for (j = 0; j < num; j++) {
+                hash[j] = a_h[j];
+                tail_buf[j] = buf[j] + i;
+        }
+        if (*hits != 0 || i == len)
+                return i;
+
+        return i + _rolling_hash2_multi_run_until_base(state, tail_buf, num, len - i, hash, mask,
+                                                       trigger, hits);
+}
+
+uint32_t
+_rolling_hash2_multi_run_until_avx2(struct isal_rh_state2 **state, const uint8_t **buf,
+                                    const uint32_t num, const uint32_t len, uint64_t *hash,
+                                    const uint64_t mask, const uint64_t trigger, uint32_t *hits)
+{
+        switch ((num + 3) / 4) {
+        case 1:
+                return multi_run_until(1, state, buf, num, len, hash, mask, trigger, hits);
+        case 2:
+                return multi_run_until(2, state, buf, num, len, hash, mask, trigger, hits);
+        case 3:
+                return multi_run_until(3, state, buf, num, len, hash, mask, trigger, hits);
+        default:
+                return multi_run_until(4, state, buf, num, len, hash, mask, trigger, hits);
+        }
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
@@ -0,0 +1,180 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,avx512f"))), apply_to = function)
+#elif defined(__ICC)
+#pragma intel optimization_parameter target_arch = CORE-AVX512
+#elif defined(__ICL)
+#pragma[intel] optimization_parameter target_arch = CORE-AVX512
+#elif (__GNUC__ >= 5)
+#pragma GCC target("avx2,avx512f")
+#endif
+
+#include <stdint.h>
+#include <immintrin.h>
+#include "rolling_hashx.h"
+
+// The stream loop below must be inlined for each register count to keep its state in registers
+#if defined(__GNUC__)
+#define FORCE_INLINE static inline __attribute__((always_inline))
+#else
+#define FORCE_INLINE static __forceinline
+#endif
+
+/*
+ * Multi-stream rolling hash, 8 streams per zmm register.
+ *
+ * Every 8 bytes, one qword gather per register fetches the next 8 input bytes of each stream
+ * and another the 8 bytes leaving each window. The per-byte table lookups are gathers indexed
+ * by the absolute address of each stream's table plus the byte value, so streams may use
+ * different window sizes. Streams past num repeat stream 0 and are dropped from the hit mask.
+ */
+
+uint32_t
+_rolling_hash2_multi_run_until_base(struct isal_rh_state2 **state, const uint8_t **buf,
+                                    const uint32_t num, const uint32_t len, uint64_t *hash,
+                                    const uint64_t mask, const uint64_t trigger, uint32_t *hits);
+
+FORCE_INLINE __m512i
+hash_step(__m512i h, __m512i *q_new, __m512i *q_old, const __m512i t1, const __m512i t2)
+{
+        const __m512i byte_mask = _mm512_set1_epi64(0xff);
+        __m512i g1, g2;
+
+        g1 = _mm512_i64gather_epi64(_mm512_add_epi64(t1, _mm512_and_si512(*q_new, byte_mask)),
+                                    NULL, 8);
+        g2 = _mm512_i64gather_epi64(_mm512_add_epi64(t2, _mm512_and_si512(*q_old, byte_mask)),
+                                    NULL, 8);
+        *q_new = _mm512_srli_epi64(*q_new, 8);
+        *q_old = _mm512_srli_epi64(*q_old, 8);
+
+        return _mm512_xor_si512(_mm512_rol_epi64(h, 1), _mm512_xor_si512(g1, g2));
+}
+
+FORCE_INLINE uint32_t
+hit_mask(const __m512i h, const __m512i vmask, const __m512i vtrigger)
+{
+        return (uint32_t) _mm512_cmpeq_epi64_mask(_mm512_and_si512(h, vmask), vtrigger);
+}
+
+FORCE_INLINE __m512i
+load_qwords(const __m512i p, const __m512i pos)
+{
+        return _mm512_i64gather_epi64(_mm512_add_epi64(p, pos), NULL, 1);
+}
+
+FORCE_INLINE uint32_t
+multi_run_until(const int two, struct isal_rh_state2 **state, const uint8_t **buf,
+                const uint32_t num, const uint32_t len, uint64_t *hash, const uint64_t mask,
+                const uint64_t trigger, uint32_t *hits)
+{
+        const __m512i vmask = _mm512_set1_epi64((long long) mask);
+        const __m512i vtrigger = _mm512_set1_epi64((long long) trigger);
+        const uint32_t active = (1 << num) - 1;
+        uint64_t a_new[16], a_old[16], a_t1[16], a_t2[16], a_h[16];
+        const uint8_t *tail_buf[16];
+        __m512i h0, p_new0, p_old0, t1_0, t2_0, q_new0, q_old0;
+        __m512i h1, p_new1, p_old1, t1_1, t2_1, q_new1, q_old1;
+        __m512i pos;
+        uint32_t i, j, s, m;
+
+        for (j = 0; j < 16; j++) {
+                i = j < num ? j : 0;
+                a_new[j] = (uint64_t) (uintptr_t) buf[i];
+                a_old[j] = (uint64_t) (uintptr_t) (buf[i] - state[i]->w);
+                a_t1[j] = (uint64_t) (uintptr_t) state[i]->table1 / 8;
+                a_t2[j] = (uint64_t) (uintptr_t) state[i]->table2 / 8;
+                a_h[j] = hash[i];
+        }
+        p_new0 = _mm512_loadu_si512((const void *) &a_new[0]);
+        p_old0 = _mm512_loadu_si512((const void *) &a_old[0]);
+        t1_0 = _mm512_loadu_si512((const void *) &a_t1[0]);
+        t2_0 = _mm512_loadu_si512((const void *) &a_t2[0]);
+        h0 = _mm512_loadu_si512((const void *) &a_h[0]);
+        p_new1 = _mm512_loadu_si512((const void *) &a_new[8]);
+        p_old1 = _mm512_loadu_si512((const void *) &a_old[8]);
+        t1_1 = _mm512_loadu_si512((const void *) &a_t1[8]);
+        t2_1 = _mm512_loadu_si512((const void *) &a_t2[8]);
+        h1 = _mm512_loadu_si512((const void *) &a_h[8]);
+        q_new1 = q_old1 = h1;
+
+        for (i = 0; i + 8 <= len; i += 8) {
+                pos = _mm512_set1_epi64(i);
+                q_new0 = load_qwords(p_new0, pos);
+                q_old0 = load_qwords(p_old0, pos);
+                if (two) {
+                        q_new1 = load_qwords(p_new1, pos);
+                        q_old1 = load_qwords(p_old1, pos);
+                }
+                for (s = 0; s < 8; s++) {
+                        h0 = hash_step(h0, &q_new0, &q_old0, t1_0, t2_0);
+                        m = hit_mask(h0, vmask, vtrigger);
+                        if (two) {
+                                h1 = hash_step(h1, &q_new1, &q_old1, t1_1, t2_1);
+                                m |= hit_mask(h1, vmask, vtrigger) << 8;
+                        }
+                        if (m & active) {
+                                *hits = m & active;
+                                i += s + 1;
+                                goto done;
+                        }
+                }
+        }
+        *hits = 0;
+
+done:
+        _mm512_storeu_si512((void *) &a_h[0], h0);
+        _mm512_storeu_si512((void *) &a_h[8], h1);
+        for (j = 0; j < num; j++) {
+                hash[j] = a_h[j];
+                tail_buf[j] = buf[j] + i;
+        }
+        if (*hits != 0 || i == len)
+                return i;
+
+        return i + _rolling_hash2_multi_run_until_base(state, tail_buf, num, len - i, hash, mask,
+                                                       trigger, hits);
+}
+
+uint32_t
+_rolling_hash2_multi_run_until_avx512(struct isal_rh_state2 **state, const uint8_t **buf,
+                                      const uint32_t num, const uint32_t len, uint64_t *hash,
+                                      const uint64_t mask, const uint64_t trigger,
+                                      uint32_t *hits)
+{
+        if (num <= 8)
+                return multi_run_until(0, state, buf, num, len, hash, mask, trigger, hits);
+
+        return multi_run_until(1, state, buf, num, len, hash, mask, trigger, hits);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
@@ -0,0 +1,265 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "isal_crypto_api.h"
+#include "rolling_hashx.h"
+
+#define NUM_STREAMS ISAL_ROLLING_HASH2_MAX_STREAMS
+#define TEST_LEN    (64 * 1024)
+#define MAX_PIECE   4096
+
+#ifndef RANDOMS
+#define RANDOMS 30
+#endif
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+#ifndef FIPS_MODE
+struct stream {
+        struct isal_rh_state2 state;
+        struct isal_rh_state2 ref_state;
+        uint8_t *buf;
+        uint32_t *ref_hits;
+        uint32_t n_ref;
+        uint32_t n_hits;
+        uint32_t pos;
+};
+
+/*
+ * Run one stream through isal_rolling_hash2_run() to get the reference hit positions.
+ */
+static int
+stream_ref(struct stream *s, uint32_t mask, uint32_t trigger)
+{
+        uint32_t pos = 0, offset;
+        int ret, match;
+
+        s->n_ref = 0;
+        while (pos < TEST_LEN) {
+                ret = isal_rolling_hash2_run(&s->ref_state, s->buf + pos, TEST_LEN - pos, mask,
+                                             trigger, &offset, &match);
+                if (ret != ISAL_CRYPTO_ERR_NONE) {
+                        printf("\nisal_rolling_hash2_run returned error %d\n", ret);
+                        return 1;
+                }
+                pos += offset;
+                if (match == ISAL_FINGERPRINT_RET_HIT)
+                        s->ref_hits[s->n_ref++] = pos;
+        }
+        return 0;
+}
+
+/*
+ * Run all streams through isal_rolling_hash2_run_multi() in pieces of random length up to
+ * max_piece, dropping streams from the call as they reach the end of their buffer, and check
+ * each hit and the final state against the reference.
+ */
+static int
+streams_multi(struct stream *s, uint32_t num, uint32_t max_piece, uint32_t mask, uint32_t trigger)
+{
+        struct isal_rh_state2 *state[NUM_STREAMS];
+        const uint8_t *buffer[NUM_STREAMS];
+        uint32_t max_len[NUM_STREAMS], offset[NUM_STREAMS], lane[NUM_STREAMS];
+        int match[NUM_STREAMS];
+        uint32_t i, j, n;
+        int ret;
+
+        for (j = 0; j < num; j++) {
+                s[j].pos = 0;
+                s[j].n_hits = 0;
+        }
+
+        for (;;) {
+                n = 0;
+                for (j = 0; j < num; j++) {
+                        if (s[j].pos == TEST_LEN)
+                                continue;
+                        lane[n] = j;
+                        state[n] = &s[j].state;
+                        buffer[n] = s[j].buf + s[j].pos;
+                        max_len[n] = 1 + rand() % max_piece;
+                        if (max_len[n] > TEST_LEN - s[j].pos)
+                                max_len[n] = TEST_LEN - s[j].pos;
+                        n++;
+                }
+                if (n == 0)
+                        break;
+
+                ret = isal_rolling_hash2_run_multi(state, buffer, max_len, n, mask, trigger,
+                                                   offset, match);
+                if (ret != ISAL_CRYPTO_ERR_NONE) {
+                        printf("\nisal_rolling_hash2_run_multi returned error %d\n", ret);
+                        return 1;
+                }
+                for (i = 0; i < n; i++) {
+                        j = lane[i];
+                        if (offset[i] > max_len[i]) {
+                                printf("\nstream %u offset %u past max_len %u\n", j, offset[i],
+                                       max_len[i]);
+                                return 1;
+                        }
+                        s[j].pos += offset[i];
+                        if (match[i] != ISAL_FINGERPRINT_RET_HIT)
+                                continue;
+                        if (s[j].n_hits == s[j].n_ref ||
+                            s[j].ref_hits[s[j].n_hits] != s[j].pos) {
+                                printf("\nstream %u unexpected hit at %u\n", j, s[j].pos);
+                                return 1;
+                        }
+                        s[j].n_hits++;
+                }
+        }
+
+        for (j = 0; j < num; j++) {
+                if (s[j].n_hits != s[j].n_ref) {
+                        printf("\nstream %u found %u hits, expected %u\n", j, s[j].n_hits,
+                               s[j].n_ref);
+                        return 1;
+                }
+                if (s[j].state.hash != s[j].ref_state.hash ||
+                    memcmp(s[j].state.history, s[j].ref_state.history, s[j].state.w)) {
+                        printf("\nstream %u final state mismatch\n", j);
+                        return 1;
+                }
+        }
+        return 0;
+}
+
+/*
+ * Set up num streams with window widths w (random when 0) and run both ways.
+ */
+static int
+run_case(struct stream *s, uint32_t num, uint32_t w, uint32_t max_piece, uint32_t mask,
+         uint32_t trigger)
+{
+        uint8_t init_bytes[ISAL_FINGERPRINT_MAX_WINDOW];
+        uint32_t i, j, ws;
+
+        for (j = 0; j < num; j++) {
+                ws = w ? w : 1 + (uint32_t) rand() % ISAL_FINGERPRINT_MAX_WINDOW;
+                for (i = 0; i < ws; i++)
+                        init_bytes[i] = rand();
+                if (isal_rolling_hash2_init(&s[j].state, ws) != ISAL_CRYPTO_ERR_NONE ||
+                    isal_rolling_hash2_reset(&s[j].state, init_bytes) != ISAL_CRYPTO_ERR_NONE) {
+                        printf("\nrolling hash init failed\n");
+                        return 1;
+                }
+                s[j].ref_state = s[j].state;
+                if (stream_ref(&s[j], mask, trigger))
+                        return 1;
+        }
+        return streams_multi(s, num, max_piece, mask, trigger);
+}
+#endif
+
+int
+main(void)
+{
+#ifndef FIPS_MODE
+        struct stream *s = NULL;
+        uint32_t mask, trigger, num, r;
+        int i, j, errors = 0;
+
+        printf("isal_rolling_hash2_run_multi test: ");
+
+        s = calloc(NUM_STREAMS, sizeof(struct stream));
+        if (s == NULL) {
+                printf("cannot allocate mem\n");
+                return 1;
+        }
+        for (j = 0; j < NUM_STREAMS; j++) {
+                s[j].buf = malloc(TEST_LEN);
+                s[j].ref_hits = malloc(TEST_LEN * sizeof(uint32_t));
+                if (s[j].buf == NULL || s[j].ref_hits == NULL) {
+                        printf("cannot allocate mem\n");
+                        errors++;
+                        goto end;
+                }
+        }
+        srand(TEST_SEED);
+        for (j = 0; j < NUM_STREAMS; j++)
+                for (i = 0; i < TEST_LEN; i++)
+                        s[j].buf[i] = rand();
+
+        isal_rolling_hashx_mask_gen(1024, 0, &mask);
+
+        // Test case 1, 16 streams with the same window, whole buffers in one call
+        errors += run_case(s, NUM_STREAMS, 32, TEST_LEN, mask, 0);
+        if (errors)
+                goto end;
+        putchar('.');
+
+        // Test case 2, 8 streams in small pieces, including pieces shorter than w
+        errors += run_case(s, 8, 32, 40, mask, 0);
+        if (errors)
+                goto end;
+        putchar('.');
+
+        // Test case 3, single stream
+        errors += run_case(s, 1, 48, MAX_PIECE, mask, 0);
+        if (errors)
+                goto end;
+        putchar('.');
+
+        // Test case 4, random stream count, window widths, trigger and piece sizes
+        for (r = 0; r < RANDOMS; r++) {
+                num = 1 + rand() % NUM_STREAMS;
+                isal_rolling_hashx_mask_gen(64 + rand() % 8192, rand() % 32, &mask);
+                trigger = rand() & mask;
+                errors += run_case(s, num, 0, 1 + rand() % MAX_PIECE, mask, trigger);
+                if (errors) {
+                        printf("  num=%u mask=0x%x trigger=0x%x\n", num, mask, trigger);
+                        goto end;
+                }
+                putchar('.');
+        }
+
+end:
+        for (j = 0; j < NUM_STREAMS; j++) {
+                free(s[j].buf);
+                free(s[j].ref_hits);
+        }
+        free(s);
+
+        if (errors > 0)
+                printf(" Fail: %d\n", errors);
+        else
+                printf(" Pass\n");
+        return errors;
+#else
+        printf("FIPS Mode enabled. Test not run\n");
+
+        return 0;
+#endif
+}
@@ -140,6 +140,141 @@ end_run:
         return ret;
 }
 
+static int
+test_rolling_hash2_run_ref_api(void)
+{
+        int ret = -1;
+        const char *fn_name = "isal_rolling_hash2_run_ref";
+        struct isal_rh_state2 state = { 0 };
+        uint8_t buffer[64] = { 0 };
+        uint32_t len = (uint32_t) sizeof(buffer);
+        uint32_t mask = 0xffff0;
+        uint32_t trigger = 0x3df0;
+        uint32_t offset = 0;
+        int match = -1;
+
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_ref(&state, buffer, len, mask, trigger, &offset, &match),
+                ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_run_ref);
+#else
+        if (isal_rolling_hash2_init(&state, 32) != ISAL_CRYPTO_ERR_NONE)
+                goto end_run_ref;
+
+        // check NULL state
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_ref(NULL, buffer, len, mask, trigger, &offset, &match),
+                ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_run_ref);
+
+        // check NULL source buffer
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_ref(&state, NULL, len, mask, trigger, &offset, &match),
+                ISAL_CRYPTO_ERR_NULL_SRC, fn_name, end_run_ref);
+
+        // check NULL offset
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_ref(&state, buffer, len, mask, trigger, NULL, &match),
+                ISAL_CRYPTO_ERR_NULL_OFFSET, fn_name, end_run_ref);
+
+        // check NULL match
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_ref(&state, buffer, len, mask, trigger, &offset, NULL),
+                ISAL_CRYPTO_ERR_NULL_MATCH, fn_name, end_run_ref);
+
+        // check valid args
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_ref(&state, buffer, len, mask, trigger, &offset, &match),
+                ISAL_CRYPTO_ERR_NONE, fn_name, end_run_ref);
+#endif
+
+        ret = 0;
+end_run_ref:
+        return ret;
+}
+
+static int
+test_rolling_hash2_run_multi_api(void)
+{
+        int ret = -1;
+        const char *fn_name = "isal_rolling_hash2_run_multi";
+        struct isal_rh_state2 states[2];
+        struct isal_rh_state2 *state[2] = { &states[0], &states[1] };
+        uint8_t buf0[64] = { 0 }, buf1[64] = { 0 };
+        const uint8_t *buffer[2] = { buf0, buf1 };
+        uint32_t max_len[2] = { sizeof(buf0), sizeof(buf1) };
+        uint32_t offset[2];
+        int match[2];
+
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_multi(state, buffer, max_len, 2, 0, 0, offset, match),
+                ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_run_multi);
+#else
+        if (isal_rolling_hash2_init(state[0], 32) != ISAL_CRYPTO_ERR_NONE ||
+            isal_rolling_hash2_init(state[1], 16) != ISAL_CRYPTO_ERR_NONE)
+                goto end_run_multi;
+
+        // check NULL state array
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_multi(NULL, buffer, max_len, 2, 0, 0, offset, match),
+                ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_run_multi);
+
+        // check NULL state
+        state[1] = NULL;
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_multi(state, buffer, max_len, 2, 0, 0, offset, match),
+                ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_run_multi);
+        state[1] = &states[1];
+
+        // check NULL buffer array
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_multi(state, NULL, max_len, 2, 0, 0, offset, match),
+                ISAL_CRYPTO_ERR_NULL_SRC, fn_name, end_run_multi);
+
+        // check NULL buffer
+        buffer[1] = NULL;
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_multi(state, buffer, max_len, 2, 0, 0, offset, match),
+                ISAL_CRYPTO_ERR_NULL_SRC, fn_name, end_run_multi);
+        buffer[1] = buf1;
+
+        // check NULL max_len array
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_multi(state, buffer, NULL, 2, 0, 0, offset, match),
+                ISAL_CRYPTO_ERR_NULL_SRC, fn_name, end_run_multi);
+
+        // check NULL offset array
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_multi(state, buffer, max_len, 2, 0, 0, NULL, match),
+                ISAL_CRYPTO_ERR_NULL_OFFSET, fn_name, end_run_multi);
+
+        // check NULL match array
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_multi(state, buffer, max_len, 2, 0, 0, offset, NULL),
+                ISAL_CRYPTO_ERR_NULL_MATCH, fn_name, end_run_multi);
+
+        // check invalid number of streams
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_multi(state, buffer, max_len, 0, 0, 0, offset, match),
+                ISAL_CRYPTO_ERR_NUM_STREAMS, fn_name, end_run_multi);
+        CHECK_RETURN_GOTO(isal_rolling_hash2_run_multi(state, buffer, max_len,
+                                                       ISAL_ROLLING_HASH2_MAX_STREAMS + 1, 0, 0,
+                                                       offset, match),
+                          ISAL_CRYPTO_ERR_NUM_STREAMS, fn_name, end_run_multi);
+
+        // check valid args
+        CHECK_RETURN_GOTO(
+                isal_rolling_hash2_run_multi(state, buffer, max_len, 2, 0, 0, offset, match),
+                ISAL_CRYPTO_ERR_NONE, fn_name, end_run_multi);
+#endif
+
+        ret = 0;
+end_run_multi:
+        return ret;
+}
+
 static int
 test_rolling_hashx_mask_gen_api(void)
 {
@@ -174,6 +309,165 @@ end_mask_gen:
         return ret;
 }
 
+static int
+test_chunker_init_api(void)
+{
+        int ret = -1;
+        const char *fn_name = "isal_chunker_init";
+        struct isal_chunker chunker = { 0 };
+
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(isal_chunker_init(&chunker, 32, 1024, 4096, 16384),
+                          ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_init);
+#else
+        // check NULL chunker
+        CHECK_RETURN_GOTO(isal_chunker_init(NULL, 32, 1024, 4096, 16384), ISAL_CRYPTO_ERR_NULL_CTX,
+                          fn_name, end_init);
+
+        // check invalid window size
+        CHECK_RETURN_GOTO(isal_chunker_init(&chunker, 0, 1024, 4096, 16384),
+                          ISAL_CRYPTO_ERR_WINDOW_SIZE, fn_name, end_init);
+        CHECK_RETURN_GOTO(isal_chunker_init(&chunker, 500, 1024, 4096, 16384),
+                          ISAL_CRYPTO_ERR_WINDOW_SIZE, fn_name, end_init);
+
+        // check min size smaller than window
+        CHECK_RETURN_GOTO(isal_chunker_init(&chunker, 32, 16, 4096, 16384),
+                          ISAL_CRYPTO_ERR_CHUNK_SIZE, fn_name, end_init);
+
+        // check average size smaller than min size
+        CHECK_RETURN_GOTO(isal_chunker_init(&chunker, 32, 1024, 512, 16384),
+                          ISAL_CRYPTO_ERR_CHUNK_SIZE, fn_name, end_init);
+
+        // check max size smaller than average size
+        CHECK_RETURN_GOTO(isal_chunker_init(&chunker, 32, 1024, 4096, 2048),
+                          ISAL_CRYPTO_ERR_CHUNK_SIZE, fn_name, end_init);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_chunker_init(&chunker, 32, 1024, 4096, 16384), ISAL_CRYPTO_ERR_NONE,
+                          fn_name, end_init);
+#endif
+
+        ret = 0;
+end_init:
+        return ret;
+}
+
+static int
+test_chunker_init_gear_api(void)
+{
+        int ret = -1;
+        const char *fn_name = "isal_chunker_init_gear";
+        struct isal_chunker chunker = { 0 };
+
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(isal_chunker_init_gear(&chunker, 2048, 8192, 65536),
+                          ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_init);
+#else
+        // check NULL chunker
+        CHECK_RETURN_GOTO(isal_chunker_init_gear(NULL, 2048, 8192, 65536),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_init);
+
+        // check too small average size
+        CHECK_RETURN_GOTO(isal_chunker_init_gear(&chunker, 0, 4, 65536),
+                          ISAL_CRYPTO_ERR_CHUNK_SIZE, fn_name, end_init);
+
+        // check average size smaller than min size
+        CHECK_RETURN_GOTO(isal_chunker_init_gear(&chunker, 2048, 1024, 65536),
+                          ISAL_CRYPTO_ERR_CHUNK_SIZE, fn_name, end_init);
+
+        // check max size smaller than average size
+        CHECK_RETURN_GOTO(isal_chunker_init_gear(&chunker, 2048, 8192, 4096),
+                          ISAL_CRYPTO_ERR_CHUNK_SIZE, fn_name, end_init);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_chunker_init_gear(&chunker, 2048, 8192, 65536),
+                          ISAL_CRYPTO_ERR_NONE, fn_name, end_init);
+#endif
+
+        ret = 0;
+end_init:
+        return ret;
+}
+
+static int
+test_chunker_reset_api(void)
+{
+        int ret = -1;
+        const char *fn_name = "isal_chunker_reset";
+        struct isal_chunker chunker = { 0 };
+
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(isal_chunker_reset(&chunker), ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name,
+                          end_reset);
+#else
+        // check NULL chunker
+        CHECK_RETURN_GOTO(isal_chunker_reset(NULL), ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_reset);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_chunker_reset(&chunker), ISAL_CRYPTO_ERR_NONE, fn_name, end_reset);
+#endif
+
+        ret = 0;
+end_reset:
+        return ret;
+}
+
+static int
+test_chunker_run_api(void)
+{
+        int ret = -1;
+        const char *fn_name = "isal_chunker_run";
+        struct isal_chunker chunker = { 0 };
+        uint8_t buffer[64] = { 0 };
+        uint64_t len = sizeof(buffer);
+        uint64_t cuts[4], consumed;
+        uint32_t num_cuts;
+
+#ifdef FIPS_MODE
+        // check for invalid algorithm
+        CHECK_RETURN_GOTO(isal_chunker_run(&chunker, buffer, len, cuts, 4, &num_cuts, &consumed),
+                          ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO, fn_name, end_run);
+#else
+        if (isal_chunker_init(&chunker, 16, 16, 32, 48) != ISAL_CRYPTO_ERR_NONE)
+                goto end_run;
+
+        // check NULL chunker
+        CHECK_RETURN_GOTO(isal_chunker_run(NULL, buffer, len, cuts, 4, &num_cuts, &consumed),
+                          ISAL_CRYPTO_ERR_NULL_CTX, fn_name, end_run);
+
+        // check NULL source buffer
+        CHECK_RETURN_GOTO(isal_chunker_run(&chunker, NULL, len, cuts, 4, &num_cuts, &consumed),
+                          ISAL_CRYPTO_ERR_NULL_SRC, fn_name, end_run);
+
+        // check NULL cuts array
+        CHECK_RETURN_GOTO(isal_chunker_run(&chunker, buffer, len, NULL, 4, &num_cuts, &consumed),
+                          ISAL_CRYPTO_ERR_NULL_DST, fn_name, end_run);
+
+        // check NULL num_cuts
+        CHECK_RETURN_GOTO(isal_chunker_run(&chunker, buffer, len, cuts, 4, NULL, &consumed),
+                          ISAL_CRYPTO_ERR_NULL_OFFSET, fn_name, end_run);
+
+        // check NULL consumed
+        CHECK_RETURN_GOTO(isal_chunker_run(&chunker, buffer, len, cuts, 4, &num_cuts, NULL),
+                          ISAL_CRYPTO_ERR_NULL_OFFSET, fn_name, end_run);
+
+        // check NULL source buffer with zero length
+        CHECK_RETURN_GOTO(isal_chunker_run(&chunker, NULL, 0, cuts, 4, &num_cuts, &consumed),
+                          ISAL_CRYPTO_ERR_NONE, fn_name, end_run);
+
+        // check valid args
+        CHECK_RETURN_GOTO(isal_chunker_run(&chunker, buffer, len, cuts, 4, &num_cuts, &consumed),
+                          ISAL_CRYPTO_ERR_NONE, fn_name, end_run);
+#endif
+
+        ret = 0;
+end_run:
+        return ret;
+}
+
 #endif /* SAFE_PARAM */
 
 int
@@ -185,7 +479,13 @@ main(void)
         fail |= test_rolling_hash2_init_api();
         fail |= test_rolling_hash2_reset_api();
         fail |= test_rolling_hash2_run_api();
+        fail |= test_rolling_hash2_run_ref_api();
+        fail |= test_rolling_hash2_run_multi_api();
         fail |= test_rolling_hashx_mask_gen_api();
+        fail |= test_chunker_init_api();
+        fail |= test_chunker_init_gear_api();
+        fail |= test_chunker_reset_api();
+        fail |= test_chunker_run_api();
 
         printf(fail ? "Fail\n" : "Pass\n");
 #else
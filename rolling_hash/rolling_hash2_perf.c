@@ -69,6 +69,122 @@
 
 #define TEST_MEM TEST_LEN
 
+#define CHUNK_MIN  (2 * 1024)
+#define CHUNK_AVG  (8 * 1024)
+#define CHUNK_MAX  (64 * 1024)
+#define CHUNK_CUTS (TEST_LEN / CHUNK_MIN + 1)
+
+#define SHORT_LEN 256
+
+#ifndef FIPS_MODE
+/*
+ * Chunk the test buffer as a repeating stream, the chunker state carries over between calls
+ */
+static int
+chunker_perf(struct isal_chunker *chunker, const char *name, uint8_t *buf, uint64_t *cuts)
+{
+        struct perf start, stop;
+        uint64_t consumed;
+        uint32_t num_cuts;
+        int i, ret;
+
+        perf_start(&start);
+        for (i = 0; i < TEST_LOOPS; i++) {
+                ret = isal_chunker_run(chunker, buf, TEST_LEN, cuts, CHUNK_CUTS, &num_cuts,
+                                       &consumed);
+                if (ret)
+                        return ret;
+        }
+        perf_stop(&stop);
+
+        printf("isal_chunker_run_%s" TEST_TYPE_STR ": ", name);
+        perf_print(stop, start, (long long) TEST_LEN * i);
+
+        return 0;
+}
+
+/*
+ * Hash the test buffer as num streams of TEST_LEN / num bytes each, advanced in lockstep
+ */
+static int
+multi_perf(struct isal_rh_state2 *states, uint32_t num, uint8_t *buf, int w, uint32_t mask,
+           uint32_t trigger)
+{
+        struct isal_rh_state2 *state[ISAL_ROLLING_HASH2_MAX_STREAMS];
+        const uint8_t *buffer[ISAL_ROLLING_HASH2_MAX_STREAMS];
+        uint32_t max_len[ISAL_ROLLING_HASH2_MAX_STREAMS], offset[ISAL_ROLLING_HASH2_MAX_STREAMS];
+        int match[ISAL_ROLLING_HASH2_MAX_STREAMS];
+        uint32_t j, len = TEST_LEN / num;
+        struct perf start, stop;
+        int i, ret;
+
+        for (j = 0; j < num; j++) {
+                state[j] = &states[j];
+                buffer[j] = buf + j * len;
+                max_len[j] = len;
+                ret = isal_rolling_hash2_init(state[j], w);
+                if (ret == 0)
+                        ret = isal_rolling_hash2_reset(state[j], buffer[j]);
+                if (ret)
+                        return ret;
+        }
+
+        perf_start(&start);
+        for (i = 0; i < TEST_LOOPS; i++) {
+                ret = isal_rolling_hash2_run_multi(state, buffer, max_len, num, mask, trigger,
+                                                   offset, match);
+                if (ret)
+                        return ret;
+        }
+        perf_stop(&stop);
+
+        printf("isal_rolling_hash2_run_multi_x%u" TEST_TYPE_STR ": ", num);
+        perf_print(stop, start, (long long) len * num * i);
+
+        return 0;
+}
+
+/*
+ * Hash the test buffer as a stream of short pieces, keeping the window history in the state or,
+ * with by_ref, in the stream buffer
+ */
+static int
+short_perf(struct isal_rh_state2 *state, uint8_t *buf, int w, uint32_t mask, uint32_t trigger,
+           int by_ref)
+{
+        struct perf start, stop;
+        uint32_t pos, offset;
+        int i, ret, match;
+
+        ret = isal_rolling_hash2_init(state, w);
+        if (ret)
+                return ret;
+
+        perf_start(&start);
+        for (i = 0; i < TEST_LOOPS; i++) {
+                // The stream wraps around, so the window starts over
+                isal_rolling_hash2_reset(state, buf);
+                for (pos = 0; pos < TEST_LEN; pos += SHORT_LEN) {
+                        if (by_ref)
+                                ret = isal_rolling_hash2_run_ref(state, buf + pos, SHORT_LEN, mask,
+                                                                 trigger, &offset, &match);
+                        else
+                                ret = isal_rolling_hash2_run(state, buf + pos, SHORT_LEN, mask,
+                                                             trigger, &offset, &match);
+                        if (ret)
+                                return ret;
+                }
+        }
+        perf_stop(&stop);
+
+        printf("isal_rolling_hash2_run%s_w%d_%d" TEST_TYPE_STR ": ", by_ref ? "_ref" : "", w,
+               SHORT_LEN);
+        perf_print(stop, start, (long long) TEST_LEN * i);
+
+        return 0;
+}
+#endif
+
 int
 main(int argc, char *argv[])
 {
@@ -77,7 +193,9 @@ main(int argc, char *argv[])
         uint32_t mask, trigger, offset = 0;
         int i, w, ret, match;
         long long run_length;
-        struct isal_rh_state2 *state;
+        struct isal_rh_state2 *state, *states;
+        struct isal_chunker *chunker;
+        uint64_t *cuts;
         struct perf start, stop;
 
         // Case
@@ -134,6 +252,57 @@ main(int argc, char *argv[])
         printf(xstr(FUT_run) TEST_TYPE_STR ": ");
         perf_print(stop, start, run_length * i);
 
+        // Same hash over 8 and 16 streams at once
+        states = malloc(ISAL_ROLLING_HASH2_MAX_STREAMS * sizeof(*states));
+        if (states == NULL) {
+                printf("alloc error rh_state: Fail\n");
+                return -1;
+        }
+        ret = multi_perf(states, 8, buf, w, mask, trigger);
+        if (ret == 0)
+                ret = multi_perf(states, ISAL_ROLLING_HASH2_MAX_STREAMS, buf, w, mask, trigger);
+        free(states);
+        if (ret) {
+                printf("isal_rolling_hash2_run_multi error (%d)\n", ret);
+                return -1;
+        }
+
+        // Short buffer streaming, small and large windows
+        for (w = 32; w <= ISAL_FINGERPRINT_MAX_WINDOW && ret == 0; w *= 8) {
+                ret = short_perf(state, buf, w, mask, trigger, 0);
+                if (ret == 0)
+                        ret = short_perf(state, buf, w, mask, trigger, 1);
+        }
+        w = 32;
+        if (ret) {
+                printf("isal_rolling_hash2_run short buffer error (%d)\n", ret);
+                return -1;
+        }
+
+        // Chunking throughput with rolling_hash2 and Gear boundary hashes
+        chunker = malloc(sizeof(*chunker));
+        cuts = malloc(CHUNK_CUTS * sizeof(*cuts));
+        if (chunker == NULL || cuts == NULL) {
+                printf("alloc error chunker: Fail\n");
+                return -1;
+        }
+        printf("chunker min=%d, avg=%d, max=%d\n", CHUNK_MIN, CHUNK_AVG, CHUNK_MAX);
+
+        ret = isal_chunker_init(chunker, w, CHUNK_MIN, CHUNK_AVG, CHUNK_MAX);
+        if (ret == 0)
+                ret = chunker_perf(chunker, "rh2", buf, cuts);
+        if (ret == 0)
+                ret = isal_chunker_init_gear(chunker, CHUNK_MIN, CHUNK_AVG, CHUNK_MAX);
+        if (ret == 0)
+                ret = chunker_perf(chunker, "gear", buf, cuts);
+
+        free(chunker);
+        free(cuts);
+        if (ret) {
+                printf("isal_chunker error (%d)\n", ret);
+                return -1;
+        }
+
         return 0;
 
 run_error:
@@ -52,6 +52,8 @@
 
 #define MAX_BUFFER_SIZE        128 * 1024 * 1024
 #define MAX_ROLLING_HASH_WIDTH 32
+#define STREAM_LEN             64 * 1024
+#define MAX_PIECE              (2 * ISAL_FINGERPRINT_MAX_WINDOW + 16)
 
 #ifndef RANDOMS
 #define RANDOMS 200
@@ -104,6 +106,69 @@ pick_rand_mask_in_range(int min_bits, int max_bits)
 
         return mask;
 }
+
+/*
+ * Hash a stream in pieces of up to max_piece bytes, checking each result and the window hash
+ * after each call against the reference. Mode 0 copies every piece to the same scratch buffer
+ * and clears it after the call, so the history has to be kept in the state. Mode 1 runs by
+ * reference on two scratch buffers in turn, mode 2 by reference on the stream itself.
+ */
+static int
+stream_pieces(struct isal_rh_state2 *state, uint8_t *stream, uint32_t w, uint32_t mask,
+              uint32_t trigger, uint32_t max_piece, int mode, uint8_t *scratch)
+{
+        uint32_t pos, n, k = 0, offset = 0, offset_ref;
+        uint8_t *piece;
+        uint64_t hash;
+        int ret, match, match_ref;
+
+        FUT_init(state, w);
+        FUT_reset(state, stream);
+        for (pos = w; pos < STREAM_LEN; pos += offset) {
+                n = rand() % (max_piece + 1);
+                if (n > STREAM_LEN - pos)
+                        n = STREAM_LEN - pos;
+                if (mode == 2) {
+                        piece = stream + pos;
+                } else {
+                        piece = scratch + (mode == 1 ? (k++ & 1) * (MAX_PIECE + 64) : 0);
+                        memcpy(piece, stream + pos, n);
+                }
+                if (mode == 0)
+                        ret = FUT_run(state, piece, n, mask, trigger, &offset, &match);
+                else
+                        ret = isal_rolling_hash2_run_ref(state, piece, n, mask, trigger, &offset,
+                                                         &match);
+                if (ret != ISAL_CRYPTO_ERR_NONE)
+                        return ret;
+
+                match_ref = ISAL_FINGERPRINT_RET_MAX;
+                for (offset_ref = 1; offset_ref <= n; offset_ref++) {
+                        hash = FUT_ref(state, stream + pos + offset_ref - w, w, 0);
+                        if ((hash & mask) == trigger) {
+                                match_ref = ISAL_FINGERPRINT_RET_HIT;
+                                break;
+                        }
+                }
+                if (match_ref == ISAL_FINGERPRINT_RET_MAX)
+                        offset_ref = n;
+                if (offset != offset_ref || match != match_ref) {
+                        printf("\ncase 5 mode %d, w=%u at %u: fut offset=%u match=%d, "
+                               "ref offset=%u match=%d\n",
+                               mode, w, pos, offset, match, offset_ref, match_ref);
+                        return -1;
+                }
+                if (state->hash != FUT_ref(state, stream + pos + offset - w, w, 0)) {
+                        printf("\ncase 5 mode %d, w=%u at %u: window hash mismatch\n", mode, w,
+                               pos + offset);
+                        return -1;
+                }
+                if (mode == 0)
+                        memset(piece, 0, n);
+        }
+
+        return 0;
+}
 #endif
 
 int
@@ -116,6 +181,7 @@ main(void)
         int i, r, ret, match, errors = 0;
         uint32_t offset_fut;
         struct isal_rh_state2 state;
+        uint8_t *scratch = NULL;
 
         printf(xstr(FUT_run) ": " xstr(MAX_BUFFER_SIZE));
 
@@ -328,9 +394,33 @@ main(void)
                 }
         }
 
+        // Test case 5, windows up to ISAL_FINGERPRINT_MAX_WINDOW streamed in short pieces
+
+        scratch = malloc(2 * (MAX_PIECE + 64));
+        if (scratch == NULL) {
+                printf("cannot allocate mem\n");
+                errors++;
+                goto end;
+        }
+        for (r = 0; r < RANDOMS / 4; r++) {
+                w = 1 + rand() % ISAL_FINGERPRINT_MAX_WINDOW;
+                if (r < 3)
+                        w = 64 << r; // Windows a multiple of the hash width
+                mask = pick_rand_mask_in_range(6, 10);
+                trigger = rand() & mask;
+
+                if (stream_pieces(&state, buffer, w, mask, trigger, 1 + rand() % (2 * w + 16),
+                                  r % 3, scratch) != 0) {
+                        errors++;
+                        goto end;
+                }
+                putchar('.'); // Finished test 5
+        }
+
 end:
         if (buffer != NULL)
                 free(buffer);
+        free(scratch);
 
         if (errors > 0)
                 printf(" Fail: %d\n", errors);
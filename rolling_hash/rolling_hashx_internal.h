@@ -48,7 +48,7 @@ extern "C" {
  * @brief Initialize state object for rolling hash2
  *
  * @param state Structure holding state info on current rolling hash
- * @param w     Window width (1 <= w <= 32)
+ * @param w     Window width (1 <= w <= ISAL_FINGERPRINT_MAX_WINDOW)
  * @returns 0 - success, -1 - failure
  */
 int
@@ -64,6 +64,25 @@ _rolling_hash2_init(struct isal_rh_state2 *state, uint32_t w);
 void
 _rolling_hash2_reset(struct isal_rh_state2 *state, uint8_t *init_bytes);
 
+/**
+ * @brief Reset the hash state, keeping the history in init_bytes
+ *
+ * @param state Structure holding state info on current rolling hash
+ * @param init_bytes Window size buffer to pre-init hash, must stay valid until the next run
+ * @returns none
+ */
+void
+_rolling_hash2_reset_ref(struct isal_rh_state2 *state, const uint8_t *init_bytes);
+
+/**
+ * @brief Copy a window history kept by reference into the state
+ *
+ * @param state Structure holding state info on current rolling hash
+ * @returns none
+ */
+void
+_rolling_hash2_save_history(struct isal_rh_state2 *state);
+
 /**
  * @brief Run rolling hash function until trigger met or max length reached
  *
@@ -80,6 +99,17 @@ int
 _rolling_hash2_run(struct isal_rh_state2 *state, uint8_t *buffer, uint32_t max_len, uint32_t mask,
                    uint32_t trigger, uint32_t *offset);
 
+/**
+ * @brief Run rolling hash function, keeping the window history in buffer
+ *
+ * Same as _rolling_hash2_run(), the w bytes before buffer + offset must stay unchanged until
+ * the next run on state.
+ * @returns ISAL_FINGERPRINT_RET_HIT - match found, ISAL_FINGERPRINT_RET_MAX - exceeded max length
+ */
+int
+_rolling_hash2_run_ref(struct isal_rh_state2 *state, uint8_t *buffer, uint32_t max_len,
+                       uint32_t mask, uint32_t trigger, uint32_t *offset);
+
 /**
  * @brief Generate an appropriate mask to target mean hit rate
  *
@@ -0,0 +1,143 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <string.h>
+
+#include "sha1_mb_internal.h"
+#include "isal_crypto_api.h"
+#include "multi_buffer.h"
+
+#define SHA1_DIGEST_BYTES (ISAL_SHA1_DIGEST_NWORDS * sizeof(ISAL_SHA1_WORD_T))
+
+/*
+ * One message in flight. Messages all have the same length, so the padded tail (the bytes
+ * after the last full block, the 0x80 marker and the length field) only differs in its
+ * message bytes. The padding is written once per lane and each message copies just its
+ * tail bytes in front of it; the full blocks are hashed in place from the caller's buffer.
+ */
+struct sha1_batch_lane {
+        ISAL_SHA1_HASH_CTX ctx; // Must be at struct offset 0.
+        uint8_t tail[2 * ISAL_SHA1_BLOCK_SIZE];
+        uint32_t index;
+        uint32_t head_done;
+};
+
+/* Build the padded tail of a len byte message, returns its length in bytes */
+static uint32_t
+sha1_batch_pad(uint8_t *tail, const uint32_t len)
+{
+        const uint32_t rem = len % ISAL_SHA1_BLOCK_SIZE;
+        const uint64_t bit_len = (uint64_t) len * 8;
+        uint32_t tail_len = ISAL_SHA1_BLOCK_SIZE;
+        uint32_t i;
+
+        if (rem + 1 + ISAL_SHA1_PADLENGTHFIELD_SIZE > ISAL_SHA1_BLOCK_SIZE)
+                tail_len = 2 * ISAL_SHA1_BLOCK_SIZE;
+
+        memset(tail, 0, 2 * ISAL_SHA1_BLOCK_SIZE);
+        tail[rem] = 0x80;
+        for (i = 0; i < 8; i++)
+                tail[tail_len - 1 - i] = (uint8_t) (bit_len >> (8 * i));
+        return tail_len;
+}
+
+int
+isal_sha1_hash_batch(const void *msgs, const size_t stride, const uint32_t len,
+                     const uint32_t count, ISAL_SHA1_WORD_T *digests)
+{
+        ISAL_SHA1_HASH_CTX_MGR mgr;
+        struct sha1_batch_lane lanes[ISAL_SHA1_MAX_LANES];
+        struct sha1_batch_lane *lane_free[ISAL_SHA1_MAX_LANES];
+        struct sha1_batch_lane *lane;
+        ISAL_SHA1_HASH_CTX *ctx;
+        const uint8_t *msg;
+        const uint32_t head_len = len - len % ISAL_SHA1_BLOCK_SIZE;
+        uint32_t tail_len, num_free = ISAL_SHA1_MAX_LANES;
+        uint32_t next = 0, i;
+
+#ifdef SAFE_PARAM
+        if (msgs == NULL && count != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        if (digests == NULL && count != 0)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+        if (count == 0)
+                return 0;
+
+        _sha1_ctx_mgr_init(&mgr);
+        tail_len = sha1_batch_pad(lanes[0].tail, len);
+        for (i = 0; i < ISAL_SHA1_MAX_LANES; i++) {
+                if (i != 0)
+                        memcpy(lanes[i].tail, lanes[0].tail, sizeof(lanes[i].tail));
+                isal_hash_ctx_init(&lanes[i].ctx);
+                lane_free[i] = &lanes[i];
+        }
+
+        while (next < count || num_free < ISAL_SHA1_MAX_LANES) {
+                if (next < count && num_free > 0) {
+                        lane = lane_free[--num_free];
+                        lane->index = next++;
+                        msg = (const uint8_t *) msgs + (size_t) lane->index * stride;
+                        memcpy(lane->tail, msg + head_len, len - head_len);
+
+                        if (head_len != 0) {
+                                lane->head_done = 0;
+                                ctx = _sha1_ctx_mgr_submit(&mgr, &lane->ctx, msg, head_len,
+                                                           ISAL_HASH_FIRST);
+                        } else {
+                                lane->head_done = 1;
+                                ctx = _sha1_ctx_mgr_submit(&mgr, &lane->ctx, lane->tail, tail_len,
+                                                           ISAL_HASH_FIRST);
+                        }
+                } else
+                        ctx = _sha1_ctx_mgr_flush(&mgr);
+
+                while (ctx != NULL) {
+                        lane = (struct sha1_batch_lane *) ctx;
+                        if (!lane->head_done) {
+                                lane->head_done = 1;
+                                ctx = _sha1_ctx_mgr_submit(&mgr, ctx, lane->tail, tail_len,
+                                                           ISAL_HASH_UPDATE);
+                                continue;
+                        }
+
+                        memcpy(digests + (size_t) lane->index * ISAL_SHA1_DIGEST_NWORDS,
+                               ctx->job.result_digest, SHA1_DIGEST_BYTES);
+                        lane_free[num_free++] = lane;
+                        ctx = NULL;
+                }
+        }
+
+        return 0;
+}
@@ -0,0 +1,308 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sha1_mb.h"
+#include "isal_crypto_api.h"
+
+#define TEST_BUFS 64
+#define TEST_KEYS 4
+#define MAX_MSG   (4 * ISAL_SHA1_BLOCK_SIZE)
+#define MAX_KEY   (2 * ISAL_SHA1_BLOCK_SIZE + 3)
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+#define MAC_LEN (ISAL_SHA1_DIGEST_NWORDS * sizeof(ISAL_SHA1_WORD_T))
+
+// Compare against reference function
+extern void
+sha1_ref(uint8_t *input_data, ISAL_SHA1_WORD_T *digest, uint32_t len);
+
+struct hmac_vector {
+        const uint8_t *key;
+        uint32_t key_len;
+        const char *msg;
+        uint8_t mac[MAC_LEN];
+};
+
+// Test cases 1, 2 and 6 from RFC 2202
+static const uint8_t key1[] = {
+        0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+        0x0b, 0x0b, 0x0b, 0x0b, 0x0b
+};
+
+static const uint8_t key2[] = {
+        0x4a, 0x65, 0x66, 0x65
+};
+
+static const uint8_t key6[] = {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+};
+
+static const struct hmac_vector vectors[] = {
+        { key1,
+          sizeof(key1),
+          "Hi There",
+          {
+                  0xb6, 0x17, 0x31, 0x86, 0x55, 0x05, 0x72, 0x64, 0xe2, 0x8b, 0xc0, 0xb6, 0xfb,
+                  0x37, 0x8c, 0x8e, 0xf1, 0x46, 0xbe, 0x00 } },
+        { key2,
+          sizeof(key2),
+          "what do ya want for nothing?",
+          {
+                  0xef, 0xfc, 0xdf, 0x6a, 0xe5, 0xeb, 0x2f, 0xa2, 0xd2, 0x74, 0x16, 0xd5, 0xf1,
+                  0x84, 0xdf, 0x9c, 0x25, 0x9a, 0x7c, 0x79 } },
+        { key6,
+          sizeof(key6),
+          "Test Using Larger Than Block-Size Key - Hash Key First",
+          {
+                  0xaa, 0x4a, 0xe5, 0xe1, 0x52, 0x72, 0xd0, 0x0e, 0x95, 0x70, 0x56, 0x37, 0xce,
+                  0x8a, 0x3b, 0x55, 0xed, 0x40, 0x21, 0x12 } },
+};
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+static void
+digest_to_bytes(const ISAL_SHA1_WORD_T *digest, uint8_t *out)
+{
+        const uint32_t word_size = sizeof(ISAL_SHA1_WORD_T);
+        uint32_t i, b;
+
+        for (i = 0; i < ISAL_SHA1_DIGEST_NWORDS; i++)
+                for (b = 0; b < word_size; b++)
+                        *out++ = (uint8_t) (digest[i] >> (8 * (word_size - 1 - b)));
+}
+
+// Reference HMAC built on the single buffer reference hash
+static void
+hmac_sha1_ref(const uint8_t *key, uint32_t key_len, const uint8_t *msg, uint32_t len, uint8_t *mac)
+{
+        static uint8_t buf[ISAL_SHA1_BLOCK_SIZE + MAX_MSG];
+        uint8_t k0[ISAL_SHA1_BLOCK_SIZE] = { 0 };
+        ISAL_SHA1_WORD_T digest[ISAL_SHA1_DIGEST_NWORDS];
+        uint32_t i;
+
+        if (key_len > ISAL_SHA1_BLOCK_SIZE) {
+                memcpy(buf, key, key_len);
+                sha1_ref(buf, digest, key_len);
+                digest_to_bytes(digest, k0);
+        } else
+                memcpy(k0, key, key_len);
+
+        for (i = 0; i < ISAL_SHA1_BLOCK_SIZE; i++)
+                buf[i] = k0[i] ^ 0x36;
+        memcpy(buf + ISAL_SHA1_BLOCK_SIZE, msg, len);
+        sha1_ref(buf, digest, ISAL_SHA1_BLOCK_SIZE + len);
+
+        digest_to_bytes(digest, buf + ISAL_SHA1_BLOCK_SIZE);
+        for (i = 0; i < ISAL_SHA1_BLOCK_SIZE; i++)
+                buf[i] = k0[i] ^ 0x5c;
+        sha1_ref(buf, digest, ISAL_SHA1_BLOCK_SIZE + MAC_LEN);
+        digest_to_bytes(digest, mac);
+}
+
+static int
+check_ctx(const ISAL_HMAC_SHA1_CTX *ctx, const uint8_t *mac_ref, const uint32_t idx)
+{
+        if (!isal_hash_ctx_complete(&ctx->hash_ctx) || ctx->hash_ctx.error) {
+                printf("Test%d not completed\n", idx);
+                return 1;
+        }
+        if (memcmp(ctx->mac, mac_ref, MAC_LEN)) {
+                printf("Test%d mac mismatch\n", idx);
+                return 1;
+        }
+        return 0;
+}
+
+static int
+test_vectors(ISAL_HMAC_SHA1_CTX_MGR *mgr)
+{
+        ISAL_HMAC_SHA1_KEY key;
+        ISAL_HMAC_SHA1_CTX ctx, *ctx_out;
+        const struct hmac_vector *v;
+        uint32_t i;
+        int fail = 0;
+
+        for (i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+                v = &vectors[i];
+                isal_hash_ctx_init(&ctx.hash_ctx);
+
+                if (isal_hmac_sha1_key_init(&key, v->key, v->key_len) != 0 ||
+                    isal_hmac_sha1_ctx_mgr_submit(mgr, &ctx, &ctx_out, &key, v->msg,
+                                                  (uint32_t) strlen(v->msg)) != 0) {
+                        printf("Vector%d submit failed\n", i);
+                        fail++;
+                        continue;
+                }
+                if (ctx_out == NULL && isal_hmac_sha1_ctx_mgr_flush(mgr, &ctx_out) != 0) {
+                        fail++;
+                        continue;
+                }
+                if (ctx_out != &ctx) {
+                        printf("Vector%d not returned\n", i);
+                        fail++;
+                        continue;
+                }
+                fail += check_ctx(&ctx, v->mac, i);
+        }
+
+        return fail;
+}
+
+int
+main(void)
+{
+        ISAL_HMAC_SHA1_CTX_MGR *mgr = NULL;
+        ISAL_HMAC_SHA1_CTX *ctxpool = NULL, *ctx = NULL;
+        ISAL_HMAC_SHA1_KEY keys[TEST_KEYS];
+        static uint8_t key_bufs[TEST_KEYS][MAX_KEY];
+        static uint8_t msgs[TEST_BUFS][MAX_MSG];
+        static uint8_t mac_ref[TEST_BUFS][MAC_LEN];
+        uint32_t key_lens[TEST_KEYS] = { 0, 20, ISAL_SHA1_BLOCK_SIZE, MAX_KEY };
+        uint32_t lens[TEST_BUFS];
+        uint32_t i, completed = 0;
+        int ret, fail = 0;
+
+        printf("hmac_sha1_mb test, %d buffers: ", TEST_BUFS);
+
+        ret = posix_memalign((void *) &mgr, 16, sizeof(ISAL_HMAC_SHA1_CTX_MGR));
+        ret |= posix_memalign((void *) &ctxpool, 64, TEST_BUFS * sizeof(ISAL_HMAC_SHA1_CTX));
+        if ((ret != 0) || (mgr == NULL) || (ctxpool == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                aligned_free(mgr);
+                return 1;
+        }
+
+        if (isal_hmac_sha1_ctx_mgr_init(mgr) != 0) {
+                fail++;
+                goto end;
+        }
+
+        fail += test_vectors(mgr);
+
+        srand(TEST_SEED);
+
+        for (i = 0; i < TEST_KEYS; i++) {
+                rand_buffer(key_bufs[i], key_lens[i]);
+                if (isal_hmac_sha1_key_init(&keys[i], key_bufs[i], key_lens[i]) != 0) {
+                        fail++;
+                        goto end;
+                }
+        }
+
+        // Message lengths cover empty, partial, exact and multi-block messages
+        for (i = 0; i < TEST_BUFS; i++) {
+                lens[i] = (i * 37) % MAX_MSG;
+                if (i % 8 == 0)
+                        lens[i] = (i / 8) * ISAL_SHA1_BLOCK_SIZE % MAX_MSG;
+                rand_buffer(msgs[i], lens[i]);
+                hmac_sha1_ref(key_bufs[i % TEST_KEYS], key_lens[i % TEST_KEYS], msgs[i], lens[i],
+                              mac_ref[i]);
+                isal_hash_ctx_init(&ctxpool[i].hash_ctx);
+                ctxpool[i].user_data = (void *) ((uintptr_t) i);
+        }
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                ret = isal_hmac_sha1_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, &keys[i % TEST_KEYS],
+                                                    msgs[i], lens[i]);
+                if (ret) {
+                        fail++;
+                        goto end;
+                }
+                if (ctx != NULL) {
+                        completed++;
+                        fail += check_ctx(ctx, mac_ref[(uintptr_t) ctx->user_data],
+                                          (uint32_t) (uintptr_t) ctx->user_data);
+                }
+        }
+
+        while (1) {
+                ret = isal_hmac_sha1_ctx_mgr_flush(mgr, &ctx);
+                if (ret) {
+                        fail++;
+                        goto end;
+                }
+                if (ctx == NULL)
+                        break;
+                completed++;
+                fail += check_ctx(ctx, mac_ref[(uintptr_t) ctx->user_data],
+                                  (uint32_t) (uintptr_t) ctx->user_data);
+        }
+
+        if (completed != TEST_BUFS) {
+                printf("completed %d of %d jobs\n", completed, TEST_BUFS);
+                fail++;
+        }
+
+        // Resubmitting a context still in the manager must be rejected
+        isal_hash_ctx_init(&ctxpool[0].hash_ctx);
+        ret = isal_hmac_sha1_ctx_mgr_submit(mgr, &ctxpool[0], &ctx, &keys[0], msgs[0], MAX_MSG);
+        if (ret == 0 && ctx == NULL) {
+                ret = isal_hmac_sha1_ctx_mgr_submit(mgr, &ctxpool[0], &ctx, &keys[0], msgs[0],
+                                                    MAX_MSG);
+#ifdef SAFE_PARAM
+                if (ret != ISAL_CRYPTO_ERR_ALREADY_PROCESSING) {
+#else
+                if (ctx == NULL || ctx->hash_ctx.error != ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING) {
+#endif
+                        printf("resubmit of a processing context not rejected\n");
+                        fail++;
+                }
+                do {
+                        ret = isal_hmac_sha1_ctx_mgr_flush(mgr, &ctx);
+                } while (ret == 0 && ctx != NULL);
+        }
+
+end:
+        aligned_free(mgr);
+        aligned_free(ctxpool);
+
+        if (fail)
+                printf("Test failed function check %d\n", fail);
+        else
+                printf(" multibinary_hmac_sha1 test: Pass\n");
+
+        return fail;
+}
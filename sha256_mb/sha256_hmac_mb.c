@@ -0,0 +1,262 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <string.h>
+
+#include "sha256_mb_internal.h"
+#include "isal_crypto_api.h"
+#include "multi_buffer.h"
+#include "endian_helper.h"
+
+#define HMAC_IPAD 0x36
+#define HMAC_OPAD 0x5c
+
+/* Stage of an HMAC context in the manager */
+#define HMAC_STAGE_DONE  0
+#define HMAC_STAGE_INNER 1
+#define HMAC_STAGE_OUTER 2
+
+#define SHA256_DIGEST_BYTES (ISAL_SHA256_DIGEST_NWORDS * sizeof(ISAL_SHA256_WORD_T))
+
+static void
+sha256_digest_to_bytes(const ISAL_SHA256_WORD_T *digest, uint8_t *out)
+{
+        ISAL_SHA256_WORD_T word;
+        int i;
+
+        for (i = 0; i < ISAL_SHA256_DIGEST_NWORDS; i++) {
+                word = to_be32(digest[i]);
+                memcpy(out + i * sizeof(word), &word, sizeof(word));
+        }
+}
+
+/*
+ * Restart the hash context from a cached state that already absorbed one block
+ * (K ^ ipad or K ^ opad), and submit the rest of the message as the last update.
+ */
+static ISAL_SHA256_HASH_CTX *
+hmac_sha256_submit_from_state(ISAL_HMAC_SHA256_CTX_MGR *mgr, ISAL_HMAC_SHA256_CTX *ctx,
+                              const ISAL_SHA256_WORD_T *state, const void *buffer,
+                              const uint32_t len)
+{
+        ISAL_SHA256_HASH_CTX *hash_ctx = &ctx->hash_ctx;
+
+        memcpy(hash_ctx->job.result_digest, state, SHA256_DIGEST_BYTES);
+        hash_ctx->total_length = ISAL_SHA256_BLOCK_SIZE;
+        hash_ctx->partial_block_buffer_length = 0;
+        hash_ctx->error = ISAL_HASH_CTX_ERROR_NONE;
+        hash_ctx->status = ISAL_HASH_CTX_STS_IDLE;
+
+        return _sha256_ctx_mgr_submit(&mgr->mgr, hash_ctx, buffer, len, ISAL_HASH_LAST);
+}
+
+/*
+ * Handle a hash context returned by the underlying manager. Contexts that finished the
+ * inner hash are resubmitted for the outer hash in the same manager; a context is only
+ * handed back to the caller once its outer hash is complete (or on error).
+ */
+static ISAL_HMAC_SHA256_CTX *
+hmac_sha256_process(ISAL_HMAC_SHA256_CTX_MGR *mgr, ISAL_SHA256_HASH_CTX *hash_ctx)
+{
+        ISAL_HMAC_SHA256_CTX *ctx;
+
+        while (hash_ctx != NULL) {
+                ctx = (ISAL_HMAC_SHA256_CTX *) hash_ctx;
+
+                if (hash_ctx->error != ISAL_HASH_CTX_ERROR_NONE) {
+                        ctx->stage = HMAC_STAGE_DONE;
+                        return ctx;
+                }
+
+                if (ctx->stage == HMAC_STAGE_OUTER) {
+                        sha256_digest_to_bytes(hash_ctx->job.result_digest, ctx->mac);
+                        ctx->stage = HMAC_STAGE_DONE;
+                        return ctx;
+                }
+
+                sha256_digest_to_bytes(hash_ctx->job.result_digest, ctx->inner_digest);
+                ctx->stage = HMAC_STAGE_OUTER;
+                hash_ctx = hmac_sha256_submit_from_state(mgr, ctx, ctx->key->opad_digest,
+                                                         ctx->inner_digest, SHA256_DIGEST_BYTES);
+        }
+
+        return NULL;
+}
+
+/* Absorb one block of the padded key into a fresh state */
+static void
+hmac_sha256_pad_state(ISAL_SHA256_HASH_CTX_MGR *mgr, ISAL_SHA256_HASH_CTX *ctx,
+                      const uint8_t *block, ISAL_SHA256_WORD_T *state)
+{
+        ISAL_SHA256_HASH_CTX *done;
+
+        isal_hash_ctx_init(ctx);
+        done = _sha256_ctx_mgr_submit(mgr, ctx, block, ISAL_SHA256_BLOCK_SIZE, ISAL_HASH_FIRST);
+        while (done == NULL)
+                done = _sha256_ctx_mgr_flush(mgr);
+
+        memcpy(state, ctx->job.result_digest, SHA256_DIGEST_BYTES);
+}
+
+int
+isal_hmac_sha256_key_init(ISAL_HMAC_SHA256_KEY *key_data, const void *key, const uint32_t key_len)
+{
+        ISAL_SHA256_HASH_CTX_MGR mgr;
+        ISAL_SHA256_HASH_CTX ctx, *done;
+        uint8_t k0[ISAL_SHA256_BLOCK_SIZE];
+        uint8_t block[ISAL_SHA256_BLOCK_SIZE];
+        int i;
+
+#ifdef SAFE_PARAM
+        if (key_data == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+        if (key == NULL && key_len != 0)
+                return ISAL_CRYPTO_ERR_NULL_KEY;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        _sha256_ctx_mgr_init(&mgr);
+        memset(k0, 0, sizeof(k0));
+
+        /* Keys longer than a block are hashed first */
+        if (key_len > ISAL_SHA256_BLOCK_SIZE) {
+                isal_hash_ctx_init(&ctx);
+                done = _sha256_ctx_mgr_submit(&mgr, &ctx, key, key_len, ISAL_HASH_ENTIRE);
+                while (done == NULL)
+                        done = _sha256_ctx_mgr_flush(&mgr);
+                sha256_digest_to_bytes(ctx.job.result_digest, k0);
+        } else if (key_len != 0)
+                memcpy(k0, key, key_len);
+
+        for (i = 0; i < ISAL_SHA256_BLOCK_SIZE; i++)
+                block[i] = k0[i] ^ HMAC_IPAD;
+        hmac_sha256_pad_state(&mgr, &ctx, block, key_data->ipad_digest);
+
+        for (i = 0; i < ISAL_SHA256_BLOCK_SIZE; i++)
+                block[i] = k0[i] ^ HMAC_OPAD;
+        hmac_sha256_pad_state(&mgr, &ctx, block, key_data->opad_digest);
+
+        memset(k0, 0, sizeof(k0));
+        memset(block, 0, sizeof(block));
+        memset(&ctx, 0, sizeof(ctx));
+        /* The lanes of the manager still hold the key derived state */
+        memset(&mgr, 0, sizeof(mgr));
+
+        return 0;
+}
+
+int
+isal_hmac_sha256_ctx_mgr_init(ISAL_HMAC_SHA256_CTX_MGR *mgr)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        _sha256_ctx_mgr_init(&mgr->mgr);
+        mgr->mgr.latency_budget = 0;
+
+        return 0;
+}
+
+int
+isal_hmac_sha256_ctx_mgr_submit(ISAL_HMAC_SHA256_CTX_MGR *mgr, ISAL_HMAC_SHA256_CTX *ctx_in,
+                                ISAL_HMAC_SHA256_CTX **ctx_out, const ISAL_HMAC_SHA256_KEY *key,
+                                const void *buffer, const uint32_t len)
+{
+        ISAL_SHA256_HASH_CTX *hash_ctx;
+
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_in == NULL || ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (key == NULL)
+                return ISAL_CRYPTO_ERR_NULL_EXP_KEY;
+        if (buffer == NULL && len != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        if (ctx_in->hash_ctx.status & ISAL_HASH_CTX_STS_PROCESSING) {
+                ctx_in->hash_ctx.error = ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING;
+                *ctx_out = ctx_in;
+#ifdef SAFE_PARAM
+                return ISAL_CRYPTO_ERR_ALREADY_PROCESSING;
+#else
+                return 0;
+#endif
+        }
+
+        ctx_in->key = key;
+        ctx_in->stage = HMAC_STAGE_INNER;
+        hash_ctx = hmac_sha256_submit_from_state(mgr, ctx_in, key->ipad_digest, buffer, len);
+        *ctx_out = hmac_sha256_process(mgr, hash_ctx);
+
+        return 0;
+}
+
+int
+isal_hmac_sha256_ctx_mgr_flush(ISAL_HMAC_SHA256_CTX_MGR *mgr, ISAL_HMAC_SHA256_CTX **ctx_out)
+{
+        ISAL_SHA256_HASH_CTX *hash_ctx;
+
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        /* Flushing an inner hash resubmits its outer hash, so keep going until one is done */
+        do {
+                hash_ctx = _sha256_ctx_mgr_flush(&mgr->mgr);
+                *ctx_out = hmac_sha256_process(mgr, hash_ctx);
+        } while (*ctx_out == NULL && hash_ctx != NULL);
+
+        return 0;
+}
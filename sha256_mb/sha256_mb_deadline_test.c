@@ -0,0 +1,241 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sha256_mb.h"
+
+#define TEST_LEN    1024
+#define TEST_BUFS   3
+#define TEST_BUDGET 100
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+static uint32_t digest_ref[TEST_BUFS][ISAL_SHA256_DIGEST_NWORDS];
+
+// Compare against reference function
+extern void
+sha256_ref(uint8_t *input_data, uint32_t *digest, uint32_t len);
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+static int
+check_digests(ISAL_SHA256_HASH_CTX *ctxpool, const uint32_t num)
+{
+        uint32_t i, j;
+        int fail = 0;
+
+        for (i = 0; i < num; i++) {
+                if (ctxpool[i].status != ISAL_HASH_CTX_STS_COMPLETE) {
+                        fail++;
+                        printf("Test%d not completed\n", i);
+                        continue;
+                }
+                for (j = 0; j < ISAL_SHA256_DIGEST_NWORDS; j++) {
+                        if (ctxpool[i].job.result_digest[j] != digest_ref[i][j]) {
+                                fail++;
+                                printf("Test%d, digest%d fail 0x%08X <=> 0x%08X\n", i, j,
+                                       ctxpool[i].job.result_digest[j], digest_ref[i][j]);
+                        }
+                }
+        }
+
+        return fail;
+}
+
+int
+main(void)
+{
+        ISAL_SHA256_HASH_CTX_MGR *mgr = NULL;
+        ISAL_SHA256_HASH_CTX ctxpool[TEST_BUFS], *ctx = NULL;
+        unsigned char *bufs[TEST_BUFS] = { NULL };
+        uint32_t lens[TEST_BUFS];
+        uint32_t i, num, completed = 0;
+        int ret, fail = 0;
+
+        printf("sha256_mb deadline test, %d buffers, budget %d: ", TEST_BUFS, TEST_BUDGET);
+
+        ret = posix_memalign((void *) &mgr, 16, sizeof(ISAL_SHA256_HASH_CTX_MGR));
+        if ((ret != 0) || (mgr == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+
+        // Init must not depend on the manager memory being zeroed
+        memset(mgr, 0xab, sizeof(*mgr));
+        if (isal_sha256_ctx_mgr_init(mgr) != 0 ||
+            isal_sha256_ctx_mgr_set_deadline(mgr, TEST_BUDGET) != 0) {
+                fail++;
+                goto end;
+        }
+
+        ret = isal_sha256_ctx_mgr_poll(mgr, &ctx, UINT64_MAX);
+        if (ret || ctx != NULL) {
+                printf("poll returned a job from an empty manager\n");
+                fail++;
+                goto end;
+        }
+
+        srand(TEST_SEED);
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                lens[i] = TEST_LEN * (i + 1);
+                bufs[i] = (unsigned char *) malloc(lens[i]);
+                if (bufs[i] == NULL) {
+                        printf("malloc failed test aborted\n");
+                        fail++;
+                        goto end;
+                }
+                rand_buffer(bufs[i], lens[i]);
+                sha256_ref(bufs[i], digest_ref[i], lens[i]);
+                isal_hash_ctx_init(&ctxpool[i]);
+        }
+
+        // Jobs submitted at t = 0, 10, 20 must not be flushed before the oldest one is overdue
+        for (i = 0; i < TEST_BUFS; i++) {
+                ret = isal_sha256_ctx_mgr_submit_timed(mgr, &ctxpool[i], &ctx, bufs[i], lens[i],
+                                                       ISAL_HASH_ENTIRE, 10 * i);
+                if (ret) {
+                        fail++;
+                        goto end;
+                }
+                if (ctx != NULL)
+                        completed++;
+        }
+
+        ret = isal_sha256_ctx_mgr_poll(mgr, &ctx, TEST_BUDGET - 1);
+        if (ret || ctx != NULL) {
+                printf("poll returned a job before the deadline\n");
+                fail++;
+                goto end;
+        }
+
+        // Past the deadline of every job, polling must drain the manager
+        do {
+                ret = isal_sha256_ctx_mgr_poll(mgr, &ctx, 10 * TEST_BUFS + TEST_BUDGET);
+                if (ret) {
+                        fail++;
+                        goto end;
+                }
+                if (ctx != NULL)
+                        completed++;
+        } while (ctx != NULL);
+
+        if (completed != TEST_BUFS) {
+                printf("poll completed %d of %d jobs\n", completed, TEST_BUFS);
+                fail++;
+                goto end;
+        }
+        fail += check_digests(ctxpool, TEST_BUFS);
+
+        // A timed submit after the deadline of a waiting job must return a completed job
+        for (i = 0; i < 2; i++)
+                isal_hash_ctx_init(&ctxpool[i]);
+
+        num = 1;
+        ret = isal_sha256_ctx_mgr_submit_timed(mgr, &ctxpool[0], &ctx, bufs[0], lens[0],
+                                               ISAL_HASH_ENTIRE, 0);
+        if (ret == 0 && ctx == NULL) {
+                num = 2;
+                ret = isal_sha256_ctx_mgr_submit_timed(mgr, &ctxpool[1], &ctx, bufs[1], lens[1],
+                                                       ISAL_HASH_ENTIRE, TEST_BUDGET);
+        }
+        if (ret || ctx == NULL) {
+                printf("timed submit did not flush an overdue job\n");
+                fail++;
+                goto end;
+        }
+        do {
+                ret = isal_sha256_ctx_mgr_flush(mgr, &ctx);
+        } while (ret == 0 && ctx != NULL);
+
+        fail += check_digests(ctxpool, num);
+
+        // An untimed submit of a context last timed at t = 0 is never overdue, in a lane or
+        // in the slice mode queue
+        for (i = 0; i < 2; i++) {
+                isal_hash_ctx_init(&ctxpool[0]);
+                ret = isal_sha256_ctx_mgr_set_slice(mgr, 4 * i);
+                ret |= isal_sha256_ctx_mgr_submit(mgr, &ctxpool[0], &ctx, bufs[0], lens[0],
+                                                  ISAL_HASH_ENTIRE);
+                if (ret == 0 && ctx == NULL) {
+                        ret = isal_sha256_ctx_mgr_poll(mgr, &ctx, UINT64_MAX);
+                        if (ret || ctx != NULL) {
+                                printf("poll flushed an untimed job\n");
+                                fail++;
+                                goto end;
+                        }
+                        ret = isal_sha256_ctx_mgr_flush(mgr, &ctx);
+                }
+                ret |= isal_sha256_ctx_mgr_set_slice(mgr, 0);
+                if (ret) {
+                        fail++;
+                        goto end;
+                }
+                fail += check_digests(ctxpool, 1);
+        }
+
+        // With deadline mode disabled, poll never flushes
+        isal_hash_ctx_init(&ctxpool[0]);
+        ret = isal_sha256_ctx_mgr_set_deadline(mgr, 0);
+        ret |= isal_sha256_ctx_mgr_submit_timed(mgr, &ctxpool[0], &ctx, bufs[0], lens[0],
+                                                ISAL_HASH_ENTIRE, 0);
+        if (ret == 0 && ctx == NULL) {
+                ret = isal_sha256_ctx_mgr_poll(mgr, &ctx, UINT64_MAX);
+                if (ret || ctx != NULL) {
+                        printf("poll flushed with deadline mode disabled\n");
+                        fail++;
+                        goto end;
+                }
+                ret = isal_sha256_ctx_mgr_flush(mgr, &ctx);
+        }
+        if (ret) {
+                fail++;
+                goto end;
+        }
+        fail += check_digests(ctxpool, 1);
+
+end:
+        for (i = 0; i < TEST_BUFS; i++)
+                free(bufs[i]);
+        aligned_free(mgr);
+
+        printf(fail ? "Fail\n" : "Pass\n");
+
+        return fail;
+}
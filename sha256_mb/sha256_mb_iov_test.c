@@ -0,0 +1,243 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "sha256_mb.h"
+
+#define TEST_BUFS 40
+#define MAX_SEGS  64
+#define MAX_LEN   (MAX_SEGS * 2 * ISAL_SHA256_BLOCK_SIZE)
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+static uint32_t digest_ref[TEST_BUFS][ISAL_SHA256_DIGEST_NWORDS];
+static ISAL_HASH_IOVEC iov[TEST_BUFS][MAX_SEGS];
+static uint32_t num_segs[TEST_BUFS];
+
+// Compare against reference function
+extern void
+sha256_ref(uint8_t *input_data, uint32_t *digest, uint32_t len);
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+// Cut a buffer into fragments of random length, some of them empty or smaller than a block
+static void
+split_buffer(const unsigned char *buf, const uint32_t len, ISAL_HASH_IOVEC *segs, uint32_t *num)
+{
+        uint32_t n = 0, off = 0, seg_len;
+
+        while (off < len && n < MAX_SEGS - 1) {
+                seg_len = rand() % (2 * ISAL_SHA256_BLOCK_SIZE + 1);
+                if (seg_len > len - off)
+                        seg_len = len - off;
+                segs[n].buffer = buf + off;
+                segs[n].len = seg_len;
+                off += seg_len;
+                n++;
+        }
+        if (off < len) {
+                segs[n].buffer = buf + off;
+                segs[n].len = len - off;
+                n++;
+        }
+        *num = n;
+}
+
+static int
+check_digests(ISAL_SHA256_HASH_CTX *ctxpool, const uint32_t *returned)
+{
+        uint32_t i, j;
+        int fail = 0;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                if (ctxpool[i].status != ISAL_HASH_CTX_STS_COMPLETE || returned[i] != 1) {
+                        fail++;
+                        printf("Test%d not completed once\n", i);
+                        continue;
+                }
+                for (j = 0; j < ISAL_SHA256_DIGEST_NWORDS; j++) {
+                        if (ctxpool[i].job.result_digest[j] != digest_ref[i][j]) {
+                                fail++;
+                                printf("Test%d, digest%d fail 0x%08X <=> 0x%08X\n", i, j,
+                                       ctxpool[i].job.result_digest[j], digest_ref[i][j]);
+                        }
+                }
+        }
+
+        return fail;
+}
+
+static void
+mark_returned(ISAL_SHA256_HASH_CTX *ctx, uint32_t *returned)
+{
+        if (ctx != NULL && ctx->status == ISAL_HASH_CTX_STS_COMPLETE)
+                returned[(uintptr_t) ctx->user_data]++;
+}
+
+// Hash every buffer from its fragments in one submit, with some plain submits in between
+static int
+test_iov_entire(ISAL_SHA256_HASH_CTX_MGR *mgr, ISAL_SHA256_HASH_CTX *ctxpool,
+                unsigned char **bufs, const uint32_t *lens)
+{
+        ISAL_SHA256_HASH_CTX *ctx;
+        uint32_t returned[TEST_BUFS] = { 0 };
+        uint32_t i;
+        int ret;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                isal_hash_ctx_init(&ctxpool[i]);
+                ctxpool[i].user_data = (void *) (uintptr_t) i;
+                if (i % 5 == 4)
+                        ret = isal_sha256_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, bufs[i], lens[i],
+                                                         ISAL_HASH_ENTIRE);
+                else
+                        ret = isal_sha256_ctx_mgr_submit_iov(mgr, &ctxpool[i], &ctx, iov[i],
+                                                             num_segs[i], ISAL_HASH_ENTIRE);
+                if (ret != 0)
+                        return 1;
+                mark_returned(ctx, returned);
+        }
+        do {
+                if (isal_sha256_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return 1;
+                mark_returned(ctx, returned);
+        } while (ctx != NULL);
+
+        return check_digests(ctxpool, returned);
+}
+
+// Hash the first half of the fragments as FIRST and the rest as LAST
+static int
+test_iov_parts(ISAL_SHA256_HASH_CTX_MGR *mgr, ISAL_SHA256_HASH_CTX *ctxpool)
+{
+        ISAL_SHA256_HASH_CTX *ctx;
+        uint32_t returned[TEST_BUFS] = { 0 };
+        uint32_t started[TEST_BUFS] = { 0 };
+        uint32_t i, idx, half, next = 0;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                isal_hash_ctx_init(&ctxpool[i]);
+                ctxpool[i].user_data = (void *) (uintptr_t) i;
+        }
+
+        for (;;) {
+                // Start the next job, or take one back from the manager once all have started
+                if (next < TEST_BUFS)
+                        ctx = &ctxpool[next++];
+                else if (isal_sha256_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return 1;
+                else if (ctx == NULL)
+                        break;
+
+                while (ctx != NULL && ctx->status != ISAL_HASH_CTX_STS_COMPLETE) {
+                        idx = (uint32_t) (uintptr_t) ctx->user_data;
+                        half = num_segs[idx] / 2;
+                        if (started[idx]++ == 0) {
+                                if (isal_sha256_ctx_mgr_submit_iov(mgr, ctx, &ctx, iov[idx], half,
+                                                                   ISAL_HASH_FIRST) != 0)
+                                        return 1;
+                        } else if (isal_sha256_ctx_mgr_submit_iov(mgr, ctx, &ctx, iov[idx] + half,
+                                                                  num_segs[idx] - half,
+                                                                  ISAL_HASH_LAST) != 0)
+                                return 1;
+                }
+                mark_returned(ctx, returned);
+        }
+
+        return check_digests(ctxpool, returned);
+}
+
+int
+main(void)
+{
+        ISAL_SHA256_HASH_CTX_MGR *mgr = NULL;
+        ISAL_SHA256_HASH_CTX ctxpool[TEST_BUFS];
+        unsigned char *bufs[TEST_BUFS] = { NULL };
+        uint32_t lens[TEST_BUFS];
+        uint32_t i, slice;
+        int ret, fail = 0;
+
+        printf("sha256_mb iovec test, %d buffers: ", TEST_BUFS);
+
+        ret = posix_memalign((void *) &mgr, 16, sizeof(ISAL_SHA256_HASH_CTX_MGR));
+        if ((ret != 0) || (mgr == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+        if (isal_sha256_ctx_mgr_init(mgr) != 0) {
+                fail++;
+                goto end;
+        }
+
+        srand(TEST_SEED);
+
+        // Random lengths, including an empty message with no fragments
+        for (i = 0; i < TEST_BUFS; i++) {
+                lens[i] = i == 0 ? 0 : rand() % MAX_LEN;
+                bufs[i] = (unsigned char *) malloc(lens[i] + 1);
+                if (bufs[i] == NULL) {
+                        printf("malloc failed test aborted\n");
+                        fail++;
+                        goto end;
+                }
+                rand_buffer(bufs[i], lens[i]);
+                sha256_ref(bufs[i], digest_ref[i], lens[i]);
+                split_buffer(bufs[i], lens[i], iov[i], &num_segs[i]);
+        }
+
+        // Default mode, then slice mode where fragments are also cut into slices
+        for (slice = 0; slice <= 2; slice += 2) {
+                if (isal_sha256_ctx_mgr_set_slice(mgr, slice) != 0) {
+                        fail++;
+                        goto end;
+                }
+                fail += test_iov_entire(mgr, ctxpool, bufs, lens);
+                fail += test_iov_parts(mgr, ctxpool);
+        }
+
+end:
+        for (i = 0; i < TEST_BUFS; i++)
+                free(bufs[i]);
+        aligned_free(mgr);
+
+        if (fail)
+                printf("Test failed function check %d\n", fail);
+        else
+                printf("Pass\n");
+
+        return fail;
+}
@@ -0,0 +1,316 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "sha256_mb.h"
+
+#define TEST_BUFS  40
+#define SHORT_LEN  (4 * 1024)
+#define LONG_LEN   (256 * 1024)
+#define NUM_LONG   2
+#define TEST_PARTS 3
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+static uint32_t digest_ref[TEST_BUFS][ISAL_SHA256_DIGEST_NWORDS];
+static const uint32_t slice_sizes[] = { 1, 3, 16, 64 };
+
+// Compare against reference function
+extern void
+sha256_ref(uint8_t *input_data, uint32_t *digest, uint32_t len);
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+static int
+check_digests(ISAL_SHA256_HASH_CTX *ctxpool, const uint32_t *returned)
+{
+        uint32_t i, j;
+        int fail = 0;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                if (ctxpool[i].status != ISAL_HASH_CTX_STS_COMPLETE || returned[i] != 1) {
+                        fail++;
+                        printf("Test%d not completed once\n", i);
+                        continue;
+                }
+                for (j = 0; j < ISAL_SHA256_DIGEST_NWORDS; j++) {
+                        if (ctxpool[i].job.result_digest[j] != digest_ref[i][j]) {
+                                fail++;
+                                printf("Test%d, digest%d fail 0x%08X <=> 0x%08X\n", i, j,
+                                       ctxpool[i].job.result_digest[j], digest_ref[i][j]);
+                        }
+                }
+        }
+
+        return fail;
+}
+
+static void
+mark_returned(ISAL_SHA256_HASH_CTX *ctx, uint32_t *returned)
+{
+        if (ctx != NULL && ctx->status == ISAL_HASH_CTX_STS_COMPLETE)
+                returned[(uintptr_t) ctx->user_data]++;
+}
+
+// Hash all buffers in one go each, long jobs submitted last
+static int
+test_entire(ISAL_SHA256_HASH_CTX_MGR *mgr, ISAL_SHA256_HASH_CTX *ctxpool,
+            unsigned char **bufs, const uint32_t *lens)
+{
+        ISAL_SHA256_HASH_CTX *ctx;
+        uint32_t returned[TEST_BUFS] = { 0 };
+        uint32_t i;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                isal_hash_ctx_init(&ctxpool[i]);
+                ctxpool[i].user_data = (void *) (uintptr_t) i;
+                if (isal_sha256_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, bufs[i], lens[i],
+                                               ISAL_HASH_ENTIRE) != 0)
+                        return 1;
+                mark_returned(ctx, returned);
+        }
+        do {
+                if (isal_sha256_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return 1;
+                mark_returned(ctx, returned);
+        } while (ctx != NULL);
+
+        return check_digests(ctxpool, returned);
+}
+
+// Leaving slice mode must be refused until every job has been flushed out of the manager
+static int
+test_mode_change(ISAL_SHA256_HASH_CTX_MGR *mgr, ISAL_SHA256_HASH_CTX *ctxpool,
+                 unsigned char **bufs, const uint32_t *lens)
+{
+        ISAL_SHA256_HASH_CTX *ctx;
+        uint32_t returned[TEST_BUFS] = { 0 };
+        uint32_t i, num_returned = 0;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                isal_hash_ctx_init(&ctxpool[i]);
+                ctxpool[i].user_data = (void *) (uintptr_t) i;
+                if (isal_sha256_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, bufs[i], lens[i],
+                                               ISAL_HASH_ENTIRE) != 0)
+                        return 1;
+                mark_returned(ctx, returned);
+                num_returned += (ctx != NULL);
+        }
+        do {
+                if (num_returned < TEST_BUFS && isal_sha256_ctx_mgr_set_slice(mgr, 0) == 0) {
+                        printf("slice mode left with %d jobs in the manager\n",
+                               TEST_BUFS - num_returned);
+                        return 1;
+                }
+                if (isal_sha256_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return 1;
+                mark_returned(ctx, returned);
+                num_returned += (ctx != NULL);
+        } while (ctx != NULL);
+
+        if (isal_sha256_ctx_mgr_set_slice(mgr, 0) != 0) {
+                printf("slice mode change refused on an empty manager\n");
+                return 1;
+        }
+
+        return check_digests(ctxpool, returned);
+}
+
+// A timed job still in the slice mode queue must be flushed out once its budget is spent
+static int
+test_deadline(ISAL_SHA256_HASH_CTX_MGR *mgr, ISAL_SHA256_HASH_CTX *ctxpool,
+              unsigned char **bufs, const uint32_t *lens)
+{
+        ISAL_SHA256_HASH_CTX *ctx;
+        uint32_t returned[TEST_BUFS] = { 0 };
+        uint32_t i;
+        int fail = 0;
+
+        if (isal_sha256_ctx_mgr_set_deadline(mgr, 10) != 0)
+                return 1;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                isal_hash_ctx_init(&ctxpool[i]);
+                ctxpool[i].user_data = (void *) (uintptr_t) i;
+                if (isal_sha256_ctx_mgr_submit_timed(mgr, &ctxpool[i], &ctx, bufs[i], lens[i],
+                                                     ISAL_HASH_ENTIRE, 0) != 0)
+                        return 1;
+                if (ctx != NULL) {
+                        printf("queued job returned before its deadline\n");
+                        return 1;
+                }
+                if (isal_sha256_ctx_mgr_poll(mgr, &ctx, 5) != 0)
+                        return 1;
+                if (ctx != NULL) {
+                        printf("queued job returned before its deadline\n");
+                        return 1;
+                }
+                if (isal_sha256_ctx_mgr_poll(mgr, &ctx, 1000000) != 0)
+                        return 1;
+                if (ctx != &ctxpool[i]) {
+                        printf("Test%d overdue job not returned from the queue\n", i);
+                        return 1;
+                }
+                mark_returned(ctx, returned);
+                if (isal_sha256_ctx_mgr_flush(mgr, &ctx) != 0 || ctx != NULL)
+                        return 1;
+        }
+
+        if (isal_sha256_ctx_mgr_set_deadline(mgr, 0) != 0)
+                return 1;
+
+        fail += check_digests(ctxpool, returned);
+
+        return fail;
+}
+
+// Hash all buffers as FIRST, UPDATE ... LAST parts, resubmitting each context when returned
+static int
+test_parts(ISAL_SHA256_HASH_CTX_MGR *mgr, ISAL_SHA256_HASH_CTX *ctxpool,
+           unsigned char **bufs, const uint32_t *lens)
+{
+        ISAL_SHA256_HASH_CTX *ctx;
+        uint32_t returned[TEST_BUFS] = { 0 };
+        uint32_t part[TEST_BUFS] = { 0 };
+        uint32_t i, idx, off, len, next = 0;
+        ISAL_HASH_CTX_FLAG flags;
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                isal_hash_ctx_init(&ctxpool[i]);
+                ctxpool[i].user_data = (void *) (uintptr_t) i;
+        }
+
+        for (;;) {
+                // Start the next job, or take one back from the manager once all have started
+                if (next < TEST_BUFS)
+                        ctx = &ctxpool[next++];
+                else if (isal_sha256_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return 1;
+                else if (ctx == NULL)
+                        break;
+
+                // Submit the next part of every context that is handed back unfinished
+                while (ctx != NULL && ctx->status != ISAL_HASH_CTX_STS_COMPLETE) {
+                        idx = (uint32_t) (uintptr_t) ctx->user_data;
+                        // Odd sized parts so that the slices do not line up with the parts
+                        off = lens[idx] / TEST_PARTS * part[idx];
+                        len = part[idx] == TEST_PARTS - 1 ? lens[idx] - off
+                                                           : lens[idx] / TEST_PARTS;
+                        if (part[idx] == 0)
+                                flags = ISAL_HASH_FIRST;
+                        else if (part[idx] == TEST_PARTS - 1)
+                                flags = ISAL_HASH_LAST;
+                        else
+                                flags = ISAL_HASH_UPDATE;
+                        part[idx]++;
+                        if (isal_sha256_ctx_mgr_submit(mgr, ctx, &ctx, bufs[idx] + off, len,
+                                                       flags) != 0)
+                                return 1;
+                }
+                mark_returned(ctx, returned);
+        }
+
+        return check_digests(ctxpool, returned);
+}
+
+int
+main(void)
+{
+        ISAL_SHA256_HASH_CTX_MGR *mgr = NULL;
+        ISAL_SHA256_HASH_CTX ctxpool[TEST_BUFS];
+        unsigned char *bufs[TEST_BUFS] = { NULL };
+        uint32_t lens[TEST_BUFS];
+        uint32_t i, s;
+        int ret, fail = 0;
+
+        printf("sha256_mb slice test, %d buffers: ", TEST_BUFS);
+
+        ret = posix_memalign((void *) &mgr, 16, sizeof(ISAL_SHA256_HASH_CTX_MGR));
+        if ((ret != 0) || (mgr == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+        if (isal_sha256_ctx_mgr_init(mgr) != 0) {
+                fail++;
+                goto end;
+        }
+
+        srand(TEST_SEED);
+
+        // Mostly short jobs of varying length, with a few long ones at the end
+        for (i = 0; i < TEST_BUFS; i++) {
+                if (i >= TEST_BUFS - NUM_LONG)
+                        lens[i] = LONG_LEN + i;
+                else
+                        lens[i] = SHORT_LEN - 7 * i;
+                bufs[i] = (unsigned char *) malloc(lens[i]);
+                if (bufs[i] == NULL) {
+                        printf("malloc failed test aborted\n");
+                        fail++;
+                        goto end;
+                }
+                rand_buffer(bufs[i], lens[i]);
+                sha256_ref(bufs[i], digest_ref[i], lens[i]);
+        }
+
+        for (s = 0; s < sizeof(slice_sizes) / sizeof(slice_sizes[0]); s++) {
+                if (isal_sha256_ctx_mgr_set_slice(mgr, slice_sizes[s]) != 0) {
+                        fail++;
+                        goto end;
+                }
+                fail += test_entire(mgr, ctxpool, bufs, lens);
+                fail += test_parts(mgr, ctxpool, bufs, lens);
+                fail += test_deadline(mgr, ctxpool, bufs, lens);
+        }
+
+        // Back to the default mode, once the manager is empty
+        fail += test_mode_change(mgr, ctxpool, bufs, lens);
+        fail += test_entire(mgr, ctxpool, bufs, lens);
+
+end:
+        for (i = 0; i < TEST_BUFS; i++)
+                free(bufs[i]);
+        aligned_free(mgr);
+
+        if (fail)
+                printf("Test failed function check %d\n", fail);
+        else
+                printf("Pass\n");
+
+        return fail;
+}
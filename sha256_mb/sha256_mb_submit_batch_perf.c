@@ -0,0 +1,174 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sha256_mb.h"
+#include "test.h"
+
+// Many small jobs, where the cost of each submit call shows
+#define TEST_BUFS 256
+#define TEST_LEN  64
+
+#ifndef TEST_LOOPS
+#define TEST_LOOPS 2000
+#endif
+
+#define TEST_TYPE_STR "_warm"
+
+static ISAL_SHA256_HASH_CTX ctxpool[TEST_BUFS];
+static ISAL_SHA256_HASH_CTX *ctxs[TEST_BUFS], *done[TEST_BUFS];
+static const void *bufs[TEST_BUFS];
+static uint32_t lens[TEST_BUFS];
+static ISAL_HASH_CTX_FLAG flags[TEST_BUFS];
+static uint32_t digest_ref[TEST_BUFS][ISAL_SHA256_DIGEST_NWORDS];
+
+static int
+flush_all(ISAL_SHA256_HASH_CTX_MGR *mgr)
+{
+        ISAL_SHA256_HASH_CTX *ctx;
+
+        do {
+                if (isal_sha256_ctx_mgr_flush(mgr, &ctx))
+                        return -1;
+        } while (ctx != NULL);
+
+        return 0;
+}
+
+static void
+reset_ctxs(void)
+{
+        uint32_t i;
+
+        for (i = 0; i < TEST_BUFS; i++)
+                isal_hash_ctx_init(&ctxpool[i]);
+}
+
+int
+main(void)
+{
+        ISAL_SHA256_HASH_CTX_MGR *mgr = NULL;
+        ISAL_SHA256_HASH_CTX *ctx = NULL;
+        uint8_t *data;
+        uint32_t i, j, t, n, fail = 0;
+        struct perf start, stop;
+
+        data = (uint8_t *) malloc((size_t) TEST_BUFS * TEST_LEN);
+        if (data == NULL) {
+                printf("malloc failed test aborted\n");
+                return 1;
+        }
+        for (i = 0; i < TEST_BUFS * TEST_LEN; i++)
+                data[i] = (uint8_t) rand();
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                ctxs[i] = &ctxpool[i];
+                bufs[i] = data + (size_t) i * TEST_LEN;
+                lens[i] = TEST_LEN;
+                flags[i] = ISAL_HASH_ENTIRE;
+        }
+
+        int ret = posix_memalign((void *) &mgr, 16, sizeof(ISAL_SHA256_HASH_CTX_MGR));
+        if (ret) {
+                printf("alloc error: Fail");
+                free(data);
+                return -1;
+        }
+        ret = isal_sha256_ctx_mgr_init(mgr);
+        if (ret)
+                goto end;
+
+        // One submit call per job
+        perf_start(&start);
+        for (t = 0; t < TEST_LOOPS; t++) {
+                reset_ctxs();
+                for (i = 0; i < TEST_BUFS; i++) {
+                        ret = isal_sha256_ctx_mgr_submit(mgr, ctxs[i], &ctx, bufs[i], lens[i],
+                                                         flags[i]);
+                        if (ret)
+                                goto end;
+                }
+                ret = flush_all(mgr);
+                if (ret)
+                        goto end;
+        }
+        perf_stop(&stop);
+
+        printf("sha256_ctx_mgr_submit" TEST_TYPE_STR ": ");
+        perf_print(stop, start, (long long) TEST_LEN * TEST_BUFS * t);
+
+        for (i = 0; i < TEST_BUFS; i++)
+                memcpy(digest_ref[i], ctxpool[i].job.result_digest, sizeof(digest_ref[i]));
+
+        // One submit call for all jobs
+        perf_start(&start);
+        for (t = 0; t < TEST_LOOPS; t++) {
+                reset_ctxs();
+                ret = isal_sha256_ctx_mgr_submit_batch(mgr, ctxs, bufs, lens, flags, TEST_BUFS,
+                                                       done, &n);
+                if (ret)
+                        goto end;
+                ret = flush_all(mgr);
+                if (ret)
+                        goto end;
+        }
+        perf_stop(&stop);
+
+        printf("sha256_ctx_mgr_submit_batch" TEST_TYPE_STR ": ");
+        perf_print(stop, start, (long long) TEST_LEN * TEST_BUFS * t);
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                for (j = 0; j < ISAL_SHA256_DIGEST_NWORDS; j++) {
+                        if (ctxpool[i].job.result_digest[j] != digest_ref[i][j]) {
+                                fail++;
+                                printf("Test%d, digest%d fail %08X <=> %08X\n", i, j,
+                                       ctxpool[i].job.result_digest[j], digest_ref[i][j]);
+                        }
+                }
+        }
+
+        printf("Multi-buffer sha256 batch submit test complete %d buffers of %d B with "
+               "%d iterations\n",
+               TEST_BUFS, TEST_LEN, TEST_LOOPS);
+
+end:
+        if (ret)
+                printf("Test failed with error %d\n", ret);
+        else if (fail)
+                printf("Test failed function check %d\n", fail);
+        else
+                printf(" multibinary_sha256_submit_batch_perf: Pass\n");
+
+        aligned_free(mgr);
+        free(data);
+
+        return ret || fail;
+}
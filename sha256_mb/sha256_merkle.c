@@ -0,0 +1,182 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <string.h>
+
+#include "sha256_mb_internal.h"
+#include "isal_crypto_api.h"
+#include "multi_buffer.h"
+#include "endian_helper.h"
+
+#define SHA256_DIGEST_BYTES (ISAL_SHA256_DIGEST_NWORDS * sizeof(ISAL_SHA256_WORD_T))
+
+/* Domain separation prefixes of leaf and interior node messages, as in RFC 6962 */
+#define SHA256_MERKLE_LEAF 0x00
+#define SHA256_MERKLE_NODE 0x01
+
+static void
+sha256_digest_to_bytes(const ISAL_SHA256_WORD_T *digest, uint8_t *out)
+{
+        ISAL_SHA256_WORD_T word;
+        int i;
+
+        for (i = 0; i < ISAL_SHA256_DIGEST_NWORDS; i++) {
+                word = to_be32(digest[i]);
+                memcpy(out + i * sizeof(word), &word, sizeof(word));
+        }
+}
+
+static uint64_t
+sha256_merkle_leaves(const uint64_t len, const uint32_t chunk_size)
+{
+        if (len == 0)
+                return 1;
+        return (len - 1) / chunk_size + 1;
+}
+
+static uint64_t
+sha256_merkle_parents(const uint64_t count, const uint32_t fanout)
+{
+        return (count - 1) / fanout + 1;
+}
+
+/*
+ * Hash one level: message i is the prefix byte followed by the msg_len bytes at
+ * src + i * msg_len, the last one cut short at src_len. Messages are submitted in batches of
+ * ISAL_SHA256_MAX_LANES and the digests are only written out once the whole batch is done,
+ * so out may point at src when messages are at least one digest long.
+ */
+static void
+sha256_merkle_level(ISAL_SHA256_HASH_CTX_MGR *mgr, ISAL_SHA256_HASH_CTX *ctxs,
+                    const uint8_t *src, const uint64_t src_len, const uint64_t msg_len,
+                    const uint64_t count, const uint8_t prefix, uint8_t *out)
+{
+        uint64_t base, offset, batch, len, i;
+
+        for (base = 0; base < count; base += batch) {
+                batch = count - base;
+                if (batch > ISAL_SHA256_MAX_LANES)
+                        batch = ISAL_SHA256_MAX_LANES;
+
+                for (i = 0; i < batch; i++) {
+                        offset = (base + i) * msg_len;
+                        len = src_len - offset < msg_len ? src_len - offset : msg_len;
+                        isal_hash_ctx_init(&ctxs[i]);
+                        /* The prefix alone is less than a block, it only gets buffered */
+                        _sha256_ctx_mgr_submit(mgr, &ctxs[i], &prefix, 1, ISAL_HASH_FIRST);
+                        _sha256_ctx_mgr_submit(mgr, &ctxs[i], src + offset, (uint32_t) len,
+                                               ISAL_HASH_LAST);
+                }
+                while (_sha256_ctx_mgr_flush(mgr) != NULL)
+                        ;
+
+                for (i = 0; i < batch; i++)
+                        sha256_digest_to_bytes(ctxs[i].job.result_digest,
+                                               out + (base + i) * SHA256_DIGEST_BYTES);
+        }
+}
+
+int
+isal_sha256_merkle_tree_nodes(const uint64_t len, const uint32_t chunk_size, const uint32_t fanout,
+                              uint64_t *num_nodes)
+{
+        uint64_t count;
+
+#ifdef SAFE_PARAM
+        if (num_nodes == NULL)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+#endif
+        if (chunk_size == 0 || fanout < 2 || fanout > UINT32_MAX / SHA256_DIGEST_BYTES)
+                return ISAL_CRYPTO_ERR_TREE_SHAPE;
+
+        count = sha256_merkle_leaves(len, chunk_size);
+        *num_nodes = count;
+        while (count > 1) {
+                count = sha256_merkle_parents(count, fanout);
+                *num_nodes += count;
+        }
+
+        return 0;
+}
+
+int
+isal_sha256_merkle_tree(const void *data, const uint64_t len, const uint32_t chunk_size,
+                        const uint32_t fanout, uint8_t *nodes, const uint64_t nodes_len,
+                        uint8_t *root)
+{
+        ISAL_SHA256_HASH_CTX_MGR mgr;
+        ISAL_SHA256_HASH_CTX ctxs[ISAL_SHA256_MAX_LANES];
+        uint64_t num_nodes, count, parents;
+        uint8_t *level, *next;
+        int full, ret;
+
+#ifdef SAFE_PARAM
+        if (data == NULL && len != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        if (nodes == NULL || root == NULL)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+#endif
+        ret = isal_sha256_merkle_tree_nodes(len, chunk_size, fanout, &num_nodes);
+        if (ret != 0)
+                return ret;
+
+        count = sha256_merkle_leaves(len, chunk_size);
+        if (nodes_len / SHA256_DIGEST_BYTES < count)
+                return ISAL_CRYPTO_ERR_DST_LEN;
+        full = nodes_len / SHA256_DIGEST_BYTES >= num_nodes;
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+        _sha256_ctx_mgr_init(&mgr);
+
+        level = nodes;
+        sha256_merkle_level(&mgr, ctxs, (const uint8_t *) data, len, chunk_size, count,
+                            SHA256_MERKLE_LEAF, level);
+
+        /*
+         * Without room for the whole tree, each level overwrites the one below. Parent i
+         * only reads children from index i * fanout on, so the batched write-back never
+         * clobbers a child that is still to be hashed.
+         */
+        while (count > 1) {
+                parents = sha256_merkle_parents(count, fanout);
+                next = full ? level + count * SHA256_DIGEST_BYTES : level;
+                sha256_merkle_level(&mgr, ctxs, level, count * SHA256_DIGEST_BYTES,
+                                    (uint64_t) fanout * SHA256_DIGEST_BYTES, parents,
+                                    SHA256_MERKLE_NODE, next);
+                level = next;
+                count = parents;
+        }
+
+        memcpy(root, level, SHA256_DIGEST_BYTES);
+
+        return 0;
+}
@@ -0,0 +1,192 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sha256_mb.h"
+#include "isal_crypto_api.h"
+
+#define MAX_LEN   (64 * 1024 + 5)
+#define MAX_NODES (2 * MAX_LEN + 64)
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+#define DIGEST_BYTES (ISAL_SHA256_DIGEST_NWORDS * sizeof(ISAL_SHA256_WORD_T))
+
+// Compare against reference function
+extern void
+sha256_ref(uint8_t *input_data, ISAL_SHA256_WORD_T *digest, uint32_t len);
+
+static uint8_t data[MAX_LEN];
+static uint8_t nodes[MAX_NODES * DIGEST_BYTES];
+static uint8_t ref_nodes[MAX_NODES * DIGEST_BYTES];
+static uint8_t ref_buf[MAX_LEN + 64];
+
+// SHA256 of the leaf prefix alone, the root of a tree over no data
+static const uint8_t empty_root[DIGEST_BYTES] = {
+        0x6e, 0x34, 0x0b, 0x9c, 0xff, 0xb3, 0x7a, 0x98, 0x9c, 0xa5, 0x44, 0xe6, 0xbb, 0x78, 0x0a,
+        0x2c, 0x78, 0x90, 0x1d, 0x3f, 0xb3, 0x37, 0x38, 0x76, 0x85, 0x11, 0xa3, 0x06, 0x17, 0xaf,
+        0xa0, 0x1d
+};
+
+static const uint32_t chunk_sizes[] = { 1, 63, 64, 100, 1024, 4096 };
+static const uint32_t fanouts[] = { 2, 3, 4, 16, 17 };
+static const uint64_t lens[] = { 0, 1, 63, 64, 65, 1000, 4096, 4097, MAX_LEN };
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+static void
+ref_hash(uint8_t prefix, const uint8_t *msg, uint32_t len, uint8_t *out)
+{
+        ISAL_SHA256_WORD_T digest[ISAL_SHA256_DIGEST_NWORDS];
+        uint32_t i;
+
+        ref_buf[0] = prefix;
+        memcpy(ref_buf + 1, msg, len);
+        sha256_ref(ref_buf, digest, len + 1);
+        for (i = 0; i < ISAL_SHA256_DIGEST_NWORDS; i++) {
+                out[4 * i] = (uint8_t) (digest[i] >> 24);
+                out[4 * i + 1] = (uint8_t) (digest[i] >> 16);
+                out[4 * i + 2] = (uint8_t) (digest[i] >> 8);
+                out[4 * i + 3] = (uint8_t) digest[i];
+        }
+}
+
+// Reference tree built level by level with the single buffer hash, returns number of nodes
+static uint64_t
+ref_merkle_tree(uint64_t len, uint32_t chunk_size, uint32_t fanout)
+{
+        uint64_t count, i, n, off, level = 0, next;
+
+        count = len == 0 ? 1 : (len + chunk_size - 1) / chunk_size;
+        for (i = 0; i < count; i++) {
+                off = i * chunk_size;
+                n = len - off < chunk_size ? len - off : chunk_size;
+                ref_hash(0x00, data + off, (uint32_t) n, ref_nodes + i * DIGEST_BYTES);
+        }
+        next = count;
+
+        while (count > 1) {
+                for (i = 0; i * fanout < count; i++) {
+                        n = count - i * fanout < fanout ? count - i * fanout : fanout;
+                        ref_hash(0x01, ref_nodes + (level + i * fanout) * DIGEST_BYTES,
+                                 (uint32_t) (n * DIGEST_BYTES),
+                                 ref_nodes + (next + i) * DIGEST_BYTES);
+                }
+                level = next;
+                next += i;
+                count = i;
+        }
+
+        return next;
+}
+
+static int
+test_tree(uint64_t len, uint32_t chunk_size, uint32_t fanout)
+{
+        uint8_t root[DIGEST_BYTES];
+        uint64_t num_nodes, ref_num;
+        uint64_t leaves = len == 0 ? 1 : (len + chunk_size - 1) / chunk_size;
+
+        if (leaves * 2 + 64 > MAX_NODES)
+                return 0;
+
+        ref_num = ref_merkle_tree(len, chunk_size, fanout);
+        if (isal_sha256_merkle_tree_nodes(len, chunk_size, fanout, &num_nodes) != 0 ||
+            num_nodes != ref_num) {
+                printf("len=%u chunk=%u fanout=%u wrong node count\n", (uint32_t) len,
+                       chunk_size, fanout);
+                return 1;
+        }
+
+        // Full tree
+        memset(nodes, 0, sizeof(nodes));
+        if (isal_sha256_merkle_tree(data, len, chunk_size, fanout, nodes,
+                                    num_nodes * DIGEST_BYTES, root) != 0) {
+                printf("len=%u chunk=%u fanout=%u failed\n", (uint32_t) len, chunk_size, fanout);
+                return 1;
+        }
+        if (memcmp(nodes, ref_nodes, num_nodes * DIGEST_BYTES) ||
+            memcmp(root, ref_nodes + (num_nodes - 1) * DIGEST_BYTES, DIGEST_BYTES)) {
+                printf("len=%u chunk=%u fanout=%u tree mismatch\n", (uint32_t) len, chunk_size,
+                       fanout);
+                return 1;
+        }
+
+        // Root only, levels reduced in place over the leaves
+        memset(root, 0, sizeof(root));
+        if (isal_sha256_merkle_tree(data, len, chunk_size, fanout, nodes, leaves * DIGEST_BYTES,
+                                    root) != 0 ||
+            memcmp(root, ref_nodes + (num_nodes - 1) * DIGEST_BYTES, DIGEST_BYTES)) {
+                printf("len=%u chunk=%u fanout=%u in place root mismatch\n", (uint32_t) len,
+                       chunk_size, fanout);
+                return 1;
+        }
+
+        return 0;
+}
+
+int
+main(void)
+{
+        uint8_t root[DIGEST_BYTES];
+        uint32_t l, c, f;
+        int fail = 0;
+
+        printf("sha256_merkle_test: ");
+        srand(TEST_SEED);
+        rand_buffer(data, sizeof(data));
+
+        if (isal_sha256_merkle_tree(data, 0, 64, 2, nodes, DIGEST_BYTES, root) != 0 ||
+            memcmp(root, empty_root, DIGEST_BYTES)) {
+                printf("empty tree mismatch\n");
+                fail++;
+        }
+
+        for (l = 0; l < sizeof(lens) / sizeof(lens[0]); l++)
+                for (c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); c++)
+                        for (f = 0; f < sizeof(fanouts) / sizeof(fanouts[0]); f++)
+                                fail += test_tree(lens[l], chunk_sizes[c], fanouts[f]);
+
+        if (fail)
+                printf("Test failed function check %d\n", fail);
+        else
+                printf(" multibinary_sha256 merkle test: Pass\n");
+
+        return fail;
+}
@@ -0,0 +1,291 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <string.h>
+
+#include "sha256_mb_internal.h"
+#include "isal_crypto_api.h"
+#include "multi_buffer.h"
+#include "endian_helper.h"
+
+#define SHA256_DIGEST_BYTES (ISAL_SHA256_DIGEST_NWORDS * sizeof(ISAL_SHA256_WORD_T))
+
+/* Stage of a lane, i.e. which hash its context is running */
+#define PBKDF2_STAGE_SALT  0 /* U1 inner hash, salt */
+#define PBKDF2_STAGE_FIRST 1 /* U1 inner hash, block index */
+#define PBKDF2_STAGE_INNER 2 /* Ui inner hash */
+#define PBKDF2_STAGE_OUTER 3 /* Ui outer hash */
+
+/*
+ * One output block of a derivation in flight. After U1, every hash is the HMAC key state
+ * followed by exactly one block: a digest and the fixed padding for a one block message
+ * after the key block. That padded block is built once per lane and only its first
+ * digest bytes change, so each step is a single block update that the ctx manager
+ * passes straight to the lanes.
+ */
+struct pbkdf2_sha256_lane {
+        ISAL_SHA256_HASH_CTX ctx; // Must be at struct offset 0.
+        const ISAL_PBKDF2_SHA256_JOB *job;
+        const ISAL_HMAC_SHA256_KEY *key;
+        ISAL_SHA256_WORD_T t[ISAL_SHA256_DIGEST_NWORDS];
+        uint8_t block[ISAL_SHA256_BLOCK_SIZE];
+        uint8_t block_index[4];
+        uint32_t index;
+        uint32_t iteration;
+        uint32_t stage;
+};
+
+static void
+pbkdf2_sha256_digest_to_block(const ISAL_SHA256_WORD_T *digest, uint8_t *block)
+{
+        ISAL_SHA256_WORD_T word;
+        int i;
+
+        for (i = 0; i < ISAL_SHA256_DIGEST_NWORDS; i++) {
+                word = to_be32(digest[i]);
+                memcpy(block + i * sizeof(word), &word, sizeof(word));
+        }
+}
+
+static ISAL_SHA256_HASH_CTX *
+pbkdf2_sha256_submit(ISAL_SHA256_HASH_CTX_MGR *mgr, struct pbkdf2_sha256_lane *lane,
+                     const ISAL_SHA256_WORD_T *state, const void *buffer, const uint32_t len,
+                     const ISAL_HASH_CTX_FLAG flags)
+{
+        ISAL_SHA256_HASH_CTX *ctx = &lane->ctx;
+
+        if (state != NULL) {
+                memcpy(ctx->job.result_digest, state, SHA256_DIGEST_BYTES);
+                ctx->total_length = ISAL_SHA256_BLOCK_SIZE;
+                ctx->partial_block_buffer_length = 0;
+        }
+        ctx->error = ISAL_HASH_CTX_ERROR_NONE;
+        ctx->status = ISAL_HASH_CTX_STS_IDLE;
+
+        return _sha256_ctx_mgr_submit(mgr, ctx, buffer, len, flags);
+}
+
+/* Start computing output block (index) of a derivation: U1 = PRF(P, S || INT(index)) */
+static ISAL_SHA256_HASH_CTX *
+pbkdf2_sha256_start(ISAL_SHA256_HASH_CTX_MGR *mgr, struct pbkdf2_sha256_lane *lane,
+                    const ISAL_PBKDF2_SHA256_JOB *job, const ISAL_HMAC_SHA256_KEY *key,
+                    const uint32_t index)
+{
+        const uint32_t index_be = to_be32(index);
+        const uint64_t pad_len = (ISAL_SHA256_BLOCK_SIZE + SHA256_DIGEST_BYTES) * 8;
+        uint32_t i;
+
+        lane->job = job;
+        lane->key = key;
+        lane->index = index;
+        lane->iteration = 1;
+        memcpy(lane->block_index, &index_be, sizeof(index_be));
+
+        memset(lane->block, 0, sizeof(lane->block));
+        lane->block[SHA256_DIGEST_BYTES] = 0x80;
+        for (i = 0; i < 8; i++)
+                lane->block[ISAL_SHA256_BLOCK_SIZE - 1 - i] = (uint8_t) (pad_len >> (8 * i));
+
+        if (job->salt_len == 0) {
+                lane->stage = PBKDF2_STAGE_FIRST;
+                return pbkdf2_sha256_submit(mgr, lane, key->ipad_digest, lane->block_index,
+                                            sizeof(lane->block_index), ISAL_HASH_LAST);
+        }
+
+        lane->stage = PBKDF2_STAGE_SALT;
+        return pbkdf2_sha256_submit(mgr, lane, key->ipad_digest, job->salt, job->salt_len,
+                                    ISAL_HASH_UPDATE);
+}
+
+/*
+ * Advance a lane whose hash just completed. Returns the context handed back by the manager
+ * on resubmission (which may belong to another lane), or NULL. *done is set when the lane
+ * has finished its output block.
+ */
+static ISAL_SHA256_HASH_CTX *
+pbkdf2_sha256_step(ISAL_SHA256_HASH_CTX_MGR *mgr, struct pbkdf2_sha256_lane *lane, int *done)
+{
+        const ISAL_PBKDF2_SHA256_JOB *job = lane->job;
+        const ISAL_SHA256_WORD_T *digest = lane->ctx.job.result_digest;
+        uint8_t out[SHA256_DIGEST_BYTES];
+        uint32_t i, offset, len;
+
+        switch (lane->stage) {
+        case PBKDF2_STAGE_SALT:
+                lane->stage = PBKDF2_STAGE_FIRST;
+                return pbkdf2_sha256_submit(mgr, lane, NULL, lane->block_index,
+                                            sizeof(lane->block_index), ISAL_HASH_LAST);
+        case PBKDF2_STAGE_FIRST:
+        case PBKDF2_STAGE_INNER:
+                pbkdf2_sha256_digest_to_block(digest, lane->block);
+                lane->stage = PBKDF2_STAGE_OUTER;
+                return pbkdf2_sha256_submit(mgr, lane, lane->key->opad_digest, lane->block,
+                                            ISAL_SHA256_BLOCK_SIZE, ISAL_HASH_UPDATE);
+        default:
+                break;
+        }
+
+        /* Outer hash done, digest is U(iteration) */
+        if (lane->iteration == 1)
+                memcpy(lane->t, digest, SHA256_DIGEST_BYTES);
+        else
+                for (i = 0; i < ISAL_SHA256_DIGEST_NWORDS; i++)
+                        lane->t[i] ^= digest[i];
+
+        if (lane->iteration < job->iterations) {
+                lane->iteration++;
+                pbkdf2_sha256_digest_to_block(digest, lane->block);
+                lane->stage = PBKDF2_STAGE_INNER;
+                return pbkdf2_sha256_submit(mgr, lane, lane->key->ipad_digest, lane->block,
+                                            ISAL_SHA256_BLOCK_SIZE, ISAL_HASH_UPDATE);
+        }
+
+        pbkdf2_sha256_digest_to_block(lane->t, out);
+        offset = (lane->index - 1) * SHA256_DIGEST_BYTES;
+        len = job->out_len - offset;
+        if (len > SHA256_DIGEST_BYTES)
+                len = SHA256_DIGEST_BYTES;
+        memcpy(job->out + offset, out, len);
+        memset(out, 0, sizeof(out));
+        *done = 1;
+
+        return NULL;
+}
+
+static int
+pbkdf2_sha256_run(const ISAL_PBKDF2_SHA256_JOB *jobs, const uint32_t num_jobs)
+{
+        ISAL_SHA256_HASH_CTX_MGR mgr;
+        struct pbkdf2_sha256_lane lanes[ISAL_SHA256_MAX_LANES];
+        struct pbkdf2_sha256_lane *lane_free[ISAL_SHA256_MAX_LANES];
+        ISAL_HMAC_SHA256_KEY keys[ISAL_SHA256_MAX_LANES];
+        uint32_t key_users[ISAL_SHA256_MAX_LANES];
+        ISAL_SHA256_HASH_CTX *ctx;
+        struct pbkdf2_sha256_lane *lane;
+        uint32_t num_free = ISAL_SHA256_MAX_LANES;
+        uint32_t job_idx = 0, index = 1, k = 0, i;
+        int ret = 0, done;
+
+        _sha256_ctx_mgr_init(&mgr);
+        for (i = 0; i < ISAL_SHA256_MAX_LANES; i++) {
+                lane_free[i] = &lanes[i];
+                key_users[i] = 0;
+        }
+
+        /* Skip jobs with nothing to derive */
+        while (job_idx < num_jobs && jobs[job_idx].out_len == 0)
+                job_idx++;
+
+        while (job_idx < num_jobs || num_free < ISAL_SHA256_MAX_LANES) {
+                if (job_idx < num_jobs && num_free > 0) {
+                        /* The key of the current job is kept while any of its blocks run */
+                        if (index == 1) {
+                                for (k = 0; key_users[k] != 0; k++)
+                                        ;
+                                ret = isal_hmac_sha256_key_init(&keys[k], jobs[job_idx].pass,
+                                                                jobs[job_idx].pass_len);
+                                if (ret != 0)
+                                        break;
+                        }
+                        lane = lane_free[--num_free];
+                        key_users[k]++;
+                        ctx = pbkdf2_sha256_start(&mgr, lane, &jobs[job_idx], &keys[k], index);
+
+                        if ((uint64_t) index * SHA256_DIGEST_BYTES >= jobs[job_idx].out_len) {
+                                index = 1;
+                                do
+                                        job_idx++;
+                                while (job_idx < num_jobs && jobs[job_idx].out_len == 0);
+                        } else
+                                index++;
+                } else
+                        ctx = _sha256_ctx_mgr_flush(&mgr);
+
+                while (ctx != NULL) {
+                        lane = (struct pbkdf2_sha256_lane *) ctx;
+                        done = 0;
+                        ctx = pbkdf2_sha256_step(&mgr, lane, &done);
+                        if (done) {
+                                key_users[lane->key - keys]--;
+                                lane_free[num_free++] = lane;
+                        }
+                }
+        }
+
+        memset(keys, 0, sizeof(keys));
+        memset(lanes, 0, sizeof(lanes));
+
+        return ret;
+}
+
+int
+isal_pbkdf2_hmac_sha256(const void *pass, const uint32_t pass_len, const void *salt,
+                        const uint32_t salt_len, const uint32_t iterations, uint8_t *out,
+                        const uint32_t out_len)
+{
+        ISAL_PBKDF2_SHA256_JOB job;
+
+        job.pass = pass;
+        job.pass_len = pass_len;
+        job.salt = salt;
+        job.salt_len = salt_len;
+        job.iterations = iterations;
+        job.out = out;
+        job.out_len = out_len;
+
+        return isal_pbkdf2_hmac_sha256_mb(&job, 1);
+}
+
+int
+isal_pbkdf2_hmac_sha256_mb(const ISAL_PBKDF2_SHA256_JOB *jobs, const uint32_t num_jobs)
+{
+#ifdef SAFE_PARAM
+        uint32_t i;
+
+        if (jobs == NULL && num_jobs != 0)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        for (i = 0; i < num_jobs; i++) {
+                if (jobs[i].pass == NULL && jobs[i].pass_len != 0)
+                        return ISAL_CRYPTO_ERR_NULL_KEY;
+                if (jobs[i].salt == NULL && jobs[i].salt_len != 0)
+                        return ISAL_CRYPTO_ERR_NULL_SRC;
+                if (jobs[i].out == NULL && jobs[i].out_len != 0)
+                        return ISAL_CRYPTO_ERR_NULL_DST;
+                if (jobs[i].iterations == 0)
+                        return ISAL_CRYPTO_ERR_ITERATIONS;
+        }
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        return pbkdf2_sha256_run(jobs, num_jobs);
+}
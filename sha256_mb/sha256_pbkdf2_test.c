@@ -0,0 +1,265 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sha256_mb.h"
+#include "isal_crypto_api.h"
+
+#define TEST_JOBS  24
+#define MAX_PASS   (2 * ISAL_SHA256_BLOCK_SIZE + 3)
+#define MAX_SALT   (3 * ISAL_SHA256_BLOCK_SIZE)
+#define MAX_ITER   40
+#define DIGEST_LEN (ISAL_SHA256_DIGEST_NWORDS * sizeof(ISAL_SHA256_WORD_T))
+#define MAX_OUT    (3 * DIGEST_LEN + 5)
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+// Compare against reference function
+extern void
+sha256_ref(uint8_t *input_data, ISAL_SHA256_WORD_T *digest, uint32_t len);
+
+struct pbkdf2_vector {
+        const char *pass;
+        const char *salt;
+        uint32_t iterations;
+        uint32_t out_len;
+        uint8_t out[64];
+};
+
+// RFC 7914 section 11 and commonly used PBKDF2 test vectors
+static const struct pbkdf2_vector vectors[] = {
+        { "passwd",
+          "salt",
+          1,
+          64,
+          {
+                  0x55, 0xac, 0x04, 0x6e, 0x56, 0xe3, 0x08, 0x9f, 0xec, 0x16, 0x91, 0xc2, 0x25,
+                  0x44, 0xb6, 0x05, 0xf9, 0x41, 0x85, 0x21, 0x6d, 0xde, 0x04, 0x65, 0xe6, 0x8b,
+                  0x9d, 0x57, 0xc2, 0x0d, 0xac, 0xbc, 0x49, 0xca, 0x9c, 0xcc, 0xf1, 0x79, 0xb6,
+                  0x45, 0x99, 0x16, 0x64, 0xb3, 0x9d, 0x77, 0xef, 0x31, 0x7c, 0x71, 0xb8, 0x45,
+                  0xb1, 0xe3, 0x0b, 0xd5, 0x09, 0x11, 0x20, 0x41, 0xd3, 0xa1, 0x97, 0x83 } },
+        { "Password",
+          "NaCl",
+          80000,
+          64,
+          {
+                  0x4d, 0xdc, 0xd8, 0xf6, 0x0b, 0x98, 0xbe, 0x21, 0x83, 0x0c, 0xee, 0x5e, 0xf2,
+                  0x27, 0x01, 0xf9, 0x64, 0x1a, 0x44, 0x18, 0xd0, 0x4c, 0x04, 0x14, 0xae, 0xff,
+                  0x08, 0x87, 0x6b, 0x34, 0xab, 0x56, 0xa1, 0xd4, 0x25, 0xa1, 0x22, 0x58, 0x33,
+                  0x54, 0x9a, 0xdb, 0x84, 0x1b, 0x51, 0xc9, 0xb3, 0x17, 0x6a, 0x27, 0x2b, 0xde,
+                  0xbb, 0xa1, 0xd0, 0x78, 0x47, 0x8f, 0x62, 0xb3, 0x97, 0xf3, 0x3c, 0x8d } },
+        { "password",
+          "salt",
+          4096,
+          32,
+          {
+                  0xc5, 0xe4, 0x78, 0xd5, 0x92, 0x88, 0xc8, 0x41, 0xaa, 0x53, 0x0d, 0xb6, 0x84,
+                  0x5c, 0x4c, 0x8d, 0x96, 0x28, 0x93, 0xa0, 0x01, 0xce, 0x4e, 0x11, 0xa4, 0x96,
+                  0x38, 0x73, 0xaa, 0x98, 0x13, 0x4a } },
+        { "passwordPASSWORDpassword",
+          "saltSALTsaltSALTsaltSALTsaltSALTsalt",
+          4096,
+          40,
+          {
+                  0x34, 0x8c, 0x89, 0xdb, 0xcb, 0xd3, 0x2b, 0x2f, 0x32, 0xd8, 0x14, 0xb8, 0x11,
+                  0x6e, 0x84, 0xcf, 0x2b, 0x17, 0x34, 0x7e, 0xbc, 0x18, 0x00, 0x18, 0x1c, 0x4e,
+                  0x2a, 0x1f, 0xb8, 0xdd, 0x53, 0xe1, 0xc6, 0x35, 0x51, 0x8c, 0x7d, 0xac, 0x47,
+                  0xe9 } },
+};
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+static void
+digest_to_bytes(const ISAL_SHA256_WORD_T *digest, uint8_t *out)
+{
+        const uint32_t word_size = sizeof(ISAL_SHA256_WORD_T);
+        uint32_t i, b;
+
+        for (i = 0; i < ISAL_SHA256_DIGEST_NWORDS; i++)
+                for (b = 0; b < word_size; b++)
+                        *out++ = (uint8_t) (digest[i] >> (8 * (word_size - 1 - b)));
+}
+
+// Reference HMAC built on the single buffer reference hash
+static void
+hmac_sha256_ref(const uint8_t *key, uint32_t key_len, const uint8_t *msg, uint32_t len,
+                uint8_t *mac)
+{
+        static uint8_t buf[ISAL_SHA256_BLOCK_SIZE + MAX_SALT + 4];
+        uint8_t k0[ISAL_SHA256_BLOCK_SIZE] = { 0 };
+        ISAL_SHA256_WORD_T digest[ISAL_SHA256_DIGEST_NWORDS];
+        uint32_t i;
+
+        if (key_len > ISAL_SHA256_BLOCK_SIZE) {
+                memcpy(buf, key, key_len);
+                sha256_ref(buf, digest, key_len);
+                digest_to_bytes(digest, k0);
+        } else
+                memcpy(k0, key, key_len);
+
+        for (i = 0; i < ISAL_SHA256_BLOCK_SIZE; i++)
+                buf[i] = k0[i] ^ 0x36;
+        memcpy(buf + ISAL_SHA256_BLOCK_SIZE, msg, len);
+        sha256_ref(buf, digest, ISAL_SHA256_BLOCK_SIZE + len);
+
+        digest_to_bytes(digest, buf + ISAL_SHA256_BLOCK_SIZE);
+        for (i = 0; i < ISAL_SHA256_BLOCK_SIZE; i++)
+                buf[i] = k0[i] ^ 0x5c;
+        sha256_ref(buf, digest, ISAL_SHA256_BLOCK_SIZE + DIGEST_LEN);
+        digest_to_bytes(digest, mac);
+}
+
+// Reference PBKDF2 following RFC 8018 section 5.2
+static void
+pbkdf2_sha256_ref(const uint8_t *pass, uint32_t pass_len, const uint8_t *salt,
+                  uint32_t salt_len, uint32_t iterations, uint8_t *out, uint32_t out_len)
+{
+        uint8_t msg[MAX_SALT + 4], u[DIGEST_LEN], t[DIGEST_LEN];
+        uint32_t index, i, j, len;
+
+        for (index = 1; (index - 1) * DIGEST_LEN < out_len; index++) {
+                memcpy(msg, salt, salt_len);
+                msg[salt_len] = (uint8_t) (index >> 24);
+                msg[salt_len + 1] = (uint8_t) (index >> 16);
+                msg[salt_len + 2] = (uint8_t) (index >> 8);
+                msg[salt_len + 3] = (uint8_t) index;
+                hmac_sha256_ref(pass, pass_len, msg, salt_len + 4, u);
+                memcpy(t, u, DIGEST_LEN);
+
+                for (i = 1; i < iterations; i++) {
+                        memcpy(msg, u, DIGEST_LEN);
+                        hmac_sha256_ref(pass, pass_len, msg, DIGEST_LEN, u);
+                        for (j = 0; j < DIGEST_LEN; j++)
+                                t[j] ^= u[j];
+                }
+
+                len = out_len - (index - 1) * DIGEST_LEN;
+                if (len > DIGEST_LEN)
+                        len = DIGEST_LEN;
+                memcpy(out + (index - 1) * DIGEST_LEN, t, len);
+        }
+}
+
+static int
+test_vectors(void)
+{
+        const struct pbkdf2_vector *v;
+        uint8_t out[64];
+        uint32_t i;
+        int fail = 0;
+
+        for (i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+                v = &vectors[i];
+                memset(out, 0, sizeof(out));
+
+                if (isal_pbkdf2_hmac_sha256(v->pass, (uint32_t) strlen(v->pass), v->salt,
+                                            (uint32_t) strlen(v->salt), v->iterations, out,
+                                            v->out_len) != 0) {
+                        printf("Vector%d derivation failed\n", i);
+                        fail++;
+                        continue;
+                }
+                if (memcmp(out, v->out, v->out_len)) {
+                        printf("Vector%d mismatch\n", i);
+                        fail++;
+                }
+        }
+
+        return fail;
+}
+
+int
+main(void)
+{
+        ISAL_PBKDF2_SHA256_JOB jobs[TEST_JOBS];
+        static uint8_t pass[TEST_JOBS][MAX_PASS];
+        static uint8_t salt[TEST_JOBS][MAX_SALT];
+        static uint8_t out[TEST_JOBS][MAX_OUT + 1];
+        static uint8_t out_ref[TEST_JOBS][MAX_OUT];
+        uint32_t i;
+        int fail = 0;
+
+        printf("pbkdf2_hmac_sha256 test, %d jobs: ", TEST_JOBS);
+
+        fail += test_vectors();
+
+        srand(TEST_SEED);
+
+        // Mix of key, salt and output lengths, including jobs with nothing to derive
+        for (i = 0; i < TEST_JOBS; i++) {
+                jobs[i].pass = pass[i];
+                jobs[i].pass_len = rand() % (MAX_PASS + 1);
+                jobs[i].salt = salt[i];
+                jobs[i].salt_len = (i % 5 == 0) ? 0 : rand() % (MAX_SALT + 1);
+                jobs[i].iterations = 1 + rand() % MAX_ITER;
+                jobs[i].out = out[i];
+                jobs[i].out_len = (i % 11 == 3) ? 0 : 1 + rand() % MAX_OUT;
+
+                rand_buffer(pass[i], jobs[i].pass_len);
+                rand_buffer(salt[i], jobs[i].salt_len);
+                memset(out[i], 0, sizeof(out[i]));
+                pbkdf2_sha256_ref(pass[i], jobs[i].pass_len, salt[i], jobs[i].salt_len,
+                                  jobs[i].iterations, out_ref[i], jobs[i].out_len);
+        }
+
+        if (isal_pbkdf2_hmac_sha256_mb(jobs, TEST_JOBS) != 0) {
+                printf("multi-job derivation failed\n");
+                fail++;
+                goto end;
+        }
+
+        for (i = 0; i < TEST_JOBS; i++) {
+                if (memcmp(out[i], out_ref[i], jobs[i].out_len)) {
+                        printf("Job%d mismatch\n", i);
+                        fail++;
+                }
+                if (out[i][jobs[i].out_len] != 0) {
+                        printf("Job%d wrote past the output length\n", i);
+                        fail++;
+                }
+        }
+
+end:
+        if (fail)
+                printf("Test failed function check %d\n", fail);
+        else
+                printf(" multibinary_pbkdf2_hmac_sha256 test: Pass\n");
+
+        return fail;
+}
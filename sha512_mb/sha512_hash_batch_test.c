@@ -0,0 +1,147 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sha512_mb.h"
+#include "isal_crypto_api.h"
+
+#define TEST_BUFS  (3 * ISAL_SHA512_MAX_LANES + 1)
+#define MAX_LEN    (3 * ISAL_SHA512_BLOCK_SIZE + 1)
+#define MAX_STRIDE (MAX_LEN + 7)
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+#define DIGEST_BYTES (ISAL_SHA512_DIGEST_NWORDS * sizeof(ISAL_SHA512_WORD_T))
+
+static uint8_t msgs[TEST_BUFS * MAX_STRIDE];
+static ISAL_SHA512_WORD_T digests[TEST_BUFS][ISAL_SHA512_DIGEST_NWORDS];
+static ISAL_SHA512_HASH_CTX ctxpool[TEST_BUFS];
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+// Hash the same messages through the regular ctx manager
+static int
+hash_ctx_mgr(ISAL_SHA512_HASH_CTX_MGR *mgr, const size_t stride, const uint32_t len,
+             const uint32_t count)
+{
+        ISAL_SHA512_HASH_CTX *ctx;
+        uint32_t i;
+
+        for (i = 0; i < count; i++) {
+                isal_hash_ctx_init(&ctxpool[i]);
+                if (isal_sha512_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, msgs + i * stride, len,
+                                               ISAL_HASH_ENTIRE) != 0)
+                        return -1;
+        }
+        do {
+                if (isal_sha512_ctx_mgr_flush(mgr, &ctx) != 0)
+                        return -1;
+        } while (ctx != NULL);
+
+        return 0;
+}
+
+static int
+test_batch(ISAL_SHA512_HASH_CTX_MGR *mgr, const size_t stride, const uint32_t len,
+           const uint32_t count)
+{
+        uint32_t i;
+
+        memset(digests, 0, sizeof(digests));
+        if (isal_sha512_hash_batch(msgs, stride, len, count, &digests[0][0]) != 0) {
+                printf("Batch len=%u count=%u failed\n", len, count);
+                return 1;
+        }
+        if (hash_ctx_mgr(mgr, stride, len, count) != 0) {
+                printf("Reference len=%u count=%u failed\n", len, count);
+                return 1;
+        }
+        for (i = 0; i < count; i++) {
+                if (memcmp(digests[i], ctxpool[i].job.result_digest, DIGEST_BYTES)) {
+                        printf("Test%u len=%u stride=%u digest mismatch\n", i, len,
+                               (uint32_t) stride);
+                        return 1;
+                }
+        }
+
+        return 0;
+}
+
+int
+main(void)
+{
+        ISAL_SHA512_HASH_CTX_MGR *mgr = NULL;
+        uint32_t len;
+        int fail = 0;
+        int ret;
+
+        printf("sha512_hash_batch_test: ");
+        srand(TEST_SEED);
+
+        ret = posix_memalign((void *) &mgr, 16, sizeof(ISAL_SHA512_HASH_CTX_MGR));
+        if ((ret != 0) || (mgr == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+        isal_sha512_ctx_mgr_init(mgr);
+        rand_buffer(msgs, sizeof(msgs));
+
+        // Every tail length, including the ones that spill the padding into a second block
+        for (len = 0; len <= MAX_LEN && !fail; len++) {
+                fail += test_batch(mgr, len, len, TEST_BUFS);
+                fail += test_batch(mgr, MAX_STRIDE, len, TEST_BUFS);
+        }
+
+        // Partial batches smaller than the number of lanes
+        for (len = 1; len < ISAL_SHA512_MAX_LANES && !fail; len++)
+                fail += test_batch(mgr, MAX_STRIDE, 2 * ISAL_SHA512_BLOCK_SIZE - 1, len);
+
+        // An empty batch must not touch the digests
+        if (isal_sha512_hash_batch(msgs, MAX_STRIDE, MAX_LEN, 0, NULL) != 0)
+                fail++;
+
+        aligned_free(mgr);
+
+        if (fail)
+                printf("Test failed function check %d\n", fail);
+        else
+                printf(" multibinary_sha512 batch test: Pass\n");
+
+        return fail;
+}
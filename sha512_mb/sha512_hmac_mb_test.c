@@ -0,0 +1,321 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sha512_mb.h"
+#include "isal_crypto_api.h"
+
+#define TEST_BUFS 64
+#define TEST_KEYS 4
+#define MAX_MSG   (4 * ISAL_SHA512_BLOCK_SIZE)
+#define MAX_KEY   (2 * ISAL_SHA512_BLOCK_SIZE + 3)
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+#define MAC_LEN (ISAL_SHA512_DIGEST_NWORDS * sizeof(ISAL_SHA512_WORD_T))
+
+// Compare against reference function
+extern void
+sha512_ref(uint8_t *input_data, ISAL_SHA512_WORD_T *digest, uint32_t len);
+
+struct hmac_vector {
+        const uint8_t *key;
+        uint32_t key_len;
+        const char *msg;
+        uint8_t mac[MAC_LEN];
+};
+
+// Test cases 1, 2 and 6 from RFC 4231
+static const uint8_t key1[] = {
+        0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+        0x0b, 0x0b, 0x0b, 0x0b, 0x0b
+};
+
+static const uint8_t key2[] = {
+        0x4a, 0x65, 0x66, 0x65
+};
+
+static const uint8_t key6[] = {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+};
+
+static const struct hmac_vector vectors[] = {
+        { key1,
+          sizeof(key1),
+          "Hi There",
+          {
+                  0x87, 0xaa, 0x7c, 0xde, 0xa5, 0xef, 0x61, 0x9d, 0x4f, 0xf0, 0xb4, 0x24, 0x1a,
+                  0x1d, 0x6c, 0xb0, 0x23, 0x79, 0xf4, 0xe2, 0xce, 0x4e, 0xc2, 0x78, 0x7a, 0xd0,
+                  0xb3, 0x05, 0x45, 0xe1, 0x7c, 0xde, 0xda, 0xa8, 0x33, 0xb7, 0xd6, 0xb8, 0xa7,
+                  0x02, 0x03, 0x8b, 0x27, 0x4e, 0xae, 0xa3, 0xf4, 0xe4, 0xbe, 0x9d, 0x91, 0x4e,
+                  0xeb, 0x61, 0xf1, 0x70, 0x2e, 0x69, 0x6c, 0x20, 0x3a, 0x12, 0x68, 0x54 } },
+        { key2,
+          sizeof(key2),
+          "what do ya want for nothing?",
+          {
+                  0x16, 0x4b, 0x7a, 0x7b, 0xfc, 0xf8, 0x19, 0xe2, 0xe3, 0x95, 0xfb, 0xe7, 0x3b,
+                  0x56, 0xe0, 0xa3, 0x87, 0xbd, 0x64, 0x22, 0x2e, 0x83, 0x1f, 0xd6, 0x10, 0x27,
+                  0x0c, 0xd7, 0xea, 0x25, 0x05, 0x54, 0x97, 0x58, 0xbf, 0x75, 0xc0, 0x5a, 0x99,
+                  0x4a, 0x6d, 0x03, 0x4f, 0x65, 0xf8, 0xf0, 0xe6, 0xfd, 0xca, 0xea, 0xb1, 0xa3,
+                  0x4d, 0x4a, 0x6b, 0x4b, 0x63, 0x6e, 0x07, 0x0a, 0x38, 0xbc, 0xe7, 0x37 } },
+        { key6,
+          sizeof(key6),
+          "Test Using Larger Than Block-Size Key - Hash Key First",
+          {
+                  0x80, 0xb2, 0x42, 0x63, 0xc7, 0xc1, 0xa3, 0xeb, 0xb7, 0x14, 0x93, 0xc1, 0xdd,
+                  0x7b, 0xe8, 0xb4, 0x9b, 0x46, 0xd1, 0xf4, 0x1b, 0x4a, 0xee, 0xc1, 0x12, 0x1b,
+                  0x01, 0x37, 0x83, 0xf8, 0xf3, 0x52, 0x6b, 0x56, 0xd0, 0x37, 0xe0, 0x5f, 0x25,
+                  0x98, 0xbd, 0x0f, 0xd2, 0x21, 0x5d, 0x6a, 0x1e, 0x52, 0x95, 0xe6, 0x4f, 0x73,
+                  0xf6, 0x3f, 0x0a, 0xec, 0x8b, 0x91, 0x5a, 0x98, 0x5d, 0x78, 0x65, 0x98 } },
+};
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+static void
+digest_to_bytes(const ISAL_SHA512_WORD_T *digest, uint8_t *out)
+{
+        const uint32_t word_size = sizeof(ISAL_SHA512_WORD_T);
+        uint32_t i, b;
+
+        for (i = 0; i < ISAL_SHA512_DIGEST_NWORDS; i++)
+                for (b = 0; b < word_size; b++)
+                        *out++ = (uint8_t) (digest[i] >> (8 * (word_size - 1 - b)));
+}
+
+// Reference HMAC built on the single buffer reference hash
+static void
+hmac_sha512_ref(const uint8_t *key, uint32_t key_len, const uint8_t *msg, uint32_t len,
+                uint8_t *mac)
+{
+        static uint8_t buf[ISAL_SHA512_BLOCK_SIZE + MAX_MSG];
+        uint8_t k0[ISAL_SHA512_BLOCK_SIZE] = { 0 };
+        ISAL_SHA512_WORD_T digest[ISAL_SHA512_DIGEST_NWORDS];
+        uint32_t i;
+
+        if (key_len > ISAL_SHA512_BLOCK_SIZE) {
+                memcpy(buf, key, key_len);
+                sha512_ref(buf, digest, key_len);
+                digest_to_bytes(digest, k0);
+        } else
+                memcpy(k0, key, key_len);
+
+        for (i = 0; i < ISAL_SHA512_BLOCK_SIZE; i++)
+                buf[i] = k0[i] ^ 0x36;
+        memcpy(buf + ISAL_SHA512_BLOCK_SIZE, msg, len);
+        sha512_ref(buf, digest, ISAL_SHA512_BLOCK_SIZE + len);
+
+        digest_to_bytes(digest, buf + ISAL_SHA512_BLOCK_SIZE);
+        for (i = 0; i < ISAL_SHA512_BLOCK_SIZE; i++)
+                buf[i] = k0[i] ^ 0x5c;
+        sha512_ref(buf, digest, ISAL_SHA512_BLOCK_SIZE + MAC_LEN);
+        digest_to_bytes(digest, mac);
+}
+
+static int
+check_ctx(const ISAL_HMAC_SHA512_CTX *ctx, const uint8_t *mac_ref, const uint32_t idx)
+{
+        if (!isal_hash_ctx_complete(&ctx->hash_ctx) || ctx->hash_ctx.error) {
+                printf("Test%d not completed\n", idx);
+                return 1;
+        }
+        if (memcmp(ctx->mac, mac_ref, MAC_LEN)) {
+                printf("Test%d mac mismatch\n", idx);
+                return 1;
+        }
+        return 0;
+}
+
+static int
+test_vectors(ISAL_HMAC_SHA512_CTX_MGR *mgr)
+{
+        ISAL_HMAC_SHA512_KEY key;
+        ISAL_HMAC_SHA512_CTX ctx, *ctx_out;
+        const struct hmac_vector *v;
+        uint32_t i;
+        int fail = 0;
+
+        for (i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+                v = &vectors[i];
+                isal_hash_ctx_init(&ctx.hash_ctx);
+
+                if (isal_hmac_sha512_key_init(&key, v->key, v->key_len) != 0 ||
+                    isal_hmac_sha512_ctx_mgr_submit(mgr, &ctx, &ctx_out, &key, v->msg,
+                                                    (uint32_t) strlen(v->msg)) != 0) {
+                        printf("Vector%d submit failed\n", i);
+                        fail++;
+                        continue;
+                }
+                if (ctx_out == NULL && isal_hmac_sha512_ctx_mgr_flush(mgr, &ctx_out) != 0) {
+                        fail++;
+                        continue;
+                }
+                if (ctx_out != &ctx) {
+                        printf("Vector%d not returned\n", i);
+                        fail++;
+                        continue;
+                }
+                fail += check_ctx(&ctx, v->mac, i);
+        }
+
+        return fail;
+}
+
+int
+main(void)
+{
+        ISAL_HMAC_SHA512_CTX_MGR *mgr = NULL;
+        ISAL_HMAC_SHA512_CTX *ctxpool = NULL, *ctx = NULL;
+        ISAL_HMAC_SHA512_KEY keys[TEST_KEYS];
+        static uint8_t key_bufs[TEST_KEYS][MAX_KEY];
+        static uint8_t msgs[TEST_BUFS][MAX_MSG];
+        static uint8_t mac_ref[TEST_BUFS][MAC_LEN];
+        uint32_t key_lens[TEST_KEYS] = { 0, 20, ISAL_SHA512_BLOCK_SIZE, MAX_KEY };
+        uint32_t lens[TEST_BUFS];
+        uint32_t i, completed = 0;
+        int ret, fail = 0;
+
+        printf("hmac_sha512_mb test, %d buffers: ", TEST_BUFS);
+
+        ret = posix_memalign((void *) &mgr, 16, sizeof(ISAL_HMAC_SHA512_CTX_MGR));
+        ret |= posix_memalign((void *) &ctxpool, 64, TEST_BUFS * sizeof(ISAL_HMAC_SHA512_CTX));
+        if ((ret != 0) || (mgr == NULL) || (ctxpool == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                aligned_free(mgr);
+                return 1;
+        }
+
+        if (isal_hmac_sha512_ctx_mgr_init(mgr) != 0) {
+                fail++;
+                goto end;
+        }
+
+        fail += test_vectors(mgr);
+
+        srand(TEST_SEED);
+
+        for (i = 0; i < TEST_KEYS; i++) {
+                rand_buffer(key_bufs[i], key_lens[i]);
+                if (isal_hmac_sha512_key_init(&keys[i], key_bufs[i], key_lens[i]) != 0) {
+                        fail++;
+                        goto end;
+                }
+        }
+
+        // Message lengths cover empty, partial, exact and multi-block messages
+        for (i = 0; i < TEST_BUFS; i++) {
+                lens[i] = (i * 37) % MAX_MSG;
+                if (i % 8 == 0)
+                        lens[i] = (i / 8) * ISAL_SHA512_BLOCK_SIZE % MAX_MSG;
+                rand_buffer(msgs[i], lens[i]);
+                hmac_sha512_ref(key_bufs[i % TEST_KEYS], key_lens[i % TEST_KEYS], msgs[i], lens[i],
+                                mac_ref[i]);
+                isal_hash_ctx_init(&ctxpool[i].hash_ctx);
+                ctxpool[i].user_data = (void *) ((uintptr_t) i);
+        }
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                ret = isal_hmac_sha512_ctx_mgr_submit(mgr, &ctxpool[i], &ctx, &keys[i % TEST_KEYS],
+                                                      msgs[i], lens[i]);
+                if (ret) {
+                        fail++;
+                        goto end;
+                }
+                if (ctx != NULL) {
+                        completed++;
+                        fail += check_ctx(ctx, mac_ref[(uintptr_t) ctx->user_data],
+                                          (uint32_t) (uintptr_t) ctx->user_data);
+                }
+        }
+
+        while (1) {
+                ret = isal_hmac_sha512_ctx_mgr_flush(mgr, &ctx);
+                if (ret) {
+                        fail++;
+                        goto end;
+                }
+                if (ctx == NULL)
+                        break;
+                completed++;
+                fail += check_ctx(ctx, mac_ref[(uintptr_t) ctx->user_data],
+                                  (uint32_t) (uintptr_t) ctx->user_data);
+        }
+
+        if (completed != TEST_BUFS) {
+                printf("completed %d of %d jobs\n", completed, TEST_BUFS);
+                fail++;
+        }
+
+        // Resubmitting a context still in the manager must be rejected
+        isal_hash_ctx_init(&ctxpool[0].hash_ctx);
+        ret = isal_hmac_sha512_ctx_mgr_submit(mgr, &ctxpool[0], &ctx, &keys[0], msgs[0], MAX_MSG);
+        if (ret == 0 && ctx == NULL) {
+                ret = isal_hmac_sha512_ctx_mgr_submit(mgr, &ctxpool[0], &ctx, &keys[0], msgs[0],
+                                                      MAX_MSG);
+#ifdef SAFE_PARAM
+                if (ret != ISAL_CRYPTO_ERR_ALREADY_PROCESSING) {
+#else
+                if (ctx == NULL || ctx->hash_ctx.error != ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING) {
+#endif
+                        printf("resubmit of a processing context not rejected\n");
+                        fail++;
+                }
+                do {
+                        ret = isal_hmac_sha512_ctx_mgr_flush(mgr, &ctx);
+                } while (ret == 0 && ctx != NULL);
+        }
+
+end:
+        aligned_free(mgr);
+        aligned_free(ctxpool);
+
+        if (fail)
+                printf("Test failed function check %d\n", fail);
+        else
+                printf(" multibinary_hmac_sha512 test: Pass\n");
+
+        return fail;
+}
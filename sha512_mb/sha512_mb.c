@@ -27,6 +27,7 @@
   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 **********************************************************************/
 
+#include <string.h>
 #include "sha512_mb_internal.h"
 #include "isal_crypto_api.h"
 #include "multi_buffer.h"
@@ -44,11 +45,100 @@ isal_sha512_ctx_mgr_init(ISAL_SHA512_HASH_CTX_MGR *mgr)
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
+        /* Deadline mode scans all lanes, not only those the arch manager sets up */
+        memset(&mgr->mgr, 0, sizeof(mgr->mgr));
         _sha512_ctx_mgr_init(mgr);
+        mgr->latency_budget = 0;
 
         return 0;
 }
 
+/* Largest piece of a 64-bit length input handed to the lanes as one job, kept block aligned */
+#define SHA512_MAX_PIECE (UINT32_MAX & ~(ISAL_SHA512_BLOCK_SIZE - 1))
+
+/* submit_time of a job entered without a timestamp, it is never overdue */
+#define SHA512_UNTIMED UINT64_MAX
+
+/*
+ * Long and scatter-gather input: a context submitted with isal_sha512_ctx_mgr_submit64() or
+ * isal_sha512_ctx_mgr_submit_iov() keeps the input not handed to the lanes yet in data_buffer /
+ * data_len and iov / iov_cnt. It comes back from the lanes after each piece of at most
+ * SHA512_MAX_PIECE bytes and is given its next piece here, so it is only returned to the
+ * application once all of its input has been hashed.
+ */
+static ISAL_SHA512_HASH_CTX *
+sha512_submit_piece(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX *ctx)
+{
+        const uint8_t *buffer;
+        uint32_t len;
+        ISAL_HASH_CTX_FLAG flags;
+
+        /* Move on to the next segment with data, an empty input is still submitted once */
+        while (ctx->data_len == 0 && ctx->iov_cnt != 0) {
+                ctx->data_buffer = (const uint8_t *) ctx->iov->buffer;
+                ctx->data_len = ctx->iov->len;
+                ctx->iov++;
+                ctx->iov_cnt--;
+        }
+
+        buffer = ctx->data_buffer;
+        len = ctx->data_len < SHA512_MAX_PIECE ? (uint32_t) ctx->data_len : SHA512_MAX_PIECE;
+        ctx->data_buffer += len;
+        ctx->data_len -= len;
+
+        /* Only the first piece may start the job and only the last one may end it */
+        flags = ctx->data_flags;
+        if (ctx->data_len != 0 || ctx->iov_cnt != 0)
+                flags = (ISAL_HASH_CTX_FLAG) (flags & ~ISAL_HASH_LAST);
+        ctx->data_flags = (ISAL_HASH_CTX_FLAG) (ctx->data_flags & ISAL_HASH_LAST);
+
+        return _sha512_ctx_mgr_submit(mgr, ctx, buffer, len, flags);
+}
+
+static ISAL_SHA512_HASH_CTX *
+sha512_data_next(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX *ctx)
+{
+        while (ctx != NULL && (ctx->data_len != 0 || ctx->iov_cnt != 0) &&
+               ctx->error == ISAL_HASH_CTX_ERROR_NONE)
+                ctx = sha512_submit_piece(mgr, ctx);
+
+        return ctx;
+}
+
+static ISAL_SHA512_HASH_CTX *
+sha512_submit_data(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX *ctx, const void *buffer,
+                   const uint64_t len, const ISAL_HASH_IOVEC *iov, const uint32_t iov_cnt,
+                   const ISAL_HASH_CTX_FLAG flags)
+{
+        /* Leave the input of a job still in the manager alone, the submit fails on it */
+        if (ctx->status & ISAL_HASH_CTX_STS_PROCESSING)
+                return _sha512_ctx_mgr_submit(mgr, ctx, buffer, 0, flags);
+
+        ctx->submit_time = SHA512_UNTIMED;
+        ctx->data_buffer = (const uint8_t *) buffer;
+        ctx->data_len = len;
+        ctx->iov = iov;
+        ctx->iov_cnt = iov_cnt;
+        ctx->data_flags = flags;
+
+        return sha512_data_next(mgr, sha512_submit_piece(mgr, ctx));
+}
+
+static ISAL_SHA512_HASH_CTX *
+sha512_data_flush(ISAL_SHA512_HASH_CTX_MGR *mgr)
+{
+        ISAL_SHA512_HASH_CTX *ctx;
+
+        do {
+                ctx = _sha512_ctx_mgr_flush(mgr);
+                if (ctx == NULL)
+                        return NULL;
+                ctx = sha512_data_next(mgr, ctx);
+        } while (ctx == NULL);
+
+        return ctx;
+}
+
 int
 isal_sha512_ctx_mgr_submit(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX *ctx_in,
                            ISAL_SHA512_HASH_CTX **ctx_out, const void *buffer, const uint32_t len,
@@ -69,7 +159,7 @@ isal_sha512_ctx_mgr_submit(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX *
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
-        *ctx_out = _sha512_ctx_mgr_submit(mgr, ctx_in, buffer, len, flags);
+        *ctx_out = sha512_submit_data(mgr, ctx_in, buffer, len, NULL, 0, flags);
 
 #ifdef SAFE_PARAM
         if (*ctx_out != NULL &&
@@ -102,8 +192,225 @@ isal_sha512_ctx_mgr_flush(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX **
                 return ISAL_CRYPTO_ERR_SELF_TEST;
 #endif
 
-        *ctx_out = _sha512_ctx_mgr_flush(mgr);
+        *ctx_out = sha512_data_flush(mgr);
+
+        return 0;
+}
+
+/*
+ * Deadline mode: flush the manager if any job in a lane has waited longer than the
+ * latency budget. Jobs in lanes are identified by the job pointer, which is at offset 0
+ * of the context.
+ */
+static ISAL_SHA512_HASH_CTX *
+sha512_ctx_mgr_expired(ISAL_SHA512_HASH_CTX_MGR *mgr, const uint64_t now)
+{
+        const ISAL_SHA512_HASH_CTX *ctx;
+        uint32_t i;
+
+        if (mgr->latency_budget == 0)
+                return NULL;
+
+        for (i = 0; i < ISAL_SHA512_MAX_LANES; i++) {
+                ctx = (const ISAL_SHA512_HASH_CTX *) mgr->mgr.ldata[i].job_in_lane;
+                if (ctx != NULL && ctx->submit_time != SHA512_UNTIMED && now >= ctx->submit_time &&
+                    now - ctx->submit_time >= mgr->latency_budget)
+                        return sha512_data_flush(mgr);
+        }
+
+        return NULL;
+}
+
+int
+isal_sha512_ctx_mgr_set_deadline(ISAL_SHA512_HASH_CTX_MGR *mgr, const uint64_t budget)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+#endif
+        mgr->latency_budget = budget;
+
+        return 0;
+}
+
+int
+isal_sha512_ctx_mgr_submit_timed(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX *ctx_in,
+                                 ISAL_SHA512_HASH_CTX **ctx_out, const void *buffer,
+                                 const uint32_t len, const ISAL_HASH_CTX_FLAG flags,
+                                 const uint64_t now)
+{
+        int processing, ret;
+
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_in == NULL || ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+        /* Do not restart the clock of a job that is still in the manager */
+        processing = ctx_in->status & ISAL_HASH_CTX_STS_PROCESSING;
+
+        ret = isal_sha512_ctx_mgr_submit(mgr, ctx_in, ctx_out, buffer, len, flags);
+        /* The submit marked the job untimed, stamp it now that it is in the manager */
+        if (!processing)
+                ctx_in->submit_time = now;
+        if (ret == 0 && *ctx_out == NULL)
+                *ctx_out = sha512_ctx_mgr_expired(mgr, now);
+
+        return ret;
+}
+
+int
+isal_sha512_ctx_mgr_poll(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX **ctx_out,
+                         const uint64_t now)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        *ctx_out = sha512_ctx_mgr_expired(mgr, now);
+
+        return 0;
+}
+
+int
+isal_sha512_ctx_mgr_submit_batch(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX *const *ctxs,
+                                 const void *const *buffers, const uint32_t *lens,
+                                 const ISAL_HASH_CTX_FLAG *flags, const uint32_t num,
+                                 ISAL_SHA512_HASH_CTX **completed, uint32_t *num_completed)
+{
+        ISAL_SHA512_HASH_CTX *cp;
+        uint32_t i, n = 0;
 
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctxs == NULL || completed == NULL || num_completed == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (buffers == NULL || lens == NULL || flags == NULL)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        /* Validate every job before any of them reaches the lanes */
+        for (i = 0; i < num; i++) {
+                if (ctxs[i] == NULL)
+                        return ISAL_CRYPTO_ERR_NULL_CTX;
+                /* OK to have NULL source buffer when flags is ISAL_HASH_FIRST or ISAL_HASH_LAST */
+                if (buffers[i] == NULL &&
+                    (flags[i] == ISAL_HASH_UPDATE || flags[i] == ISAL_HASH_ENTIRE))
+                        return ISAL_CRYPTO_ERR_NULL_SRC;
+        }
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        for (i = 0; i < num; i++) {
+                cp = sha512_submit_data(mgr, ctxs[i], buffers[i], lens[i], NULL, 0, flags[i]);
+                if (cp != NULL)
+                        completed[n++] = cp;
+        }
+        *num_completed = n;
+
+#ifdef SAFE_PARAM
+        /* Report the first rejected job; the jobs after it have still been submitted */
+        for (i = 0; i < n; i++) {
+                cp = completed[i];
+                if (cp->error == ISAL_HASH_CTX_ERROR_INVALID_FLAGS)
+                        return ISAL_CRYPTO_ERR_INVALID_FLAGS;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING)
+                        return ISAL_CRYPTO_ERR_ALREADY_PROCESSING;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_COMPLETED)
+                        return ISAL_CRYPTO_ERR_ALREADY_COMPLETED;
+        }
+#endif
+        return 0;
+}
+
+int
+isal_sha512_ctx_mgr_submit_iov(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX *ctx_in,
+                               ISAL_SHA512_HASH_CTX **ctx_out, const ISAL_HASH_IOVEC *iov,
+                               const uint32_t iov_cnt, const ISAL_HASH_CTX_FLAG flags)
+{
+#ifdef SAFE_PARAM
+        uint32_t i;
+
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_in == NULL || ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        if (iov == NULL && iov_cnt != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        for (i = 0; i < iov_cnt; i++)
+                if (iov[i].buffer == NULL && iov[i].len != 0)
+                        return ISAL_CRYPTO_ERR_NULL_SRC;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        *ctx_out = sha512_submit_data(mgr, ctx_in, NULL, 0, iov, iov_cnt, flags);
+
+#ifdef SAFE_PARAM
+        if (*ctx_out != NULL && (*ctx_out)->error != ISAL_HASH_CTX_ERROR_NONE) {
+                ISAL_SHA512_HASH_CTX *cp = *ctx_out;
+
+                if (cp->error == ISAL_HASH_CTX_ERROR_INVALID_FLAGS)
+                        return ISAL_CRYPTO_ERR_INVALID_FLAGS;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING)
+                        return ISAL_CRYPTO_ERR_ALREADY_PROCESSING;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_COMPLETED)
+                        return ISAL_CRYPTO_ERR_ALREADY_COMPLETED;
+        }
+#endif
+        return 0;
+}
+
+int
+isal_sha512_ctx_mgr_submit64(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX *ctx_in,
+                             ISAL_SHA512_HASH_CTX **ctx_out, const void *buffer, const uint64_t len,
+                             const ISAL_HASH_CTX_FLAG flags)
+{
+#ifdef SAFE_PARAM
+        if (mgr == NULL)
+                return ISAL_CRYPTO_ERR_NULL_MGR;
+        if (ctx_in == NULL || ctx_out == NULL)
+                return ISAL_CRYPTO_ERR_NULL_CTX;
+        /* OK to have NULL source buffer when flags is HASH_FIRST or HASH_LAST */
+        if (buffer == NULL && (flags == ISAL_HASH_UPDATE || flags == ISAL_HASH_ENTIRE))
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+#endif
+
+#ifdef FIPS_MODE
+        if (isal_self_tests())
+                return ISAL_CRYPTO_ERR_SELF_TEST;
+#endif
+
+        *ctx_out = sha512_submit_data(mgr, ctx_in, buffer, len, NULL, 0, flags);
+
+#ifdef SAFE_PARAM
+        if (*ctx_out != NULL &&
+            (ISAL_SHA512_HASH_CTX *) (*ctx_out)->error != ISAL_HASH_CTX_ERROR_NONE) {
+                ISAL_SHA512_HASH_CTX *cp = (ISAL_SHA512_HASH_CTX *) (*ctx_out);
+
+                if (cp->error == ISAL_HASH_CTX_ERROR_INVALID_FLAGS)
+                        return ISAL_CRYPTO_ERR_INVALID_FLAGS;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_PROCESSING)
+                        return ISAL_CRYPTO_ERR_ALREADY_PROCESSING;
+                if (cp->error == ISAL_HASH_CTX_ERROR_ALREADY_COMPLETED)
+                        return ISAL_CRYPTO_ERR_ALREADY_COMPLETED;
+        }
+#endif
         return 0;
 }
 
@@ -116,13 +423,18 @@ isal_sha512_ctx_mgr_flush(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX **
 void
 sha512_ctx_mgr_init(ISAL_SHA512_HASH_CTX_MGR *mgr)
 {
+        /* Deadline mode scans all lanes, not only those the arch manager sets up */
+        memset(&mgr->mgr, 0, sizeof(mgr->mgr));
         _sha512_ctx_mgr_init(mgr);
+        mgr->latency_budget = 0;
 }
 
 ISAL_SHA512_HASH_CTX *
 sha512_ctx_mgr_submit(ISAL_SHA512_HASH_CTX_MGR *mgr, ISAL_SHA512_HASH_CTX *ctx, const void *buffer,
                       uint32_t len, ISAL_HASH_CTX_FLAG flags)
 {
+        if (!(ctx->status & ISAL_HASH_CTX_STS_PROCESSING))
+                ctx->submit_time = SHA512_UNTIMED;
         return _sha512_ctx_mgr_submit(mgr, ctx, buffer, len, flags);
 }
 
@@ -0,0 +1,267 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sha512_mb.h"
+#include "isal_crypto_api.h"
+
+#define TEST_JOBS  24
+#define MAX_PASS   (2 * ISAL_SHA512_BLOCK_SIZE + 3)
+#define MAX_SALT   (3 * ISAL_SHA512_BLOCK_SIZE)
+#define MAX_ITER   40
+#define DIGEST_LEN (ISAL_SHA512_DIGEST_NWORDS * sizeof(ISAL_SHA512_WORD_T))
+#define MAX_OUT    (3 * DIGEST_LEN + 5)
+#ifndef TEST_SEED
+#define TEST_SEED 0x1234
+#endif
+
+// Compare against reference function
+extern void
+sha512_ref(uint8_t *input_data, ISAL_SHA512_WORD_T *digest, uint32_t len);
+
+struct pbkdf2_vector {
+        const char *pass;
+        const char *salt;
+        uint32_t iterations;
+        uint32_t out_len;
+        uint8_t out[64];
+};
+
+// RFC 7914 section 11 and commonly used PBKDF2 test vectors
+static const struct pbkdf2_vector vectors[] = {
+        { "passwd",
+          "salt",
+          1,
+          64,
+          {
+                  0xc7, 0x43, 0x19, 0xd9, 0x94, 0x99, 0xfc, 0x3e, 0x90, 0x13, 0xac, 0xff, 0x59,
+                  0x7c, 0x23, 0xc5, 0xba, 0xf0, 0xa0, 0xbe, 0xc5, 0x63, 0x4c, 0x46, 0xb8, 0x35,
+                  0x2b, 0x79, 0x3e, 0x32, 0x47, 0x23, 0xd5, 0x5c, 0xaa, 0x76, 0xb2, 0xb2, 0x5c,
+                  0x43, 0x40, 0x2d, 0xcf, 0xdc, 0x06, 0xcd, 0xcf, 0x66, 0xf9, 0x5b, 0x7d, 0x04,
+                  0x29, 0x42, 0x0b, 0x39, 0x52, 0x00, 0x06, 0x74, 0x9c, 0x51, 0xa0, 0x4e } },
+        { "Password",
+          "NaCl",
+          80000,
+          64,
+          {
+                  0xe6, 0x33, 0x7d, 0x6f, 0xbe, 0xb6, 0x45, 0xc7, 0x94, 0xd4, 0xa9, 0xb5, 0xb7,
+                  0x5b, 0x7b, 0x30, 0xda, 0xc9, 0xac, 0x50, 0x37, 0x6a, 0x91, 0xdf, 0x1f, 0x44,
+                  0x60, 0xf6, 0x06, 0x0d, 0x5a, 0xdd, 0xb2, 0xc1, 0xfd, 0x1f, 0x84, 0x40, 0x9a,
+                  0xba, 0xcc, 0x67, 0xde, 0x7e, 0xb4, 0x05, 0x6e, 0x6b, 0xb0, 0x6c, 0x2d, 0x82,
+                  0xc3, 0xef, 0x4c, 0xcd, 0x1b, 0xde, 0xd0, 0xf6, 0x75, 0xed, 0x97, 0xc6 } },
+        { "password",
+          "salt",
+          4096,
+          64,
+          {
+                  0xd1, 0x97, 0xb1, 0xb3, 0x3d, 0xb0, 0x14, 0x3e, 0x01, 0x8b, 0x12, 0xf3, 0xd1,
+                  0xd1, 0x47, 0x9e, 0x6c, 0xde, 0xbd, 0xcc, 0x97, 0xc5, 0xc0, 0xf8, 0x7f, 0x69,
+                  0x02, 0xe0, 0x72, 0xf4, 0x57, 0xb5, 0x14, 0x3f, 0x30, 0x60, 0x26, 0x41, 0xb3,
+                  0xd5, 0x5c, 0xd3, 0x35, 0x98, 0x8c, 0xb3, 0x6b, 0x84, 0x37, 0x60, 0x60, 0xec,
+                  0xd5, 0x32, 0xe0, 0x39, 0xb7, 0x42, 0xa2, 0x39, 0x43, 0x4a, 0xf2, 0xd5 } },
+        { "passwordPASSWORDpassword",
+          "saltSALTsaltSALTsaltSALTsaltSALTsalt",
+          4096,
+          40,
+          {
+                  0x8c, 0x05, 0x11, 0xf4, 0xc6, 0xe5, 0x97, 0xc6, 0xac, 0x63, 0x15, 0xd8, 0xf0,
+                  0x36, 0x2e, 0x22, 0x5f, 0x3c, 0x50, 0x14, 0x95, 0xba, 0x23, 0xb8, 0x68, 0xc0,
+                  0x05, 0x17, 0x4d, 0xc4, 0xee, 0x71, 0x11, 0x5b, 0x59, 0xf9, 0xe6, 0x0c, 0xd9,
+                  0x53 } },
+};
+
+// Generates pseudo-random data
+static void
+rand_buffer(unsigned char *buf, const long buffer_size)
+{
+        long i;
+        for (i = 0; i < buffer_size; i++)
+                buf[i] = rand();
+}
+
+static void
+digest_to_bytes(const ISAL_SHA512_WORD_T *digest, uint8_t *out)
+{
+        const uint32_t word_size = sizeof(ISAL_SHA512_WORD_T);
+        uint32_t i, b;
+
+        for (i = 0; i < ISAL_SHA512_DIGEST_NWORDS; i++)
+                for (b = 0; b < word_size; b++)
+                        *out++ = (uint8_t) (digest[i] >> (8 * (word_size - 1 - b)));
+}
+
+// Reference HMAC built on the single buffer reference hash
+static void
+hmac_sha512_ref(const uint8_t *key, uint32_t key_len, const uint8_t *msg, uint32_t len,
+                uint8_t *mac)
+{
+        static uint8_t buf[ISAL_SHA512_BLOCK_SIZE + MAX_SALT + 4];
+        uint8_t k0[ISAL_SHA512_BLOCK_SIZE] = { 0 };
+        ISAL_SHA512_WORD_T digest[ISAL_SHA512_DIGEST_NWORDS];
+        uint32_t i;
+
+        if (key_len > ISAL_SHA512_BLOCK_SIZE) {
+                memcpy(buf, key, key_len);
+                sha512_ref(buf, digest, key_len);
+                digest_to_bytes(digest, k0);
+        } else
+                memcpy(k0, key, key_len);
+
+        for (i = 0; i < ISAL_SHA512_BLOCK_SIZE; i++)
+                buf[i] = k0[i] ^ 0x36;
+        memcpy(buf + ISAL_SHA512_BLOCK_SIZE, msg, len);
+        sha512_ref(buf, digest, ISAL_SHA512_BLOCK_SIZE + len);
+
+        digest_to_bytes(digest, buf + ISAL_SHA512_BLOCK_SIZE);
+        for (i = 0; i < ISAL_SHA512_BLOCK_SIZE; i++)
+                buf[i] = k0[i] ^ 0x5c;
+        sha512_ref(buf, digest, ISAL_SHA512_BLOCK_SIZE + DIGEST_LEN);
+        digest_to_bytes(digest, mac);
+}
+
+// Reference PBKDF2 following RFC 8018 section 5.2
+static void
+pbkdf2_sha512_ref(const uint8_t *pass, uint32_t pass_len, const uint8_t *salt,
+                  uint32_t salt_len, uint32_t iterations, uint8_t *out, uint32_t out_len)
+{
+        uint8_t msg[MAX_SALT + 4], u[DIGEST_LEN], t[DIGEST_LEN];
+        uint32_t index, i, j, len;
+
+        for (index = 1; (index - 1) * DIGEST_LEN < out_len; index++) {
+                memcpy(msg, salt, salt_len);
+                msg[salt_len] = (uint8_t) (index >> 24);
+                msg[salt_len + 1] = (uint8_t) (index >> 16);
+                msg[salt_len + 2] = (uint8_t) (index >> 8);
+                msg[salt_len + 3] = (uint8_t) index;
+                hmac_sha512_ref(pass, pass_len, msg, salt_len + 4, u);
+                memcpy(t, u, DIGEST_LEN);
+
+                for (i = 1; i < iterations; i++) {
+                        memcpy(msg, u, DIGEST_LEN);
+                        hmac_sha512_ref(pass, pass_len, msg, DIGEST_LEN, u);
+                        for (j = 0; j < DIGEST_LEN; j++)
+                                t[j] ^= u[j];
+                }
+
+                len = out_len - (index - 1) * DIGEST_LEN;
+                if (len > DIGEST_LEN)
+                        len = DIGEST_LEN;
+                memcpy(out + (index - 1) * DIGEST_LEN, t, len);
+        }
+}
+
+static int
+test_vectors(void)
+{
+        const struct pbkdf2_vector *v;
+        uint8_t out[64];
+        uint32_t i;
+        int fail = 0;
+
+        for (i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+                v = &vectors[i];
+                memset(out, 0, sizeof(out));
+
+                if (isal_pbkdf2_hmac_sha512(v->pass, (uint32_t) strlen(v->pass), v->salt,
+                                            (uint32_t) strlen(v->salt), v->iterations, out,
+                                            v->out_len) != 0) {
+                        printf("Vector%d derivation failed\n", i);
+                        fail++;
+                        continue;
+                }
+                if (memcmp(out, v->out, v->out_len)) {
+                        printf("Vector%d mismatch\n", i);
+                        fail++;
+                }
+        }
+
+        return fail;
+}
+
+int
+main(void)
+{
+        ISAL_PBKDF2_SHA512_JOB jobs[TEST_JOBS];
+        static uint8_t pass[TEST_JOBS][MAX_PASS];
+        static uint8_t salt[TEST_JOBS][MAX_SALT];
+        static uint8_t out[TEST_JOBS][MAX_OUT + 1];
+        static uint8_t out_ref[TEST_JOBS][MAX_OUT];
+        uint32_t i;
+        int fail = 0;
+
+        printf("pbkdf2_hmac_sha512 test, %d jobs: ", TEST_JOBS);
+
+        fail += test_vectors();
+
+        srand(TEST_SEED);
+
+        // Mix of key, salt and output lengths, including jobs with nothing to derive
+        for (i = 0; i < TEST_JOBS; i++) {
+                jobs[i].pass = pass[i];
+                jobs[i].pass_len = rand() % (MAX_PASS + 1);
+                jobs[i].salt = salt[i];
+                jobs[i].salt_len = (i % 5 == 0) ? 0 : rand() % (MAX_SALT + 1);
+                jobs[i].iterations = 1 + rand() % MAX_ITER;
+                jobs[i].out = out[i];
+                jobs[i].out_len = (i % 11 == 3) ? 0 : 1 + rand() % MAX_OUT;
+
+                rand_buffer(pass[i], jobs[i].pass_len);
+                rand_buffer(salt[i], jobs[i].salt_len);
+                memset(out[i], 0, sizeof(out[i]));
+                pbkdf2_sha512_ref(pass[i], jobs[i].pass_len, salt[i], jobs[i].salt_len,
+                                  jobs[i].iterations, out_ref[i], jobs[i].out_len);
+        }
+
+        if (isal_pbkdf2_hmac_sha512_mb(jobs, TEST_JOBS) != 0) {
+                printf("multi-job derivation failed\n");
+                fail++;
+                goto end;
+        }
+
+        for (i = 0; i < TEST_JOBS; i++) {
+                if (memcmp(out[i], out_ref[i], jobs[i].out_len)) {
+                        printf("Job%d mismatch\n", i);
+                        fail++;
+                }
+                if (out[i][jobs[i].out_len] != 0) {
+                        printf("Job%d wrote past the output length\n", i);
+                        fail++;
+                }
+        }
+
+end:
+        if (fail)
+                printf("Test failed function check %d\n", fail);
+        else
+                printf(" multibinary_pbkdf2_hmac_sha512 test: Pass\n");
+
+        return fail;
+}
@@ -0,0 +1,99 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+#include <string.h>
+
+#include "sm3_mb.h"
+#include "sm3_mb_internal.h"
+#include "isal_crypto_api.h"
+#include "multi_buffer.h"
+
+#define SM3_DIGEST_BYTES (ISAL_SM3_DIGEST_NWORDS * sizeof(uint32_t))
+
+/*
+ * One message in flight. Unlike the SHA batch functions the padding is left to the ctx
+ * layer: the SM3 lane state is only converted to the digest word order on completion,
+ * and that conversion differs between the x86 and aarch64 implementations.
+ */
+struct sm3_batch_lane {
+        ISAL_SM3_HASH_CTX ctx; // Must be at struct offset 0.
+        uint32_t index;
+};
+
+int
+isal_sm3_hash_batch(const void *msgs, const size_t stride, const uint32_t len, const uint32_t count,
+                    uint32_t *digests)
+{
+#ifdef FIPS_MODE
+        return ISAL_CRYPTO_ERR_FIPS_INVALID_ALGO;
+#else
+        ISAL_SM3_HASH_CTX_MGR mgr;
+        struct sm3_batch_lane lanes[ISAL_SM3_MAX_LANES];
+        struct sm3_batch_lane *lane_free[ISAL_SM3_MAX_LANES];
+        struct sm3_batch_lane *lane;
+        ISAL_SM3_HASH_CTX *ctx;
+        const uint8_t *msg;
+        uint32_t num_free = ISAL_SM3_MAX_LANES;
+        uint32_t next = 0, i;
+
+#ifdef SAFE_PARAM
+        if (msgs == NULL && count != 0)
+                return ISAL_CRYPTO_ERR_NULL_SRC;
+        if (digests == NULL && count != 0)
+                return ISAL_CRYPTO_ERR_NULL_DST;
+#endif
+        if (count == 0)
+                return 0;
+
+        _sm3_ctx_mgr_init(&mgr);
+        for (i = 0; i < ISAL_SM3_MAX_LANES; i++) {
+                isal_hash_ctx_init(&lanes[i].ctx);
+                lane_free[i] = &lanes[i];
+        }
+
+        while (next < count || num_free < ISAL_SM3_MAX_LANES) {
+                if (next < count && num_free > 0) {
+                        lane = lane_free[--num_free];
+                        lane->index = next++;
+                        msg = (const uint8_t *) msgs + (size_t) lane->index * stride;
+                        ctx = _sm3_ctx_mgr_submit(&mgr, &lane->ctx, msg, len, ISAL_HASH_ENTIRE);
+                } else
+                        ctx = _sm3_ctx_mgr_flush(&mgr);
+
+                if (ctx != NULL) {
+                        lane = (struct sm3_batch_lane *) ctx;
+                        memcpy(digests + (size_t) lane->index * ISAL_SM3_DIGEST_NWORDS,
+                               ctx->job.result_digest, SM3_DIGEST_BYTES);
+                        lane_free[num_free++] = lane;
+                }
+        }
+
+        return 0;
+#endif
+}
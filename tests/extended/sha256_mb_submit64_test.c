@@ -0,0 +1,129 @@
+/**********************************************************************
+  Copyright(c) 2026 Intel Corporation All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions
+  are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Intel Corporation nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**********************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "sha256_mb.h"
+#include "endian_helper.h"
+#include <openssl/evp.h>
+
+/* One buffer larger than 4GB, not a multiple of the block size */
+#define LEN_TOTAL (4ull * 1024 * 1024 * 1024 + 1024 * 1024 + 17)
+#define HEAD_LEN  100
+#define TEST_BUFS 2
+
+/* Reference digest global to reduce stack usage */
+static uint8_t digest_ref[4 * ISAL_SHA256_DIGEST_NWORDS];
+
+int
+main(void)
+{
+        EVP_MD_CTX *o_ctx = EVP_MD_CTX_new();
+        ISAL_SHA256_HASH_CTX_MGR *mgr = NULL;
+        ISAL_SHA256_HASH_CTX ctxpool[TEST_BUFS], *ctx = NULL;
+        ISAL_HASH_IOVEC iov[2];
+        uint32_t i, j, fail = 0;
+        unsigned char *buf;
+        int ret;
+
+        ret = posix_memalign((void *) &mgr, 16, sizeof(ISAL_SHA256_HASH_CTX_MGR));
+        if ((ret != 0) || (mgr == NULL)) {
+                printf("posix_memalign failed test aborted\n");
+                return 1;
+        }
+
+        ret = isal_sha256_ctx_mgr_init(mgr);
+        if (ret)
+                return 1;
+
+        printf("sha256_submit64_test\n");
+
+        // Zeroed buffer, only touched by reads
+        buf = (unsigned char *) calloc((size_t) LEN_TOTAL, 1);
+        if (buf == NULL) {
+                printf("malloc failed test aborted\n");
+                return 1;
+        }
+        for (i = 0; i < TEST_BUFS; i++)
+                isal_hash_ctx_init(&ctxpool[i]);
+
+        // Openssl SHA256 test
+        EVP_DigestInit_ex(o_ctx, EVP_sha256(), NULL);
+        EVP_DigestUpdate(o_ctx, buf, (size_t) LEN_TOTAL);
+        EVP_DigestFinal_ex(o_ctx, (unsigned char *) digest_ref, NULL);
+
+        // Whole buffer in a single submit
+        ret = isal_sha256_ctx_mgr_submit64(mgr, &ctxpool[0], &ctx, buf, LEN_TOTAL,
+                                           ISAL_HASH_ENTIRE);
+        if (ret)
+                return 1;
+
+        // Same data as a short segment followed by a segment larger than 4GB
+        iov[0].buffer = buf;
+        iov[0].len = HEAD_LEN;
+        iov[1].buffer = buf + HEAD_LEN;
+        iov[1].len = LEN_TOTAL - HEAD_LEN;
+        ret = isal_sha256_ctx_mgr_submit_iov(mgr, &ctxpool[1], &ctx, iov, 2, ISAL_HASH_ENTIRE);
+        if (ret)
+                return 1;
+
+        do {
+                ret = isal_sha256_ctx_mgr_flush(mgr, &ctx);
+                if (ret)
+                        return 1;
+        } while (ctx != NULL);
+
+        for (i = 0; i < TEST_BUFS; i++) {
+                printf("Total processing size of buf[%d] is %" PRIu64 "\n", i,
+                       ctxpool[i].total_length);
+                if (!isal_hash_ctx_complete(&ctxpool[i]) ||
+                    ctxpool[i].total_length != LEN_TOTAL) {
+                        printf("Test failed job %d did not complete\n", i);
+                        fail++;
+                        continue;
+                }
+                for (j = 0; j < ISAL_SHA256_DIGEST_NWORDS; j++) {
+                        if (ctxpool[i].job.result_digest[j] !=
+                            to_be32(((uint32_t *) digest_ref)[j]))
+                                fail++;
+                }
+        }
+
+        free(buf);
+        EVP_MD_CTX_free(o_ctx);
+
+        if (fail)
+                printf("Test failed SHA256 submit64 check %d\n", fail);
+        else
+                printf(" SHA256_submit64_test: Pass\n");
+        return fail;
+}